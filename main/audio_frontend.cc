@@ -0,0 +1,292 @@
+#include "audio_frontend.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "signal/src/energy.h"
+#include "signal/src/filter_bank_log.h"
+#include "signal/src/filter_bank_square_root.h"
+#include "signal/src/msb.h"
+#include "signal/src/pcan_argc_fixed.h"
+#include "signal/src/rfft.h"
+#include "signal/src/window.h"
+
+namespace {
+
+// Fixed-point formats of the micro_frontend reference.
+constexpr int kWindowBits = 12;
+constexpr int kFilterbankBits = 12;
+constexpr int kIndexAlignment = 2;  // 4 bytes of int16 weights
+constexpr int kChannelBlockSize = 4;
+constexpr int kLogScaleShift = 6;
+
+constexpr float kLowerBandLimit = 125.0f;
+constexpr float kUpperBandLimit = 7500.0f;
+
+constexpr int kSmoothingBits = 10;
+constexpr int kSpectralSubtractionBits = 14;
+constexpr float kEvenSmoothing = 0.025f;
+constexpr float kOddSmoothing = 0.06f;
+constexpr float kMinSignalRemaining = 0.05f;
+
+constexpr float kPcanStrength = 0.95f;
+constexpr float kPcanOffset = 80.0f;
+constexpr int kPcanGainBits = 21;
+
+float FreqToMel(float freq) { return 1127.0f * log1pf(freq / 700.0f); }
+
+int16_t PcanGain(int input_bits, uint32_t x) {
+  const float x_as_float =
+      static_cast<float>(x) / static_cast<float>(1u << input_bits);
+  const float gain = static_cast<float>(1u << kPcanGainBits) *
+                     powf(x_as_float + kPcanOffset, -kPcanStrength);
+  if (gain > static_cast<float>(INT16_MAX)) {
+    return INT16_MAX;
+  }
+  return static_cast<int16_t>(gain + 0.5f);
+}
+
+}  // namespace
+
+bool AudioFrontend::Init() {
+  if (tflm_signal::RfftInt16GetNeededMemory(kFftSize) > sizeof(rfft_state_)) {
+    return false;
+  }
+  rfft_ = tflm_signal::RfftInt16Init(kFftSize, rfft_state_,
+                                     sizeof(rfft_state_));
+  if (rfft_ == nullptr || !BuildFilterbank()) {
+    return false;
+  }
+  BuildWindow();
+  BuildNoiseReduction();
+  BuildPcan();
+
+  // The window covers the first kWindowSamples inputs of the FFT and the
+  // energy bins outside [spectrum_start_, spectrum_end_) only ever meet zero
+  // filterbank weights; both stay zero from here on.
+  memset(windowed_, 0, sizeof(windowed_));
+  memset(energy_, 0, sizeof(energy_));
+  Reset();
+  return true;
+}
+
+void AudioFrontend::Reset() {
+  frame_fill_ = 0;
+  memset(noise_estimate_, 0, sizeof(noise_estimate_));
+  memset(spectrogram_, 0, sizeof(spectrogram_));
+  newest_slice_ = kNumSlices - 1;
+  slices_produced_ = 0;
+}
+
+void AudioFrontend::BuildWindow() {
+  // Periodic Hann window sampled at the centre of each sample.
+  const float arg = 2.0f * static_cast<float>(M_PI) / kWindowSamples;
+  for (int i = 0; i < kWindowSamples; i++) {
+    const float value = 0.5f - 0.5f * cosf(arg * (i + 0.5f));
+    window_[i] =
+        static_cast<int16_t>(floorf(value * (1 << kWindowBits) + 0.5f));
+  }
+}
+
+// Triangular mel filters laid out for FilterbankAccumulateChannels(): channel
+// 0 is the scratch channel below the first real band, each band is padded to
+// kChannelBlockSize weights starting on a kIndexAlignment boundary, and empty
+// bands point at one shared block of zero weights.
+bool AudioFrontend::BuildFilterbank() {
+  constexpr int kChannelsPlus1 = kNumChannels + 1;
+  float center_mel[kChannelsPlus1];
+  int16_t actual_starts[kChannelsPlus1];
+  int16_t actual_widths[kChannelsPlus1];
+
+  const float mel_low = FreqToMel(kLowerBandLimit);
+  const float mel_spacing =
+      (FreqToMel(kUpperBandLimit) - mel_low) / kChannelsPlus1;
+  for (int i = 0; i < kChannelsPlus1; i++) {
+    center_mel[i] = mel_low + mel_spacing * (i + 1);
+  }
+
+  // DC is always excluded.
+  const float hz_per_bin = 0.5f * kSampleRate / (kSpectrumSize - 1);
+  spectrum_start_ = static_cast<int>(1.5f + kLowerBandLimit / hz_per_bin);
+  spectrum_end_ = 0;
+
+  int freq_start = spectrum_start_;
+  int weight_start = 0;
+  bool needs_zeros = false;
+  for (int chan = 0; chan < kChannelsPlus1; chan++) {
+    int freq = freq_start;
+    while (freq < kSpectrumSize &&
+           FreqToMel(freq * hz_per_bin) <= center_mel[chan]) {
+      freq++;
+    }
+    const int width = freq - freq_start;
+    actual_starts[chan] = freq_start;
+    actual_widths[chan] = width;
+
+    if (width == 0) {
+      channel_frequency_starts_[chan] = 0;
+      channel_weight_starts_[chan] = 0;
+      channel_widths_[chan] = kChannelBlockSize;
+      if (!needs_zeros) {
+        needs_zeros = true;
+        for (int j = 0; j < chan; j++) {
+          channel_weight_starts_[j] += kChannelBlockSize;
+        }
+        weight_start += kChannelBlockSize;
+      }
+    } else {
+      const int aligned_start =
+          (freq_start / kIndexAlignment) * kIndexAlignment;
+      const int aligned_width = freq_start - aligned_start + width;
+      const int padded_width =
+          ((aligned_width - 1) / kChannelBlockSize + 1) * kChannelBlockSize;
+      channel_frequency_starts_[chan] = aligned_start;
+      channel_weight_starts_[chan] = weight_start;
+      channel_widths_[chan] = padded_width;
+      weight_start += padded_width;
+    }
+    freq_start = freq;
+  }
+  if (weight_start > kMaxFilterbankWeights) {
+    return false;
+  }
+  for (int chan = 0; chan < kChannelsPlus1; chan++) {
+    if (channel_frequency_starts_[chan] + channel_widths_[chan] >
+        kSpectrumSize) {
+      return false;
+    }
+  }
+
+  memset(weights_, 0, sizeof(weights_));
+  memset(unweights_, 0, sizeof(unweights_));
+  for (int chan = 0; chan < kChannelsPlus1; chan++) {
+    int freq = actual_starts[chan];
+    const int offset = freq - channel_frequency_starts_[chan];
+    const float denom =
+        center_mel[chan] - (chan == 0 ? mel_low : center_mel[chan - 1]);
+    for (int j = 0; j < actual_widths[chan]; j++, freq++) {
+      const float weight =
+          (center_mel[chan] - FreqToMel(freq * hz_per_bin)) / denom;
+      const int index = channel_weight_starts_[chan] + offset + j;
+      weights_[index] =
+          static_cast<int16_t>(floorf(weight * (1 << kFilterbankBits) + 0.5f));
+      unweights_[index] = static_cast<int16_t>(
+          floorf((1.0f - weight) * (1 << kFilterbankBits) + 0.5f));
+    }
+    if (freq > spectrum_end_) {
+      spectrum_end_ = freq;
+    }
+  }
+
+  filterbank_.num_channels = kNumChannels;
+  filterbank_.channel_frequency_starts = channel_frequency_starts_;
+  filterbank_.channel_weight_starts = channel_weight_starts_;
+  filterbank_.channel_widths = channel_widths_;
+  filterbank_.weights = weights_;
+  filterbank_.unweights = unweights_;
+  filterbank_.output_scale = 1;
+  filterbank_.input_correction_bits = 0;
+
+  // Bits the FFT gains over the filterbank weights; undone by the log.
+  input_correction_bits_ = static_cast<int>(
+      tflite::tflm_signal::MostSignificantBit32(kFftSize)) - 1 -
+      kFilterbankBits / 2;
+  return true;
+}
+
+void AudioFrontend::BuildNoiseReduction() {
+  const uint32_t one = 1u << kSpectralSubtractionBits;
+  noise_reduction_.num_channels = kNumChannels;
+  noise_reduction_.smoothing = static_cast<uint32_t>(kEvenSmoothing * one);
+  noise_reduction_.one_minus_smoothing = one - noise_reduction_.smoothing;
+  noise_reduction_.alternate_smoothing =
+      static_cast<uint32_t>(kOddSmoothing * one);
+  noise_reduction_.alternate_one_minus_smoothing =
+      one - noise_reduction_.alternate_smoothing;
+  noise_reduction_.min_signal_remaining =
+      static_cast<uint32_t>(kMinSignalRemaining * one);
+  noise_reduction_.smoothing_bits = kSmoothingBits;
+  noise_reduction_.spectral_subtraction_bits = kSpectralSubtractionBits;
+  noise_reduction_.clamping = false;
+}
+
+// Piecewise quadratic approximation of gain(x) = x^-strength over each power
+// of two interval, in the layout WideDynamicFunction() expects.
+void AudioFrontend::BuildPcan() {
+  const int input_bits = kSmoothingBits - input_correction_bits_;
+  snr_shift_ = kPcanGainBits - input_correction_bits_ - kPcanSnrBits;
+
+  pcan_lut_[0] = PcanGain(input_bits, 0);
+  pcan_lut_[1] = PcanGain(input_bits, 1);
+  for (int interval = 2; interval <= 32; interval++) {
+    const uint32_t x0 = 1u << (interval - 1);
+    const uint32_t x1 = x0 + (x0 >> 1);
+    const uint32_t x2 = interval == 32 ? x0 + (x0 - 1) : 2 * x0;
+    const int16_t y0 = PcanGain(input_bits, x0);
+    const int16_t y1 = PcanGain(input_bits, x1);
+    const int16_t y2 = PcanGain(input_bits, x2);
+    const int32_t diff1 = static_cast<int32_t>(y1) - y0;
+    const int32_t diff2 = static_cast<int32_t>(y2) - y0;
+    const int32_t a1 = 4 * diff1 - diff2;
+    const int32_t a2 = diff2 - a1;
+    int16_t* entry = pcan_lut_ + 4 * interval - 6;
+    entry[0] = y0;
+    entry[1] = static_cast<int16_t>(a1);
+    entry[2] = static_cast<int16_t>(a2);
+  }
+}
+
+int AudioFrontend::Process(AudioRingBuffer* ring) {
+  int new_slices = 0;
+  for (;;) {
+    if (frame_fill_ == kWindowSamples) {
+      memmove(frame_, frame_ + kHopSamples,
+              (kWindowSamples - kHopSamples) * sizeof(frame_[0]));
+      frame_fill_ = kWindowSamples - kHopSamples;
+    }
+    if (!ring->Read(frame_ + frame_fill_, kWindowSamples - frame_fill_)) {
+      break;
+    }
+    frame_fill_ = kWindowSamples;
+    newest_slice_ = (newest_slice_ + 1) % kNumSlices;
+    ComputeSlice(spectrogram_[newest_slice_]);
+    slices_produced_++;
+    new_slices++;
+  }
+  return new_slices;
+}
+
+void AudioFrontend::ComputeSlice(int16_t* out) {
+  // window.h and rfft.h live in ::tflm_signal, the rest in tflite::.
+  tflm_signal::ApplyWindow(frame_, window_, kWindowSamples, kWindowBits,
+                           windowed_);
+  // The zero padding past kWindowSamples does not change the auto-scale.
+  const int scale_bits =
+      tflm_signal::RfftInt16ApplyAutoScale(rfft_, windowed_, spectrum_);
+  tflite::tflm_signal::SpectrumToEnergy(spectrum_, spectrum_start_,
+                                        spectrum_end_, energy_);
+  tflite::tflm_signal::FilterbankAccumulateChannels(&filterbank_, energy_,
+                                                    filterbank_out_);
+  // Element 0 of the accumulator output is the scratch channel.
+  tflite::tflm_signal::FilterbankSqrt(filterbank_out_ + 1, kNumChannels,
+                                      scale_bits, channels_);
+  tflite::tflm_signal::FilterbankSpectralSubtraction(
+      &noise_reduction_, channels_, channels_, noise_estimate_);
+  tflite::tflm_signal::ApplyPcanAutoGainControlFixed(
+      pcan_lut_, snr_shift_, noise_estimate_, channels_, kNumChannels);
+  tflite::tflm_signal::FilterbankLog(channels_, kNumChannels,
+                                     1 << kLogScaleShift,
+                                     input_correction_bits_, out);
+}
+
+const int16_t* AudioFrontend::Slice(int age) const {
+  return spectrogram_[(newest_slice_ - age % kNumSlices + kNumSlices) %
+                      kNumSlices];
+}
+
+void AudioFrontend::CopySpectrogram(int16_t* out) const {
+  for (int age = kNumSlices - 1; age >= 0; age--) {
+    memcpy(out, Slice(age), kNumChannels * sizeof(int16_t));
+    out += kNumChannels;
+  }
+}
@@ -0,0 +1,101 @@
+#ifndef AUDIO_FRONTEND_H_
+#define AUDIO_FRONTEND_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "audio_ring_buffer.h"
+#include "signal/src/complex.h"
+#include "signal/src/filter_bank.h"
+#include "signal/src/filter_bank_spectral_subtraction.h"
+
+// Streaming log-mel front end for the drop-impact sound, built on the
+// signal/ kernels of esp-tflite-micro:
+//
+//   Hann window -> auto-scaled int16 RFFT -> SpectrumToEnergy ->
+//   FilterbankAccumulateChannels -> FilterbankSqrt ->
+//   FilterbankSpectralSubtraction -> PCAN -> FilterbankLog
+//
+// Parameters and fixed-point conventions follow the TFLM micro_frontend
+// defaults (25 ms window, 10 ms hop, 40 mel channels, PCAN on), so the
+// features match what the training pipeline produces with those settings.
+// All state is inside the object; Init() only builds the constant tables.
+class AudioFrontend {
+ public:
+  static constexpr int kSampleRate = 16000;
+  static constexpr int kWindowSamples = 400;  // 25 ms
+  static constexpr int kHopSamples = 160;     // 10 ms
+  static constexpr int kFftSize = 512;
+  static constexpr int kNumChannels = 40;
+  // Slices kept in the rolling spectrogram (~0.5 s, one impact).
+  static constexpr int kNumSlices = 49;
+
+  // Returns false if the tables do not fit the static buffers.
+  bool Init();
+
+  // Clears the audio history, noise estimate and spectrogram.
+  void Reset();
+
+  // Pulls whole hops from `ring` and computes one spectrogram slice per hop
+  // once the first window has filled. Samples short of a hop stay in the
+  // ring. Returns the number of new slices.
+  int Process(AudioRingBuffer* ring);
+
+  // Slice `age` (0 = newest) of the rolling spectrogram, kNumChannels values.
+  const int16_t* Slice(int age) const;
+
+  // Copies the spectrogram oldest slice first into `out`
+  // (kNumSlices * kNumChannels values). Missing slices read as zero.
+  void CopySpectrogram(int16_t* out) const;
+
+  // Total slices produced since the last Reset().
+  uint32_t slices_produced() const { return slices_produced_; }
+
+ private:
+  static constexpr int kSpectrumSize = kFftSize / 2 + 1;
+  // Every channel pads its band by at most 4 weights, plus one all-zero block.
+  static constexpr int kMaxFilterbankWeights =
+      kSpectrumSize + 4 * (kNumChannels + 1) + 4;
+  static constexpr int kPcanLutSize = 4 * 32 - 3;
+  static constexpr size_t kRfftStateBytes = 4096;
+
+  void BuildWindow();
+  bool BuildFilterbank();
+  void BuildNoiseReduction();
+  void BuildPcan();
+  void ComputeSlice(int16_t* out);
+
+  // Constant tables.
+  int16_t window_[kWindowSamples];
+  int16_t channel_frequency_starts_[kNumChannels + 1];
+  int16_t channel_weight_starts_[kNumChannels + 1];
+  int16_t channel_widths_[kNumChannels + 1];
+  int16_t weights_[kMaxFilterbankWeights];
+  int16_t unweights_[kMaxFilterbankWeights];
+  int16_t pcan_lut_[kPcanLutSize];
+  tflite::tflm_signal::FilterbankConfig filterbank_;
+  tflite::tflm_signal::SpectralSubtractionConfig noise_reduction_;
+  int spectrum_start_;
+  int spectrum_end_;
+  int input_correction_bits_;
+  int snr_shift_;
+  alignas(8) uint8_t rfft_state_[kRfftStateBytes];
+  void* rfft_;
+
+  // Streaming state.
+  int16_t frame_[kWindowSamples];
+  int frame_fill_;
+  uint32_t noise_estimate_[kNumChannels];
+  int16_t spectrogram_[kNumSlices][kNumChannels];
+  int newest_slice_;
+  uint32_t slices_produced_;
+
+  // Per-slice scratch.
+  int16_t windowed_[kFftSize];
+  Complex<int16_t> spectrum_[kSpectrumSize];
+  uint32_t energy_[kSpectrumSize];
+  uint64_t filterbank_out_[kNumChannels + 1];
+  uint32_t channels_[kNumChannels + 1];
+};
+
+#endif  // AUDIO_FRONTEND_H_
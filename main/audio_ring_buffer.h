@@ -0,0 +1,64 @@
+#ifndef AUDIO_RING_BUFFER_H_
+#define AUDIO_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Single-producer / single-consumer ring buffer of int16 PCM samples.
+//
+// The producer (I2S task or ISR) only moves `head_` and the consumer (the
+// acoustic front end) only moves `tail_`, so no lock is needed even when they
+// run on different cores. The storage size must be a power of two; the
+// indices run freely and are masked on access.
+class AudioRingBuffer {
+ public:
+  AudioRingBuffer(int16_t* storage, size_t capacity)
+      : storage_(storage), mask_(capacity - 1), head_(0), tail_(0) {}
+
+  size_t capacity() const { return mask_ + 1; }
+
+  // Samples ready for the consumer.
+  size_t Available() const {
+    return head_.load(std::memory_order_acquire) -
+           tail_.load(std::memory_order_relaxed);
+  }
+
+  // Producer side. Copies as many samples as fit and returns that count;
+  // the rest are dropped, never overwriting unread audio.
+  size_t Write(const int16_t* samples, size_t count) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t space =
+        capacity() - (head - tail_.load(std::memory_order_acquire));
+    if (count > space) {
+      count = space;
+    }
+    for (size_t i = 0; i < count; i++) {
+      storage_[(head + i) & mask_] = samples[i];
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // Consumer side. Copies exactly `count` samples and returns true, or
+  // leaves the buffer untouched and returns false if fewer are available.
+  bool Read(int16_t* samples, size_t count) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) - tail < count) {
+      return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+      samples[i] = storage_[(tail + i) & mask_];
+    }
+    tail_.store(tail + count, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  int16_t* const storage_;
+  const size_t mask_;
+  std::atomic<size_t> head_;
+  std::atomic<size_t> tail_;
+};
+
+#endif  // AUDIO_RING_BUFFER_H_
@@ -0,0 +1,77 @@
+#include "core_copy_engine.h"
+
+#include <cstring>
+
+#include "esp_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace {
+
+const char* TAG = "COPY_ENGINE";
+
+constexpr uint32_t kStackSize = 2 * 1024;
+constexpr UBaseType_t kWorkerPriority = 5;
+// Two prefetcher slots of up to four tensors each.
+constexpr UBaseType_t kQueueLength = 8;
+
+}  // namespace
+
+CoreCopyEngine::CoreCopyEngine(BaseType_t core)
+    : core_(core),
+      queue_(nullptr),
+      task_(nullptr),
+      submitted_(0),
+      completed_(0),
+      busy_ticks_(0) {}
+
+CoreCopyEngine::~CoreCopyEngine() {
+  if (task_ != nullptr) {
+    vTaskDelete(task_);
+  }
+  if (queue_ != nullptr) {
+    vQueueDelete(queue_);
+  }
+}
+
+bool CoreCopyEngine::Init() {
+  queue_ = xQueueCreate(kQueueLength, sizeof(Request));
+  if (queue_ == nullptr) {
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(WorkerTask, "copy_engine", kStackSize, this,
+                              kWorkerPriority, &task_, core_) != pdPASS) {
+    ESP_LOGE(TAG, "Cannot start the copy worker on core %d", (int)core_);
+    task_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+uint32_t CoreCopyEngine::Submit(void* dst, const void* src, size_t bytes) {
+  const Request request = {dst, src, bytes};
+  if (xQueueSend(queue_, &request, 0) != pdTRUE) {
+    return 0;
+  }
+  return ++submitted_;
+}
+
+bool CoreCopyEngine::IsDone(uint32_t ticket) {
+  return static_cast<int32_t>(ticket - completed_.load()) <= 0;
+}
+
+void CoreCopyEngine::Wait(uint32_t ticket) {
+  while (!IsDone(ticket)) {
+  }
+}
+
+void CoreCopyEngine::WorkerTask(void* arg) {
+  CoreCopyEngine* engine = static_cast<CoreCopyEngine*>(arg);
+  Request request;
+  for (;;) {
+    xQueueReceive(engine->queue_, &request, portMAX_DELAY);
+    const uint32_t start = tflite::GetCurrentTimeTicks();
+    memcpy(request.dst, request.src, request.bytes);
+    engine->busy_ticks_ += tflite::GetCurrentTimeTicks() - start;
+    engine->completed_++;
+  }
+}
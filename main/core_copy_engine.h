@@ -0,0 +1,52 @@
+#ifndef CORE_COPY_ENGINE_H_
+#define CORE_COPY_ENGINE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "tensorflow/lite/micro/micro_copy_engine.h"
+
+// MicroCopyEngine whose copies run on a worker task pinned to the other
+// core, for tflite::MicroWeightPrefetcher.
+//
+// The ESP32 has no memory-to-memory DMA usable from the application
+// (esp_async_memcpy needs GDMA or the S2's copy DMA), so the second core is
+// the copy engine. Each core has its own flash cache: the worker's misses on
+// the model weights do not evict what the inference core has cached.
+class CoreCopyEngine : public tflite::MicroCopyEngine {
+ public:
+  explicit CoreCopyEngine(BaseType_t core);
+  ~CoreCopyEngine();
+
+  // Creates the request queue and starts the worker task.
+  bool Init();
+
+  uint32_t Submit(void* dst, const void* src, size_t bytes) override;
+  bool IsDone(uint32_t ticket) override;
+  // Spins: waits are short, and a context switch would cost more than most
+  // of the copies.
+  void Wait(uint32_t ticket) override;
+  uint32_t busy_ticks() const override { return busy_ticks_.load(); }
+
+ private:
+  struct Request {
+    void* dst;
+    const void* src;
+    size_t bytes;
+  };
+
+  static void WorkerTask(void* arg);
+
+  BaseType_t core_;
+  QueueHandle_t queue_;
+  TaskHandle_t task_;
+  uint32_t submitted_;
+  std::atomic<uint32_t> completed_;
+  std::atomic<uint32_t> busy_ticks_;
+};
+
+#endif  // CORE_COPY_ENGINE_H_
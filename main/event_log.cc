@@ -0,0 +1,102 @@
+#include "event_log.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+namespace {
+
+const char* TAG = "EVENT_LOG";
+
+constexpr uint32_t kStackSize = 3 * 1024;
+
+}  // namespace
+
+EventLog::EventLog(Slot* slots, size_t capacity)
+    : slots_(slots),
+      mask_(capacity - 1),
+      head_(0),
+      tail_(0),
+      dropped_(0),
+      formatter_(nullptr),
+      period_ms_(0),
+      task_(nullptr) {
+  for (size_t i = 0; i < capacity; i++) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+EventLog::~EventLog() {
+  if (task_ != nullptr) {
+    vTaskDelete(task_);
+  }
+}
+
+bool EventLog::Log(uint32_t id, int32_t arg0, int32_t arg1, int32_t arg2) {
+  uint32_t head = head_.load(std::memory_order_relaxed);
+  Slot* slot;
+  for (;;) {
+    slot = &slots_[head & mask_];
+    const int32_t lag = static_cast<int32_t>(
+        slot->sequence.load(std::memory_order_acquire) - head);
+    if (lag == 0) {
+      // Free slot: claim it, or retry from the head another writer moved.
+      if (head_.compare_exchange_weak(head, head + 1,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (lag < 0) {
+      // The reader has not freed this slot yet: the ring is full.
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      head = head_.load(std::memory_order_relaxed);
+    }
+  }
+  slot->record.time_us = static_cast<uint32_t>(esp_timer_get_time());
+  slot->record.id = id;
+  slot->record.args[0] = arg0;
+  slot->record.args[1] = arg1;
+  slot->record.args[2] = arg2;
+  slot->sequence.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool EventLog::Read(Record* record) {
+  Slot& slot = slots_[tail_ & mask_];
+  if (slot.sequence.load(std::memory_order_acquire) != tail_ + 1) {
+    return false;
+  }
+  *record = slot.record;
+  // Free again for the writer that wraps around to it.
+  slot.sequence.store(tail_ + mask_ + 1, std::memory_order_release);
+  tail_++;
+  return true;
+}
+
+bool EventLog::StartPrinter(Formatter formatter, UBaseType_t priority,
+                            BaseType_t core, uint32_t period_ms) {
+  formatter_ = formatter;
+  period_ms_ = period_ms;
+  if (xTaskCreatePinnedToCore(PrinterTask, "event_log", kStackSize, this,
+                              priority, &task_, core) != pdPASS) {
+    ESP_LOGE(TAG, "Cannot start the event log printer on core %d", (int)core);
+    task_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void EventLog::Flush() {
+  Record record;
+  while (Read(&record)) {
+    formatter_(record);
+  }
+}
+
+void EventLog::PrinterTask(void* arg) {
+  EventLog* log = static_cast<EventLog*>(arg);
+  for (;;) {
+    log->Flush();
+    vTaskDelay(pdMS_TO_TICKS(log->period_ms_));
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef EVENT_LOG_H_
+#define EVENT_LOG_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Binary event log for the inference hot path.
+//
+// Log() stores a fixed-size record (timestamp, event id and three integer
+// arguments) in a ring and returns: nothing is formatted and no lock is
+// taken, so it costs a few dozen cycles instead of the thousands of an
+// ESP_LOGI. A low-priority task started with StartPrinter() drains the ring
+// and hands each record to the application's formatter.
+//
+// Any task on either core may log. Each slot carries a sequence number: a
+// writer claims a slot by moving `head_` with a compare-and-swap and
+// publishes it by bumping the slot sequence, so the single reader never sees
+// a half-written record. When the ring is full the record is dropped and
+// counted; the hot path never waits. The capacity must be a power of two.
+class EventLog {
+ public:
+  struct Record {
+    // esp_timer_get_time() of the Log() call, truncated to 32 bits.
+    uint32_t time_us;
+    uint32_t id;
+    int32_t args[3];
+  };
+
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    Record record;
+  };
+
+  // Called from the printer task for each record, oldest first.
+  typedef void (*Formatter)(const Record& record);
+
+  EventLog(Slot* slots, size_t capacity);
+  ~EventLog();
+
+  // Producer side. Returns false if the record was dropped.
+  bool Log(uint32_t id, int32_t arg0 = 0, int32_t arg1 = 0, int32_t arg2 = 0);
+
+  // Consumer side, for applications without a printer task; only one task
+  // may read. Returns false if the ring is empty.
+  bool Read(Record* record);
+
+  // Starts the task that formats the records every `period_ms`.
+  bool StartPrinter(Formatter formatter, UBaseType_t priority,
+                    BaseType_t core, uint32_t period_ms);
+
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  static void PrinterTask(void* arg);
+  // Formats the records in the ring; runs in the printer task.
+  void Flush();
+
+  Slot* const slots_;
+  const uint32_t mask_;
+  std::atomic<uint32_t> head_;
+  uint32_t tail_;
+  std::atomic<uint32_t> dropped_;
+  Formatter formatter_;
+  uint32_t period_ms_;
+  TaskHandle_t task_;
+};
+
+#endif  // EVENT_LOG_H_
@@ -0,0 +1,157 @@
+#include "late_fusion.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+namespace {
+
+const char* TAG = "LATE_FUSION";
+
+constexpr uint32_t kStackSize = 8 * 1024;
+constexpr UBaseType_t kWorkerPriority = 5;
+
+int NumClasses(const TfLiteTensor* output) {
+  return output->dims->data[output->dims->size - 1];
+}
+
+// Class probability `c` of `output` as float, whatever its type.
+float Dequantize(const TfLiteTensor* output, int c) {
+  switch (output->type) {
+    case kTfLiteUInt8:
+      return output->params.scale *
+             (static_cast<int32_t>(output->data.uint8[c]) -
+              output->params.zero_point);
+    case kTfLiteInt8:
+      return output->params.scale *
+             (static_cast<int32_t>(output->data.int8[c]) -
+              output->params.zero_point);
+    case kTfLiteFloat32:
+      return output->data.f[c];
+    default:
+      return 0.0f;
+  }
+}
+
+bool SupportedOutput(const TfLiteTensor* output) {
+  return output->type == kTfLiteUInt8 || output->type == kTfLiteInt8 ||
+         output->type == kTfLiteFloat32;
+}
+
+}  // namespace
+
+LateFusionScheduler::LateFusionScheduler(
+    const tflite::MicroOpResolver& resolver, const BranchConfig& image,
+    const BranchConfig& audio)
+    : image_interpreter_(image.model, resolver, image.arena,
+                         image.arena_size),
+      audio_interpreter_(audio.model, resolver, audio.arena,
+                         audio.arena_size),
+      interpreters_{&image_interpreter_, &audio_interpreter_},
+      weights_{image.weight, audio.weight},
+      cores_{image.core, audio.core},
+      workers_{{this, kImage, nullptr, kTfLiteOk},
+               {this, kAudio, nullptr, kTfLiteOk}},
+      done_(nullptr),
+      num_classes_(0) {}
+
+LateFusionScheduler::~LateFusionScheduler() {
+  for (Worker& worker : workers_) {
+    if (worker.task != nullptr) {
+      vTaskDelete(worker.task);
+    }
+  }
+  if (done_ != nullptr) {
+    vEventGroupDelete(done_);
+  }
+}
+
+TfLiteStatus LateFusionScheduler::Init() {
+  for (int b = 0; b < kNumBranches; b++) {
+    if (interpreters_[b]->AllocateTensors() != kTfLiteOk) {
+      ESP_LOGE(TAG, "AllocateTensors failed for branch %d", b);
+      return kTfLiteError;
+    }
+    const TfLiteTensor* output = interpreters_[b]->output(0);
+    if (!SupportedOutput(output)) {
+      ESP_LOGE(TAG, "Unsupported output type %d for branch %d",
+               output->type, b);
+      return kTfLiteError;
+    }
+    ESP_LOGI(TAG, "Branch %d: arena %u bytes, core %d", b,
+             (unsigned)interpreters_[b]->arena_used_bytes(), (int)cores_[b]);
+  }
+
+  num_classes_ = NumClasses(interpreters_[kImage]->output(0));
+  if (NumClasses(interpreters_[kAudio]->output(0)) != num_classes_ ||
+      num_classes_ > kMaxClasses) {
+    ESP_LOGE(TAG, "Class count mismatch: image %d, audio %d (max %d)",
+             num_classes_, NumClasses(interpreters_[kAudio]->output(0)),
+             kMaxClasses);
+    return kTfLiteError;
+  }
+
+  done_ = xEventGroupCreate();
+  if (done_ == nullptr) {
+    return kTfLiteError;
+  }
+  for (int b = 0; b < kNumBranches; b++) {
+    if (xTaskCreatePinnedToCore(WorkerTask,
+                                b == kImage ? "fusion_img" : "fusion_aud",
+                                kStackSize, &workers_[b], kWorkerPriority,
+                                &workers_[b].task, cores_[b]) != pdPASS) {
+      ESP_LOGE(TAG, "Cannot start the worker for branch %d", b);
+      return kTfLiteError;
+    }
+  }
+  return kTfLiteOk;
+}
+
+void LateFusionScheduler::WorkerTask(void* arg) {
+  Worker* worker = static_cast<Worker*>(arg);
+  LateFusionScheduler* owner = worker->owner;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    worker->status = owner->interpreters_[worker->branch]->Invoke();
+    xEventGroupSetBits(owner->done_, 1 << worker->branch);
+  }
+}
+
+TfLiteStatus LateFusionScheduler::RunItem(float* scores,
+                                          int64_t* latency_us) {
+  const EventBits_t all = (1 << kImage) | (1 << kAudio);
+  const int64_t start = esp_timer_get_time();
+  xEventGroupClearBits(done_, all);
+  for (Worker& worker : workers_) {
+    xTaskNotifyGive(worker.task);
+  }
+  xEventGroupWaitBits(done_, all, pdTRUE, pdTRUE, portMAX_DELAY);
+  if (workers_[kImage].status != kTfLiteOk ||
+      workers_[kAudio].status != kTfLiteOk) {
+    return kTfLiteError;
+  }
+  Fuse(scores);
+  *latency_us = esp_timer_get_time() - start;
+  return kTfLiteOk;
+}
+
+TfLiteStatus LateFusionScheduler::RunSequential(float* scores,
+                                                int64_t* latency_us) {
+  const int64_t start = esp_timer_get_time();
+  for (tflite::MicroInterpreter* interpreter : interpreters_) {
+    if (interpreter->Invoke() != kTfLiteOk) {
+      return kTfLiteError;
+    }
+  }
+  Fuse(scores);
+  *latency_us = esp_timer_get_time() - start;
+  return kTfLiteOk;
+}
+
+void LateFusionScheduler::Fuse(float* scores) const {
+  const TfLiteTensor* image = interpreters_[kImage]->output(0);
+  const TfLiteTensor* audio = interpreters_[kAudio]->output(0);
+  for (int c = 0; c < num_classes_; c++) {
+    scores[c] = weights_[kImage] * Dequantize(image, c) +
+                weights_[kAudio] * Dequantize(audio, c);
+  }
+}
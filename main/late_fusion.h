@@ -0,0 +1,85 @@
+#ifndef LATE_FUSION_H_
+#define LATE_FUSION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Runs the image and impact-sound classifiers of one item side by side, one
+// MicroInterpreter per ESP32 core, and fuses their class scores.
+//
+// Each branch owns its interpreter and arena and is served by a worker task
+// pinned to its core. RunItem() wakes both workers for the same item, waits
+// for both and combines the dequantized outputs as
+//   score[c] = w_image * p_image[c] + w_audio * p_audio[c].
+// RunSequential() runs the same two models one after the other on the calling
+// task, so the two latencies can be compared on the board.
+//
+// The esp-nn scratch pointers set before each kernel call are thread-local,
+// so the two interpreters can run the same kernels concurrently. The
+// per-kernel *_total_time counters are shared and only approximate here.
+class LateFusionScheduler {
+ public:
+  enum BranchId { kImage = 0, kAudio = 1, kNumBranches = 2 };
+
+  struct BranchConfig {
+    const tflite::Model* model;
+    uint8_t* arena;
+    size_t arena_size;
+    float weight;
+    BaseType_t core;
+  };
+
+  static constexpr int kMaxClasses = 16;
+
+  LateFusionScheduler(const tflite::MicroOpResolver& resolver,
+                      const BranchConfig& image, const BranchConfig& audio);
+  ~LateFusionScheduler();
+
+  // Allocates both arenas, checks that the two models agree on the number of
+  // classes and starts the worker tasks.
+  TfLiteStatus Init();
+
+  TfLiteTensor* input(BranchId branch) {
+    return interpreters_[branch]->input(0);
+  }
+
+  int num_classes() const { return num_classes_; }
+
+  // Both branches in parallel; `scores` receives num_classes() values. The
+  // inputs must be written before every call: the arenas reuse the input
+  // buffers once the first layer has consumed them.
+  TfLiteStatus RunItem(float* scores, int64_t* latency_us);
+
+  // Same work, both branches on the calling task.
+  TfLiteStatus RunSequential(float* scores, int64_t* latency_us);
+
+ private:
+  struct Worker {
+    LateFusionScheduler* owner;
+    BranchId branch;
+    TaskHandle_t task;
+    TfLiteStatus status;
+  };
+
+  static void WorkerTask(void* arg);
+  void Fuse(float* scores) const;
+
+  tflite::MicroInterpreter image_interpreter_;
+  tflite::MicroInterpreter audio_interpreter_;
+  tflite::MicroInterpreter* interpreters_[kNumBranches];
+  float weights_[kNumBranches];
+  BaseType_t cores_[kNumBranches];
+  Worker workers_[kNumBranches];
+  EventGroupHandle_t done_;
+  int num_classes_;
+};
+
+#endif  // LATE_FUSION_H_
@@ -1,39 +1,565 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
-#include <map>
-#include <string>
+#include <cstring>
 
+#include "esp_cpu.h"
 #include "esp_log.h"
 #include "esp_system.h"
 #include "esp_heap_caps.h"
 #include "esp_psram.h"
+#include "esp_random.h"
+#include "esp_timer.h"
 
 #include "model_data.h" 
+#include "model_codegen.h"
+#include "late_fusion.h"
+#include "audio_frontend.h"
+#include "core_copy_engine.h"
+#include "event_log.h"
+#include "realtime_inference.h"
 
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_stats_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/micro_weight_prefetcher.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/c/common.h"
+#include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
+#include "signal/src/rfft.h"
 
 static const char *TAG = "TFLM_MAIN";
 constexpr int kTensorArenaSize = 700 * 1024;
+constexpr int kFusionArenaSize = 256 * 1024;
+// Parte de la arena que los kernels pueden usar para acelerar capas, p. ej.
+// los filtros transformados de las convoluciones Winograd
+constexpr size_t kOptionalPersistentBudget = 128 * 1024;
+// Dos ranuras de 24 KB: cubren todas las capas salvo las dos mayores
+constexpr size_t kWeightStagingSize = 48 * 1024;
+// Perfilador siempre activo: mide una de cada 8 inferencias
+constexpr uint32_t kProfileSampleInterval = 8;
+constexpr int kMonitorInferences = 64;
+// Modo de latencia determinista: el núcleo 1 solo para la inferencia, por
+// encima de cualquier otra tarea de la aplicación (la tarea IPC de IDF, con
+// prioridad configMAX_PRIORITIES - 1, sigue pudiendo expulsarla).
+constexpr BaseType_t kRealtimeCore = 1;
+constexpr UBaseType_t kRealtimePriority = configMAX_PRIORITIES - 2;
+constexpr int kRealtimeFrames = 200;
+// Plazo de la inferencia anytime, en porcentaje de la latencia completa: el
+// objeto llega a la paleta antes de que termine la inferencia.
+constexpr int64_t kAnytimeDeadlinePercent = 50;
 static uint8_t *tensor_arena = nullptr;
+static tflite::MicroStatsProfiler::NodeStats node_stats[model_codegen::kNumOps];
+static tflite::MicroStatsProfiler latency_profiler(node_stats, model_codegen::kNumOps,
+                                                   kProfileSampleInterval);
 
-// Mapeo de clases
-std::map<int, std::string> label_map = {
-    {0, "carton"},
-    {1, "metal"},
-    {2, "papel"},
-    {3, "plastico"}
+// Nombres de las clases, en el orden de la salida del modelo
+constexpr const char *kLabels[] = {"carton", "metal", "papel", "plastico"};
+constexpr int kNumLabels = sizeof(kLabels) / sizeof(kLabels[0]);
+
+static const char *label(int index)
+{
+    return index >= 0 && index < kNumLabels ? kLabels[index] : "?";
+}
+
+// Registro binario de eventos: las inferencias solo guardan registros de
+// tamaño fijo y una tarea de baja prioridad los formatea después.
+constexpr size_t kEventLogSlots = 256;
+constexpr UBaseType_t kEventLogPriority = 1;
+constexpr uint32_t kEventLogPeriodMs = 100;
+
+enum EventId : uint32_t {
+    kEventInference,  // número, latencia en us, clase
+    kEventResult,     // clase, probabilidad en 1/256
 };
 
+static EventLog::Slot event_slots[kEventLogSlots];
+static EventLog event_log(event_slots, kEventLogSlots);
+
+static void format_event(const EventLog::Record &record)
+{
+    switch (record.id) {
+    case kEventInference:
+        ESP_LOGI(TAG, "[%u us] Inferencia %d: %d us, %s", (unsigned) record.time_us,
+                 (int) record.args[0], (int) record.args[1], label(record.args[2]));
+        break;
+    case kEventResult:
+        ESP_LOGI(TAG, "[%u us] Resultado: %s (%d/256)", (unsigned) record.time_us,
+                 label(record.args[0]), (int) record.args[1]);
+        break;
+    default:
+        ESP_LOGW(TAG, "[%u us] Evento desconocido %u", (unsigned) record.time_us,
+                 (unsigned) record.id);
+        break;
+    }
+}
+
 // Imagen de prueba (rellena con valores dummy, 96x96x3)
 uint8_t test_image[96 * 96 * 3];
 
+// Valor int8 de cada píxel en el tensor de entrada, calculado por
+// set_image_conversion()
+static int8_t pixel_to_input[256];
+
+// Con la QUANTIZE de entrada a cargo de la aplicación, input(0) es el tensor
+// int8 de la primera capa: cada píxel, en la cuantización de la entrada uint8
+// del modelo, se recuantiza a la escala y el zero point de ese tensor, como
+// lo haría la QUANTIZE. Falla si la entrada del modelo no es uint8.
+static bool set_image_conversion(tflite::MicroInterpreter &interpreter)
+{
+    TfLiteType model_type;
+    TfLiteQuantizationParams model_params;
+    if (interpreter.GetModelInputQuantization(0, &model_type, &model_params) != kTfLiteOk ||
+        model_type != kTfLiteUInt8) {
+        return false;
+    }
+    const TfLiteTensor *input = interpreter.input(0);
+    if (input->type == kTfLiteUInt8) {
+        return true;
+    }
+    if (input->type != kTfLiteInt8 || input->params.scale <= 0.0f) {
+        return false;
+    }
+    for (int pixel = 0; pixel < 256; pixel++) {
+        const float real = (pixel - model_params.zero_point) * model_params.scale;
+        const long value = lroundf(real / input->params.scale) + input->params.zero_point;
+        pixel_to_input[pixel] = (int8_t) std::min(std::max(value, -128L), 127L);
+    }
+    return true;
+}
+
+// Preprocesado: copia la imagen al tensor de entrada, convertida con
+// set_image_conversion() si es el int8 de la primera capa.
+static void write_image(TfLiteTensor *input)
+{
+    if (input->type == kTfLiteInt8) {
+        for (size_t i = 0; i < sizeof(test_image); i++) {
+            input->data.int8[i] = pixel_to_input[test_image[i]];
+        }
+    } else {
+        memcpy(input->data.uint8, test_image, sizeof(test_image));
+    }
+}
+
+// Probabilidad de la clase i en pasos de la escala de salida (1/256): la
+// salida es la int8 de la softmax o, con la QUANTIZE final, su copia uint8.
+static int32_t output_steps(const TfLiteTensor *output, int i)
+{
+    const int32_t value = output->type == kTfLiteInt8 ? output->data.int8[i]
+                                                      : output->data.uint8[i];
+    return value - output->params.zero_point;
+}
+
+#if CONFIG_WASTE_COMPARE_CODEGEN
+// model_codegen incluye la QUANTIZE final: su salida es uint8 con zero point 0,
+// en los mismos pasos de 1/256 que output_steps().
+static bool same_output(const uint8_t *codegen_output, const TfLiteTensor *output)
+{
+    for (size_t i = 0; i < model_codegen::kOutputBytes; i++) {
+        if (codegen_output[i] != output_steps(output, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Ejecuta model_codegen sobre la misma entrada que el intérprete y comprueba
+// que la salida es idéntica.
+static void compare_codegen(const TfLiteTensor* input, const TfLiteTensor* output,
+                            int64_t t_interpreter)
+{
+    if (modelo_tflite_len != model_codegen::kModelSize ||
+        input->bytes != model_codegen::kInputBytes ||
+        output->bytes != model_codegen::kOutputBytes) {
+        ESP_LOGW(TAG, "model_codegen no corresponde al modelo cargado; regenerarlo.");
+        return;
+    }
+
+    const size_t arena_size = model_codegen::RequiredArenaSize();
+    uint8_t *arena = (uint8_t *)heap_caps_aligned_alloc(16, arena_size,
+                                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!arena) {
+        arena = (uint8_t *)heap_caps_aligned_alloc(16, arena_size, MALLOC_CAP_8BIT);
+    }
+    if (!arena) {
+        ESP_LOGW(TAG, "Sin memoria para la arena de model_codegen (%u bytes).",
+                 (unsigned) arena_size);
+        return;
+    }
+
+    // La arena del intérprete reutiliza el tensor de entrada tras la primera
+    // capa, así que se copia la imagen original.
+    memcpy(model_codegen::Input(arena), test_image, model_codegen::kInputBytes);
+    int64_t t_start = esp_timer_get_time();
+    TfLiteStatus status = model_codegen::Invoke(modelo_tflite, arena, arena_size);
+    int64_t t_codegen = esp_timer_get_time() - t_start;
+
+    if (status != kTfLiteOk) {
+        ESP_LOGE(TAG, "Error al ejecutar model_codegen.");
+    } else if (!same_output(model_codegen::Output(arena), output)) {
+        ESP_LOGE(TAG, "model_codegen difiere del intérprete.");
+    } else {
+        ESP_LOGI(TAG, "model_codegen coincide con el intérprete: %lld us frente a %lld us, "
+                 "arena %u bytes", t_codegen, t_interpreter, (unsigned) arena_size);
+    }
+    heap_caps_free(arena);
+}
+#endif
+
+#if CONFIG_WASTE_BENCH_RFFT
+// Ciclos de la RFFT int16 del front end de audio: kiss_fftr frente al
+// motor radix-4 de RfftInt16Apply, y diferencia máxima entre ambos en LSB.
+static void bench_rfft()
+{
+    constexpr int kN = AudioFrontend::kFftSize;
+    const size_t state_size = tflm_signal::RfftInt16GetNeededMemory(kN);
+    size_t kiss_size = 0;
+    kiss_fft_fixed16::kiss_fftr_alloc(kN, 0, nullptr, &kiss_size);
+
+    void *state = heap_caps_aligned_alloc(8, state_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    void *kiss_state = heap_caps_aligned_alloc(8, kiss_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    int16_t *frame = (int16_t *)heap_caps_malloc(kN * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+    Complex<int16_t> *out = (Complex<int16_t> *)heap_caps_malloc(
+        (kN / 2 + 1) * sizeof(Complex<int16_t>), MALLOC_CAP_INTERNAL);
+    Complex<int16_t> *ref = (Complex<int16_t> *)heap_caps_malloc(
+        (kN / 2 + 1) * sizeof(Complex<int16_t>), MALLOC_CAP_INTERNAL);
+
+    void *rfft = nullptr;
+    kiss_fft_fixed16::kiss_fftr_cfg kiss = nullptr;
+    if (state && kiss_state && frame && out && ref) {
+        rfft = tflm_signal::RfftInt16Init(kN, state, state_size);
+        kiss = kiss_fft_fixed16::kiss_fftr_alloc(kN, 0, kiss_state, &kiss_size);
+    }
+    if (!rfft || !kiss) {
+        ESP_LOGW(TAG, "Sin memoria para la prueba de la RFFT.");
+    } else {
+        for (int i = 0; i < kN; i++) {
+            frame[i] = (int16_t)((esp_random() & 0x3fff) - 0x2000);
+        }
+        uint32_t kiss_cycles = UINT32_MAX;
+        uint32_t rfft_cycles = UINT32_MAX;
+        for (int run = 0; run < 20; run++) {
+            uint32_t start = esp_cpu_get_cycle_count();
+            kiss_fft_fixed16::kiss_fftr(kiss, frame,
+                                        (kiss_fft_fixed16::kiss_fft_cpx *)ref);
+            uint32_t mid = esp_cpu_get_cycle_count();
+            tflm_signal::RfftInt16Apply(rfft, frame, out);
+            uint32_t end = esp_cpu_get_cycle_count();
+            kiss_cycles = std::min(kiss_cycles, mid - start);
+            rfft_cycles = std::min(rfft_cycles, end - mid);
+        }
+        int max_diff = 0;
+        for (int k = 0; k <= kN / 2; k++) {
+            max_diff = std::max(max_diff, std::abs(out[k].real - ref[k].real));
+            max_diff = std::max(max_diff, std::abs(out[k].imag - ref[k].imag));
+        }
+        ESP_LOGI(TAG, "RFFT int16 de %d puntos: kiss_fftr %u ciclos, radix-4 %u ciclos, "
+                 "diferencia máx %d LSB", kN, (unsigned) kiss_cycles,
+                 (unsigned) rfft_cycles, max_diff);
+    }
+    heap_caps_free(state);
+    heap_caps_free(kiss_state);
+    heap_caps_free(frame);
+    heap_caps_free(out);
+    heap_caps_free(ref);
+}
+#endif
+
+// Clase con mayor probabilidad en la salida de la softmax
+static int predicted_class(const TfLiteTensor *output)
+{
+    int best = 0;
+    for (int i = 1; i < output->dims->data[1]; i++) {
+        if (output_steps(output, i) > output_steps(output, best)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void log_result_text(const TfLiteTensor *output)
+{
+    // Salida de la softmax: escala 1/256, no 1/255
+    for (int i = 0; i < output->dims->data[1]; i++) {
+        float prob = output_steps(output, i) * output->params.scale;
+        ESP_LOGI(TAG, "Clase %d (%s) -> %f", i, label(i), prob);
+    }
+    const int best = predicted_class(output);
+    ESP_LOGI(TAG, "Clase predicha: %s con probabilidad: %f", label(best),
+             output_steps(output, best) * output->params.scale);
+}
+
+#if CONFIG_WASTE_WEIGHT_PREFETCH || CONFIG_WASTE_TOP_K || CONFIG_WASTE_ANYTIME || \
+    CONFIG_WASTE_LATENCY_MONITOR
+static int64_t invoke_test_image(tflite::MicroInterpreter &interpreter)
+{
+    write_image(interpreter.input(0));
+    const int64_t t_start = esp_timer_get_time();
+    if (interpreter.Invoke() != kTfLiteOk) {
+        return -1;
+    }
+    return esp_timer_get_time() - t_start;
+}
+#endif
+
+#if CONFIG_WASTE_WEIGHT_PREFETCH
+// Prefetch de pesos: mientras una capa calcula, el núcleo 1 copia los filtros
+// y bias de la siguiente desde flash a SRAM interna. Compara la latencia con y
+// sin prefetch sobre la misma imagen y exige la misma salida.
+static void run_weight_prefetch(tflite::MicroInterpreter &interpreter,
+                                const tflite::Model *model)
+{
+    const size_t staging_size =
+        std::min(2 * tflite::MicroWeightPrefetcher::LargestNodeBytes(model),
+                 kWeightStagingSize);
+    uint8_t *staging = (uint8_t *)heap_caps_aligned_alloc(16, staging_size,
+                                                          MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!staging) {
+        ESP_LOGW(TAG, "Sin SRAM interna para el prefetch de pesos.");
+        return;
+    }
+
+    {
+        CoreCopyEngine engine(1);
+        tflite::MicroWeightPrefetcher prefetcher(&engine, staging, staging_size);
+        const TfLiteTensor *output = interpreter.output(0);
+        uint8_t reference[16];
+        const size_t output_bytes = std::min(output->bytes, sizeof(reference));
+
+        const int64_t t_direct = invoke_test_image(interpreter);
+        memcpy(reference, output->data.raw, output_bytes);
+
+        int64_t t_prefetch = -1;
+        if (engine.Init()) {
+            interpreter.SetWeightPrefetcher(&prefetcher);
+            t_prefetch = invoke_test_image(interpreter);
+            interpreter.SetWeightPrefetcher(nullptr);
+        }
+        if (t_direct < 0 || t_prefetch < 0) {
+            ESP_LOGE(TAG, "Error al ejecutar la inferencia con prefetch.");
+        } else {
+            const bool same = memcmp(reference, output->data.raw, output_bytes) == 0;
+            ESP_LOGI(TAG, "Prefetch de pesos (%u bytes de SRAM): %lld us frente a %lld us "
+                     "leyendo de flash, salida %s", (unsigned) staging_size, t_prefetch,
+                     t_direct, same ? "idéntica" : "DISTINTA");
+            prefetcher.Log();
+        }
+    }
+    heap_caps_free(staging);
+}
+#endif
+
+#if CONFIG_WASTE_LATE_FUSION
+static void copy_fusion_inputs(LateFusionScheduler &fusion)
+{
+    for (int branch = 0; branch < LateFusionScheduler::kNumBranches; branch++) {
+        memcpy(fusion.input((LateFusionScheduler::BranchId) branch)->data.raw,
+               test_image, sizeof(test_image));
+    }
+}
+
+// Clasificación por fusión tardía imagen + sonido de impacto, cada modelo en
+// un núcleo. Hasta tener el modelo de audio ambas ramas usan modelo_tflite, lo
+// que basta para medir la latencia paralela frente a la secuencial.
+static void run_late_fusion(const tflite::MicroOpResolver &resolver,
+                            const tflite::Model *model)
+{
+    uint8_t *arenas[LateFusionScheduler::kNumBranches];
+    for (uint8_t *&arena : arenas) {
+        arena = (uint8_t *)heap_caps_aligned_alloc(16, kFusionArenaSize,
+                                                   MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!arenas[0] || !arenas[1]) {
+        ESP_LOGW(TAG, "Sin memoria para las arenas de fusión tardía.");
+        heap_caps_free(arenas[0]);
+        heap_caps_free(arenas[1]);
+        return;
+    }
+
+    {
+        LateFusionScheduler fusion(resolver,
+                                   {model, arenas[0], kFusionArenaSize, 0.6f, 0},
+                                   {model, arenas[1], kFusionArenaSize, 0.4f, 1});
+        float scores[LateFusionScheduler::kMaxClasses];
+        int64_t t_sequential = 0;
+        int64_t t_parallel = 0;
+        if (fusion.Init() != kTfLiteOk) {
+            ESP_LOGE(TAG, "Error al inicializar la fusión tardía.");
+        } else {
+            // Cada ejecución consume la entrada: se copia antes de cada una
+            copy_fusion_inputs(fusion);
+            TfLiteStatus status = fusion.RunSequential(scores, &t_sequential);
+            copy_fusion_inputs(fusion);
+            if (status != kTfLiteOk || fusion.RunItem(scores, &t_parallel) != kTfLiteOk) {
+                ESP_LOGE(TAG, "Error al ejecutar la fusión tardía.");
+            } else {
+                int best = 0;
+                for (int i = 1; i < fusion.num_classes(); i++) {
+                    if (scores[i] > scores[best]) {
+                        best = i;
+                    }
+                }
+                ESP_LOGI(TAG, "Fusión tardía: %s (%f), paralelo %lld us frente a "
+                         "secuencial %lld us", label(best), scores[best],
+                         t_parallel, t_sequential);
+            }
+        }
+    }
+    heap_caps_free(arenas[0]);
+    heap_caps_free(arenas[1]);
+}
+#endif
+
+#if CONFIG_WASTE_TOP_K
+// Modo top-k: Invoke() se detiene antes de la SOFTMAX y su QUANTIZE, y la
+// clase y la confianza salen directamente de los logits int8. Basta cuando
+// solo hace falta la decisión.
+static void run_top_k(tflite::MicroInterpreter &interpreter)
+{
+    const int64_t t_full = invoke_test_image(interpreter);
+    if (interpreter.SetTopKOutputMode(true) != kTfLiteOk) {
+        ESP_LOGW(TAG, "El modelo no termina en SOFTMAX; sin modo top-k.");
+        return;
+    }
+    const int64_t t_top_k = invoke_test_image(interpreter);
+    tflite::MicroTopKEntry best;
+    if (t_full < 0 || t_top_k < 0 || interpreter.TopK(&best, 1) != 1) {
+        ESP_LOGE(TAG, "Error al ejecutar la inferencia en modo top-k.");
+    } else {
+        ESP_LOGI(TAG, "Top-1 desde los logits: %s (%f), %lld us frente a %lld us "
+                 "con la softmax", label(best.index), best.confidence,
+                 t_top_k, t_full);
+    }
+    interpreter.SetTopKOutputMode(false);
+}
+#endif
+
+#if CONFIG_WASTE_ANYTIME
+// Instante, en ticks de TFLM, que queda `us` microsegundos por delante
+static uint32_t deadline_in(int64_t us)
+{
+    return tflite::GetCurrentTimeTicks() +
+           (uint32_t) (us * tflite::ticks_per_second() / 1000000);
+}
+
+// Inferencia anytime: InvokeUntil() se detiene entre dos capas al llegar el
+// plazo y la decisión sale de la salida más profunda ya calculada (con cabezas
+// de clasificación intermedias; este modelo solo tiene la final). Si después
+// sobra tiempo, ResumeInvoke() continúa la misma inferencia donde se quedó, y
+// su salida debe ser la de una inferencia sin plazo.
+static void run_anytime(tflite::MicroInterpreter &interpreter,
+                        const tflite::Model *model)
+{
+    const TfLiteTensor *output = interpreter.output(0);
+    uint8_t reference[16];
+    const size_t output_bytes = std::min(output->bytes, sizeof(reference));
+    const int64_t t_full = invoke_test_image(interpreter);
+    if (t_full < 0) {
+        ESP_LOGE(TAG, "Error al ejecutar la inferencia sin plazo.");
+        return;
+    }
+    memcpy(reference, output->data.raw, output_bytes);
+
+    write_image(interpreter.input(0));
+    const int64_t budget_us = t_full * kAnytimeDeadlinePercent / 100;
+    TfLiteStatus status = interpreter.InvokeUntil(deadline_in(budget_us));
+    const unsigned num_ops = model->subgraphs()->Get(0)->operators()->size();
+    ESP_LOGI(TAG, "Plazo de %lld us: %u de %u operadores ejecutados", budget_us,
+             (unsigned) interpreter.completed_operators(), num_ops);
+    const int head = interpreter.DeepestCompletedOutput();
+    if (head >= 0) {
+        ESP_LOGI(TAG, "Decisión en plazo (salida %d): %s", head,
+                 label(predicted_class(interpreter.output(head))));
+    } else if (status == tflite::kTfLiteAbort) {
+        ESP_LOGI(TAG, "Ninguna salida lista en plazo: el objeto sigue sin desviar");
+    }
+
+    // Hay tiempo de sobra: se termina la inferencia suspendida
+    while (status == tflite::kTfLiteAbort && interpreter.invoke_suspended()) {
+        status = interpreter.ResumeInvoke(deadline_in(t_full));
+    }
+    if (status != kTfLiteOk) {
+        ESP_LOGE(TAG, "Error al reanudar la inferencia.");
+        return;
+    }
+    const bool same = memcmp(reference, output->data.raw, output_bytes) == 0;
+    ESP_LOGI(TAG, "Inferencia reanudada: %s, salida %s", label(predicted_class(output)),
+             same ? "idéntica" : "DISTINTA");
+}
+#endif
+
+#if CONFIG_WASTE_LATENCY_MONITOR
+// Inferencias seguidas con el perfilador de estadísticas enganchado, como en
+// un equipo desplegado. Enviando 'p' por la consola se vuelcan las
+// estadísticas por nodo en cualquier momento; al terminar se vuelcan siempre.
+static void run_latency_monitor(tflite::MicroInterpreter &interpreter)
+{
+    for (int i = 0; i < kMonitorInferences; i++) {
+        const int64_t latency = invoke_test_image(interpreter);
+        if (latency < 0) {
+            ESP_LOGE(TAG, "Error al ejecutar la inferencia monitorizada.");
+            return;
+        }
+        event_log.Log(kEventInference, i, (int32_t) latency,
+                      predicted_class(interpreter.output(0)));
+        // La consola no bloquea: sin datos getchar() devuelve EOF y lo deja
+        // marcado en stdin
+        clearerr(stdin);
+        if (getchar() == 'p') {
+            latency_profiler.Log();
+        }
+    }
+    latency_profiler.Log();
+    if (event_log.dropped() > 0) {
+        ESP_LOGW(TAG, "Registro de eventos lleno: %u eventos perdidos",
+                 (unsigned) event_log.dropped());
+    }
+}
+#endif
+
+#if CONFIG_WASTE_REALTIME
+static void write_realtime_frame(TfLiteTensor *input, int frame, void *arg)
+{
+    write_image(input);
+}
+
+// Latencia en el peor caso del modo determinista: histograma de Invoke en el
+// núcleo reservado y jitter medido (latencia máxima menos mínima). La paleta
+// desviadora compensa el retardo fijo de la inferencia; solo el jitter
+// desplaza el punto de desvío. Aún no hay una cota medida en placa con la
+// que compararlo.
+static void run_realtime(tflite::MicroInterpreter &interpreter)
+{
+    // Con una de cada N inferencias perfilada, esas serían más lentas: se
+    // perfilan todas para que el coste sea el mismo en cada frame.
+    latency_profiler.set_sample_interval(1);
+    RealtimeInference realtime(interpreter,
+                               {kRealtimeCore, kRealtimePriority, tensor_arena,
+                                interpreter.arena_used_bytes()});
+    const TfLiteStatus status = realtime.Run(kRealtimeFrames, write_realtime_frame, nullptr);
+    latency_profiler.set_sample_interval(kProfileSampleInterval);
+    if (status != kTfLiteOk) {
+        ESP_LOGE(TAG, "Error al ejecutar el modo de latencia determinista.");
+        return;
+    }
+
+    const LatencyHistogram &histogram = realtime.histogram();
+    histogram.Log(TAG);
+    ESP_LOGI(TAG, "Jitter de %u us con una mediana de %u us",
+             (unsigned) histogram.jitter_us(), (unsigned) histogram.Percentile(0.5f));
+}
+#endif
+
 extern "C" void app_main(void)
 {
     ESP_LOGI(TAG, "Inicializando TensorFlow Lite Micro...");
 
+    if (!event_log.StartPrinter(format_event, kEventLogPriority, 0, kEventLogPeriodMs)) {
+        ESP_LOGW(TAG, "Sin tarea para el registro de eventos.");
+    }
+
     if (esp_psram_is_initialized()) {
         tensor_arena = (uint8_t *)heap_caps_malloc(kTensorArenaSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
         ESP_LOGI(TAG, "PSRAM detectada y usada para tensor arena.");
@@ -73,46 +599,97 @@ extern "C" void app_main(void)
     resolver.AddSoftmax();
 
     // Crear intérprete
-    static tflite::MicroInterpreter interpreter(model, resolver, tensor_arena, kTensorArenaSize);
+    static tflite::MicroInterpreter interpreter(model, resolver, tensor_arena, kTensorArenaSize,
+                                                nullptr, &latency_profiler);
     ESP_LOGI(TAG, "Intérprete creado correctamente.");
 
+    // La QUANTIZE uint8 -> int8 de la entrada y la int8 -> uint8 de la salida
+    // las hace la aplicación: write_image() escribe la imagen ya en int8 y el
+    // resultado se lee de la salida int8 de la softmax. Ni esas dos pasadas ni
+    // los tensores uint8 ocupan tiempo o arena.
+    interpreter.SetApplicationBoundaryConversions(true);
+    interpreter.SetOptionalPersistentBudget(kOptionalPersistentBudget);
+
     if (interpreter.AllocateTensors() != kTfLiteOk) {
         ESP_LOGE(TAG, "Error al asignar tensores.");
         return;
     }
+    if (!set_image_conversion(interpreter)) {
+        ESP_LOGE(TAG, "La entrada del modelo no admite la imagen uint8.");
+        return;
+    }
     ESP_LOGI(TAG, "Tensor arena asignada correctamente. Setup completo.");
+    ESP_LOGI(TAG, "Arena usada: %u de %u bytes (%u en búferes opcionales de los kernels)",
+             (unsigned) interpreter.arena_used_bytes(), (unsigned) kTensorArenaSize,
+             (unsigned) interpreter.optional_persistent_bytes());
+    interpreter.PrintEliminatedNodes();
 
     // Copiar imagen de prueba al tensor de entrada
     TfLiteTensor* input = interpreter.input(0);
-    if (input->type == kTfLiteUInt8) {
-        for (int i = 0; i < 96*96*3; i++) {
-            input->data.uint8[i] = test_image[i]; 
-        }
-    }
+    write_image(input);
 
     ESP_LOGI(TAG, "Iniciando inferencia de prueba...");
+    int64_t t_start = esp_timer_get_time();
     if (interpreter.Invoke() != kTfLiteOk) {
         ESP_LOGE(TAG, "Error al ejecutar inferencia.");
         return;
     }
-    ESP_LOGI(TAG, "Inferencia ejecutada correctamente.");
+    int64_t t_interpreter = esp_timer_get_time() - t_start;
+    ESP_LOGI(TAG, "Inferencia ejecutada correctamente (%lld us).", t_interpreter);
 
-    // Procesar salida
+    // Procesar salida: en texto con ESP_LOGI y en el registro binario, que
+    // es lo que haría cada inferencia de un equipo desplegado
     TfLiteTensor* output = interpreter.output(0);
-    int predicted_class = 0;
-    float max_prob = 0.0f;
+    const uint32_t t_text = esp_cpu_get_cycle_count();
+    log_result_text(output);
+    const uint32_t t_binary = esp_cpu_get_cycle_count();
+    const int best = predicted_class(output);
+    event_log.Log(kEventResult, best, output_steps(output, best));
+    const uint32_t t_end = esp_cpu_get_cycle_count();
+    ESP_LOGI(TAG, "Registro del resultado: %u ciclos con ESP_LOGI, %u con el registro binario",
+             (unsigned) (t_binary - t_text), (unsigned) (t_end - t_binary));
 
-    for (int i = 0; i < output->dims->data[1]; i++) {
-        float prob = static_cast<float>(output->data.uint8[i]) / 255.0f;
-        ESP_LOGI(TAG, "Clase %d (%s) -> %f", i, label_map[i].c_str(), prob);
-        if (prob > max_prob) {
-            max_prob = prob;
-            predicted_class = i;
-        }
-    }
+    // Demos y benchmarks, cada uno activado en menuconfig (Clasificador de
+    // residuos -> Demos y benchmarks)
+#if CONFIG_WASTE_COMPARE_CODEGEN
+    // Comparar con el modelo compilado por tools/tflite_codegen.py
+    compare_codegen(input, output, t_interpreter);
+#endif
+
+#if CONFIG_WASTE_TOP_K
+    // Solo la clase ganadora, sin la softmax
+    run_top_k(interpreter);
+#endif
+
+#if CONFIG_WASTE_ANYTIME
+    // Decisión en plazo y reanudación de la inferencia
+    run_anytime(interpreter, model);
+#endif
+
+#if CONFIG_WASTE_WEIGHT_PREFETCH
+    // Pesos de la capa siguiente copiados a SRAM por el otro núcleo
+    run_weight_prefetch(interpreter, model);
+#endif
+
+#if CONFIG_WASTE_LATE_FUSION
+    // Imagen y sonido en paralelo, uno por núcleo
+    run_late_fusion(resolver, model);
+#endif
+
+#if CONFIG_WASTE_BENCH_RFFT
+    // RFFT del front end de audio
+    bench_rfft();
+#endif
+
+#if CONFIG_WASTE_LATENCY_MONITOR
+    // Latencia por capa: mínimo, media, p95 y máximo
+    run_latency_monitor(interpreter);
+#endif
 
-    ESP_LOGI(TAG, "Clase predicha: %s con probabilidad: %f",
-             label_map[predicted_class].c_str(), max_prob);
+#if CONFIG_WASTE_REALTIME
+    // Peor caso con núcleo reservado y caché precargada
+    run_realtime(interpreter);
+#endif
 
     ESP_LOGI(TAG, "app_main finalizado.");
 }
@@ -0,0 +1,3274 @@
+// Generated by tools/tflite_codegen.py from model_data.h.
+// Do not edit; regenerate whenever the model changes.
+
+#include "model_codegen.h"
+
+#include <algorithm>
+
+#include "esp_nn.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/reference/requantize.h"
+
+namespace model_codegen {
+namespace {
+
+// Arena offsets of the activation tensors.
+constexpr size_t kTensor0 = 0;
+constexpr size_t kTensor110 = 36864;
+constexpr size_t kTensor111 = 0;
+constexpr size_t kTensor112 = 36864;
+constexpr size_t kTensor113 = 110592;
+constexpr size_t kTensor114 = 0;
+constexpr size_t kTensor115 = 110592;
+constexpr size_t kTensor116 = 55296;
+constexpr size_t kTensor117 = 0;
+constexpr size_t kTensor118 = 27648;
+constexpr size_t kTensor119 = 0;
+constexpr size_t kTensor120 = 55296;  // in place of t116
+constexpr size_t kTensor121 = 0;
+constexpr size_t kTensor122 = 27648;
+constexpr size_t kTensor123 = 34560;
+constexpr size_t kTensor124 = 0;
+constexpr size_t kTensor125 = 13824;
+constexpr size_t kTensor126 = 0;
+constexpr size_t kTensor127 = 34560;  // in place of t123
+constexpr size_t kTensor128 = 0;
+constexpr size_t kTensor129 = 13824;
+constexpr size_t kTensor130 = 0;
+constexpr size_t kTensor131 = 34560;  // in place of t123
+constexpr size_t kTensor132 = 0;
+constexpr size_t kTensor133 = 13824;
+constexpr size_t kTensor134 = 10368;
+constexpr size_t kTensor135 = 0;
+constexpr size_t kTensor136 = 5184;
+constexpr size_t kTensor137 = 0;
+constexpr size_t kTensor138 = 10368;  // in place of t134
+constexpr size_t kTensor139 = 0;
+constexpr size_t kTensor140 = 5184;
+constexpr size_t kTensor141 = 0;
+constexpr size_t kTensor142 = 10368;  // in place of t134
+constexpr size_t kTensor143 = 0;
+constexpr size_t kTensor144 = 5184;
+constexpr size_t kTensor145 = 0;
+constexpr size_t kTensor146 = 10368;  // in place of t134
+constexpr size_t kTensor147 = 0;
+constexpr size_t kTensor148 = 5184;
+constexpr size_t kTensor149 = 13824;
+constexpr size_t kTensor150 = 0;
+constexpr size_t kTensor151 = 6912;
+constexpr size_t kTensor152 = 0;
+constexpr size_t kTensor153 = 13824;  // in place of t149
+constexpr size_t kTensor154 = 0;
+constexpr size_t kTensor155 = 6912;
+constexpr size_t kTensor156 = 0;
+constexpr size_t kTensor157 = 13824;  // in place of t149
+constexpr size_t kTensor158 = 0;
+constexpr size_t kTensor159 = 6912;
+constexpr size_t kTensor160 = 6048;
+constexpr size_t kTensor161 = 0;
+constexpr size_t kTensor162 = 3024;
+constexpr size_t kTensor163 = 0;
+constexpr size_t kTensor164 = 6048;  // in place of t160
+constexpr size_t kTensor165 = 0;
+constexpr size_t kTensor166 = 3024;
+constexpr size_t kTensor167 = 0;
+constexpr size_t kTensor168 = 6048;  // in place of t160
+constexpr size_t kTensor169 = 0;
+constexpr size_t kTensor170 = 3024;
+constexpr size_t kTensor171 = 11520;
+constexpr size_t kTensor172 = 0;
+constexpr size_t kTensor173 = 11520;
+constexpr size_t kTensor174 = 0;
+constexpr size_t kTensor175 = 16;
+constexpr size_t kTensor176 = 0;
+constexpr size_t kTensor177 = 0;  // in place of t176
+
+// Offsets of the constant tensors inside the model image.
+constexpr size_t kConst2 = 433604;
+constexpr size_t kConst3 = 433528;
+constexpr size_t kConst4 = 433452;
+constexpr size_t kConst5 = 412960;
+constexpr size_t kConst6 = 407828;
+constexpr size_t kConst7 = 264456;
+constexpr size_t kConst8 = 263996;
+constexpr size_t kConst9 = 226352;
+constexpr size_t kConst10 = 224996;
+constexpr size_t kConst11 = 221960;
+constexpr size_t kConst12 = 220604;
+constexpr size_t kConst13 = 201776;
+constexpr size_t kConst14 = 201540;
+constexpr size_t kConst15 = 182712;
+constexpr size_t kConst16 = 181356;
+constexpr size_t kConst17 = 178320;
+constexpr size_t kConst18 = 176964;
+constexpr size_t kConst19 = 158136;
+constexpr size_t kConst20 = 157900;
+constexpr size_t kConst21 = 139072;
+constexpr size_t kConst22 = 137716;
+constexpr size_t kConst23 = 134680;
+constexpr size_t kConst24 = 133324;
+constexpr size_t kConst25 = 114496;
+constexpr size_t kConst26 = 114260;
+constexpr size_t kConst27 = 103496;
+constexpr size_t kConst28 = 102716;
+constexpr size_t kConst29 = 100976;
+constexpr size_t kConst30 = 100196;
+constexpr size_t kConst31 = 94040;
+constexpr size_t kConst32 = 93900;
+constexpr size_t kConst33 = 87744;
+constexpr size_t kConst34 = 86964;
+constexpr size_t kConst35 = 85224;
+constexpr size_t kConst36 = 84444;
+constexpr size_t kConst37 = 78288;
+constexpr size_t kConst38 = 78148;
+constexpr size_t kConst39 = 71992;
+constexpr size_t kConst40 = 71212;
+constexpr size_t kConst41 = 69472;
+constexpr size_t kConst42 = 68692;
+constexpr size_t kConst43 = 62536;
+constexpr size_t kConst44 = 62396;
+constexpr size_t kConst45 = 57776;
+constexpr size_t kConst46 = 57188;
+constexpr size_t kConst47 = 55880;
+constexpr size_t kConst48 = 55292;
+constexpr size_t kConst49 = 51824;
+constexpr size_t kConst50 = 51716;
+constexpr size_t kConst51 = 48248;
+constexpr size_t kConst52 = 47660;
+constexpr size_t kConst53 = 46352;
+constexpr size_t kConst54 = 45764;
+constexpr size_t kConst55 = 42296;
+constexpr size_t kConst56 = 42188;
+constexpr size_t kConst57 = 38720;
+constexpr size_t kConst58 = 38132;
+constexpr size_t kConst59 = 36824;
+constexpr size_t kConst60 = 36236;
+constexpr size_t kConst61 = 32768;
+constexpr size_t kConst62 = 32660;
+constexpr size_t kConst63 = 29192;
+constexpr size_t kConst64 = 28604;
+constexpr size_t kConst65 = 27296;
+constexpr size_t kConst66 = 26708;
+constexpr size_t kConst67 = 23240;
+constexpr size_t kConst68 = 23132;
+constexpr size_t kConst69 = 20816;
+constexpr size_t kConst70 = 20420;
+constexpr size_t kConst71 = 19544;
+constexpr size_t kConst72 = 19148;
+constexpr size_t kConst73 = 17600;
+constexpr size_t kConst74 = 17524;
+constexpr size_t kConst75 = 15976;
+constexpr size_t kConst76 = 15580;
+constexpr size_t kConst77 = 14704;
+constexpr size_t kConst78 = 14308;
+constexpr size_t kConst79 = 12760;
+constexpr size_t kConst80 = 12684;
+constexpr size_t kConst81 = 11136;
+constexpr size_t kConst82 = 10740;
+constexpr size_t kConst83 = 9864;
+constexpr size_t kConst84 = 9468;
+constexpr size_t kConst85 = 7920;
+constexpr size_t kConst86 = 7844;
+constexpr size_t kConst87 = 7064;
+constexpr size_t kConst88 = 6860;
+constexpr size_t kConst89 = 6416;
+constexpr size_t kConst90 = 6212;
+constexpr size_t kConst91 = 5816;
+constexpr size_t kConst92 = 5772;
+constexpr size_t kConst93 = 5376;
+constexpr size_t kConst94 = 5172;
+constexpr size_t kConst95 = 4728;
+constexpr size_t kConst96 = 4524;
+constexpr size_t kConst97 = 4128;
+constexpr size_t kConst98 = 4084;
+constexpr size_t kConst99 = 3688;
+constexpr size_t kConst100 = 3484;
+constexpr size_t kConst101 = 3040;
+constexpr size_t kConst102 = 2836;
+constexpr size_t kConst103 = 2440;
+constexpr size_t kConst104 = 2396;
+constexpr size_t kConst105 = 2256;
+constexpr size_t kConst106 = 2180;
+constexpr size_t kConst107 = 2024;
+constexpr size_t kConst108 = 1948;
+constexpr size_t kConst109 = 1504;
+
+inline int8_t* Act(uint8_t* arena, size_t offset) {
+  return reinterpret_cast<int8_t*>(arena + offset);
+}
+inline const int8_t* Weights(const uint8_t* model, size_t offset) {
+  return reinterpret_cast<const int8_t*>(model + offset);
+}
+inline const int32_t* Bias(const uint8_t* model, size_t offset) {
+  return reinterpret_cast<const int32_t*>(model + offset);
+}
+
+constexpr int32_t kConvMult1[16] = {
+    2006215247, 1834356467, 1874394186, 1624424342, 1891882059, 1862875892, 1419457592, 1328099381,
+    1882933664, 1940390647, 1429039587, 1960235598, 1766094577, 2029882448, 1212717872, 1523108071,
+};
+
+constexpr int32_t kConvShift1[16] = {
+    -24, -8, -8, -10, -12, -8, -10, -7,
+    -14, -10, -9, -12, -24, -10, -10, -27,
+};
+
+constexpr data_dims_t kConvIn1 = {96, 96, 3, 1};
+constexpr data_dims_t kConvFilter1 = {3, 3, 0, 0};
+constexpr data_dims_t kConvOut1 = {48, 48, 16, 1};
+
+constexpr conv_params_t kConvParams1 = {128, -128, {2, 2}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult2[16] = {
+    1364559872, 1310965632, 2019778944, 1493542656, 1770996736, 1910957952, 1134638464, 1246530176,
+    1437625600, 1395109760, 1130767488, 1117576064, 2123966336, 1385190272, 1110929536, 1426514688,
+};
+
+constexpr int32_t kDwShift2[16] = {
+    -3, -7, -7, -6, -7, -7, -5, -6,
+    -9, -6, -6, -4, -5, -6, -6, -2,
+};
+
+constexpr data_dims_t kDwIn2 = {48, 48, 16, 1};
+constexpr data_dims_t kDwFilter2 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut2 = {48, 48, 16, 1};
+
+constexpr dw_conv_params_t kDwParams2 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult3[8] = {
+    1354131945, 1385033203, 1656300240, 1540950327, 1743297684, 1552819160, 1889922813, 1363949270,
+};
+
+constexpr int32_t kConvShift3[8] = {
+    -7, -7, -7, -8, -8, -7, -8, -8,
+};
+
+constexpr data_dims_t kConvIn3 = {48, 48, 16, 1};
+constexpr data_dims_t kConvFilter3 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut3 = {48, 48, 8, 1};
+
+constexpr conv_params_t kConvParams3 = {128, 10, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult4[48] = {
+    1099194976, 2053192606, 1476969706, 1369064423, 1240575018, 1486228015, 1656366597, 1378932671,
+    1719479639, 1400026996, 1353788844, 1117524587, 1685967275, 1201360990, 1094131845, 1524487768,
+    1201360990, 1839697669, 1891290709, 1375476982, 1313668106, 1284069596, 1424470904, 1780419613,
+    1266560103, 1494299239, 1239631178, 1229108001, 1310090456, 1840824586, 1439545113, 1579866333,
+    1829742287, 1327392345, 2010388597, 1239844745, 2129540555, 1689359138, 1547082616, 1189819577,
+    1387147132, 1681201863, 1089043915, 1263787801, 1679076901, 1250263442, 1230908006, 1651719893,
+};
+
+constexpr int32_t kConvShift4[48] = {
+    -5, -6, -6, -6, -6, -6, -6, -4,
+    -6, -3, -5, -3, -7, -23, -4, -7,
+    -23, -2, -6, -6, -6, -2, -6, -4,
+    -4, -5, -3, -3, -6, -4, -4, -7,
+    -7, -1, -6, -5, -3, -6, -3, -6,
+    -4, -7, -5, -1, -6, -5, -6, -7,
+};
+
+constexpr data_dims_t kConvIn4 = {48, 48, 8, 1};
+constexpr data_dims_t kConvFilter4 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut4 = {48, 48, 48, 1};
+
+constexpr conv_params_t kConvParams4 = {-10, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult5[48] = {
+    1264078208, 1694855808, 1988390528, 1389390464, 1566645760, 1870535424, 1473426688, 1337737344,
+    2042066432, 1490528256, 1857536256, 1406131968, 2059891200, 2023072128, 1556984576, 1298466816,
+    2006741504, 1958005376, 1094567552, 1958198016, 1341126144, 1719416960, 1536684032, 1616721024,
+    2070707584, 2050279168, 1566298112, 1112153984, 1706005248, 1352819200, 1161480576, 2132496256,
+    1234963456, 2028460032, 2026157312, 1275645184, 1613591680, 1244171136, 1580772096, 1115416832,
+    1681648256, 1345276800, 1358971136, 2072957312, 1781583360, 1669129984, 1329668992, 1467074176,
+};
+
+constexpr int32_t kDwShift5[48] = {
+    -7, -8, -7, -7, -7, -7, -7, -8,
+    -8, -9, -8, -9, -7, -2, -8, -6,
+    -3, -10, -7, -7, -7, -7, -7, -9,
+    -8, -8, -9, -8, -6, -8, -8, -7,
+    -6, -11, -8, -6, -10, -5, -9, -7,
+    -8, -6, -7, -11, -7, -8, -6, -7,
+};
+
+constexpr data_dims_t kDwIn5 = {48, 48, 48, 1};
+constexpr data_dims_t kDwFilter5 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut5 = {24, 24, 48, 1};
+
+constexpr dw_conv_params_t kDwParams5 = {128, -128, 1, {2, 2}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult6[8] = {
+    1262462871, 1284171498, 1291964300, 1242884661, 1101518225, 1112650327, 1649394869, 1479816102,
+};
+
+constexpr int32_t kConvShift6[8] = {
+    -7, -8, -7, -7, -7, -7, -8, -8,
+};
+
+constexpr data_dims_t kConvIn6 = {24, 24, 48, 1};
+constexpr data_dims_t kConvFilter6 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut6 = {24, 24, 8, 1};
+
+constexpr conv_params_t kConvParams6 = {128, 27, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult7[48] = {
+    1275531876, 1262059755, 1927323287, 1684859185, 1406669933, 2089774111, 1912050778, 1166959662,
+    1259762508, 1205329338, 1393889077, 1976043547, 1094411565, 1087432884, 1153918758, 1824050966,
+    1225453386, 1431957752, 1968617189, 1700708523, 1136254704, 1489176509, 1893904774, 1974646300,
+    1366390660, 1859202095, 1278935632, 1570798479, 1622316814, 1989551490, 1098551799, 1619936403,
+    1886630998, 1981313815, 1451810233, 1134066181, 1971745310, 1197910628, 1828309702, 1245864978,
+    1259680021, 1095225593, 1769506070, 1648343533, 1106771369, 1967861444, 1620800775, 2070873330,
+};
+
+constexpr int32_t kConvShift7[48] = {
+    -8, -6, -7, -6, -4, -6, -5, -4,
+    -5, -5, -5, -6, -5, -5, -5, -4,
+    -6, -6, -4, -8, -6, -6, -6, -5,
+    -6, -7, -7, -6, -5, -5, -5, -6,
+    -5, -7, -6, -6, -6, -6, -8, -3,
+    -5, -4, -6, -6, -6, -6, -5, -5,
+};
+
+constexpr data_dims_t kConvIn7 = {24, 24, 8, 1};
+constexpr data_dims_t kConvFilter7 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut7 = {24, 24, 48, 1};
+
+constexpr conv_params_t kConvParams7 = {-27, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult8[48] = {
+    1856558464, 1524246912, 1103133312, 1230023296, 1383279872, 1136912384, 1747340288, 1637822080,
+    1344359680, 1535650688, 1845586176, 1822376832, 1420812800, 1334265728, 2115762176, 1121823104,
+    1221049344, 1310811648, 1549704448, 1865237632, 1116659072, 1133190528, 1733479680, 1642032896,
+    1075732608, 1437755648, 1804397312, 1114466304, 2092892416, 1122780672, 1228685184, 2054206464,
+    2091134080, 1922201856, 2024358400, 1668123008, 1932221056, 1794942592, 1553159808, 1925754368,
+    1470034432, 1212523776, 1517477120, 1553329152, 1797870336, 1182920192, 1173536384, 1116166400,
+};
+
+constexpr int32_t kDwShift8[48] = {
+    -6, -6, -6, -6, -7, -7, -5, -7,
+    -7, -7, -8, -7, -6, -6, -8, -6,
+    -6, -6, -8, -7, -6, -6, -7, -7,
+    -6, -7, -5, -7, -7, -4, -7, -7,
+    -5, -7, -7, -7, -6, -7, -6, -10,
+    -7, -8, -7, -7, -7, -7, -6, -7,
+};
+
+constexpr data_dims_t kDwIn8 = {24, 24, 48, 1};
+constexpr data_dims_t kDwFilter8 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut8 = {24, 24, 48, 1};
+
+constexpr dw_conv_params_t kDwParams8 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult9[8] = {
+    2080288507, 1918750676, 1857702841, 1899426055, 1903334998, 1535501168, 1851482090, 1270609000,
+};
+
+constexpr int32_t kConvShift9[8] = {
+    -10, -9, -8, -8, -9, -9, -9, -8,
+};
+
+constexpr data_dims_t kConvIn9 = {24, 24, 48, 1};
+constexpr data_dims_t kConvFilter9 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut9 = {24, 24, 8, 1};
+
+constexpr conv_params_t kConvParams9 = {128, -20, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult11[48] = {
+    1639472168, 1839709802, 1219882288, 1278892420, 2093421715, 1155049404, 2057127962, 2063424128,
+    1640211159, 1760031474, 2073796027, 1316895531, 1758386504, 1524849433, 1267970674, 1894432487,
+    1203146790, 1656380471, 2092868546, 1266074527, 1506823575, 2087453436, 1650217786, 1425574218,
+    1273907107, 1310669982, 1755648348, 1711170727, 1820062374, 1947405106, 1240287676, 1845798131,
+    1614232256, 1143670791, 1796823842, 1159617243, 1667588148, 1494169349, 2094217477, 1569796037,
+    1511652976, 1077577317, 1438086517, 1168551039, 2015345572, 1672177034, 1416458339, 1281161870,
+};
+
+constexpr int32_t kConvShift11[48] = {
+    -6, -5, -6, -6, -7, -6, -6, -7,
+    -6, -5, -5, -6, -6, -5, -7, -6,
+    -6, -6, -7, -6, -6, -7, -6, -7,
+    -6, -6, -4, -6, -7, -6, -6, -7,
+    -5, -6, -5, -5, -5, -6, -7, -6,
+    -7, -6, -6, -6, -4, -6, -6, -4,
+};
+
+constexpr data_dims_t kConvIn11 = {24, 24, 8, 1};
+constexpr data_dims_t kConvFilter11 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut11 = {24, 24, 48, 1};
+
+constexpr conv_params_t kConvParams11 = {6, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult12[48] = {
+    1843222784, 1684658560, 2000230400, 1323017856, 1642148736, 1558645760, 1832969728, 1418227328,
+    1887818368, 1898164736, 1166640896, 1156259968, 1983147008, 1785938816, 1865047296, 1143105024,
+    2044874112, 1823715200, 1550886400, 1626725632, 2072320896, 1085296768, 1238596352, 1485531392,
+    1181469952, 1248484352, 2056275712, 1487283712, 1384351232, 1091100288, 1295254912, 1647913600,
+    1204004224, 1601766272, 1339173120, 1286421888, 1188287232, 1095018240, 1478893056, 1971833472,
+    1220533888, 1163623424, 2049565184, 2124025344, 1474294016, 1928019712, 1207851648, 1485626752,
+};
+
+constexpr int32_t kDwShift12[48] = {
+    -8, -9, -7, -8, -7, -8, -7, -7,
+    -8, -9, -8, -7, -9, -9, -7, -6,
+    -7, -8, -7, -7, -8, -6, -7, -7,
+    -7, -7, -10, -8, -7, -7, -7, -7,
+    -8, -7, -9, -8, -7, -7, -7, -8,
+    -7, -7, -8, -8, -9, -7, -7, -9,
+};
+
+constexpr data_dims_t kDwIn12 = {24, 24, 48, 1};
+constexpr data_dims_t kDwFilter12 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut12 = {12, 12, 48, 1};
+
+constexpr dw_conv_params_t kDwParams12 = {128, -128, 1, {2, 2}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult13[16] = {
+    1600028280, 1854013244, 1223819296, 1110262546, 2021020198, 1116606684, 1278137542, 1299206139,
+    1222058338, 1354620360, 1948138362, 1344052250, 2041132890, 1401902058, 1305909770, 1385273829,
+};
+
+constexpr int32_t kConvShift13[16] = {
+    -8, -8, -7, -7, -8, -7, -7, -8,
+    -8, -8, -8, -8, -8, -7, -8, -8,
+};
+
+constexpr data_dims_t kConvIn13 = {12, 12, 48, 1};
+constexpr data_dims_t kConvFilter13 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut13 = {12, 12, 16, 1};
+
+constexpr conv_params_t kConvParams13 = {128, 4, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult14[96] = {
+    1407326600, 1290083813, 1506807680, 1837987729, 1366116769, 1588612890, 1961414628, 1373703019,
+    1617198547, 1869249989, 1925976098, 1293651607, 1970790101, 1213508556, 2039637752, 1517195347,
+    1092908192, 1773188330, 1137235847, 1458000513, 1762073264, 1616694443, 1615082522, 1123981716,
+    1999072083, 1844304277, 1200761907, 2016978005, 1466143789, 1949648904, 2108275100, 1893329716,
+    1169395015, 1496634302, 2096264946, 1204469932, 1107598241, 1806011754, 1549885729, 1819178923,
+    1599662821, 1457286971, 1657358681, 1682918499, 1749700362, 1367247366, 2036043367, 1094011938,
+    1619801700, 1238146782, 2004852132, 1113593877, 1485858423, 1127678134, 1447904222, 1120093617,
+    1870368720, 1120485381, 1095049249, 1979950940, 1293690671, 1824144263, 1759371369, 2028751698,
+    1711660585, 1209422799, 1468921559, 2006071510, 1534742852, 1439076594, 1869364495, 1780943394,
+    1186519575, 1880911774, 1148964067, 1964270179, 1888014794, 1580099937, 1259393478, 1156981490,
+    1768761913, 1704826940, 1682301968, 1939908258, 1090369741, 1376694817, 1172649865, 1244522488,
+    1356036416, 1897392173, 1598721653, 2057819806, 1400803387, 1222635875, 1462636193, 1095349806,
+};
+
+constexpr int32_t kConvShift14[96] = {
+    -7, -6, -7, -5, -6, -7, -7, -5,
+    -6, -8, -7, -5, -6, -7, -7, -6,
+    -6, -7, -6, -5, -6, -7, -6, -6,
+    -7, -6, -6, -7, -5, -6, -7, -7,
+    -7, -5, -7, -5, -7, -6, -5, -7,
+    -5, -7, -7, -7, -6, -6, -7, -6,
+    -6, -6, -6, -4, -7, -6, -6, -7,
+    -6, -6, -6, -6, -7, -7, -6, -6,
+    -7, -6, -6, -6, -7, -7, -7, -6,
+    -6, -6, -6, -6, -8, -6, -7, -5,
+    -7, -6, -7, -6, -6, -6, -6, -6,
+    -7, -6, -7, -6, -7, -7, -6, -6,
+};
+
+constexpr data_dims_t kConvIn14 = {12, 12, 16, 1};
+constexpr data_dims_t kConvFilter14 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut14 = {12, 12, 96, 1};
+
+constexpr conv_params_t kConvParams14 = {-4, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult15[96] = {
+    2109828352, 1345399680, 1618002560, 1912251904, 2080322816, 1861657344, 1702051200, 2005877248,
+    1663537408, 1194976512, 1865869056, 2014937856, 2136366848, 1151050880, 1116204544, 1701026176,
+    1195051776, 1729428864, 1349144576, 1833130496, 1230243200, 1092945408, 1447286656, 1103079296,
+    1107018368, 1390826368, 1850525056, 2014006528, 1472395392, 1242630400, 1730960512, 2038170880,
+    1475821056, 1854038144, 1241208320, 2054196352, 1147342336, 1419248128, 2002820096, 1606569088,
+    1412162048, 1942834688, 1959165568, 1682860800, 1179613440, 1085543680, 1224549888, 1584876544,
+    1080695424, 1094582400, 1235547904, 1808053760, 1383960192, 1650985344, 1675095936, 1257249280,
+    1769341056, 1240585728, 1310498304, 1893202048, 1744306304, 1631760128, 1580030080, 1583058048,
+    1132778880, 2069316992, 1919174400, 1535784704, 1915097472, 1416328448, 1298990080, 1233301376,
+    1275479296, 1487465472, 1908124288, 1558124160, 1567639808, 1237091072, 1559744256, 1467440512,
+    1879088384, 1552967936, 1259374080, 1885077120, 1515933440, 1084334208, 1587207936, 1161927296,
+    1117604736, 1259531008, 1177570048, 1414113024, 1706121856, 1262044032, 1957131520, 1799975040,
+};
+
+constexpr int32_t kDwShift15[96] = {
+    -7, -7, -6, -9, -7, -7, -6, -8,
+    -7, -5, -7, -6, -8, -5, -6, -7,
+    -7, -6, -8, -6, -8, -6, -7, -5,
+    -6, -6, -7, -7, -7, -7, -7, -7,
+    -7, -7, -6, -7, -5, -7, -9, -7,
+    -6, -6, -6, -7, -6, -8, -6, -6,
+    -7, -6, -6, -7, -6, -6, -6, -5,
+    -6, -6, -7, -8, -6, -7, -6, -7,
+    -6, -7, -8, -8, -6, -6, -6, -7,
+    -7, -7, -7, -6, -5, -8, -6, -6,
+    -7, -6, -7, -7, -7, -7, -7, -6,
+    -6, -7, -6, -7, -7, -5, -3, -8,
+};
+
+constexpr data_dims_t kDwIn15 = {12, 12, 96, 1};
+constexpr data_dims_t kDwFilter15 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut15 = {12, 12, 96, 1};
+
+constexpr dw_conv_params_t kDwParams15 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult16[16] = {
+    1821254374, 1111866899, 1132809231, 1908118168, 1545158879, 1334296635, 1275816416, 1541122650,
+    1655469804, 1073853868, 1508577492, 1384237866, 1929940651, 1965453499, 1890171757, 1215080332,
+};
+
+constexpr int32_t kConvShift16[16] = {
+    -9, -9, -9, -10, -9, -9, -9, -9,
+    -10, -9, -9, -8, -9, -9, -9, -9,
+};
+
+constexpr data_dims_t kConvIn16 = {12, 12, 96, 1};
+constexpr data_dims_t kConvFilter16 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut16 = {12, 12, 16, 1};
+
+constexpr conv_params_t kConvParams16 = {128, 5, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult18[96] = {
+    1147668016, 2130833481, 1434489716, 1561831051, 1900024784, 1556954696, 1189756551, 1556263391,
+    1436128978, 1540104140, 1246707427, 2000791360, 1540092591, 2011986078, 1412190016, 1901354232,
+    1803823283, 1278159092, 1600526578, 1930849214, 1594164035, 1463919618, 1656608693, 1564851458,
+    1395707570, 1203832260, 1701042553, 1886750099, 1202461747, 1874984151, 1103239839, 1416694595,
+    1097550178, 1710915889, 2019826743, 1135671266, 1893584512, 1116369609, 1246010439, 1503996107,
+    1553395507, 1679414085, 1355715318, 1544305138, 1258929479, 1840039568, 1414255043, 1774645632,
+    1376914171, 1880374907, 1175887171, 2031579858, 1492442262, 1154941210, 1075282835, 1607707102,
+    1907371215, 1217667359, 1744223960, 1703998614, 1509695759, 1683790706, 1087971165, 1792883199,
+    1114610271, 1101267207, 1170572127, 2093920390, 1143253357, 1151339123, 1081343722, 1583524965,
+    2114374866, 1747131074, 1648483146, 1316159555, 1205227612, 1648385069, 1534472133, 1709878105,
+    1354042966, 1308005409, 1521327882, 1244851021, 1745843973, 1505684499, 2146017827, 1131352667,
+    1412780862, 2071689528, 2068294045, 1810102232, 1084990356, 1919405729, 1142188808, 1457373845,
+};
+
+constexpr int32_t kConvShift18[96] = {
+    -6, -7, -7, -8, -7, -6, -5, -6,
+    -8, -6, -6, -7, -7, -7, -8, -6,
+    -7, -7, -7, -7, -6, -5, -7, -5,
+    -5, -6, -7, -7, -6, -8, -8, -7,
+    -6, -6, -7, -6, -6, -5, -7, -5,
+    -7, -7, -8, -6, -7, -7, -6, -7,
+    -8, -7, -6, -7, -6, -6, -5, -7,
+    -7, -7, -6, -7, -6, -8, -6, -7,
+    -6, -6, -6, -7, -6, -6, -6, -7,
+    -8, -7, -6, -6, -6, -6, -6, -6,
+    -7, -7, -7, -7, -6, -6, -7, -8,
+    -7, -7, -7, -6, -6, -7, -6, -7,
+};
+
+constexpr data_dims_t kConvIn18 = {12, 12, 16, 1};
+constexpr data_dims_t kConvFilter18 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut18 = {12, 12, 96, 1};
+
+constexpr conv_params_t kConvParams18 = {-6, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult19[96] = {
+    1508292096, 2124605440, 1370208640, 1245587456, 1351594752, 1913472256, 1261540736, 1133468288,
+    1399426048, 2002104320, 1621295872, 1396729600, 1505734528, 1190624640, 1146225024, 1948808704,
+    1234353920, 2016597632, 1117315456, 1801795968, 1903035776, 1098907648, 1668439808, 1889413504,
+    1705514240, 1176177280, 2114097280, 1157016064, 1706189824, 1362648576, 1085562752, 1391024768,
+    1454903040, 2058552960, 1299406976, 1324456704, 1133609088, 1417363968, 1429093248, 1338316800,
+    1272571392, 1167336448, 1987234816, 1165354752, 2051405824, 1121745920, 1361635456, 1612490112,
+    2009993856, 1189745664, 1221612416, 1840417536, 2144213888, 2029388544, 1268562688, 1448073216,
+    1671186432, 1178814208, 2019134336, 2072313344, 1940061696, 1930395136, 1399829120, 1838024320,
+    1552361856, 1663423872, 1596884096, 1618511232, 1093040512, 1208556032, 1171742464, 1179709056,
+    1666668288, 1657073280, 1113684864, 1813324544, 1439137280, 1964739200, 1345910656, 1082225024,
+    1450944384, 1348959488, 2047544448, 1694775040, 1348861440, 1417477760, 1816952064, 1404209536,
+    1428917760, 1438931968, 1104294400, 1501941632, 1833771776, 1271345920, 2108828544, 1594864128,
+};
+
+constexpr int32_t kDwShift19[96] = {
+    -7, -8, -7, -6, -6, -7, -8, -7,
+    -6, -7, -6, -7, -6, -6, -5, -7,
+    -6, -7, -6, -8, -8, -8, -7, -8,
+    -8, -7, -7, -6, -8, -5, -5, -6,
+    -7, -7, -6, -5, -5, -6, -6, -7,
+    -6, -6, -6, -7, -6, -7, -7, -6,
+    -5, -7, -5, -7, -7, -7, -6, -7,
+    -7, -5, -9, -7, -6, -6, -7, -7,
+    -7, -7, -6, -6, -6, -7, -6, -7,
+    -6, -7, -5, -6, -7, -8, -8, -6,
+    -6, -6, -7, -6, -8, -7, -8, -5,
+    -6, -7, -5, -9, -7, -7, -6, -6,
+};
+
+constexpr data_dims_t kDwIn19 = {12, 12, 96, 1};
+constexpr data_dims_t kDwFilter19 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut19 = {12, 12, 96, 1};
+
+constexpr dw_conv_params_t kDwParams19 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult20[16] = {
+    1422570910, 1445715791, 1603191819, 1494006965, 1430318689, 1379909567, 1261595397, 1907960368,
+    1139287665, 1857812702, 1257809656, 2010852187, 1537404271, 1623203405, 1778605262, 1925420885,
+};
+
+constexpr int32_t kConvShift20[16] = {
+    -8, -9, -10, -10, -9, -9, -9, -10,
+    -9, -10, -8, -9, -9, -10, -9, -9,
+};
+
+constexpr data_dims_t kConvIn20 = {12, 12, 96, 1};
+constexpr data_dims_t kConvFilter20 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut20 = {12, 12, 16, 1};
+
+constexpr conv_params_t kConvParams20 = {128, 11, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult22[96] = {
+    1428653052, 2071675049, 1339007950, 1615059698, 1739415747, 1647750332, 1727802809, 1723939506,
+    1919330916, 2081536566, 1883940389, 1441466137, 1383107880, 1591329593, 1075715335, 1771232041,
+    1284270751, 1312188212, 1226487674, 1336188855, 1309450266, 1803879140, 1525487193, 1828591931,
+    1935533782, 1181685137, 1797664890, 1783567656, 1202134685, 1987804231, 2106084535, 1526194078,
+    1079046336, 1275237406, 1599872637, 1220675776, 1723301489, 2112736448, 1792756613, 1880014908,
+    1349051507, 1205184950, 1512537029, 2057745270, 1125841003, 2015920839, 1227948270, 1390528527,
+    1445861084, 1173273030, 1222095139, 1750585100, 1399496733, 1175478564, 1686547966, 1726815845,
+    1117975455, 1263734569, 1954073557, 1735241441, 2073324155, 1128937984, 1077360712, 1163243948,
+    1334599734, 1274555853, 2007745055, 2147130142, 1226266046, 2004614627, 1241094729, 1242989808,
+    1083495895, 1663441731, 1350207461, 1950120660, 1466731189, 2078823076, 1140622422, 1839776746,
+    1433574489, 1745178186, 1946269748, 1632838414, 1221985806, 1525591372, 1264063995, 1871702704,
+    1189554743, 1236831487, 1421218148, 1289039428, 1604661163, 1327056374, 1891397226, 2018168483,
+};
+
+constexpr int32_t kConvShift22[96] = {
+    -6, -6, -6, -6, -6, -6, -7, -6,
+    -7, -6, -7, -6, -6, -4, -6, -7,
+    -7, -6, -5, -6, -7, -8, -7, -8,
+    -7, -5, -5, -6, -6, -6, -7, -6,
+    -6, -6, -6, -6, -7, -7, -6, -6,
+    -7, -5, -6, -7, -5, -7, -6, -6,
+    -6, -6, -6, -7, -5, -6, -6, -6,
+    -5, -6, -6, -7, -5, -5, -6, -5,
+    -5, -6, -8, -7, -5, -6, -6, -6,
+    -4, -6, -6, -7, -6, -8, -7, -7,
+    -7, -7, -7, -7, -7, -6, -5, -7,
+    -7, -5, -6, -6, -6, -5, -6, -7,
+};
+
+constexpr data_dims_t kConvIn22 = {12, 12, 16, 1};
+constexpr data_dims_t kConvFilter22 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut22 = {12, 12, 96, 1};
+
+constexpr conv_params_t kConvParams22 = {-11, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult23[96] = {
+    1360114048, 1766885248, 1605970176, 2072409984, 2010906112, 1807904128, 1262433408, 2009681024,
+    1450399104, 1528847488, 1483218816, 1586777856, 2028459136, 1377399808, 1146389888, 1363705088,
+    1540746240, 1196806656, 1228927872, 1822771072, 1536850688, 2083546368, 1760891904, 2074925312,
+    1225580416, 1886531840, 1840455040, 1156742272, 1534056832, 1973797376, 1348580864, 2021594368,
+    1753254528, 1308320896, 1419472384, 1360626944, 1994133120, 1610285184, 1225038848, 1751130752,
+    1547377920, 2106935680, 1307331584, 1805458176, 1338760448, 1337716224, 1461312128, 1372060160,
+    1174579584, 1362115968, 1514667648, 2070894208, 1077948800, 1103656320, 1894124800, 2008402304,
+    1331433984, 1468519808, 1900921600, 1454035200, 1760165888, 1283308416, 2060316544, 1448915840,
+    1155912192, 1341196416, 1308988032, 1363003648, 1393240704, 1970231296, 1498270080, 1518428928,
+    2139450624, 1312685312, 1512280832, 1117210752, 1206089472, 1310911360, 1085047424, 1087956992,
+    1460291456, 1802867840, 1713004928, 1434707968, 2033150976, 1880762624, 1832316544, 2028488448,
+    1426242176, 1185794944, 1257451776, 1084790656, 1852158464, 1427381504, 1753233792, 1704150400,
+};
+
+constexpr int32_t kDwShift23[96] = {
+    -8, -9, -8, -9, -8, -8, -8, -9,
+    -8, -8, -7, -8, -8, -9, -8, -7,
+    -8, -8, -7, -8, -7, -7, -7, -7,
+    -7, -9, -10, -8, -8, -7, -8, -8,
+    -8, -8, -8, -8, -8, -7, -8, -9,
+    -7, -9, -8, -8, -9, -7, -8, -8,
+    -8, -7, -7, -8, -8, -7, -9, -9,
+    -8, -8, -8, -8, -9, -8, -8, -8,
+    -7, -8, -6, -8, -8, -9, -8, -8,
+    -10, -8, -8, -7, -7, -6, -6, -7,
+    -7, -8, -8, -8, -7, -9, -9, -8,
+    -7, -9, -8, -6, -8, -8, -8, -8,
+};
+
+constexpr data_dims_t kDwIn23 = {12, 12, 96, 1};
+constexpr data_dims_t kDwFilter23 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut23 = {6, 6, 96, 1};
+
+constexpr dw_conv_params_t kDwParams23 = {128, -128, 1, {2, 2}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult24[24] = {
+    1806838756, 1748351877, 1166505081, 1191276975, 1966210828, 1458450875, 2000703710, 1299018842,
+    1093972745, 1146430897, 1730738836, 2026184126, 2040324826, 1476810594, 1147665780, 1990149325,
+    2115970634, 1834545727, 1333081795, 1079477932, 1272548042, 1733385411, 1778479457, 1288756627,
+};
+
+constexpr int32_t kConvShift24[24] = {
+    -9, -9, -8, -8, -9, -9, -9, -8,
+    -8, -9, -9, -9, -9, -9, -8, -9,
+    -9, -9, -9, -8, -8, -9, -9, -8,
+};
+
+constexpr data_dims_t kConvIn24 = {6, 6, 96, 1};
+constexpr data_dims_t kConvFilter24 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut24 = {6, 6, 24, 1};
+
+constexpr conv_params_t kConvParams24 = {128, -6, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult25[144] = {
+    1714927692, 1302978212, 2142260885, 1501704966, 1214701930, 1695199171, 1788970274, 1384206869,
+    1477978964, 1882973313, 1424861122, 1253549703, 2089048813, 1234665033, 2013422348, 1087150205,
+    1642050745, 1787151644, 1764323799, 2101754589, 1494593613, 1637370844, 1114551902, 1162773529,
+    1646530284, 1915406949, 1793715970, 1644836963, 2079007417, 2042338743, 1733377171, 1900643663,
+    1157280278, 1114003552, 2093861296, 1720141890, 1872106335, 1583856411, 1979418551, 1289396183,
+    1515014472, 2053480475, 1708652005, 1752771094, 1918841533, 1601686125, 1539910242, 1788812729,
+    1527490957, 1165094633, 1520974903, 1755028470, 1524641919, 1469645603, 1190344012, 2043731687,
+    1215152578, 1531341638, 1675806901, 1643688190, 1622220060, 1145190217, 1838320258, 1654757018,
+    1535740834, 1392376734, 1954825803, 1564936777, 1379735596, 1431983220, 1305807081, 1083782409,
+    1367052220, 1413382974, 1706695999, 1762138170, 1277133947, 1228094590, 1832611106, 1502425408,
+    1116467571, 1171444876, 1920814401, 1384547997, 1182213823, 1626175716, 1854421107, 1255967682,
+    1788838187, 1122726395, 1611484507, 1377244713, 1474040666, 1480826679, 2108565235, 1487978369,
+    2014626172, 1576028253, 1745333409, 1757845436, 1754607082, 1207574376, 1290976098, 2108402399,
+    1469738675, 1091904745, 1191593958, 1287331152, 1134410360, 2132135013, 1831280817, 1311197836,
+    1152365630, 1372625731, 1841135075, 1405077386, 1450895747, 1610671984, 1953271181, 1220663104,
+    1251762814, 1940503412, 1129696074, 1155526782, 2047189414, 1424501562, 1780402992, 1959326833,
+    1635574697, 1175543282, 1341561150, 1505839493, 1357322443, 1131906004, 1382557687, 1583917247,
+    1482837240, 1605674844, 1857449181, 1908870562, 1084858444, 1181921629, 1822187007, 1691311955,
+};
+
+constexpr int32_t kConvShift25[144] = {
+    -7, -5, -8, -7, -6, -7, -7, -6,
+    -8, -7, -7, -6, -7, -7, -6, -7,
+    -7, -7, -7, -7, -7, -6, -6, -6,
+    -7, -7, -8, -7, -7, -8, -6, -6,
+    -6, -7, -7, -7, -8, -7, -8, -7,
+    -7, -7, -7, -8, -6, -7, -7, -8,
+    -7, -6, -7, -7, -7, -6, -7, -6,
+    -6, -8, -8, -8, -5, -6, -7, -7,
+    -7, -7, -7, -7, -8, -6, -7, -5,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -6, -6, -7, -6, -7, -7, -7, -7,
+    -6, -6, -5, -6, -7, -7, -8, -9,
+    -7, -7, -7, -7, -7, -6, -7, -7,
+    -7, -6, -5, -7, -6, -7, -6, -6,
+    -6, -6, -7, -8, -7, -7, -7, -6,
+    -7, -6, -6, -6, -7, -7, -7, -6,
+    -5, -6, -6, -7, -7, -6, -7, -7,
+    -7, -6, -7, -6, -7, -6, -8, -7,
+};
+
+constexpr data_dims_t kConvIn25 = {6, 6, 24, 1};
+constexpr data_dims_t kConvFilter25 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut25 = {6, 6, 144, 1};
+
+constexpr conv_params_t kConvParams25 = {6, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult26[144] = {
+    1340073344, 1411622400, 2129566208, 1784035968, 2053485312, 2122310272, 1336193536, 1274477056,
+    1126275712, 1281239808, 1779049984, 2047549056, 1212085504, 1630324864, 1713690752, 1516021888,
+    1973319936, 1114704896, 1270155136, 1773651840, 1485353856, 1519042176, 1971356032, 2048409088,
+    1936311936, 1224308352, 1406129024, 1106189952, 1897962496, 1108333440, 1470489728, 1528200832,
+    1121734272, 1140298752, 2043187968, 1172778880, 1621048320, 1593988224, 1678935936, 1637203968,
+    1897945472, 1257453952, 1468720640, 1727465472, 1076253824, 1932208384, 1184869376, 1305802496,
+    1118467328, 1399891840, 1205518464, 1880496000, 1689769216, 1762169728, 1702263424, 1401090048,
+    1699198336, 1909427712, 1091864576, 1214812544, 1088198912, 1383724544, 1226401792, 1163132288,
+    1259105152, 1350380928, 1460694528, 1234299520, 1127998080, 1160628736, 1096845696, 1447724672,
+    1696792448, 1145169408, 1767544704, 1307580032, 1338228352, 1419003264, 1450632960, 1177076864,
+    1082518016, 1077245696, 1244457216, 1076863104, 1528487680, 1328365952, 1202361856, 1553609856,
+    1336125696, 1528914944, 1574481792, 1841626496, 1427815168, 1237652224, 1128771584, 1869083520,
+    1086478464, 1130469632, 1440474240, 2145821184, 1478807680, 1837885312, 1149650304, 1134593664,
+    1142259456, 1297894656, 1590246144, 2036074496, 1816358400, 1546281600, 1561000064, 1545285760,
+    1238719744, 2134399872, 1866361472, 1857969024, 1472926464, 2036894976, 2097013504, 1381789312,
+    1342617856, 1841785856, 1236447616, 1262610432, 1358555392, 1164742400, 1308445312, 1808503424,
+    1376388608, 1273117184, 1196536448, 1612050688, 1096392320, 1718790016, 1354710912, 1169444096,
+    1652605440, 1521182720, 1335525376, 1124722816, 1164602496, 1311548672, 1767393024, 1763786496,
+};
+
+constexpr int32_t kDwShift26[144] = {
+    -6, -8, -6, -7, -6, -7, -6, -9,
+    -5, -5, -6, -7, -5, -5, -7, -6,
+    -6, -6, -6, -6, -7, -6, -6, -8,
+    -7, -6, -5, -6, -6, -6, -6, -5,
+    -5, -5, -7, -5, -6, -6, -6, -6,
+    -7, -6, -6, -6, -5, -7, -6, -6,
+    -5, -6, -6, -7, -6, -8, -6, -8,
+    -5, -6, -5, -4, -7, -6, -6, -6,
+    -7, -5, -6, -5, -5, -7, -6, -6,
+    -6, -5, -6, -6, -6, -5, -7, -6,
+    -6, -6, -6, -5, -6, -6, -7, -7,
+    -6, -7, -8, -8, -6, -6, -5, -4,
+    -6, -5, -6, -6, -6, -6, -6, -6,
+    -7, -6, -8, -6, -7, -7, -6, -5,
+    -6, -8, -7, -6, -6, -6, -7, -6,
+    -5, -7, -6, -6, -6, -5, -5, -8,
+    -7, -7, -7, -6, -6, -7, -6, -5,
+    -8, -6, -5, -5, -5, -6, -6, -7,
+};
+
+constexpr data_dims_t kDwIn26 = {6, 6, 144, 1};
+constexpr data_dims_t kDwFilter26 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut26 = {6, 6, 144, 1};
+
+constexpr dw_conv_params_t kDwParams26 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult27[24] = {
+    1079374401, 2066610656, 1295756327, 1198358779, 1274140485, 1787818100, 1089624196, 1839543116,
+    1912805512, 2139594814, 1595797476, 1468570028, 1458564468, 1504030628, 1075927504, 1720880021,
+    2079859473, 1546086627, 1297331849, 1994360994, 1559836819, 1927321190, 1376534173, 2120535017,
+};
+
+constexpr int32_t kConvShift27[24] = {
+    -9, -9, -10, -10, -10, -11, -10, -10,
+    -11, -9, -10, -11, -11, -11, -10, -11,
+    -10, -10, -9, -11, -11, -11, -9, -11,
+};
+
+constexpr data_dims_t kConvIn27 = {6, 6, 144, 1};
+constexpr data_dims_t kConvFilter27 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut27 = {6, 6, 24, 1};
+
+constexpr conv_params_t kConvParams27 = {128, -5, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult29[144] = {
+    1395467472, 1187831997, 1862348430, 1308236274, 1928065079, 1476529602, 1707786107, 1078896649,
+    1528493590, 1969087367, 1173450522, 1784611097, 1931668015, 1310209513, 1597019634, 1991779093,
+    1430662669, 1565340835, 1575599799, 1594226416, 1491531889, 1935416195, 1314604162, 1113349011,
+    1173686045, 1204597918, 1357357817, 1273906978, 1587294857, 1100955648, 1236123471, 1847759961,
+    1499354744, 1130977442, 1448163249, 1384135699, 1664393811, 1582010216, 1977056163, 1479242458,
+    1191356222, 1904803334, 1912603924, 1629590427, 1498584687, 1129287560, 1946823373, 1446289072,
+    1528424881, 1787343434, 1088845555, 1705202841, 1303348229, 1144932402, 1597871098, 1551267592,
+    1086902931, 1408593755, 1405278874, 1089982203, 1078912478, 1899462856, 2000999601, 1141682924,
+    1192359627, 1278748580, 1950115816, 1325048377, 1852285155, 1270276560, 1641703999, 1169774965,
+    1964507553, 1616492497, 1677031133, 2029696103, 1845751063, 2145933339, 1122413317, 1162286954,
+    1421248037, 1921341038, 1651468957, 1601430721, 1126590620, 2010244810, 1205142194, 1547443746,
+    1816177527, 1491077891, 1107376154, 1236696883, 1495927320, 1122374440, 2084974798, 1448250048,
+    2059864359, 1521580644, 1456105431, 1136324355, 1894588204, 1467448424, 2137491237, 1981705207,
+    1399250441, 1555354966, 1606961321, 1494034096, 1648781149, 1392123977, 1345225372, 1853896587,
+    1164167306, 1167646131, 1093166103, 1596637128, 1502354958, 1783105945, 1609395342, 1235110673,
+    1386628948, 1976586336, 1165972949, 1748212979, 1358746685, 1365794265, 2099364970, 1265055235,
+    1522886453, 1077621106, 1373848817, 1540104459, 1680216077, 1691558548, 1674593459, 2077728051,
+    1623410139, 1147145772, 1086881796, 1248628334, 1604387796, 1220386612, 1648601985, 1842773636,
+};
+
+constexpr int32_t kConvShift29[144] = {
+    -6, -7, -7, -7, -8, -6, -7, -6,
+    -7, -7, -6, -7, -7, -6, -8, -8,
+    -6, -6, -7, -7, -7, -8, -7, -6,
+    -6, -7, -6, -6, -7, -6, -7, -8,
+    -7, -6, -8, -8, -7, -7, -8, -7,
+    -6, -7, -7, -6, -6, -7, -7, -7,
+    -7, -7, -7, -7, -6, -6, -8, -7,
+    -7, -7, -6, -8, -7, -8, -8, -6,
+    -6, -7, -9, -7, -8, -7, -6, -7,
+    -8, -7, -6, -8, -7, -7, -6, -7,
+    -7, -7, -6, -7, -7, -7, -6, -6,
+    -8, -7, -6, -6, -7, -7, -8, -7,
+    -7, -7, -7, -7, -8, -7, -7, -8,
+    -7, -8, -7, -6, -6, -6, -7, -7,
+    -7, -7, -6, -8, -7, -6, -7, -7,
+    -8, -9, -6, -7, -7, -7, -7, -6,
+    -6, -8, -6, -7, -7, -7, -8, -7,
+    -7, -7, -6, -6, -7, -6, -6, -8,
+};
+
+constexpr data_dims_t kConvIn29 = {6, 6, 24, 1};
+constexpr data_dims_t kConvFilter29 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut29 = {6, 6, 144, 1};
+
+constexpr conv_params_t kConvParams29 = {5, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult30[144] = {
+    1076669696, 2120075392, 1179342720, 1301440128, 1216783232, 1139530112, 1291144064, 1938518784,
+    1630727680, 2001721344, 1203910144, 1352698624, 1832221056, 1512181888, 2081385984, 1554420992,
+    1831983232, 1979866112, 2095385472, 1129606656, 1486499840, 1782484992, 1393951872, 2025373952,
+    1249782656, 1591495552, 1094277632, 1091401984, 1246704000, 1956278144, 1772045952, 1756461056,
+    1588957312, 2075601408, 1102836096, 1125517056, 2049990784, 1548893312, 1939419904, 2111026816,
+    1632204160, 1512663168, 1090156288, 1292170112, 1379776000, 1377198720, 1227716864, 1813327104,
+    1139997568, 1508937216, 1350966144, 2049681280, 2025210624, 1514327424, 1304343168, 1162333440,
+    1402706048, 1859464320, 1155051520, 1341025536, 1716114432, 1188008704, 1110195584, 1946050816,
+    1206969856, 1424271104, 1930040064, 2039550848, 1239175552, 1432595328, 1501471744, 1825182336,
+    1140597248, 1154484992, 2091901568, 1981538560, 1711625216, 1254179968, 1370687488, 2024330624,
+    1198165248, 1873636096, 1360117248, 1139735936, 1101908224, 1272403968, 1578089600, 1894741376,
+    1958730240, 1270548736, 1268257920, 1322518400, 2023517440, 1545104128, 1569434496, 1678349824,
+    1663143808, 1309425280, 1082741376, 1342379008, 1189331712, 1957603712, 1528690432, 2080290432,
+    1313339520, 1182239744, 1111051264, 1202593664, 1160950144, 1124718592, 1521056768, 1570723968,
+    2108873600, 1544182400, 1712087680, 1775435520, 1189406848, 1679271424, 1271552512, 1783586176,
+    1424170240, 1998376192, 1672945536, 1102002304, 1520609280, 1444053248, 1775735936, 2121280128,
+    1317358336, 1318877440, 2054087808, 1511535744, 2112131200, 1389655168, 1705064320, 1115173632,
+    1915731328, 1262601600, 1738977792, 2103778176, 1156553216, 1570219904, 1273229440, 1366037632,
+};
+
+constexpr int32_t kDwShift30[144] = {
+    -7, -7, -6, -6, -6, -7, -6, -7,
+    -8, -6, -7, -8, -8, -7, -6, -5,
+    -8, -7, -6, -6, -5, -6, -5, -7,
+    -6, -6, -7, -6, -6, -9, -6, -6,
+    -7, -6, -5, -7, -7, -6, -6, -7,
+    -7, -7, -7, -6, -9, -7, -6, -6,
+    -6, -6, -7, -8, -7, -6, -5, -6,
+    -6, -7, -8, -5, -6, -5, -6, -7,
+    -7, -6, -7, -7, -4, -7, -7, -6,
+    -5, -6, -7, -6, -7, -5, -6, -7,
+    -7, -6, -7, -5, -5, -7, -7, -6,
+    -6, -6, -5, -6, -7, -7, -5, -7,
+    -6, -6, -5, -5, -6, -7, -6, -6,
+    -5, -5, -6, -6, -6, -6, -7, -7,
+    -7, -6, -6, -5, -6, -7, -6, -6,
+    -5, -5, -7, -6, -7, -6, -7, -7,
+    -6, -5, -7, -6, -6, -6, -6, -7,
+    -7, -6, -6, -6, -6, -7, -7, -5,
+};
+
+constexpr data_dims_t kDwIn30 = {6, 6, 144, 1};
+constexpr data_dims_t kDwFilter30 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut30 = {6, 6, 144, 1};
+
+constexpr dw_conv_params_t kDwParams30 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult31[24] = {
+    1256369661, 1727309946, 1872257945, 1487126398, 1272232959, 1202830616, 1726520500, 1482951153,
+    1090431476, 1835491717, 1627511198, 2017431043, 2122317751, 1202230539, 1573270905, 1257820865,
+    1128823797, 1418696100, 1461654253, 1610512530, 1292866690, 1078836697, 1328897161, 1693884855,
+};
+
+constexpr int32_t kConvShift31[24] = {
+    -9, -9, -11, -10, -10, -10, -11, -10,
+    -10, -8, -10, -11, -11, -10, -10, -10,
+    -10, -10, -8, -10, -10, -9, -9, -10,
+};
+
+constexpr data_dims_t kConvIn31 = {6, 6, 144, 1};
+constexpr data_dims_t kConvFilter31 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut31 = {6, 6, 24, 1};
+
+constexpr conv_params_t kConvParams31 = {128, -5, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult33[144] = {
+    1361231934, 2026929849, 1617803559, 1269574878, 1223465069, 1548626082, 1456416831, 1460592530,
+    1333997279, 2103801109, 1728535720, 1197129190, 1267895729, 1936102131, 1349230024, 2068414137,
+    2037855425, 1398674607, 1892996807, 2080272117, 1147313282, 1599346427, 1246673182, 1360541386,
+    1303318074, 1382740685, 1867010558, 1676224831, 2073594380, 1798917431, 1144804099, 1126269601,
+    2068869275, 1594247733, 1433016522, 1753934402, 1928755975, 1171962520, 1142979192, 1605260258,
+    1246346726, 1588557638, 1477204105, 1276753058, 1076890710, 1786241004, 1283791403, 1850882785,
+    1555102213, 1221365806, 1355711644, 1684769645, 2138034554, 1471102783, 1174327599, 1999345913,
+    1350994380, 1207806721, 1140791323, 1133937595, 1968741374, 1696145130, 1843470240, 1799944802,
+    1187496541, 1712076351, 1945813366, 1740296644, 1718331709, 1611502199, 1815354670, 1272139211,
+    1201986637, 1938202003, 2102403634, 1946363818, 1142428827, 1830139334, 1299307476, 1967203628,
+    1563310726, 1213739110, 1526083164, 1135592697, 1457365180, 1636039395, 1668036357, 1951098507,
+    1691398767, 1415396917, 1657284159, 1141141738, 1256385375, 1455330216, 1249424483, 1183229013,
+    1101138566, 1332019294, 1294277523, 1799548560, 1581317425, 1751138231, 1081082875, 1629804249,
+    1765360594, 1928934231, 1082517727, 1322264845, 1404085817, 1956296349, 1344692497, 1206045414,
+    1516104979, 1333876002, 1491362693, 1138998303, 1427187202, 1278885776, 2053350326, 1126641448,
+    1645659846, 1463901602, 1212371953, 1743290936, 1882589622, 1499607798, 1134258648, 1785072491,
+    1519431912, 1319414744, 1751240689, 1775068692, 1960456714, 2137793743, 1921730437, 1706455607,
+    1167456359, 1555910379, 1614395601, 1142033717, 1324678888, 1645422694, 1747951220, 1595319189,
+};
+
+constexpr int32_t kConvShift33[144] = {
+    -7, -7, -7, -7, -6, -8, -7, -7,
+    -7, -7, -7, -7, -7, -7, -6, -7,
+    -7, -5, -7, -7, -7, -7, -7, -6,
+    -7, -8, -6, -7, -7, -9, -6, -7,
+    -7, -6, -6, -7, -8, -7, -6, -6,
+    -8, -10, -7, -6, -6, -7, -6, -7,
+    -7, -6, -7, -8, -8, -6, -6, -8,
+    -6, -6, -5, -6, -8, -7, -7, -7,
+    -6, -7, -7, -7, -6, -7, -7, -7,
+    -7, -7, -7, -7, -6, -7, -6, -7,
+    -7, -7, -7, -6, -7, -6, -7, -7,
+    -7, -7, -7, -7, -6, -6, -7, -6,
+    -5, -6, -6, -7, -8, -7, -6, -8,
+    -8, -7, -6, -8, -7, -7, -6, -6,
+    -7, -6, -6, -6, -7, -7, -7, -6,
+    -7, -7, -6, -7, -8, -7, -8, -7,
+    -7, -6, -7, -7, -7, -7, -6, -7,
+    -7, -6, -6, -8, -7, -7, -7, -7,
+};
+
+constexpr data_dims_t kConvIn33 = {6, 6, 24, 1};
+constexpr data_dims_t kConvFilter33 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut33 = {6, 6, 144, 1};
+
+constexpr conv_params_t kConvParams33 = {5, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult34[144] = {
+    1549956352, 1094410112, 1612582528, 2117334912, 1448811008, 1751521664, 1085114624, 2128172800,
+    1506295552, 1346790272, 1866977664, 1635548288, 1793144064, 1451185792, 1630339840, 1250063360,
+    1121071232, 1351608448, 1297154816, 1771387008, 1216477696, 1793936640, 1750083712, 1998376832,
+    2003744000, 1704694912, 1484404480, 1552789760, 1199916160, 1560314240, 1107890816, 1364204928,
+    1208877696, 1207354624, 1959372416, 1171268480, 1107840640, 1359984896, 1509840000, 1269652480,
+    1406641024, 1859150848, 1226798976, 1770390912, 1082707200, 1188175360, 1676566912, 1967273216,
+    1278587520, 1128365696, 1387270400, 1340600320, 1948035968, 1524262528, 1276808832, 1670137472,
+    1794220416, 2123618304, 1255444480, 1681451392, 1642414336, 2051047552, 1610493824, 2080137856,
+    1686979840, 1892343424, 1192659712, 1492154880, 1364704512, 1117285632, 1473445760, 2100084224,
+    1143702400, 1882394112, 1913582336, 1865158144, 1098444544, 1194695680, 1361343488, 1507166848,
+    1094333568, 1480120192, 1102394240, 1823030656, 1368134784, 1978413568, 1244429056, 1553391488,
+    1680793728, 2100355584, 1536825856, 2025009536, 1680849408, 1818875136, 1134399360, 1749056000,
+    1475981440, 1923312384, 1489244288, 2101869568, 2028149248, 1167120256, 1444950016, 1237529216,
+    1801267712, 1788813184, 1365296512, 1640905088, 1557674368, 1879859072, 2082559488, 1383089408,
+    1635646464, 1708804864, 1564392832, 1505574272, 1166715008, 1216291200, 1098966528, 2114930816,
+    1703698688, 1218779264, 1818173696, 1865417088, 1962401408, 1116256768, 1642678656, 1586717440,
+    2045334016, 1140961024, 1782297856, 1088044544, 1206385408, 1501912064, 1394761216, 1400635648,
+    1617614208, 2132079488, 2047022336, 1646116352, 1947959936, 1674447104, 1952485760, 2143857536,
+};
+
+constexpr int32_t kDwShift34[144] = {
+    -6, -6, -6, -8, -6, -5, -6, -6,
+    -6, -8, -6, -6, -6, -6, -6, -6,
+    -6, -8, -7, -7, -6, -8, -7, -7,
+    -8, -5, -8, -5, -6, -5, -6, -5,
+    -4, -6, -6, -7, -5, -6, -6, -7,
+    -5, -3, -5, -6, -6, -7, -6, -7,
+    -6, -6, -7, -5, -6, -5, -6, -6,
+    -7, -9, -7, -7, -5, -8, -6, -7,
+    -7, -7, -6, -6, -7, -6, -5, -7,
+    -6, -6, -7, -7, -6, -5, -7, -8,
+    -5, -6, -6, -6, -7, -8, -7, -7,
+    -6, -7, -5, -7, -7, -8, -6, -7,
+    -6, -6, -5, -7, -6, -6, -8, -5,
+    -7, -7, -7, -6, -7, -7, -8, -6,
+    -8, -7, -7, -7, -7, -5, -7, -7,
+    -6, -5, -7, -7, -6, -7, -6, -7,
+    -7, -7, -8, -7, -6, -7, -6, -6,
+    -6, -8, -8, -5, -7, -6, -7, -6,
+};
+
+constexpr data_dims_t kDwIn34 = {6, 6, 144, 1};
+constexpr data_dims_t kDwFilter34 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut34 = {6, 6, 144, 1};
+
+constexpr dw_conv_params_t kDwParams34 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult35[24] = {
+    2035604138, 1437636135, 1771553192, 1091125811, 1743310396, 1750068353, 1418934577, 1606545925,
+    1175472551, 1834935789, 1132285538, 1687227485, 1777227837, 1855602557, 1353880492, 1715507526,
+    1797812083, 1722241384, 1614971573, 1848046977, 1620950603, 1830721724, 1801369617, 1977668482,
+};
+
+constexpr int32_t kConvShift35[24] = {
+    -11, -9, -11, -10, -11, -11, -11, -11,
+    -10, -9, -10, -11, -11, -11, -11, -11,
+    -11, -11, -8, -11, -11, -11, -9, -11,
+};
+
+constexpr data_dims_t kConvIn35 = {6, 6, 144, 1};
+constexpr data_dims_t kConvFilter35 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut35 = {6, 6, 24, 1};
+
+constexpr conv_params_t kConvParams35 = {128, 19, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult37[144] = {
+    1386057307, 1322654193, 1830859288, 1436312434, 1370888158, 1192089105, 1694691527, 1957114851,
+    1912715464, 1103307269, 1437841599, 1441156022, 2083954956, 1782096308, 1244811401, 1843532440,
+    1320221126, 1734201447, 1437595600, 1614882538, 1823028714, 1619612493, 1155774928, 1744797237,
+    1849323231, 1361880985, 1658457779, 1816602343, 1364198063, 1611893085, 1192407120, 1459677510,
+    1294028464, 2053488554, 1855011830, 1667496810, 1452296757, 1377095565, 1542170950, 1431028449,
+    1357727944, 1298670923, 1769018766, 2012435335, 1076861541, 1184112144, 1178457533, 1254937516,
+    1101662228, 1164676769, 1776196933, 1687381556, 1927650393, 1764222741, 1392436117, 1118897634,
+    1497683056, 1074302053, 1509035464, 1866298952, 2029762725, 1407134133, 1508267517, 1455623856,
+    1665863211, 1350603621, 2126106813, 1814504902, 1318088237, 1441382839, 1169296905, 1235425526,
+    2077770994, 1854913004, 1571975410, 1361004676, 1482872978, 1972408963, 1613331724, 1192747122,
+    1906271256, 1200864638, 1237045103, 1613629323, 1923930907, 1385048633, 1342253679, 1294031493,
+    1390520399, 1473824637, 1176361887, 1728544481, 2004709421, 1645700159, 1679125952, 1816394707,
+    1169630961, 1431060643, 1827891596, 1820882365, 2063515619, 1486735374, 1914203124, 1091492365,
+    1893753466, 1867175260, 1627033181, 1535835664, 2054496331, 1998506837, 1756739572, 1249576242,
+    2061107903, 2041349914, 1476649306, 1753848832, 2084359682, 1528990768, 1143299091, 1428045277,
+    1647683631, 1163784084, 1380610108, 1125927954, 1074326844, 1810392356, 2108129260, 2120997708,
+    1392132797, 1493642975, 1104134220, 1112989172, 1632989429, 1410613790, 1715557464, 1778691920,
+    1653300438, 1551836925, 1428915640, 1484356151, 1380526650, 2122563890, 1162106288, 1429496704,
+};
+
+constexpr int32_t kConvShift37[144] = {
+    -6, -6, -7, -6, -6, -6, -7, -7,
+    -5, -5, -6, -6, -8, -6, -7, -7,
+    -7, -6, -6, -6, -6, -7, -6, -6,
+    -6, -6, -8, -7, -6, -6, -6, -6,
+    -6, -7, -7, -6, -6, -6, -7, -6,
+    -6, -6, -6, -7, -6, -5, -6, -6,
+    -5, -6, -6, -6, -6, -7, -6, -6,
+    -6, -5, -6, -6, -6, -6, -6, -6,
+    -6, -6, -7, -7, -6, -7, -6, -6,
+    -6, -6, -6, -6, -6, -7, -6, -6,
+    -8, -6, -7, -7, -6, -5, -6, -5,
+    -6, -7, -5, -6, -7, -7, -7, -6,
+    -6, -7, -7, -7, -6, -6, -8, -6,
+    -7, -7, -7, -6, -7, -7, -6, -6,
+    -7, -7, -6, -6, -6, -7, -6, -6,
+    -7, -6, -6, -6, -5, -6, -7, -7,
+    -5, -6, -6, -6, -6, -6, -6, -6,
+    -6, -6, -6, -7, -6, -7, -6, -7,
+};
+
+constexpr data_dims_t kConvIn37 = {6, 6, 24, 1};
+constexpr data_dims_t kConvFilter37 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut37 = {6, 6, 144, 1};
+
+constexpr conv_params_t kConvParams37 = {-19, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult38[144] = {
+    1749967872, 1138268288, 1669571200, 2062907136, 1969820032, 2021435392, 1934603904, 1160471936,
+    1826865536, 1435739392, 1240346368, 1595057920, 1583550720, 1407309568, 1169385216, 1077599232,
+    1853223936, 1613863296, 1440654336, 1601863040, 1741976064, 2028832512, 1300538368, 1905026560,
+    1417231488, 1115423232, 1242630144, 1825768448, 1595784064, 1246314752, 2120247808, 1542448384,
+    1835406336, 1829176064, 2045468160, 1750112512, 1250811008, 1664192640, 1554838784, 1415848320,
+    1482627072, 1186443904, 1209984896, 1682898816, 2114649728, 1640260736, 1647161600, 1255645312,
+    1220262528, 1920745856, 1139391232, 1413276800, 1153646464, 1137024896, 1963515520, 2112388224,
+    1076569216, 2076883328, 1667575552, 1975690624, 1531504640, 1289507328, 1965439744, 1199760768,
+    1498557056, 1126043008, 1076679808, 1691118976, 1079579008, 1130069888, 1895650432, 1415556480,
+    1514018176, 1874258560, 1338854784, 1666583680, 1705891712, 1131425536, 1813954560, 1569553536,
+    1616338176, 1316612096, 1529565312, 1254625024, 1866310400, 1152140672, 1312580480, 1308368384,
+    1860357760, 1693347968, 2000954240, 1358020992, 1139163136, 1650444672, 2016592128, 1551277952,
+    1945506176, 1099023744, 1522952448, 1108895616, 1378179456, 1702684672, 1325717248, 1424933120,
+    1207320704, 2091289088, 1936866560, 1090126336, 1790963584, 1277668736, 1319740544, 1528618752,
+    1759618688, 1530171520, 1720228224, 1383798400, 1646908544, 1674560512, 1080403712, 1997443072,
+    1611354368, 1758350080, 1893843456, 1339703936, 1937051136, 1442990080, 1118625280, 1879994624,
+    1292884992, 1882547200, 1096543104, 1151137280, 1228402688, 1588679680, 1679314432, 1959835904,
+    1731037696, 1819636992, 1911862912, 1368858368, 1341756672, 1781386624, 1691674112, 1111591936,
+};
+
+constexpr int32_t kDwShift38[144] = {
+    -7, -7, -7, -7, -8, -7, -6, -8,
+    -8, -7, -7, -8, -6, -7, -6, -7,
+    -6, -7, -7, -7, -7, -7, -7, -7,
+    -7, -8, -7, -7, -6, -6, -7, -7,
+    -7, -7, -6, -6, -6, -7, -7, -7,
+    -7, -7, -8, -7, -7, -7, -8, -6,
+    -8, -7, -8, -7, -7, -7, -7, -7,
+    -7, -9, -7, -8, -8, -7, -7, -6,
+    -7, -7, -6, -6, -7, -5, -7, -7,
+    -7, -8, -6, -7, -7, -7, -8, -7,
+    -6, -7, -7, -6, -9, -7, -7, -6,
+    -9, -7, -8, -7, -6, -6, -7, -7,
+    -7, -7, -7, -5, -8, -7, -5, -7,
+    -6, -7, -7, -6, -7, -6, -7, -7,
+    -7, -7, -8, -7, -7, -6, -8, -7,
+    -7, -7, -7, -7, -7, -8, -6, -7,
+    -8, -8, -6, -7, -7, -7, -7, -8,
+    -8, -9, -7, -7, -6, -7, -8, -6,
+};
+
+constexpr data_dims_t kDwIn38 = {6, 6, 144, 1};
+constexpr data_dims_t kDwFilter38 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut38 = {6, 6, 144, 1};
+
+constexpr dw_conv_params_t kDwParams38 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult39[32] = {
+    2144419765, 1852430597, 1485195014, 1773964543, 1678062885, 1399136796, 1784517940, 1541635084,
+    1973837173, 1573860753, 1481754860, 1718944384, 1806545064, 1708676770, 1740852633, 1735175777,
+    1584908787, 1120991000, 1106855256, 1679703437, 1557393891, 1477301606, 2089134989, 2020017993,
+    2142912155, 1074021777, 1153815987, 1594299539, 1099598932, 1102572838, 1661205813, 1490510302,
+};
+
+constexpr int32_t kConvShift39[32] = {
+    -9, -9, -9, -9, -9, -9, -9, -9,
+    -9, -9, -9, -9, -9, -9, -9, -9,
+    -9, -8, -8, -9, -9, -9, -9, -9,
+    -9, -8, -8, -9, -8, -8, -9, -9,
+};
+
+constexpr data_dims_t kConvIn39 = {6, 6, 144, 1};
+constexpr data_dims_t kConvFilter39 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut39 = {6, 6, 32, 1};
+
+constexpr conv_params_t kConvParams39 = {128, -2, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult40[192] = {
+    1308826846, 1075412540, 1231242716, 1547393614, 1715590989, 1271095008, 1198715179, 1099906736,
+    1130179238, 1874165136, 2045742800, 1320743504, 2101153572, 1823597199, 1244406152, 1130855632,
+    1270732765, 1811598448, 1715949483, 1545623510, 1827286596, 1668686593, 1313220691, 1766587490,
+    1190548681, 1920075884, 1836853587, 1925937835, 1944630454, 1887923390, 1158581057, 1232169137,
+    1375837152, 1181804687, 1575477015, 1362386973, 1294305581, 1229171389, 1124551156, 1565171317,
+    1270064128, 1155340649, 1241004920, 1540991919, 1751258094, 1412003796, 1502408124, 1699591663,
+    2124023621, 2016669888, 1406550888, 1785214952, 1329839657, 1553802290, 1730228606, 1612779773,
+    1576535690, 1331976787, 1751711092, 1089626636, 1287017929, 1124729174, 1220057913, 1440324943,
+    1243945785, 1365646643, 1121645455, 1648868331, 1581162240, 1602254299, 1789173898, 1322554202,
+    1747447949, 1525691094, 1145305923, 1894175896, 1190814222, 1681748415, 1132134860, 1080607470,
+    1081928260, 2051262416, 1475492381, 1563173809, 2100893331, 1645079388, 1604289815, 1737068432,
+    1183843565, 1158367098, 1720078691, 1627265098, 1213866427, 1467962587, 1318470113, 1650445291,
+    1220474195, 1614877473, 1733053895, 2027724506, 1962758895, 1544213710, 1329958982, 1466450009,
+    1078637886, 1749663165, 1967613365, 1271520210, 2028864886, 1153128924, 1765915491, 1978609160,
+    1167563572, 1080707726, 1449714562, 1441798220, 1481057375, 1270481573, 1107346939, 1457278357,
+    1286709208, 1873867016, 1211626260, 1937098980, 1143032790, 1566797274, 1411701797, 1246591891,
+    1763546432, 1705726783, 1276460522, 1571184526, 1294928194, 1213494876, 1148445750, 1343983941,
+    1796612550, 1644601569, 1192300039, 1209441684, 1859620471, 1328408267, 1378415128, 1866285122,
+    1179662903, 1897357998, 1858473627, 1408781100, 1950152010, 1787585174, 1770848564, 1385223668,
+    1488426474, 1082822750, 1339864687, 1394638884, 1314929387, 1994028664, 1322041865, 2096119790,
+    1661193256, 1869046159, 1810602862, 1606850209, 1240477457, 1165908527, 1205545309, 2019750893,
+    1658743526, 1263936377, 1399376485, 1857349277, 1702458968, 1278295913, 1380517482, 1893040428,
+    1578839851, 2114523209, 1968165391, 1196902284, 1485408299, 1791278321, 1201831736, 1165794890,
+    1720149925, 1480092815, 1311031590, 2010359206, 1508955776, 1198099677, 1085878287, 1345059423,
+};
+
+constexpr int32_t kConvShift40[192] = {
+    -7, -6, -6, -8, -8, -7, -7, -6,
+    -6, -8, -7, -6, -7, -7, -8, -8,
+    -6, -7, -7, -7, -7, -8, -6, -7,
+    -6, -7, -9, -7, -7, -8, -6, -6,
+    -7, -7, -7, -7, -7, -6, -8, -8,
+    -7, -7, -7, -7, -7, -6, -8, -7,
+    -8, -7, -7, -8, -7, -7, -8, -7,
+    -8, -6, -7, -6, -6, -6, -8, -7,
+    -7, -7, -7, -7, -8, -7, -8, -7,
+    -7, -7, -7, -6, -6, -7, -7, -7,
+    -6, -7, -6, -7, -8, -7, -6, -7,
+    -6, -7, -7, -7, -6, -6, -7, -8,
+    -8, -8, -6, -7, -7, -7, -7, -8,
+    -6, -8, -7, -6, -7, -7, -8, -8,
+    -7, -6, -6, -7, -8, -7, -6, -6,
+    -6, -7, -6, -7, -7, -7, -7, -6,
+    -8, -7, -8, -7, -6, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -8, -8,
+    -7, -8, -8, -8, -8, -8, -7, -6,
+    -7, -7, -7, -7, -7, -7, -6, -8,
+    -7, -7, -7, -7, -6, -6, -6, -7,
+    -7, -7, -5, -7, -6, -8, -7, -7,
+    -6, -7, -7, -7, -7, -7, -8, -8,
+    -6, -7, -6, -8, -7, -6, -6, -6,
+};
+
+constexpr data_dims_t kConvIn40 = {6, 6, 32, 1};
+constexpr data_dims_t kConvFilter40 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut40 = {6, 6, 192, 1};
+
+constexpr conv_params_t kConvParams40 = {2, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult41[192] = {
+    1731579520, 1789258496, 2107324032, 1868159488, 1586273408, 1443749760, 1090936448, 1221363712,
+    1710410496, 2019661952, 1808848256, 1203697408, 1190538112, 1724201984, 1302693760, 1258500096,
+    1181769984, 1730553344, 1306251136, 1651674368, 1399620864, 1245318272, 1570478208, 1096589056,
+    1410135808, 1421249408, 2062932608, 1523600640, 1651456384, 1474553472, 1370614656, 1225895168,
+    1653451136, 1096507136, 1843906944, 1341171840, 1349462656, 1357386496, 2139979648, 1426959616,
+    1464161408, 1969022848, 2017931520, 1216259328, 2110847360, 1371483904, 1539155840, 2082005248,
+    1791114752, 1918627968, 1576894336, 1119169152, 1334656768, 1764597120, 1848000896, 1105089024,
+    1396667008, 1572822656, 2134022784, 1262450304, 1511743360, 1120755840, 1330375040, 2057502080,
+    1674575616, 2128557440, 1364576384, 1966104064, 1309094272, 1994124928, 1348771584, 1346619520,
+    1720045696, 1853745280, 1124543488, 1190236672, 2099770496, 1433256192, 1231671808, 1230525952,
+    1239063296, 1550736512, 1527711104, 1567343104, 1309068416, 1816389760, 1351494400, 1687107584,
+    1581726336, 1140965120, 1615261696, 1516449792, 1746187520, 1215973120, 1208346112, 1554333312,
+    1287549184, 1169958912, 2006780416, 1335695360, 1975977216, 1180503424, 2066409984, 1844119808,
+    1288187136, 1647019648, 1109853312, 1893939328, 1620803456, 1990767872, 1566155392, 1419224704,
+    1306883584, 1183220608, 1823722880, 2124278656, 1073757568, 1120545152, 1548780032, 1442389376,
+    2117448704, 1292274176, 1954488576, 1588626560, 1309934080, 2071356672, 1706818816, 1208269184,
+    2137713536, 2073416704, 1109087744, 1467653760, 1127754496, 2124418560, 2103108096, 2010827392,
+    1820029696, 1751114240, 1353983616, 1823418752, 2009373696, 2047395200, 1384983808, 1799768576,
+    1697796864, 1820204160, 1711684224, 1195969280, 1425379200, 1842020864, 2125675648, 1439840512,
+    1463953152, 1117467008, 1518090496, 1213744768, 1212693120, 2084599040, 1497915264, 1495598976,
+    1147266176, 1551182720, 1281685632, 1241128064, 1862561536, 1678944640, 1882473344, 1333574656,
+    2038837376, 1490582656, 1852917120, 1219970048, 1329182848, 1156458624, 1365617152, 1384240256,
+    1582924800, 1430499968, 1366175872, 1328336256, 1190457856, 1898398080, 1225754624, 1309481472,
+    1970957312, 1339553408, 1370942080, 1859130496, 1331286016, 1512321792, 2116136320, 1967549184,
+};
+
+constexpr int32_t kDwShift41[192] = {
+    -6, -6, -8, -6, -6, -6, -6, -7,
+    -7, -6, -5, -7, -7, -6, -5, -5,
+    -6, -6, -6, -7, -7, -5, -6, -7,
+    -7, -7, -5, -6, -7, -6, -6, -5,
+    -6, -6, -6, -6, -6, -7, -6, -6,
+    -6, -7, -7, -6, -6, -7, -6, -7,
+    -5, -8, -7, -5, -6, -8, -6, -6,
+    -5, -7, -8, -8, -7, -6, -5, -6,
+    -5, -6, -6, -6, -5, -8, -6, -6,
+    -7, -7, -8, -7, -8, -8, -5, -6,
+    -6, -6, -8, -7, -5, -7, -6, -8,
+    -7, -6, -6, -6, -6, -6, -6, -6,
+    -5, -6, -8, -6, -8, -8, -7, -6,
+    -6, -6, -7, -7, -7, -6, -6, -6,
+    -6, -7, -7, -7, -5, -5, -6, -7,
+    -7, -7, -6, -8, -7, -7, -6, -7,
+    -6, -6, -5, -7, -7, -7, -7, -7,
+    -7, -7, -5, -6, -9, -6, -5, -6,
+    -6, -7, -6, -5, -6, -6, -7, -7,
+    -6, -5, -6, -6, -6, -7, -6, -6,
+    -6, -6, -8, -6, -7, -7, -8, -6,
+    -8, -6, -7, -7, -8, -5, -6, -6,
+    -6, -6, -6, -6, -6, -9, -5, -5,
+    -7, -6, -7, -6, -7, -6, -8, -6,
+};
+
+constexpr data_dims_t kDwIn41 = {6, 6, 192, 1};
+constexpr data_dims_t kDwFilter41 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut41 = {6, 6, 192, 1};
+
+constexpr dw_conv_params_t kDwParams41 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult42[32] = {
+    1652132976, 1698377885, 1377470641, 1086064891, 1520550731, 1391928176, 1074376416, 2108103831,
+    1434499768, 1450069191, 1766760123, 1980560570, 1082524504, 2043206835, 1285144409, 1490680928,
+    1909778197, 1186660600, 1330228363, 1084207751, 1173551742, 1972369141, 1091924192, 1107573073,
+    1197282378, 1733847649, 1385596442, 1783208344, 1549035916, 1869642769, 1405218150, 2008699732,
+};
+
+constexpr int32_t kConvShift42[32] = {
+    -11, -10, -11, -9, -11, -9, -10, -10,
+    -11, -11, -9, -12, -9, -10, -10, -10,
+    -11, -9, -10, -10, -11, -12, -11, -9,
+    -10, -10, -10, -11, -11, -10, -11, -11,
+};
+
+constexpr data_dims_t kConvIn42 = {6, 6, 192, 1};
+constexpr data_dims_t kConvFilter42 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut42 = {6, 6, 32, 1};
+
+constexpr conv_params_t kConvParams42 = {128, -15, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult44[192] = {
+    1749408355, 1842670106, 2140126545, 2048307510, 1179020820, 1202115814, 1477780483, 1640190237,
+    1591529757, 1219878784, 1075302768, 1660947723, 1212171215, 2039341354, 2012524906, 1206773908,
+    1312641062, 1099333473, 1667338676, 1283445815, 1094578572, 1485969485, 1771217794, 1514390552,
+    1174261920, 1945675076, 1694525613, 1847275193, 2110300238, 1164021088, 1621139573, 1897875725,
+    1916665261, 1376220555, 1218262261, 1487869455, 1996278956, 2143186064, 1628151729, 2100411948,
+    1278888713, 1142736417, 1159415443, 1731201151, 1323512117, 1166579459, 1197146933, 1221325964,
+    1959019227, 1252080077, 1809932886, 1525186840, 1674793857, 1229121971, 1676635148, 2022103338,
+    1148138281, 1495700893, 1216774535, 1234453344, 1173156215, 1826497249, 1553347058, 2054745332,
+    1501790822, 1115399386, 1965171184, 1460263391, 1109865005, 1150003471, 1832382313, 1220619578,
+    1928719950, 1554963581, 1082673325, 1868009430, 1304589878, 1411382700, 1829529056, 2129562930,
+    1924488515, 1989278703, 1381437917, 1813514289, 1236421945, 1091663660, 2089458872, 1359997667,
+    1829579273, 1109980319, 1404433222, 1848002038, 1832491302, 1769220272, 1656419263, 1492825782,
+    1425202052, 1822600037, 1287404497, 1852530312, 1414521635, 1398484457, 1614384640, 2124996343,
+    1437459748, 1247769876, 1625525007, 1263363563, 2121660072, 1074123598, 2051309930, 2001941018,
+    1609113340, 1182260375, 1371589150, 1639530535, 1203242721, 1365274174, 1658612631, 1568582066,
+    1447146519, 1601629144, 2055093504, 1200937667, 1821393340, 1538885114, 1157335807, 1135240783,
+    1357650672, 1359886538, 1972044407, 1779409120, 1128665329, 1139908362, 1238108493, 1793678380,
+    1097707836, 1306493568, 1197750932, 1097820453, 1503116738, 1098450769, 2079763453, 1127477045,
+    1859557533, 2110643388, 1709738209, 1300135907, 2066495744, 1965580918, 1677569557, 1984257000,
+    1401189481, 1172400077, 1277896183, 1857439863, 1369060630, 1723831710, 1566323230, 1213979679,
+    1360504208, 1354481327, 1947349907, 1227224883, 1525968738, 1095807680, 1875540867, 1773779792,
+    1919400786, 1087395306, 1215812321, 1144952197, 1939649592, 1636896187, 1247194519, 1349490406,
+    1783238819, 1409025010, 1889758236, 1904361346, 1128553921, 1628872809, 1095055913, 1317233502,
+    1712320294, 1344346602, 1135624385, 1562165260, 1248331562, 1938266392, 1284888439, 1314950766,
+};
+
+constexpr int32_t kConvShift44[192] = {
+    -6, -8, -7, -7, -6, -7, -7, -7,
+    -7, -6, -6, -8, -5, -8, -8, -7,
+    -6, -6, -7, -7, -7, -8, -7, -6,
+    -8, -7, -7, -7, -7, -7, -7, -8,
+    -7, -6, -6, -8, -7, -7, -7, -8,
+    -6, -6, -5, -7, -6, -6, -7, -6,
+    -7, -6, -7, -7, -6, -7, -6, -7,
+    -6, -7, -7, -7, -6, -7, -7, -8,
+    -7, -6, -7, -6, -6, -6, -7, -7,
+    -7, -8, -7, -6, -6, -8, -7, -7,
+    -7, -7, -6, -7, -5, -6, -7, -6,
+    -8, -6, -5, -7, -6, -7, -7, -7,
+    -6, -7, -7, -7, -6, -7, -7, -7,
+    -6, -6, -6, -7, -8, -6, -7, -6,
+    -7, -6, -5, -6, -5, -6, -6, -6,
+    -6, -6, -7, -7, -6, -7, -6, -6,
+    -6, -6, -7, -7, -7, -7, -6, -8,
+    -6, -6, -6, -6, -6, -7, -7, -6,
+    -6, -7, -7, -6, -7, -5, -8, -7,
+    -6, -6, -6, -7, -6, -6, -6, -6,
+    -7, -7, -7, -6, -7, -6, -8, -6,
+    -7, -6, -6, -6, -7, -6, -6, -8,
+    -5, -8, -7, -7, -7, -5, -7, -6,
+    -6, -6, -6, -7, -6, -6, -6, -8,
+};
+
+constexpr data_dims_t kConvIn44 = {6, 6, 32, 1};
+constexpr data_dims_t kConvFilter44 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut44 = {6, 6, 192, 1};
+
+constexpr conv_params_t kConvParams44 = {15, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult45[192] = {
+    1173257216, 1626386176, 1422696960, 1131129984, 1983522048, 1337493504, 1117671296, 1416263680,
+    2003077376, 1239737344, 2121922304, 2116589184, 1868696832, 1401097088, 1732192128, 1083897472,
+    1294385792, 1758613888, 1679709056, 1306997376, 1765959424, 1409226240, 1648558080, 1740884608,
+    2043203200, 1269967616, 1336803584, 1241195776, 1336911872, 1831135488, 1386638720, 1384974976,
+    1597529344, 1662611584, 1510488192, 2050777216, 1797021824, 2055387520, 1767338368, 1508617728,
+    1758669952, 1906293120, 1944400640, 1425206400, 1495724160, 1676826624, 1389063424, 1369497472,
+    1536204544, 1473345664, 1940397056, 1544376192, 1280072064, 1601997056, 1813296896, 1435624320,
+    1332087936, 1853797120, 1546983296, 1292774528, 1556402560, 1309428992, 1498673536, 1179882368,
+    1494220544, 1648465152, 1781238912, 1840773248, 1341824128, 2033221376, 1151903872, 1431686400,
+    1611916160, 1707515648, 1866293120, 1437385984, 1932790528, 1627930368, 1650660864, 1570223360,
+    2085293312, 2086872960, 1387916800, 1218199936, 1101469824, 1193866112, 2134598400, 1517794048,
+    1524220544, 1594901248, 2076351360, 1422009472, 1586272768, 1719646592, 1456859008, 1601071488,
+    1767530624, 1906366464, 2049663232, 1536713088, 1091998720, 1964414976, 1856882304, 1164276224,
+    2115219072, 1794477312, 1755020160, 1230888320, 1726148224, 1418192384, 1338890112, 1237678336,
+    1174240768, 1134239616, 1469004416, 1536685952, 1663891200, 1422128128, 1856871296, 1530208000,
+    1646181888, 1748753792, 1142483584, 1788856448, 1473543040, 1861241088, 1730058752, 1534334720,
+    1105440384, 2076980992, 1215400320, 1763979520, 1899548160, 1271728512, 1316170368, 1719217536,
+    1617778176, 1137112576, 1910042368, 1286251008, 1347392768, 1868944768, 1798425856, 1317220736,
+    1750082816, 1465565440, 1233985920, 1401010432, 1490508800, 1671256320, 1904010112, 1178950016,
+    1095535744, 1214432256, 1809285504, 1706727680, 1912628224, 1318695040, 2045008384, 1579789696,
+    1700164736, 1436771840, 1591919232, 1404317056, 1613136768, 1206019456, 1605959424, 2065081600,
+    1846741248, 1510536960, 1380285568, 1532898432, 1610001536, 1879963264, 2042440320, 1534506368,
+    1553157632, 1532150144, 1385188352, 1827404672, 1494908288, 1308497024, 2032308864, 1153131392,
+    1524505472, 2038577152, 1117647232, 1496444032, 1157058176, 1867093376, 1927508992, 1542052736,
+};
+
+constexpr int32_t kDwShift45[192] = {
+    -6, -6, -8, -6, -7, -5, -8, -6,
+    -6, -5, -7, -7, -6, -5, -6, -5,
+    -7, -7, -7, -6, -7, -5, -7, -6,
+    -6, -7, -6, -7, -7, -7, -6, -6,
+    -7, -7, -7, -6, -7, -7, -7, -7,
+    -7, -7, -8, -7, -7, -7, -5, -7,
+    -7, -8, -8, -6, -6, -6, -7, -6,
+    -8, -7, -7, -7, -6, -6, -7, -6,
+    -7, -6, -7, -7, -6, -7, -6, -7,
+    -8, -6, -6, -7, -6, -6, -7, -6,
+    -7, -8, -7, -6, -7, -5, -9, -6,
+    -7, -7, -7, -7, -6, -8, -6, -6,
+    -6, -6, -7, -6, -5, -8, -7, -6,
+    -8, -7, -6, -7, -6, -7, -6, -7,
+    -6, -7, -8, -6, -7, -6, -7, -6,
+    -7, -9, -5, -6, -7, -7, -6, -7,
+    -5, -8, -6, -6, -6, -6, -7, -6,
+    -7, -7, -7, -7, -5, -6, -7, -6,
+    -6, -7, -6, -6, -7, -8, -6, -8,
+    -6, -6, -7, -7, -9, -6, -8, -7,
+    -6, -7, -7, -6, -6, -7, -6, -6,
+    -7, -7, -7, -9, -6, -8, -7, -7,
+    -8, -6, -6, -7, -6, -8, -6, -6,
+    -7, -6, -7, -5, -5, -6, -8, -5,
+};
+
+constexpr data_dims_t kDwIn45 = {6, 6, 192, 1};
+constexpr data_dims_t kDwFilter45 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut45 = {6, 6, 192, 1};
+
+constexpr dw_conv_params_t kDwParams45 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult46[32] = {
+    1891393503, 1375205291, 1441370971, 2023294513, 1564176004, 1088736093, 1472521613, 2039746705,
+    1229727689, 1460439795, 2098807812, 1404083328, 1956840473, 1495589918, 1143603345, 1562205319,
+    1114449917, 1690467972, 2037217153, 2123520713, 2133528763, 2063555954, 1765042078, 1699795378,
+    1476583920, 1286302448, 1235596458, 1323139949, 1092342194, 1879900196, 1428789744, 1463989219,
+};
+
+constexpr int32_t kConvShift46[32] = {
+    -11, -9, -10, -10, -11, -8, -11, -10,
+    -10, -10, -9, -11, -10, -9, -10, -10,
+    -10, -9, -10, -11, -12, -11, -11, -9,
+    -10, -9, -10, -10, -11, -10, -11, -11,
+};
+
+constexpr data_dims_t kConvIn46 = {6, 6, 192, 1};
+constexpr data_dims_t kConvFilter46 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut46 = {6, 6, 32, 1};
+
+constexpr conv_params_t kConvParams46 = {128, -8, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult48[192] = {
+    1106557111, 1623851539, 1919901936, 2018589389, 1243068254, 1856268639, 1441358200, 1327212550,
+    1142478838, 1267078327, 1783561213, 1706478487, 1348350175, 1294956328, 1379373667, 1596401535,
+    2031684749, 1859412086, 1230383286, 1097191166, 1389775366, 1415623396, 1140330291, 1243836607,
+    1105723878, 1338653310, 1157004877, 1864712834, 1512538259, 1361775677, 1892818063, 1573674871,
+    1955644196, 1477450738, 1901701150, 1574816165, 2010992824, 1236113004, 1104997936, 1397556651,
+    1403837416, 1198763030, 1779591732, 1285860994, 1412281806, 1715826145, 2090547041, 1472843442,
+    1088007994, 1501054115, 1991531197, 1465440254, 1647006687, 1523799260, 1863850419, 1146958026,
+    1086685871, 1998100763, 1499038053, 1433823306, 1434962557, 1222127410, 1513698424, 1391595522,
+    1169811338, 1811335134, 1297090674, 1816042717, 1956334828, 1146328384, 1711056308, 1175547379,
+    2051460759, 1831252189, 1115225324, 1361978976, 1978820451, 1399487309, 1225528044, 1666156459,
+    1938064979, 1937391856, 1390470473, 1231726322, 1141086485, 1577751158, 1195016010, 1281115961,
+    1172365705, 1149758297, 1411747684, 1420772205, 1347095754, 1962040617, 1158510358, 1505065521,
+    2009586269, 1161870429, 1129118023, 1495877778, 1406406665, 1771012523, 1214577438, 1445971137,
+    1163959057, 1076299541, 1320981782, 1484606271, 1399702767, 1846028217, 1884054038, 1659249748,
+    1659422309, 1222545485, 1602409354, 1297821090, 1327251750, 1906315546, 1748395972, 1195393426,
+    1847837284, 1476294755, 1898744077, 1969677453, 1218892333, 1227739137, 1328965004, 1799238759,
+    2025784999, 1084674964, 1218832219, 1257528537, 1408769600, 1990218217, 1422931063, 1511677303,
+    1460554274, 1407250015, 1294986872, 1519838825, 1940284146, 1670107265, 2043061115, 2006350024,
+    1241619386, 1086934791, 1921523462, 1525252214, 1621708634, 1138688046, 1373803766, 2084480567,
+    2141240613, 1277512223, 1360640608, 1216769466, 1722453296, 1273209001, 1272781101, 1187684705,
+    1591472464, 2081405016, 1088775277, 1918017774, 1524124538, 1206556474, 1682273481, 1762365419,
+    1810282649, 1249109243, 2082818575, 1838830467, 1161207909, 1159216748, 1517125710, 1845644381,
+    1114977085, 1514246066, 1781632307, 1337744885, 1080258809, 1852800887, 1468474853, 1292257707,
+    1783098003, 1794171659, 1475173110, 2134349271, 1244694061, 2143657048, 1162028497, 1406216109,
+};
+
+constexpr int32_t kConvShift48[192] = {
+    -6, -7, -6, -7, -6, -7, -6, -8,
+    -6, -6, -7, -7, -6, -6, -6, -7,
+    -6, -7, -6, -5, -6, -6, -6, -6,
+    -6, -6, -6, -6, -6, -6, -7, -6,
+    -7, -6, -7, -6, -7, -6, -6, -6,
+    -7, -6, -7, -6, -6, -6, -7, -6,
+    -6, -7, -6, -6, -7, -7, -7, -6,
+    -6, -6, -7, -7, -6, -6, -6, -6,
+    -6, -6, -6, -6, -7, -6, -6, -6,
+    -7, -6, -6, -6, -7, -6, -6, -6,
+    -7, -7, -6, -6, -6, -6, -6, -6,
+    -6, -7, -6, -6, -6, -7, -6, -6,
+    -7, -6, -6, -6, -6, -7, -6, -6,
+    -6, -6, -6, -6, -6, -7, -7, -7,
+    -7, -6, -6, -6, -6, -7, -7, -6,
+    -7, -6, -6, -8, -6, -6, -6, -7,
+    -8, -6, -6, -6, -6, -7, -7, -6,
+    -6, -6, -7, -6, -7, -6, -7, -7,
+    -6, -6, -7, -5, -6, -6, -6, -7,
+    -7, -6, -6, -6, -6, -6, -6, -6,
+    -6, -7, -6, -7, -7, -6, -7, -6,
+    -6, -6, -7, -7, -6, -6, -6, -7,
+    -6, -6, -7, -8, -4, -7, -7, -6,
+    -7, -7, -6, -7, -6, -7, -6, -6,
+};
+
+constexpr data_dims_t kConvIn48 = {6, 6, 32, 1};
+constexpr data_dims_t kConvFilter48 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut48 = {6, 6, 192, 1};
+
+constexpr conv_params_t kConvParams48 = {8, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult49[192] = {
+    1785873024, 1499165568, 1143708928, 1463401344, 1116755968, 1743503232, 1224132992, 1756655616,
+    1449017088, 1182395776, 1694824192, 1478421504, 1888532224, 1319789568, 1739607424, 1472563840,
+    1317842176, 1980073600, 1202248832, 1147214848, 1406486016, 1180253056, 1300254848, 1652233088,
+    1720090752, 2010344320, 1136649856, 1628564608, 2077982080, 1245304960, 1930296064, 1933792896,
+    1711704704, 1214298112, 1608394880, 1385759104, 1979415168, 1530251776, 1566235008, 1629821312,
+    1137349888, 1835275648, 1639692288, 1263450752, 1806468480, 1620195712, 1443404416, 1608205312,
+    1191745024, 1257598336, 1560018432, 1121805184, 1187691776, 1753332352, 1510617984, 1240160256,
+    2024006016, 1773122944, 1651054208, 1896375040, 2079411840, 1378986752, 1266800384, 1867071232,
+    1737374848, 1175555584, 1086745472, 1360720128, 1170649856, 1438223616, 1420508544, 1208460672,
+    1769804416, 1363804032, 2003156224, 1289664128, 1427192832, 1232829696, 1075358080, 1269685376,
+    1723983872, 1276569856, 2069313152, 1091610496, 1831285376, 1185391872, 1156291968, 1622465536,
+    2122761472, 1581813376, 1329610624, 1334942848, 1977995904, 1146339456, 1715154432, 1712182656,
+    1757114624, 1791971584, 1355206656, 2078907008, 2009103488, 1635680000, 1906759040, 1641152000,
+    1174832256, 1420286720, 1508306816, 1958083968, 2062718720, 1149861248, 1142094080, 1831655808,
+    2107307392, 1206398208, 1235163264, 1503005056, 1885025664, 2075356160, 1728149760, 1242338176,
+    1923765632, 1801044992, 1167230592, 1396344320, 1510956032, 1320250624, 2125277952, 1419752320,
+    2044537472, 1798757760, 1201669504, 1312977152, 1632067712, 1828049152, 1425571968, 1392478080,
+    1150892928, 2002973056, 1488898304, 2028944768, 1100794880, 1673204096, 1278926336, 2100819072,
+    1123248896, 1864591872, 1578151552, 1272028800, 1901790720, 1327987200, 1859500928, 1181120512,
+    1370430208, 2144595456, 1493581952, 1383248256, 1206358912, 1504849920, 1158206720, 1199594752,
+    1584059008, 1377248128, 1398693760, 1961799680, 1088269952, 1535050752, 1208834816, 1216333568,
+    1751118976, 1113414144, 1990927104, 1162967040, 2100461440, 1414476032, 1846099072, 1268026240,
+    1521959936, 1174212864, 1118864384, 1608561792, 1559892608, 1904096896, 1331349760, 1595406976,
+    2100195840, 1913756800, 1969684352, 1316607104, 1992626176, 1504326272, 1149253248, 1795652608,
+};
+
+constexpr int32_t kDwShift49[192] = {
+    -8, -7, -7, -8, -7, -7, -7, -6,
+    -7, -7, -8, -7, -8, -7, -7, -7,
+    -8, -8, -7, -7, -7, -7, -7, -7,
+    -7, -8, -7, -8, -8, -8, -8, -8,
+    -7, -7, -8, -8, -8, -7, -8, -8,
+    -7, -8, -8, -7, -7, -8, -7, -7,
+    -7, -7, -8, -7, -7, -8, -7, -7,
+    -8, -8, -7, -7, -8, -7, -7, -8,
+    -8, -7, -7, -7, -7, -7, -7, -7,
+    -8, -7, -8, -7, -7, -7, -7, -7,
+    -7, -7, -8, -7, -8, -7, -7, -7,
+    -8, -7, -7, -8, -8, -7, -8, -7,
+    -8, -8, -7, -8, -7, -7, -8, -7,
+    -7, -7, -7, -8, -8, -6, -7, -8,
+    -8, -7, -7, -7, -8, -8, -8, -7,
+    -8, -8, -7, -7, -7, -7, -8, -7,
+    -7, -8, -7, -7, -7, -7, -7, -7,
+    -8, -8, -7, -8, -7, -8, -7, -8,
+    -7, -8, -7, -8, -8, -7, -8, -7,
+    -7, -8, -7, -8, -7, -7, -7, -7,
+    -7, -7, -7, -8, -7, -7, -7, -7,
+    -8, -7, -8, -7, -8, -8, -8, -7,
+    -7, -7, -7, -6, -8, -7, -7, -8,
+    -8, -8, -8, -7, -8, -7, -7, -7,
+};
+
+constexpr data_dims_t kDwIn49 = {6, 6, 192, 1};
+constexpr data_dims_t kDwFilter49 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut49 = {3, 3, 192, 1};
+
+constexpr dw_conv_params_t kDwParams49 = {128, -128, 1, {2, 2}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult50[56] = {
+    2007031750, 1757099756, 1982276740, 1262805718, 1282737958, 1124545127, 1207691540, 1429707004,
+    2018560142, 1902068233, 1082886839, 1476077890, 1461779993, 1997940336, 1126723026, 1212824577,
+    1495769916, 1406091690, 1076069914, 1463688500, 1084780632, 1510235586, 1098643126, 1141304276,
+    1202324075, 1138312415, 1251609098, 1822829890, 1461413383, 1769267923, 1713045112, 1569511003,
+    1111849118, 1109606448, 1148055425, 1542571302, 1229502858, 2019393471, 1945021791, 1244502910,
+    1426489015, 1237050990, 1354692908, 2139809674, 1297225511, 1332145856, 1926049527, 2038419562,
+    1323678370, 1986469419, 2091238124, 1465614615, 1316778313, 1479625011, 1962545601, 1359961521,
+};
+
+constexpr int32_t kConvShift50[56] = {
+    -10, -10, -10, -9, -9, -9, -9, -9,
+    -10, -10, -9, -9, -9, -10, -9, -9,
+    -9, -9, -9, -9, -9, -9, -9, -9,
+    -9, -9, -9, -10, -9, -10, -10, -9,
+    -9, -9, -9, -9, -9, -10, -9, -9,
+    -9, -9, -9, -10, -9, -9, -10, -10,
+    -9, -10, -10, -9, -9, -9, -10, -9,
+};
+
+constexpr data_dims_t kConvIn50 = {3, 3, 192, 1};
+constexpr data_dims_t kConvFilter50 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut50 = {3, 3, 56, 1};
+
+constexpr conv_params_t kConvParams50 = {128, 18, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult51[336] = {
+    1558131137, 1117128299, 2058926463, 1615600464, 1936074371, 2090713490, 1279729058, 1161199688,
+    1907021776, 1711282146, 1531773112, 1426210735, 1596401856, 1457378183, 1448708248, 1334771787,
+    1327189892, 1158829239, 2036756717, 1880083644, 1944216700, 2020615750, 1622227065, 1310415668,
+    1076362589, 1426413310, 1137325449, 1222294124, 1800600249, 1306517897, 1676412337, 2117770300,
+    1165359438, 1723328630, 1664437634, 1475074090, 1350388926, 1765934708, 1247813581, 1903570321,
+    1913498173, 1666098616, 1122537759, 2067977707, 1568401087, 1559616511, 1384692438, 1847448149,
+    1821108752, 1226274358, 1819250276, 1412306818, 1838834622, 1505098783, 1385503258, 1311059608,
+    1885911412, 1517216526, 1454901822, 1184896365, 1879054226, 1964024725, 1116778646, 1506537258,
+    1084373994, 1112747214, 1851741950, 2019480159, 1566790521, 1280039238, 1680778961, 1088357680,
+    1673254517, 1164589394, 1881748665, 1479879604, 1621158305, 2050076620, 1239128144, 1104004717,
+    1758567373, 1817906249, 2074536046, 1533967562, 1636119389, 1197364151, 1492766089, 1624644022,
+    1084869162, 1296532985, 1110843273, 1215625053, 1812606348, 1868853973, 2132406092, 2108252939,
+    2066152972, 1960466706, 1630352980, 1974014978, 1342161659, 1690978172, 1679851286, 1333462412,
+    1646669295, 1120547577, 1308988526, 1616427307, 1097522979, 1851386956, 1166007026, 2043524926,
+    1099344848, 1401133945, 1196825472, 1769138644, 1884179952, 1351680584, 1853293373, 1925155271,
+    1715252219, 1109529859, 1608329401, 1160671300, 2040088582, 1145647946, 2029357987, 1243281641,
+    1145762456, 1918758601, 1477968107, 1937183256, 1183805718, 1795400529, 1325082334, 1816968282,
+    1784272600, 1207382934, 1080598810, 1848553125, 1109085889, 1626277256, 2022811763, 1723660566,
+    1593881854, 1170605666, 1713238327, 1501353952, 1810161904, 2022965486, 2141417734, 1170885362,
+    1671290780, 1772755937, 1635980648, 1640937669, 1870966091, 1820608113, 1166851586, 1708728012,
+    1264602136, 1123756203, 1682392002, 1213784033, 1602236789, 2094375076, 2058844651, 1607451751,
+    1562684052, 1934720443, 2092525849, 1492986902, 1176834414, 2047338931, 2021534696, 1392673750,
+    1883860001, 1134410979, 1369430424, 1179465670, 1714291194, 1223823009, 1276383905, 1953457492,
+    1655250514, 1974621008, 1406454429, 1342791399, 1884437111, 1612126601, 1333163565, 1428037946,
+    1916032506, 1553599197, 1542468924, 2046260530, 2050072712, 1090777112, 1757312973, 1180421093,
+    1795787700, 1247069983, 1164014499, 1404047764, 1208801608, 1111622827, 1287961666, 1358993855,
+    1771329447, 1672228095, 1230231012, 1161059384, 1334476327, 1596533563, 1828353500, 1539645124,
+    1308934984, 1781268372, 1356911960, 1413497384, 1530942360, 1229578344, 1785081466, 1637523863,
+    2146198366, 1642191157, 1371780941, 1320082453, 1834549158, 2020678411, 1686233756, 1810286705,
+    1329454690, 1832807667, 1122625563, 1725343694, 1724430871, 1471505128, 1599824391, 1435163884,
+    1377333571, 1125583283, 1146690000, 1891268632, 1122413608, 1970231717, 1733331259, 1461353597,
+    1411798362, 1362572848, 1524607179, 1635995759, 1393138304, 2128605244, 1869946313, 1585122421,
+    1560761091, 1610040538, 1212345558, 1108616254, 1927859610, 1794304671, 1687584949, 1362410788,
+    1140720626, 1126108675, 1660288826, 1312088895, 1273325223, 1377872902, 2074093769, 1195077468,
+    2110043673, 1340501719, 2077435665, 1839063381, 1758313992, 1075785479, 1140351823, 1083420330,
+    2077906862, 1943956805, 1229734281, 1851280262, 1176916746, 1960348418, 1129134267, 1338237181,
+    1250205005, 1166894055, 2114512431, 1171077124, 1956985939, 1311474788, 1679983383, 1504344762,
+    1745436236, 1099058899, 1348114227, 1457411403, 1357438524, 1372657288, 2144436422, 1989370789,
+    1521165755, 1817281068, 1728952390, 1958767684, 1345055415, 1603553459, 2071683065, 1258817620,
+    1090338222, 1822124752, 1460750303, 1302903339, 1346304604, 1550959603, 2022332619, 1332732492,
+    1340765913, 1168433232, 1084483293, 1138527739, 1120308265, 1755199292, 1888844641, 1739211917,
+    1965953809, 1665317107, 1534690968, 1992705390, 2064880334, 1086105258, 2013964917, 1794424913,
+};
+
+constexpr int32_t kConvShift51[336] = {
+    -7, -7, -7, -7, -7, -8, -8, -7,
+    -7, -8, -7, -8, -7, -7, -7, -7,
+    -7, -7, -8, -7, -8, -6, -6, -7,
+    -6, -6, -7, -7, -8, -7, -7, -8,
+    -7, -8, -8, -8, -6, -8, -8, -7,
+    -7, -7, -7, -7, -8, -7, -7, -8,
+    -8, -7, -7, -7, -8, -8, -6, -7,
+    -7, -7, -7, -6, -9, -7, -7, -7,
+    -7, -7, -7, -8, -7, -7, -8, -8,
+    -7, -7, -7, -7, -8, -8, -7, -6,
+    -7, -7, -7, -8, -9, -6, -8, -8,
+    -7, -7, -7, -7, -7, -7, -7, -8,
+    -8, -7, -7, -7, -6, -6, -7, -6,
+    -7, -7, -6, -7, -7, -8, -6, -7,
+    -7, -6, -5, -7, -9, -7, -7, -7,
+    -7, -8, -6, -8, -7, -8, -8, -7,
+    -6, -8, -8, -7, -7, -7, -7, -7,
+    -8, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -8, -7, -7, -7, -7,
+    -7, -8, -7, -8, -8, -7, -6, -9,
+    -7, -6, -6, -8, -7, -8, -8, -7,
+    -7, -7, -7, -7, -6, -8, -8, -8,
+    -8, -7, -7, -7, -8, -7, -8, -8,
+    -7, -8, -7, -7, -7, -7, -8, -5,
+    -8, -7, -7, -8, -7, -7, -7, -7,
+    -8, -8, -7, -8, -7, -7, -7, -7,
+    -8, -7, -7, -7, -7, -7, -7, -7,
+    -6, -7, -6, -7, -7, -7, -7, -7,
+    -8, -8, -7, -7, -7, -7, -6, -8,
+    -7, -7, -7, -8, -7, -7, -7, -7,
+    -7, -7, -7, -7, -6, -7, -7, -7,
+    -8, -7, -7, -8, -7, -9, -7, -7,
+    -8, -7, -7, -6, -8, -8, -7, -8,
+    -7, -6, -7, -7, -7, -7, -8, -6,
+    -8, -7, -8, -7, -7, -7, -6, -7,
+    -8, -8, -6, -6, -7, -9, -7, -7,
+    -7, -6, -8, -7, -8, -7, -7, -9,
+    -8, -7, -8, -7, -7, -7, -9, -8,
+    -7, -9, -7, -7, -7, -8, -7, -6,
+    -7, -7, -7, -7, -7, -8, -9, -7,
+    -7, -7, -7, -7, -7, -8, -8, -7,
+    -8, -8, -6, -8, -8, -7, -8, -7,
+};
+
+constexpr data_dims_t kConvIn51 = {3, 3, 56, 1};
+constexpr data_dims_t kConvFilter51 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut51 = {3, 3, 336, 1};
+
+constexpr conv_params_t kConvParams51 = {-18, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult52[336] = {
+    1374955008, 1937582080, 1119030144, 1536729728, 1636201984, 1568466944, 1849161344, 1383723776,
+    1594348288, 1486721024, 1704775040, 1212969600, 2130446080, 2124494336, 1850545664, 1780341376,
+    1116966400, 1940700800, 1115280000, 1695248896, 1113994496, 1532813824, 1889004416, 1541475328,
+    1569515776, 1464924800, 1854529920, 1631748352, 1863177600, 1558105088, 2099970944, 1644862464,
+    2055646208, 1166912640, 1149522816, 1232665472, 1994894848, 1513829248, 1523400832, 2029377792,
+    1755502976, 1183736832, 1150170880, 2073844608, 1553338880, 1128946944, 1181203712, 1899469568,
+    1369370880, 1150039808, 1973518464, 1423853824, 1592617344, 1832518784, 1618008960, 1911938048,
+    2026358016, 1570672512, 1161381248, 1100572800, 1932674816, 2132860672, 1971782144, 1083454464,
+    2010007808, 1290334080, 1871767424, 1273904640, 1718384512, 1729528064, 1139513088, 1078698368,
+    1699421824, 1527538688, 1651568512, 1868317696, 2081017216, 1941425536, 1223600768, 1906525952,
+    1259841280, 1310013184, 1230338816, 1962452480, 1076841600, 1515577216, 1220366592, 1714389504,
+    1200157824, 1101873024, 1648102400, 1651211776, 1306427008, 1702885248, 1896758784, 1301312512,
+    1105517824, 1715287680, 1095037440, 1739065472, 1367684992, 1827339136, 2058865664, 1205843584,
+    1667005568, 1141585792, 1702286208, 1080466432, 1186043648, 1512410112, 1328248704, 1153986176,
+    1094066560, 1752204416, 1839276928, 1092310912, 1093805440, 1474509952, 1841305088, 1617894016,
+    1738617600, 2089749504, 1142380928, 2127789440, 1546498816, 1835346944, 1328892672, 1169388288,
+    1194619392, 1162389120, 2012499200, 1296294144, 1319868288, 1679399168, 1260333696, 2095166336,
+    1962538240, 1214092032, 1180548608, 1528729600, 1124652800, 1593489792, 1372726656, 1191853568,
+    2031361920, 1355637120, 1238906112, 2112179840, 1386397312, 1087905152, 1831624192, 1201936512,
+    1732984960, 2070785792, 1126500352, 1534501632, 1823264896, 1159181952, 1079804416, 1848604032,
+    1115728768, 1236379648, 1394677248, 1947895808, 1517274624, 1338986112, 1976270720, 1708874112,
+    1200576512, 1078006528, 2036665728, 1598945408, 1364075264, 1126347008, 1367031808, 1609728512,
+    1973990528, 1364620160, 1318793472, 1700349184, 1524091264, 2115500288, 1123334656, 1746590848,
+    1082013952, 1473423104, 1858800384, 1354995328, 1645729280, 1404528128, 1983219328, 2009416192,
+    1841573504, 1270306560, 1089908352, 1722985472, 1300410368, 1162017664, 1575098112, 1348814464,
+    1674151552, 1197186688, 1109843072, 1907152640, 1087099136, 1491323392, 1989656832, 1133970944,
+    1363839616, 1540029952, 2007134976, 1261014912, 2128057728, 1900147712, 1585468800, 1316133504,
+    1938001024, 1939809664, 1593896448, 1218915968, 1833999488, 1211345408, 1452410880, 2108871296,
+    1191021312, 1387917056, 1576781312, 1826567296, 1867187200, 1534696448, 1559418240, 1611911552,
+    1951996160, 1831222016, 1504331648, 1754889600, 1458539520, 1941433856, 1964931328, 1762619776,
+    1819845760, 1135614336, 1963644672, 1705430144, 1732372096, 1741654656, 1610271488, 1643271552,
+    1240597504, 1342759808, 1482671744, 2135182976, 1121458432, 1149388544, 2136648960, 1880265728,
+    1709880448, 1350628992, 2124709120, 1828313984, 2099427328, 1172665984, 1543416192, 1571334400,
+    1186061696, 1501135744, 1741407360, 1974163072, 1867256064, 1773783424, 1157280512, 1502742784,
+    1284780160, 1076316544, 1562907392, 1881803264, 1233754752, 2117058048, 1112174208, 1971150592,
+    1302167424, 1327917312, 1439041792, 1147939456, 1077543040, 1875339776, 1284384000, 1566554880,
+    1535860480, 1819356928, 1514240128, 1269360640, 1113666688, 1592364672, 1102809472, 2053453056,
+    2068100352, 1567680768, 1918347008, 1308102400, 1293646080, 1244898432, 1962960640, 1282951424,
+    1172871424, 1594280832, 1982880000, 1744418944, 1378977792, 1253229440, 1093805696, 1109114624,
+    1346206848, 1294745216, 1700432128, 1468278016, 2052309504, 1577848448, 1246915328, 1169405824,
+    2108237312, 1672157824, 2081328896, 1515792896, 2067573504, 1517509248, 1199989760, 1695965312,
+    2110596480, 1275609344, 1370772864, 1241470336, 2067821952, 2091184384, 1406563968, 1985619456,
+};
+
+constexpr int32_t kDwShift52[336] = {
+    -7, -7, -6, -6, -6, -7, -7, -6,
+    -6, -6, -7, -6, -7, -7, -7, -7,
+    -6, -7, -5, -7, -6, -7, -7, -8,
+    -7, -7, -7, -6, -6, -6, -7, -7,
+    -8, -6, -6, -6, -9, -6, -7, -9,
+    -8, -7, -7, -9, -7, -7, -6, -6,
+    -6, -6, -7, -8, -6, -6, -8, -8,
+    -7, -8, -6, -7, -6, -7, -7, -6,
+    -6, -6, -9, -6, -7, -7, -6, -5,
+    -7, -7, -8, -7, -5, -6, -7, -7,
+    -6, -7, -7, -6, -5, -6, -6, -7,
+    -6, -7, -8, -7, -7, -6, -7, -6,
+    -6, -7, -6, -8, -6, -7, -7, -7,
+    -7, -6, -8, -7, -6, -8, -6, -6,
+    -6, -8, -8, -6, -5, -6, -9, -7,
+    -6, -7, -7, -6, -7, -6, -7, -6,
+    -7, -6, -7, -8, -6, -7, -7, -7,
+    -6, -6, -5, -7, -5, -7, -6, -5,
+    -8, -6, -6, -7, -6, -6, -8, -6,
+    -7, -6, -6, -6, -6, -7, -6, -5,
+    -6, -7, -6, -6, -6, -6, -7, -7,
+    -6, -6, -7, -8, -7, -6, -6, -6,
+    -7, -6, -6, -7, -7, -7, -6, -3,
+    -6, -6, -7, -7, -6, -7, -6, -7,
+    -6, -7, -5, -7, -7, -6, -8, -6,
+    -7, -5, -5, -5, -6, -6, -7, -7,
+    -6, -6, -7, -6, -8, -6, -7, -6,
+    -7, -6, -7, -7, -7, -5, -7, -8,
+    -6, -5, -7, -7, -7, -8, -6, -6,
+    -6, -7, -6, -6, -6, -7, -6, -6,
+    -7, -6, -7, -6, -6, -7, -6, -7,
+    -6, -6, -7, -7, -6, -6, -8, -6,
+    -6, -6, -7, -7, -7, -6, -7, -7,
+    -7, -5, -6, -7, -7, -6, -6, -7,
+    -6, -6, -6, -6, -7, -6, -6, -8,
+    -7, -7, -6, -5, -5, -6, -6, -7,
+    -6, -7, -7, -7, -5, -7, -7, -6,
+    -7, -6, -6, -6, -7, -6, -6, -6,
+    -6, -5, -7, -7, -6, -6, -6, -6,
+    -6, -6, -6, -6, -7, -6, -6, -6,
+    -7, -7, -7, -7, -7, -6, -6, -7,
+    -8, -6, -6, -5, -7, -6, -6, -7,
+};
+
+constexpr data_dims_t kDwIn52 = {3, 3, 336, 1};
+constexpr data_dims_t kDwFilter52 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut52 = {3, 3, 336, 1};
+
+constexpr dw_conv_params_t kDwParams52 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult53[56] = {
+    1374238984, 1690706248, 1168987915, 1940077374, 1265244223, 2060094094, 2072242613, 2125848187,
+    1950008527, 1255582079, 1542261879, 1140582532, 1950375911, 1225514474, 1960554984, 1884642157,
+    1339868850, 1944834745, 2145291298, 1659935881, 1277496149, 1781892609, 1543835251, 1693689212,
+    1497837702, 1326966937, 1651116944, 1792499120, 1877382462, 1518090193, 1505515521, 1654220228,
+    1316306688, 1875448128, 2115529739, 1260575594, 1340123514, 1658560759, 1553625852, 1199124673,
+    1338831353, 1098711740, 1624291570, 1375526114, 1171878712, 1109821799, 1649523232, 1156979735,
+    1800431710, 1139466891, 1959941607, 1222275240, 1723735943, 1255624576, 1918361447, 1559621432,
+};
+
+constexpr int32_t kConvShift53[56] = {
+    -10, -10, -9, -11, -10, -11, -10, -10,
+    -11, -9, -9, -10, -10, -10, -11, -11,
+    -9, -10, -11, -9, -10, -10, -9, -10,
+    -10, -10, -10, -10, -11, -11, -9, -11,
+    -10, -11, -10, -10, -9, -11, -10, -10,
+    -10, -10, -11, -10, -10, -10, -9, -10,
+    -9, -10, -10, -9, -10, -10, -11, -10,
+};
+
+constexpr data_dims_t kConvIn53 = {3, 3, 336, 1};
+constexpr data_dims_t kConvFilter53 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut53 = {3, 3, 56, 1};
+
+constexpr conv_params_t kConvParams53 = {128, -5, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult55[336] = {
+    1428665765, 1929059891, 1666826432, 1457962136, 1972602693, 1794240643, 1950462218, 1692733192,
+    1594900214, 1991786017, 1865401656, 1259174254, 1659464869, 1985907438, 1519223824, 1968890370,
+    1660746139, 1358026289, 1987058590, 1621594525, 1710502544, 2022818465, 2136447892, 1124851918,
+    1245369405, 1253446466, 1752424036, 1341726544, 1654733337, 1591987298, 1129398077, 1313848249,
+    1924870569, 1568019239, 1669372403, 2099307486, 1636901510, 2113147297, 1288568519, 1806625440,
+    1430357454, 1117363353, 1575455894, 1351660222, 1641433305, 1514767729, 1118225159, 2044145396,
+    1177927632, 1151589627, 1806237213, 1928891771, 1302420490, 1545837874, 1943210101, 1350491134,
+    1761767775, 1753248676, 1640474290, 1101616763, 2025916830, 1512410400, 1380089088, 1223384586,
+    1352295309, 1444268101, 1234891008, 1327736550, 1875666102, 1852125792, 1166619275, 1477968276,
+    1225022465, 1147796208, 1792719658, 1460750559, 1622169872, 2061518465, 1928625758, 1135824719,
+    1152767607, 1950579264, 1621238675, 1085158170, 1689408032, 1713586621, 1934506162, 1772054718,
+    2072950480, 1647785995, 2037208086, 1237457500, 1129524167, 1897354051, 1556725095, 1132872205,
+    1123658433, 2105576420, 1933199355, 1432091250, 1812927664, 1185349237, 1415228013, 1873581322,
+    1599438545, 1752306535, 1262749087, 1460536228, 1904264000, 1227274757, 1694419562, 2021071140,
+    1520396409, 1672434894, 1232915445, 1417045565, 1987118633, 1483274548, 1675616712, 1852753126,
+    1092968686, 2106887027, 1091618481, 1285712149, 1732278354, 1991043918, 1144708103, 1146388316,
+    1626067492, 1198722462, 1868964252, 1557637139, 2059921476, 1789603660, 1863253488, 1576593820,
+    1313826664, 1601575616, 1182269189, 1266971470, 1629290655, 1235169410, 1526400242, 1282644337,
+    1664641479, 1876249203, 1142796003, 1160303294, 1680683116, 1625954247, 2069557221, 1929440821,
+    1316839145, 2066379204, 1741857399, 1404696186, 2026402493, 1714966544, 1388309796, 1856649226,
+    1356218466, 1137560339, 1267149699, 1853629905, 1448116318, 1508376581, 2053108052, 1155271624,
+    1902910527, 1088291497, 1854346467, 1101231044, 1621260869, 1466111097, 1454458368, 1611363368,
+    1573218194, 2039605089, 1700649278, 1822989180, 1865013277, 1966068354, 1800237940, 1632767823,
+    1221815718, 1740577650, 1390117467, 2048305837, 2037126762, 1264889578, 1550974810, 1990464922,
+    1531328471, 1952445762, 1583663073, 1517726248, 1245610261, 1332156163, 1315291710, 1138569667,
+    2112779895, 1979300288, 1223375161, 1146878920, 1937306136, 1669434726, 1261053749, 1536618782,
+    1338840837, 1102731432, 1914073337, 1172407182, 1788512247, 1586093366, 1929811719, 2076144610,
+    1195451036, 1339909144, 2122300418, 1100388848, 1563603274, 1653396433, 1361013841, 1522428139,
+    1335504732, 1415370140, 1804206851, 1956198063, 1165428905, 1189033211, 1176550065, 1546217589,
+    1626496457, 1684749920, 1396971174, 1837641470, 1478764491, 1723266903, 1883370290, 2026143017,
+    1355403099, 1196765139, 1788069602, 2087075457, 2052038225, 1696709248, 1674541868, 1101063380,
+    1538038531, 1614677127, 1877900002, 1325860931, 1208087785, 1951422905, 1093165992, 1128452668,
+    1639165355, 2091102891, 1094404775, 1604125235, 1643858885, 1369561517, 1214908201, 1323870548,
+    1352743731, 1573333871, 1909333141, 1994631899, 1553001220, 2033585903, 1634472129, 1633080654,
+    1625054211, 1760922006, 1821398728, 1210471108, 1153765535, 1169828529, 1478727401, 2005604547,
+    2002914626, 1114544454, 1303615116, 1503064686, 1737769162, 1615117797, 2146991576, 1364173161,
+    1632773447, 1828949388, 1821010653, 1990952257, 1484223986, 1856855500, 2011883666, 1268124446,
+    1982888117, 1698554921, 2125709942, 1328573806, 1369963728, 1382829628, 1456703972, 1537204010,
+    1118769649, 1770965130, 2128072440, 1410267558, 1741203312, 1654396793, 1145956159, 1434203848,
+    1849864835, 1240707036, 1117394363, 1138351917, 1140285222, 1370163466, 1843176209, 1334920416,
+    1572605604, 1400366409, 1457533020, 1678253127, 1590036436, 1988462225, 1945756224, 1643480083,
+    1689349813, 1171104479, 1172533044, 1098982172, 1098427193, 1180349260, 1874391065, 1659115556,
+};
+
+constexpr int32_t kConvShift55[336] = {
+    -8, -8, -7, -7, -8, -7, -7, -7,
+    -7, -8, -7, -9, -7, -8, -7, -7,
+    -7, -7, -7, -8, -6, -8, -7, -8,
+    -7, -7, -8, -7, -7, -7, -7, -7,
+    -7, -7, -8, -8, -7, -7, -8, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -8, -6, -7, -8, -8, -6, -8, -7,
+    -7, -8, -8, -6, -7, -8, -7, -6,
+    -7, -7, -7, -7, -8, -7, -7, -7,
+    -6, -6, -8, -7, -7, -7, -7, -7,
+    -7, -8, -8, -7, -7, -7, -7, -7,
+    -7, -7, -8, -7, -7, -7, -8, -8,
+    -7, -8, -7, -7, -7, -7, -7, -8,
+    -7, -7, -7, -7, -7, -7, -7, -8,
+    -7, -7, -8, -7, -8, -8, -7, -8,
+    -6, -7, -6, -6, -7, -8, -7, -8,
+    -7, -7, -7, -7, -8, -7, -7, -7,
+    -7, -7, -7, -7, -7, -8, -7, -7,
+    -7, -7, -8, -7, -7, -7, -8, -7,
+    -7, -7, -7, -8, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -6,
+    -11, -6, -7, -6, -8, -7, -7, -7,
+    -7, -8, -8, -8, -8, -7, -7, -7,
+    -6, -7, -7, -7, -9, -7, -7, -8,
+    -6, -8, -7, -7, -7, -7, -7, -7,
+    -8, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -8,
+    -7, -7, -7, -7, -7, -7, -8, -7,
+    -7, -7, -8, -7, -7, -6, -7, -7,
+    -7, -7, -7, -7, -7, -8, -7, -8,
+    -6, -6, -7, -8, -7, -8, -7, -6,
+    -7, -7, -8, -7, -7, -9, -8, -7,
+    -8, -8, -7, -8, -8, -8, -7, -7,
+    -8, -8, -8, -7, -8, -7, -7, -7,
+    -7, -7, -7, -8, -6, -8, -7, -7,
+    -8, -7, -8, -7, -8, -7, -8, -7,
+    -7, -8, -7, -8, -7, -7, -7, -6,
+    -8, -8, -8, -7, -7, -8, -7, -7,
+    -7, -7, -8, -6, -7, -8, -7, -7,
+    -7, -7, -6, -7, -7, -7, -7, -8,
+    -8, -7, -8, -7, -7, -8, -8, -7,
+    -7, -7, -6, -6, -7, -7, -6, -7,
+};
+
+constexpr data_dims_t kConvIn55 = {3, 3, 56, 1};
+constexpr data_dims_t kConvFilter55 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut55 = {3, 3, 336, 1};
+
+constexpr conv_params_t kConvParams55 = {4, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult56[336] = {
+    2044254848, 1680410112, 1339932544, 1777544320, 1129116544, 1735797760, 1543202048, 1405113216,
+    1785487744, 2120978304, 1111654016, 1435708544, 1698875904, 2016194816, 1681904128, 2020115584,
+    1191794432, 1451629184, 1133817344, 2017230848, 1676584192, 1316670848, 1912766976, 1519537664,
+    1400035712, 1347007616, 1645892224, 1124218368, 1259696256, 2059830272, 1783636352, 1334914048,
+    2037459712, 1816232064, 1324604672, 1474363776, 1981240192, 1396155008, 1487207680, 1462680448,
+    1998353536, 1666651392, 1773799680, 1518126848, 1074936448, 1429478656, 1536868352, 2049842048,
+    1309320704, 1836312064, 1209913344, 1824741248, 1689605120, 1459956864, 2020650752, 1415488128,
+    1387773312, 1265592320, 1508903040, 1415489280, 1207048320, 2024183424, 1875380736, 1606431488,
+    1339373440, 1160571776, 1114252160, 1226388480, 1856894080, 1225925376, 2127395584, 1673600384,
+    1928973568, 2044954112, 1983339648, 1668297216, 1901689088, 1181261184, 1666961792, 1103070848,
+    1660308608, 1299765888, 1442830208, 1500178304, 1233706368, 1988730112, 1859983616, 2129438720,
+    1916793984, 1742198912, 1845285376, 1513577472, 1918139136, 1688025216, 1291435904, 1554982528,
+    1182547456, 1324469504, 1719645440, 1112109440, 2079087616, 1594527872, 1661510912, 1629462272,
+    1593200896, 1733342848, 1832831360, 1476402048, 1860482688, 2089428992, 1081960192, 1944629120,
+    1587942016, 1497267840, 1769195008, 1161199488, 1836447360, 1107881216, 1351934336, 1092772352,
+    1586509824, 1170897408, 1200411136, 1827438080, 1193934208, 1957604480, 1500624640, 1615412864,
+    1429664896, 1234878592, 1166858112, 1568867456, 1748290048, 1145645184, 1902784896, 1925825664,
+    2002294016, 1222541696, 1095286528, 1301869184, 2145368704, 1802750848, 1522207360, 2112724608,
+    1797735040, 1208523648, 1479984256, 1574081536, 1251139328, 1390942080, 1907883264, 1701640832,
+    1767654400, 1261684224, 1424916352, 1875562496, 2024156800, 1808489344, 2109809536, 2023130752,
+    1909490944, 1107559168, 1682876032, 2052960128, 1948675968, 1131554944, 1217511936, 1261143296,
+    2036792192, 2132187008, 1588572672, 1378342400, 2036687360, 1339103744, 2031298560, 1371488640,
+    1271699328, 1963718144, 1133656704, 1794963968, 1757707520, 1367873792, 1832998528, 1614269568,
+    1430627840, 1297814528, 1085571456, 1687464832, 1150361216, 1468865408, 2071089280, 1982592768,
+    1695781632, 1754340608, 1360672640, 1141289856, 1225429376, 1937044992, 1795665280, 1303953920,
+    1161220608, 1215362304, 1122118400, 2083458048, 1142521600, 1176670080, 2007146624, 1396254336,
+    1840087808, 1299378944, 1777475072, 1876346112, 1560915584, 1409071104, 1230058368, 2089571072,
+    1150219136, 1495467008, 1127443072, 1442483200, 2142837760, 1339499264, 2055181952, 1188047616,
+    2000147712, 1380928768, 1986370688, 1776381184, 1395783424, 1838064640, 1275268096, 1108117376,
+    1284594176, 1208408960, 2038782464, 1210131968, 1189080320, 1174672256, 1127429248, 1924231552,
+    1475211392, 2050014592, 1103908992, 1530864640, 1254632320, 1464647424, 1662644992, 1896286848,
+    1649348224, 1155452928, 2096941824, 1466832512, 1706124928, 2076466176, 1972675200, 1775766784,
+    1549678976, 1194719488, 2095529344, 1296143488, 1349293056, 1604412160, 1138265600, 1431142912,
+    1721467648, 1168958976, 1890367616, 2081152896, 1500737024, 1080572160, 1524674688, 1460517632,
+    1409808768, 1579638400, 1260994432, 1435637632, 2017179136, 1504280448, 1202630656, 1197276416,
+    1237175424, 1217343488, 1407527168, 1897887232, 1529832320, 1431624960, 1113187584, 2117686656,
+    1661539584, 1289946496, 1393110272, 1228905472, 1684516864, 2073275392, 1090272512, 1102661504,
+    1896919680, 1337016832, 1124331136, 1092357760, 1647881984, 1483835904, 1332082688, 1403804800,
+    1308812544, 1563018240, 1549502208, 2051078272, 1642364928, 1211784832, 2038467840, 1921821568,
+    1831401984, 1075311232, 1725050752, 1531844224, 1455543424, 1166895488, 1311507712, 1429507456,
+    1824780416, 1682122880, 1948098176, 1446806144, 1646109056, 1173692288, 1120422912, 1256403840,
+    1781842688, 1958024832, 2005567104, 1968022784, 2049400064, 1701995648, 1349818496, 1754343680,
+};
+
+constexpr int32_t kDwShift56[336] = {
+    -7, -5, -7, -7, -7, -7, -7, -7,
+    -7, -6, -6, -4, -7, -7, -7, -7,
+    -6, -6, -6, -5, -8, -6, -7, -6,
+    -5, -6, -7, -6, -6, -6, -7, -7,
+    -8, -7, -6, -5, -7, -7, -6, -6,
+    -7, -6, -7, -7, -6, -5, -6, -8,
+    -6, -7, -6, -7, -5, -6, -7, -8,
+    -7, -7, -6, -7, -6, -7, -7, -7,
+    -6, -7, -6, -6, -6, -6, -7, -6,
+    -7, -7, -6, -9, -8, -6, -6, -6,
+    -6, -6, -6, -6, -8, -8, -8, -7,
+    -6, -8, -6, -7, -7, -9, -6, -6,
+    -6, -5, -7, -6, -7, -7, -6, -7,
+    -7, -7, -6, -7, -7, -6, -6, -8,
+    -6, -7, -5, -7, -7, -5, -4, -5,
+    -7, -6, -8, -7, -7, -7, -7, -6,
+    -7, -6, -7, -7, -6, -6, -7, -7,
+    -7, -7, -6, -7, -8, -6, -6, -7,
+    -8, -6, -6, -6, -6, -6, -7, -8,
+    -7, -7, -7, -7, -8, -6, -7, -8,
+    -6, -7, -6, -8, -6, -7, -7, -6,
+    -2, -7, -7, -8, -7, -7, -7, -7,
+    -5, -7, -5, -6, -6, -8, -7, -7,
+    -7, -7, -6, -7, -5, -7, -8, -7,
+    -7, -5, -7, -6, -6, -7, -8, -6,
+    -5, -6, -6, -7, -7, -6, -7, -8,
+    -6, -5, -7, -7, -8, -6, -7, -7,
+    -6, -6, -8, -6, -7, -7, -6, -6,
+    -8, -7, -6, -7, -7, -7, -5, -6,
+    -6, -7, -7, -6, -6, -5, -6, -7,
+    -8, -7, -6, -6, -6, -6, -6, -8,
+    -5, -7, -6, -7, -7, -6, -7, -6,
+    -5, -5, -8, -6, -6, -7, -8, -7,
+    -6, -6, -7, -8, -6, -7, -6, -7,
+    -6, -8, -7, -5, -9, -6, -7, -8,
+    -6, -6, -6, -7, -6, -6, -7, -7,
+    -4, -5, -7, -5, -7, -10, -6, -6,
+    -7, -6, -6, -7, -8, -6, -6, -6,
+    -6, -7, -7, -7, -6, -5, -7, -6,
+    -7, -6, -6, -6, -7, -6, -8, -6,
+    -6, -7, -6, -6, -6, -6, -5, -6,
+    -6, -6, -7, -8, -7, -8, -9, -7,
+};
+
+constexpr data_dims_t kDwIn56 = {3, 3, 336, 1};
+constexpr data_dims_t kDwFilter56 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut56 = {3, 3, 336, 1};
+
+constexpr dw_conv_params_t kDwParams56 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult57[56] = {
+    1142635644, 1341767959, 1290569318, 1561005649, 1645076157, 1250464297, 1220085523, 1601355882,
+    1403596634, 1583205291, 1903667473, 1450049116, 1839087987, 1670936295, 1427067070, 1292925674,
+    1334585841, 2033083653, 1381042084, 2003979840, 1226695275, 1493482497, 1281195844, 1676720134,
+    1747590657, 1181289521, 1748648567, 1830843893, 1466136547, 1645039253, 1728453321, 1614093908,
+    1745721269, 1374257267, 1271235975, 1347563895, 1510031176, 1773104123, 1187174412, 1107284001,
+    1134712298, 1595921969, 2064081457, 1938064903, 2040422943, 1361845478, 1394752013, 1957531832,
+    1865064429, 1923345252, 1677543506, 1570755786, 1403491616, 1875567282, 1265949982, 1527904224,
+};
+
+constexpr int32_t kConvShift57[56] = {
+    -9, -9, -9, -10, -10, -10, -9, -9,
+    -10, -9, -9, -10, -10, -10, -10, -10,
+    -9, -10, -10, -9, -10, -10, -9, -10,
+    -10, -9, -10, -10, -10, -10, -8, -10,
+    -10, -10, -10, -10, -9, -10, -10, -9,
+    -9, -10, -10, -10, -10, -10, -8, -10,
+    -9, -10, -10, -10, -9, -10, -10, -10,
+};
+
+constexpr data_dims_t kConvIn57 = {3, 3, 336, 1};
+constexpr data_dims_t kConvFilter57 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut57 = {3, 3, 56, 1};
+
+constexpr conv_params_t kConvParams57 = {128, -4, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult59[336] = {
+    1805937601, 1433200642, 1142366459, 1918776570, 2114881319, 1345317168, 1084823051, 2036993097,
+    1551839729, 1646572789, 1410767609, 1562657860, 1086091615, 1372815272, 1842485597, 1851842498,
+    1649649317, 1917561268, 1207889744, 1495981965, 1313465914, 1535568617, 1446139144, 1162754462,
+    1997362288, 2043860895, 1727501116, 1341866831, 1629079607, 2039884937, 1210668208, 1837322380,
+    1447294816, 1694373078, 1141355024, 1609513112, 1643322531, 1880848084, 2056249844, 1835872270,
+    1229791515, 1987870658, 1214140141, 1736048514, 1277605504, 1198574342, 1523811250, 1853379150,
+    1628074296, 1976847694, 1980574177, 1562249643, 1825204500, 1580817757, 1697009803, 1451743937,
+    1842647884, 1424077583, 1780057052, 1596449551, 1439373843, 1203940216, 1234545227, 1844592108,
+    1546923085, 2062712165, 1361643880, 1969361529, 1355624586, 1969258064, 2030359142, 1585100239,
+    1532205870, 1747486947, 2045527925, 1725668737, 1763793836, 2039413869, 1877725464, 1672680733,
+    1335265914, 1832930793, 1859313836, 1490065167, 1089499889, 1731413255, 1154761291, 1710923318,
+    1153694981, 1320369086, 2091038466, 2088783527, 1551332561, 1200186417, 1644741215, 1533790709,
+    1136755945, 2037106231, 1078668060, 1546912449, 1688152818, 1237118939, 1870475397, 1133122692,
+    1174016264, 1098280002, 2120784579, 1762523096, 1280046098, 1156603581, 1695919239, 1363985201,
+    1253038160, 1286360636, 1435715208, 1152264210, 1406758936, 1702660849, 1501427694, 1961629596,
+    1884677709, 1516472223, 1257673661, 1991315596, 1315496036, 1360743001, 2039668823, 1734673021,
+    1593978820, 1733880763, 1303776139, 1468204572, 1345083407, 1728193295, 1625796472, 1516982614,
+    1314269776, 1134107455, 1464428774, 1476914741, 1215485820, 1488068244, 1148781158, 1288745389,
+    1406349431, 1642098205, 1702421044, 1406905108, 1717280080, 1594660201, 2096819728, 1506672780,
+    1321388982, 2071253278, 1687545571, 1721892455, 1912709572, 1218020531, 1280701210, 1573479214,
+    1451426614, 1986561240, 1297872799, 2117623603, 1601695281, 1426145900, 1123468372, 1473092207,
+    1535835496, 1763117129, 2052267762, 1985856168, 1469035509, 1530049238, 1530120309, 1543184193,
+    1611460237, 1228802723, 1533566053, 1327640265, 1279231680, 1397828785, 1345096139, 1452566493,
+    1836766058, 1561937156, 1828603186, 1098373554, 1242775545, 1481220430, 1546158868, 1353012518,
+    1188380783, 1473079153, 1773814552, 2022104570, 1730891905, 1409760042, 1523130675, 1647326208,
+    1916669414, 1798604376, 1389413215, 1767771889, 1234720326, 1132606338, 1930491551, 1265079408,
+    1979494249, 2038824188, 1706861624, 1100527366, 1472259498, 1863875446, 1628786297, 1637027332,
+    1238357447, 1850484409, 1605994524, 1806782719, 1640714653, 2109300860, 1561511212, 1610561775,
+    1075423120, 1269632718, 2119232938, 1475403874, 1445232140, 1252641225, 1915564023, 2033468224,
+    1402968795, 1889282026, 1456780483, 1942347225, 1759346005, 2111987545, 1250182742, 1898618460,
+    2063721666, 1650267685, 1356478568, 1708767976, 1556387318, 1487574130, 1322692518, 1699969330,
+    1535384895, 2064719725, 1546638156, 1262173064, 1716370820, 1081398580, 1719301499, 1307410842,
+    1829534686, 1930406298, 1868622712, 1756595985, 1778007429, 1567309719, 1444777671, 1669656904,
+    1865459802, 1306202793, 2141607631, 1312797829, 1328007950, 1375243618, 1977127305, 1609594659,
+    1800166652, 1471909621, 1624187943, 1524863781, 2076295948, 1325660022, 1501560489, 1097323925,
+    1632470879, 1077520526, 1563738593, 2005804610, 1351859908, 1727077268, 1367307174, 1506886477,
+    1831419926, 1103565216, 1632209156, 1372427684, 1806835096, 1436695539, 1626584863, 2024187230,
+    1618430371, 1498568569, 2091570291, 1520599026, 1315621015, 1482516311, 1676417531, 1282326419,
+    1384823402, 1922491288, 1452882526, 2072674541, 1321379635, 1300719353, 2082122496, 1224156424,
+    1137820159, 2031744949, 1341736212, 1349456139, 2022969994, 1382339778, 1959921953, 1129355033,
+    1561675595, 1439081984, 1591279243, 2076438574, 1412150838, 1266406312, 1900131261, 1556526559,
+    1914240423, 1683430210, 1888704432, 1557545246, 1130327548, 1980733241, 1488793460, 1716334398,
+};
+
+constexpr int32_t kConvShift59[336] = {
+    -6, -7, -7, -7, -7, -7, -6, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -8, -6, -6,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -6, -7, -6, -6, -7, -7, -7, -7,
+    -6, -7, -7, -6, -6, -7, -8, -7,
+    -7, -7, -7, -7, -7, -7, -7, -6,
+    -8, -7, -7, -7, -6, -5, -6, -8,
+    -7, -7, -6, -7, -7, -7, -6, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -6, -7, -7, -7, -5, -7, -6, -7,
+    -6, -7, -7, -7, -7, -7, -7, -7,
+    -6, -7, -7, -7, -7, -7, -7, -6,
+    -6, -6, -7, -7, -6, -6, -7, -6,
+    -6, -6, -7, -7, -7, -7, -7, -7,
+    -7, -6, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -6, -7, -7, -7,
+    -7, -6, -7, -7, -6, -6, -6, -6,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -6, -7, -7,
+    -7, -7, -7, -7, -7, -7, -6, -7,
+    -6, -6, -8, -8, -7, -8, -7, -7,
+    -7, -6, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -6, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -6, -6, -8, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -6, -7, -7, -7, -7, -7, -7, -7,
+    -6, -8, -7, -7, -7, -6, -7, -7,
+    -6, -7, -7, -7, -7, -8, -7, -8,
+    -7, -7, -6, -7, -7, -8, -7, -6,
+    -8, -7, -7, -7, -7, -7, -7, -6,
+    -8, -8, -7, -7, -7, -7, -8, -7,
+    -7, -7, -8, -6, -7, -6, -8, -7,
+    -7, -7, -7, -7, -7, -7, -6, -6,
+    -7, -6, -7, -7, -7, -8, -6, -7,
+    -7, -7, -7, -7, -8, -7, -7, -7,
+    -7, -6, -7, -7, -7, -7, -8, -7,
+    -7, -7, -7, -7, -7, -7, -8, -7,
+    -7, -8, -6, -6, -7, -7, -7, -6,
+    -7, -6, -7, -7, -7, -6, -8, -7,
+    -8, -7, -7, -6, -6, -7, -7, -7,
+};
+
+constexpr data_dims_t kConvIn59 = {3, 3, 56, 1};
+constexpr data_dims_t kConvFilter59 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut59 = {3, 3, 336, 1};
+
+constexpr conv_params_t kConvParams59 = {4, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kDwMult60[336] = {
+    2092523392, 1825700608, 2047660032, 1166098816, 1569132672, 1512514688, 1785836672, 2025808128,
+    2039729152, 2077989632, 1641798272, 1215756160, 2047205504, 1728667520, 1940382336, 1113942400,
+    1434508544, 2063797888, 1759298560, 1856140672, 1122367360, 1900011264, 1700499456, 1883640960,
+    1656120832, 1620142464, 1963137792, 1327901312, 1503940224, 1139320064, 1316744832, 1429965312,
+    1315227392, 1709624192, 1650264448, 2099921920, 1773174656, 1140816512, 2124889088, 1867232768,
+    2127577600, 1489454592, 1118950656, 1140529920, 2019804288, 1538157440, 1688996352, 1978910848,
+    1428400768, 1986677888, 1897400192, 1204203392, 1756217856, 2106861312, 2092078464, 2145186176,
+    2116106240, 2105422848, 1091113728, 1114411648, 1917626112, 1365528320, 1423095168, 1797772544,
+    1080786816, 1117278464, 1275383808, 1192800256, 1802123264, 1677305344, 1718810240, 1175724288,
+    1862540544, 1534152192, 1545780480, 1263846400, 1375131776, 1973051904, 1087317632, 1430007680,
+    1581764864, 1735245696, 1696302336, 1196902016, 1566295552, 1076846720, 1985016064, 1160791680,
+    1446461184, 1367990656, 1207024640, 1083166208, 1248016512, 1493091584, 1200329600, 1826187904,
+    1633472768, 2060739200, 1369040768, 1441101824, 1864165888, 1723704320, 1971793792, 2119767808,
+    2059859328, 1373484800, 1361802752, 1458317568, 1763640704, 1342494336, 1536165632, 1242495360,
+    2091370880, 1513347072, 2057106816, 1930946176, 1230034944, 1297238656, 1546478208, 1110950144,
+    1770087808, 1973780096, 1671272320, 1468591232, 1717870848, 1900168064, 2097896832, 1336091904,
+    1635247872, 1634118656, 1587636480, 1149183872, 1399025664, 1419373696, 1918968448, 1772732544,
+    1169315968, 1699654528, 1461590400, 2084265472, 1557172608, 1223287808, 1125166208, 1907088640,
+    1318632064, 1503617408, 1386245504, 1958073856, 1503892352, 1257164928, 1080848640, 1803441280,
+    1743986304, 1218788992, 1259363200, 1393414528, 1980721152, 1824837504, 1637964032, 1852102784,
+    1371423232, 2042359680, 1306250880, 1927182592, 1618248448, 1785296000, 1273319424, 1162100224,
+    1151324672, 2128414976, 1775311360, 1127858176, 1262799360, 1584714112, 1735292928, 1948263168,
+    1531628672, 1153902336, 1130819328, 1468925312, 1563337856, 1658287872, 2106491008, 1760945280,
+    1953537024, 1527797632, 1484488192, 1310251904, 1774539392, 1573628416, 1799693056, 1402372864,
+    2128335488, 1690910592, 1192800128, 2017294080, 1427536896, 1261671936, 1816987648, 1354592512,
+    1821118464, 1664338304, 1752075008, 1959238912, 1461760512, 2001408384, 1162280704, 1794645248,
+    1424988288, 1562868096, 1150541184, 1357656832, 1186684800, 1714353920, 2010112128, 1939127168,
+    1816899328, 1333653760, 1614874112, 1132552064, 2104993024, 1368433152, 1798782976, 1818921472,
+    1780953088, 1824205696, 2138521856, 1717254144, 1692877952, 1941957376, 1353848064, 1257928448,
+    1928152832, 1961446272, 1868326400, 1110178688, 1600009728, 1280197504, 1481130368, 1234086400,
+    1258449408, 1927100032, 1592063232, 1957230336, 1352603008, 1209928448, 1918547840, 1840185088,
+    1523195008, 1608261504, 1114139136, 1649639424, 1312562944, 1683965824, 1425780352, 1180768512,
+    1609127936, 1219622016, 1885837824, 1797062400, 1227175296, 1831030784, 1595621376, 2075457408,
+    1221318272, 1554846464, 1351901952, 1611008128, 2136841344, 1825858304, 1855310848, 1880174208,
+    1703050496, 1420219904, 1445696512, 1702715904, 1359079936, 1973215872, 1205463808, 1260426752,
+    1282566016, 1504634880, 1836232960, 1552229248, 1576909696, 1393584384, 1302407680, 1542235776,
+    1120246912, 1196916736, 1395208320, 1751679872, 1413397248, 1721364352, 1149961600, 1935013120,
+    1787413760, 1540425728, 1629925632, 2008854912, 1363050752, 1898017536, 1157679872, 2114842496,
+    1916448768, 1119781504, 1782960384, 1931050752, 1136736256, 1112201600, 1440790400, 1083027712,
+    1082130944, 1137757184, 2095416576, 1181948544, 1079720832, 1081951104, 1078731008, 1482933120,
+    1123961344, 1500586368, 2119657472, 1269830784, 1619165952, 1527256704, 1343476864, 1207728384,
+    1824275456, 1785686784, 1503837184, 1076881792, 1115076224, 2037494016, 2052612608, 1722962944,
+};
+
+constexpr int32_t kDwShift60[336] = {
+    -7, -7, -7, -6, -4, -7, -7, -7,
+    -7, -8, -7, -6, -7, -7, -7, -6,
+    -7, -8, -7, -7, -6, -6, -8, -7,
+    -7, -7, -7, -6, -7, -7, -6, -7,
+    -7, -7, -7, -9, -7, -6, -7, -7,
+    -8, -7, -6, -7, -8, -7, -6, -8,
+    -6, -8, -7, -6, -7, -7, -8, -8,
+    -7, -7, -5, -6, -7, -8, -7, -7,
+    -7, -7, -7, -6, -7, -7, -8, -6,
+    -7, -7, -7, -6, -6, -7, -6, -7,
+    -7, -7, -8, -6, -8, -6, -7, -6,
+    -8, -7, -6, -6, -6, -7, -6, -7,
+    -7, -7, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -6, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -6,
+    -7, -8, -8, -7, -7, -7, -7, -7,
+    -7, -7, -7, -6, -7, -7, -7, -7,
+    -6, -6, -7, -7, -7, -8, -6, -8,
+    -6, -6, -7, -7, -7, -6, -7, -7,
+    -7, -7, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -8, -7, -7, -7, -6,
+    -6, -9, -7, -6, -7, -5, -7, -7,
+    -6, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -6, -8, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -8, -6, -7,
+    -7, -8, -7, -6, -6, -8, -8, -8,
+    -7, -6, -7, -6, -7, -6, -7, -7,
+    -7, -6, -7, -7, -7, -7, -7, -7,
+    -8, -7, -7, -7, -7, -6, -7, -6,
+    -7, -7, -8, -7, -6, -6, -7, -7,
+    -6, -6, -6, -7, -7, -7, -7, -6,
+    -6, -6, -7, -7, -6, -7, -5, -8,
+    -7, -7, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -6, -7,
+    -6, -7, -7, -7, -7, -6, -7, -7,
+    -6, -6, -7, -7, -6, -7, -5, -7,
+    -7, -7, -7, -8, -7, -7, -6, -7,
+    -7, -6, -7, -7, -7, -6, -6, -6,
+    -6, -6, -7, -7, -6, -6, -6, -6,
+    -7, -7, -7, -7, -7, -7, -6, -6,
+    -7, -7, -7, -6, -6, -7, -7, -8,
+};
+
+constexpr data_dims_t kDwIn60 = {3, 3, 336, 1};
+constexpr data_dims_t kDwFilter60 = {3, 3, 0, 0};
+constexpr data_dims_t kDwOut60 = {3, 3, 336, 1};
+
+constexpr dw_conv_params_t kDwParams60 = {128, -128, 1, {1, 1}, {1, 1}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult61[112] = {
+    1322106334, 1590703462, 1578559671, 1779910580, 1902524780, 1650432577, 1525603504, 1372795229,
+    1169592875, 1087455406, 1449927952, 1134427767, 1818455093, 1199258120, 1663984007, 1141890694,
+    1225170251, 1146755150, 1087216350, 1285977588, 2143362780, 1145951278, 2120841325, 1793944275,
+    1422962711, 1395136157, 1077255203, 1292547170, 1427327009, 1171402995, 2094627062, 1948838502,
+    1822693635, 1183831022, 2088116206, 1976243298, 1094967468, 1912455575, 1691692912, 2028177893,
+    1380178569, 1919265992, 1961721803, 2094978429, 1328905084, 1829866689, 2008130634, 2030692229,
+    1170018093, 1336142895, 1534699186, 1520978202, 1082122922, 1315674174, 1094928911, 1306919082,
+    1127708306, 1151088306, 1503353927, 1682014618, 2106900761, 1307172572, 1338773002, 2018814188,
+    1341430296, 2127799842, 1773879022, 1837702534, 2109040003, 1106357314, 1487760043, 2082265967,
+    1244073939, 1913548034, 1226170074, 1269502323, 1340000114, 1991273947, 1654420001, 1995107736,
+    1949418049, 2024675302, 1900230122, 1161993614, 1210194274, 1076649556, 1555390353, 2050910129,
+    1698738232, 1989713461, 1466571091, 1258509816, 1459744657, 1568170142, 2140137803, 1199365191,
+    1204401673, 1148874520, 1182839999, 1169136415, 1911629261, 1924784836, 1663754838, 1454709857,
+    1495059051, 1333128994, 2066384485, 1819440184, 2029982971, 1167493179, 1700217253, 1189109822,
+};
+
+constexpr int32_t kConvShift61[112] = {
+    -9, -10, -10, -10, -10, -10, -9, -9,
+    -9, -9, -9, -9, -10, -9, -10, -9,
+    -9, -9, -9, -9, -10, -9, -10, -10,
+    -9, -9, -9, -9, -9, -9, -10, -10,
+    -10, -9, -10, -10, -9, -10, -10, -10,
+    -9, -10, -10, -10, -9, -10, -10, -10,
+    -9, -9, -10, -9, -9, -9, -9, -9,
+    -9, -9, -10, -10, -10, -9, -9, -10,
+    -9, -10, -10, -10, -10, -9, -10, -10,
+    -9, -10, -9, -9, -9, -10, -10, -10,
+    -10, -10, -10, -9, -9, -9, -10, -10,
+    -10, -10, -9, -9, -10, -9, -10, -9,
+    -9, -9, -9, -9, -10, -10, -10, -10,
+    -10, -9, -10, -10, -10, -9, -10, -9,
+};
+
+constexpr data_dims_t kConvIn61 = {3, 3, 336, 1};
+constexpr data_dims_t kConvFilter61 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut61 = {3, 3, 112, 1};
+
+constexpr conv_params_t kConvParams61 = {128, -8, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kConvMult62[1280] = {
+    1941599457, 1089204886, 1688341179, 1113040353, 2094902529, 2121653524, 1165227015, 1919908086,
+    1787627534, 1154355809, 1887498885, 1297370184, 1937024069, 1595677029, 1512087754, 2129703249,
+    1144066200, 1882869472, 1924013821, 2115652274, 1988254356, 1237319819, 2027828665, 2012769112,
+    1132305570, 1387819557, 1194588693, 1873644288, 2077571441, 1822866420, 1122959493, 2036040631,
+    1098305779, 1126322052, 1228940226, 1109064709, 1985383573, 1829025270, 2116967766, 1270768090,
+    1334343007, 1288811281, 1267531810, 2033770421, 1080293578, 2018767048, 2049135563, 1403001661,
+    2015402417, 1853929305, 1469208473, 1208069008, 2050829893, 1828534074, 1990378400, 1392367850,
+    1327385465, 1332674612, 1880874193, 1131547563, 1256697726, 2138837949, 1915138308, 1243504687,
+    2075460157, 2003480623, 1303878374, 2013433653, 1204592350, 1258134111, 2115031815, 1074260510,
+    1860046394, 1863097149, 1495555274, 1182162693, 1851288046, 1899997552, 1445486525, 1185408751,
+    1261037458, 2110967842, 2101792209, 1155926097, 1678414001, 2119541577, 2001560747, 1231133542,
+    2044751583, 1855824158, 1112543688, 1153723832, 1089935218, 1930666519, 1628994381, 1214322071,
+    1075337364, 1670444651, 1942174011, 1495316636, 1238368418, 1613369720, 1946088172, 1823989344,
+    1782639502, 1903346605, 1101223792, 2082884121, 1260626222, 2053614169, 1933602762, 1932898614,
+    1983783869, 1088390534, 1873156903, 1122244324, 1971595928, 1943653898, 1989643097, 1174546079,
+    1373872655, 1846714813, 1958140885, 2015017779, 2031057073, 1649487589, 2109907560, 1889863556,
+    1356489447, 1108628946, 1120875553, 1312657769, 2058438304, 1178345893, 2137057113, 1863115876,
+    2060401930, 1328882505, 2024734491, 1084458061, 1074610926, 1158691895, 1879964551, 1989300054,
+    1148081285, 2080109290, 1984042394, 2119586984, 1958422279, 1235213424, 1263961437, 1129053712,
+    1175890821, 1093528875, 1454097216, 1804380091, 2087411118, 1944821733, 1111218335, 1078285455,
+    1736757691, 2062538569, 1220732320, 1915343636, 1139269575, 1845399652, 2085996358, 1274647864,
+    2057468837, 1935641791, 1171417601, 1877279044, 1808361204, 1342120536, 1241914596, 1764288236,
+    2006632137, 1121712609, 1307069330, 2134477833, 1836764103, 1195938821, 1345682541, 1413688502,
+    1408026483, 1285339429, 1227339611, 1094570762, 1659252360, 1902922857, 1291498611, 1131887208,
+    2049951572, 2008733975, 1081970425, 1144007535, 1987268482, 2128166188, 1443139255, 1872722217,
+    1942546551, 1924941029, 1903557734, 1264829152, 2053530149, 1075540786, 2146101826, 1110523302,
+    1091383867, 2042975884, 1297073130, 1099210864, 1826480792, 1115991842, 1511876957, 1990482804,
+    1227464316, 1533067850, 1205489894, 2058916243, 1144589961, 2035265057, 1116900738, 1107118401,
+    1931717853, 1952469088, 1276183848, 2126672214, 1955900505, 1121076904, 2123706971, 1123468753,
+    2043738531, 1233713650, 1913193408, 2075352770, 1842952121, 1657247469, 1827212284, 2124545021,
+    2020320349, 1458259627, 1734081796, 1737184587, 1660892168, 1110017604, 1255099762, 1574752781,
+    2084132827, 2125454166, 1996491511, 1305303491, 1932574298, 1204966299, 2130921463, 1906372669,
+    1156009206, 1927059770, 2078336740, 1771427656, 1123876758, 1722021791, 1988813332, 1938584662,
+    1147671209, 2029820298, 1918868354, 2145650403, 1129652379, 2106987890, 1929757706, 1186261136,
+    2035131321, 1928537669, 1164157949, 1339129689, 1250267342, 1262744797, 2144239952, 1338093353,
+    1990798171, 1310683950, 1979868217, 1270746961, 1268114651, 1108337278, 1220149314, 1155486274,
+    1295988487, 2133406945, 1944446541, 1922843500, 2046136181, 2076871436, 1971369222, 1126980047,
+    1329452087, 1108662588, 1940120232, 2131613348, 2052604598, 1845718002, 1102218780, 1227032530,
+    1176612453, 2135343559, 2145785134, 2027968865, 1884321353, 1688907778, 1817959922, 1823725683,
+    1641720252, 1345534055, 1194239767, 2107354796, 2076286938, 1232705570, 2063550295, 1658950417,
+    1654104904, 1302592712, 1201926813, 1699828286, 2111465833, 1743346421, 1465249899, 1294838798,
+    2092479359, 1095345342, 1554162460, 1196043639, 1721043872, 1132683331, 1074058165, 1336727068,
+    2126472189, 1989853231, 1245029816, 1241422239, 1105851962, 1133792086, 1905455569, 1235538817,
+    1129135827, 1842855837, 1722436590, 2030078160, 1626363728, 1444022050, 1682666730, 2111810201,
+    2107626743, 1891218324, 1987212303, 1307586627, 1269989865, 1293108506, 2059834336, 1561157538,
+    1179863979, 1210990004, 1100836254, 2146872262, 1436602064, 1700536246, 1315111349, 1197930951,
+    1087249711, 2011402578, 1464335948, 1252191112, 1192306551, 1106386743, 1317540817, 2144903001,
+    1086039618, 1162731010, 2101428286, 1190207613, 2119214941, 1274784170, 2125063230, 2126887154,
+    2068554403, 1334097160, 1094836496, 2139691743, 1151281935, 1212617880, 1316102940, 1198740083,
+    2033929679, 1339640109, 1861257482, 1929945302, 1887388349, 2094607712, 1258927997, 1192565572,
+    1095191635, 1110300159, 1603816575, 1898253175, 1868830926, 1722451174, 1769678970, 2017293292,
+    2043916018, 1805294539, 1803912593, 1440742600, 2040570445, 1659652908, 1386812306, 1327044246,
+    1082847254, 1079559683, 1381031631, 1186062685, 1711016268, 1076714339, 1346124684, 1896391301,
+    1829255125, 1924752604, 1249605038, 1259923565, 1081513118, 2068054589, 1888193752, 1099496069,
+    2014339980, 1157464401, 1811085986, 1166785951, 2065595954, 1242992776, 1238440672, 2126592668,
+    1320057620, 1168210405, 1919343310, 1920748954, 1383699654, 2050290637, 1325485475, 1133923751,
+    1194338454, 1814255232, 1175888584, 1988209280, 1772475841, 1837222984, 1177196205, 1981371636,
+    1334839258, 1115601321, 1258715957, 1123564043, 2135795977, 1199574239, 1690161291, 1841500737,
+    1761977921, 1937826821, 1410564830, 1128417510, 2079931969, 1210498145, 1146395158, 2084196630,
+    2146990587, 1253251726, 2078105725, 1208688804, 1259402539, 1356148642, 1225734356, 1114001286,
+    1286331434, 1107792719, 2035169105, 1108988726, 1456693896, 1814838404, 1196644129, 1179267135,
+    1108431904, 1842197096, 1479896144, 1273006896, 2082022538, 1762662514, 1961950145, 1087569387,
+    1075574925, 1967761644, 1279624545, 1161265126, 1813905230, 1218472881, 1110855572, 2137766066,
+    2114382189, 1088963017, 1995301801, 1929288053, 1933098970, 1930952719, 1168941648, 1722506690,
+    1657153340, 1242078991, 2043890497, 1922787984, 1880076910, 2006487960, 1148450428, 1261455489,
+    2120895848, 1160387551, 1150652444, 1191250577, 1830072792, 1869154247, 1834369768, 1172167322,
+    1501656785, 2112232458, 1171222962, 1181831417, 1176161692, 1149913744, 2128852272, 1897564439,
+    1238878838, 1932367313, 1903765714, 1153433075, 2098006978, 1122314259, 1884743609, 1387321732,
+    1992601545, 1649599120, 1370961519, 1925994185, 1136578600, 2104781648, 1074173589, 1922802070,
+    1898782487, 1987223075, 2101315098, 1185139537, 2041041590, 1346274164, 1110800304, 1959043401,
+    1155722840, 1902460993, 1764520576, 2073326004, 1174546576, 2026474394, 1437482870, 1915833010,
+    1897717896, 1267158110, 1362975762, 1835104077, 1983210807, 1799284506, 1701916369, 1398260552,
+    2055183877, 1780860488, 1908162620, 1106169649, 1202790218, 1643086952, 1948773844, 1840748033,
+    2146926288, 1194364307, 1130922712, 1120472851, 2097065684, 1895404764, 1315958514, 1413100690,
+    1391033465, 1085059213, 1221055724, 1501998170, 1969802828, 1137752235, 1284243269, 1315288422,
+    1215453033, 1860717066, 2099098085, 1074519449, 1283998582, 2128822608, 1682372741, 1131887705,
+    2133259619, 1851340082, 1769073591, 1284421998, 1932658153, 1326894351, 1123736309, 2107064453,
+    1081126905, 1210581585, 2072594180, 1127939405, 1074323069, 1932143092, 1089380136, 1173166122,
+    1984430015, 1141989469, 1366768118, 1252575916, 1136696924, 1983863250, 1206180039, 1950372222,
+    1113378589, 1891378576, 2088063229, 1277802527, 2050925845, 1159819211, 1116662183, 1957360837,
+    1275591728, 1906223188, 1277401234, 2135352011, 1174494374, 1890993772, 1996118474, 1098536214,
+    1112226498, 1235202983, 1258722420, 1231418333, 1179193390, 1133006238, 1122579329, 1931406463,
+    1077860878, 1961380065, 1186090526, 1096298237, 2128670974, 1105906650, 1254128472, 1340267114,
+    1166225317, 1102955410, 1831464681, 1322258393, 1141241819, 1249000488, 1179302351, 2107574044,
+    2055498581, 1355644354, 1152133326, 1150612340, 2007377881, 1166961864, 1448096795, 1206395559,
+    1125194985, 1400977049, 1380352921, 1317658810, 1301450978, 1963923218, 1180931056, 1074206733,
+    1136293974, 2136375171, 2066894377, 1969797194, 1085994210, 1846531691, 1437082654, 1174249439,
+    1211720170, 1966966681, 2014847749, 1388677329, 2042552135, 1808242050, 1241466155, 1675990665,
+    2036143875, 1171488446, 1855310754, 1771221997, 1882514664, 1077984092, 1309626734, 1834608738,
+    1994463088, 2061026035, 1094230372, 2001494293, 1101159907, 2042812649, 1930921564, 2054413275,
+    1174172627, 1924095687, 2108118769, 1880331125, 1263235994, 1101099667, 1085109592, 1990396298,
+    1351641283, 1972856401, 1261743429, 2085219790, 2016518216, 1123654858, 2018062071, 2109299530,
+    2042327418, 1738894495, 1338818051, 1754757297, 2102313898, 1277578887, 1088196723, 1149938519,
+    1410048940, 1307475263, 1867846875, 1759942703, 1132588787, 2146628156, 1940918178, 2068325542,
+    1193795387, 1254287647, 1291501097, 1137948780, 1995613522, 2097741659, 1222126695, 1132244170,
+    1082132251, 1819941612, 2054836361, 1878464777, 1837925807, 1920840763, 2058559114, 1390140395,
+    1928919987, 1238755127, 2080712846, 1179150882, 2007536144, 1608614526, 2103337556, 1095525729,
+    1929000030, 1961647207, 2050021838, 1244054218, 2119490866, 1366698350, 1317024265, 1099940367,
+    1546304805, 1760361314, 1916443526, 1880982077, 1285780495, 1747280634, 1261047816, 1208352557,
+    1115145671, 1132450824, 1131667130, 1103375512, 2092139134, 1192042806, 2006083104, 1784072822,
+    2100852240, 1168957392, 2006530053, 1922304907, 1161041734, 1105739852, 1374191667, 1857680894,
+    1323757753, 1892896413, 1526583524, 1115627173, 2022735068, 1247851629, 2012312054, 1614742221,
+    1691559644, 1183756928, 2045993329, 1274053175, 1792656831, 1479709211, 1096602914, 1255855947,
+    1095463749, 1869312676, 1183703649, 2129349932, 1198444272, 2119663713, 1764465888, 1268884507,
+    1105646468, 1563290862, 2006086584, 1482220876, 1331297472, 1413550622, 2120640306, 2016107725,
+    1878749154, 2091839676, 2002330355, 1257346689, 1985761085, 1201280999, 1399464183, 1314082554,
+    2050506240, 1192924689, 2093438386, 2097874899, 2002392334, 1759615239, 1703405703, 1943240756,
+    1301814901, 1492178546, 1076158428, 2065256889, 1119507196, 1732847507, 1966289877, 2026083293,
+    1981552272, 1814998490, 1102758202, 1266919803, 2110182656, 1319354798, 2081201225, 1990689292,
+    2065959380, 1085700718, 1974347723, 2125413399, 1726475705, 1838059543, 1263680043, 1136862479,
+    2112550310, 1316743948, 1909344872, 1156641348, 2036167573, 1337228622, 1859494709, 1680967594,
+    1876913298, 1083249375, 1934376512, 1199801194, 1852915591, 1194235790, 1563647991, 1178707496,
+    1199577471, 1911593373, 1256736587, 1426825693, 1906539715, 1961543963, 1834005017, 1851085701,
+    2046932801, 1980719359, 1913612185, 1170690998, 1831893567, 2097482140, 2090525013, 1257622117,
+    1912941015, 1956893504, 1861625548, 2069113213, 1122355357, 2097580744, 1982129809, 1084835738,
+    1528973219, 2127589645, 2117700749, 1179953717, 1986151855, 2025083333, 1081343668, 1887486124,
+    2130754914, 1081196425, 1913135406, 1948301871, 1999253581, 1335350922, 2042131370, 2059938078,
+    1121560643, 1182041137, 1098313651, 1200674460, 1468075771, 1943449896, 1824325261, 2010233417,
+    1211334538, 1958085037, 1995634237, 1103912199, 1106794416, 2058765934, 1767588235, 2102885138,
+    2101656649, 1161748119, 1077307454, 1291309192, 2111108705, 1125355651, 1137511028, 1280914765,
+    1171528799, 1253649207, 2069412505, 2093108932, 2060917819, 1349372482, 1961602463, 1924094195,
+    1959399535, 1220232920, 1825965069, 1143067317, 1154480431, 1107408909, 1996592767, 1983691231,
+    2019364969, 1761380000, 1838301164, 1847845858, 1796238391, 1947477907, 1849585430, 2025251871,
+    1230871123, 1217115710, 1921824980, 1102098716, 1458230957, 1128861642, 1182836763, 2038858383,
+    2015511627, 1938160914, 1160333278, 2062995959, 1090430143, 2002930430, 1943497126, 1664512341,
+    1877632693, 1214635118, 1965673230, 1568615805, 2065271969, 1187600326, 2134237869, 1266889973,
+    1170592145, 1169493581, 2038814467, 1109028002, 1917003662, 1993342318, 1290135391, 1079197832,
+    1125113781, 2096050975, 1953144401, 1223790947, 2057484912, 1125107235, 1074687655, 2047862329,
+    1076535029, 2128327932, 2020230860, 1486353955, 1141810490, 2062351636, 1813500208, 1206206471,
+    1524159028, 1847351678, 1536272395, 1197655606, 1240205765, 1600940324, 1081638983, 1197761833,
+    1211782896, 1120215321, 1759730580, 1216603964, 2067314479, 1952012527, 2081148029, 1587633601,
+    1292621287, 1424000318, 1987091824, 1844316003, 2105102649, 1429241406, 1140167865, 2080592367,
+    2142214677, 1216707871, 1902612296, 2124248712, 1758252847, 1127914050, 1315894877, 1808060917,
+    1330012224, 1796701083, 2086073253, 1941806110, 1430948331, 1787116782, 1856403352, 1304554350,
+    1942931521, 2045850312, 1727801472, 2032581539, 1657029215, 1947615953, 2034465620, 2128844152,
+    1868736631, 2021402010, 1224576878, 1172586181, 1220931765, 1253063218, 2101124188, 1206465576,
+    2013213741, 1820305867, 1793016943, 2035558052, 2129006724, 1099636766, 1105991582, 1837215858,
+    1453538405, 2086559809, 1142687071, 1786967634, 1796894314, 2059126874, 1179419433, 1215392048,
+    1131407280, 1892291532, 2107114500, 1089239605, 1110082153, 1133574660, 1841500903, 2093324701,
+    2043716656, 2037593270, 1102998331, 2048348389, 1146784271, 1337766718, 1581444589, 2135378857,
+    1874299714, 1827765129, 1768172236, 1150088579, 1999421456, 1344873408, 1909751054, 1329202760,
+    2070199182, 1802762655, 1145791603, 1092830279, 2132470622, 2116371005, 1391289835, 1073796077,
+    1199070034, 1616108921, 1470403321, 1447482633, 2091144643, 1101838534, 1894259467, 1239973921,
+    1344869597, 1192079347, 2132602701, 2112029284, 1599132143, 1986982282, 1138958351, 1322351031,
+    1199274947, 1232823066, 1225929575, 1890659347, 1250086540, 1121166973, 1145930725, 1289340097,
+    1082816264, 1893346014, 1091404334, 1923913560, 1189553347, 1156314712, 1103455472, 2046856072,
+    1493292853, 1259368317, 1082039447, 1746381764, 1946021884, 1182245471, 1783561076, 1193767131,
+    1982177040, 1243604700, 1225071058, 2109045314, 1949482964, 2094887780, 1141667805, 1444977597,
+    1176928565, 1085272164, 1382869724, 1404871821, 1194099733, 1116404155, 1242344973, 1911914374,
+    1561281663, 1916465401, 2135197724, 1752878685, 1115817089, 1258676516, 1342411128, 1503757629,
+    1701301545, 2134238201, 1116760704, 1193486069, 1123026527, 1878372471, 2077936027, 2000433348,
+    1185118574, 1241704876, 1357740723, 1211166000, 1979804746, 1858372447, 1091072560, 1905011272,
+    1298979748, 1696667658, 1906755649, 1225699057, 1156261267, 1199350765, 2096137150, 1780408236,
+    1848579173, 1319790478, 1775262106, 1945530024, 1130512470, 1988933480, 1983891588, 1874187521,
+    1952378439, 1726717989, 1986353206, 1883360669, 1491687681, 1102226652, 1091018950, 1250069802,
+    1159936459, 1759769856, 1130048534, 1496574126, 2082500477, 2077891116, 1847783381, 1709149422,
+    1125889272, 1214728667, 2059529078, 1262300914, 1535792136, 1080608199, 1993182231, 1188736012,
+    1081610976, 1102011878, 1375970681, 1549604970, 1325663957, 1659962971, 2093420156, 1373636171,
+    1224008787, 1124553810, 2130742816, 2071559585, 2041494339, 1391975588, 1261233837, 1992268944,
+    1359754480, 1990012157, 1086272290, 1101934735, 1168218857, 1149648507, 1791174624, 1145123002,
+};
+
+constexpr int32_t kConvShift62[1280] = {
+    -6, -5, -6, -5, -6, -6, -5, -6,
+    -6, -5, -6, -5, -6, -6, -5, -6,
+    -5, -6, -6, -6, -6, -5, -6, -6,
+    -5, -5, -5, -6, -6, -6, -5, -6,
+    -5, -5, -5, -5, -6, -6, -6, -5,
+    -5, -5, -5, -6, -5, -6, -6, -5,
+    -6, -6, -5, -5, -6, -6, -6, -5,
+    -5, -5, -6, -5, -5, -6, -6, -5,
+    -6, -6, -5, -6, -5, -5, -6, -5,
+    -6, -6, -5, -5, -6, -6, -5, -5,
+    -5, -6, -6, -5, -6, -6, -6, -5,
+    -6, -6, -5, -5, -5, -6, -5, -5,
+    -5, -6, -6, -5, -5, -6, -6, -6,
+    -6, -6, -5, -6, -5, -6, -6, -6,
+    -6, -5, -6, -5, -6, -6, -6, -5,
+    -5, -6, -6, -6, -6, -6, -6, -6,
+    -5, -5, -5, -5, -6, -5, -6, -5,
+    -6, -5, -6, -5, -5, -5, -6, -6,
+    -5, -6, -6, -6, -6, -5, -5, -5,
+    -5, -5, -5, -6, -6, -6, -5, -5,
+    -6, -6, -5, -6, -5, -6, -6, -5,
+    -6, -6, -5, -6, -6, -5, -5, -6,
+    -6, -5, -5, -6, -6, -5, -5, -5,
+    -5, -5, -5, -5, -6, -6, -5, -5,
+    -6, -6, -5, -5, -6, -6, -5, -6,
+    -6, -6, -6, -5, -6, -5, -6, -5,
+    -5, -6, -5, -5, -6, -5, -5, -6,
+    -5, -5, -5, -6, -5, -6, -5, -5,
+    -6, -6, -5, -6, -6, -5, -6, -5,
+    -6, -5, -6, -6, -6, -6, -6, -6,
+    -6, -5, -6, -6, -6, -5, -5, -5,
+    -6, -6, -6, -5, -6, -5, -6, -6,
+    -5, -6, -6, -6, -5, -6, -6, -6,
+    -5, -6, -6, -6, -5, -6, -6, -5,
+    -6, -6, -5, -5, -5, -5, -6, -5,
+    -6, -5, -6, -5, -5, -5, -5, -5,
+    -5, -6, -6, -6, -6, -6, -6, -5,
+    -5, -5, -6, -6, -6, -6, -5, -5,
+    -5, -6, -6, -6, -6, -6, -6, -6,
+    -6, -5, -5, -6, -6, -5, -6, -6,
+    -6, -5, -5, -6, -6, -6, -5, -5,
+    -6, -5, -5, -5, -6, -5, -5, -5,
+    -6, -6, -5, -5, -5, -5, -6, -5,
+    -5, -6, -6, -6, -5, -5, -6, -6,
+    -6, -6, -6, -5, -5, -5, -6, -5,
+    -5, -5, -5, -6, -5, -6, -5, -5,
+    -5, -6, -5, -5, -5, -5, -5, -6,
+    -5, -5, -6, -5, -6, -5, -6, -6,
+    -6, -5, -5, -6, -5, -5, -5, -5,
+    -6, -5, -6, -6, -6, -6, -5, -5,
+    -5, -5, -5, -6, -6, -6, -6, -6,
+    -6, -6, -6, -5, -6, -6, -5, -5,
+    -5, -5, -5, -5, -6, -5, -5, -6,
+    -6, -6, -5, -5, -5, -6, -6, -5,
+    -6, -5, -6, -5, -6, -5, -5, -6,
+    -5, -5, -6, -6, -5, -6, -5, -5,
+    -5, -6, -5, -6, -6, -6, -5, -6,
+    -5, -5, -5, -5, -6, -5, -6, -6,
+    -6, -6, -5, -5, -6, -5, -5, -6,
+    -6, -5, -6, -5, -5, -5, -5, -5,
+    -5, -5, -6, -5, -5, -6, -5, -5,
+    -5, -6, -5, -5, -6, -6, -6, -5,
+    -5, -6, -5, -5, -6, -5, -5, -6,
+    -6, -5, -6, -6, -6, -6, -5, -6,
+    -6, -5, -6, -6, -6, -6, -5, -5,
+    -6, -5, -5, -5, -6, -6, -6, -5,
+    -5, -6, -5, -5, -5, -5, -6, -6,
+    -5, -6, -6, -5, -6, -5, -6, -5,
+    -6, -6, -5, -6, -5, -6, -5, -6,
+    -6, -6, -6, -5, -6, -5, -5, -6,
+    -5, -6, -6, -6, -5, -6, -5, -6,
+    -6, -5, -5, -6, -6, -6, -6, -5,
+    -6, -6, -6, -5, -5, -5, -6, -6,
+    -6, -5, -5, -5, -6, -6, -5, -5,
+    -5, -5, -5, -5, -6, -5, -5, -5,
+    -5, -6, -6, -5, -5, -6, -6, -5,
+    -6, -6, -6, -5, -6, -5, -5, -6,
+    -5, -5, -6, -5, -5, -6, -5, -5,
+    -6, -5, -5, -5, -5, -6, -5, -6,
+    -5, -6, -6, -5, -6, -5, -5, -6,
+    -5, -6, -5, -6, -5, -6, -6, -5,
+    -5, -5, -5, -5, -5, -5, -5, -6,
+    -5, -6, -5, -5, -6, -5, -5, -5,
+    -5, -5, -6, -5, -5, -5, -5, -6,
+    -6, -5, -5, -5, -6, -5, -5, -5,
+    -5, -5, -5, -5, -5, -6, -5, -5,
+    -5, -6, -6, -6, -5, -6, -5, -5,
+    -5, -6, -6, -5, -6, -6, -5, -6,
+    -6, -5, -6, -6, -6, -5, -5, -6,
+    -6, -6, -5, -6, -5, -6, -6, -6,
+    -5, -6, -6, -6, -5, -5, -5, -6,
+    -5, -6, -5, -6, -6, -5, -6, -6,
+    -6, -6, -5, -6, -6, -5, -5, -5,
+    -5, -5, -6, -6, -5, -6, -6, -6,
+    -5, -5, -5, -5, -6, -6, -5, -5,
+    -5, -6, -6, -6, -6, -6, -6, -5,
+    -6, -5, -6, -5, -6, -5, -6, -5,
+    -6, -6, -6, -5, -6, -5, -5, -5,
+    -5, -6, -6, -6, -5, -6, -5, -5,
+    -5, -5, -5, -5, -6, -5, -6, -6,
+    -6, -5, -6, -6, -5, -5, -5, -6,
+    -5, -6, -5, -5, -6, -5, -6, -5,
+    -6, -5, -6, -5, -6, -5, -5, -5,
+    -5, -6, -5, -6, -5, -6, -6, -5,
+    -5, -6, -6, -5, -5, -5, -6, -6,
+    -6, -6, -6, -5, -6, -5, -5, -5,
+    -6, -5, -6, -6, -6, -6, -6, -6,
+    -5, -5, -5, -6, -5, -6, -6, -6,
+    -6, -6, -5, -5, -6, -5, -6, -6,
+    -6, -5, -6, -6, -6, -6, -5, -5,
+    -6, -5, -6, -5, -6, -5, -6, -6,
+    -6, -5, -6, -5, -6, -5, -5, -5,
+    -5, -6, -5, -5, -6, -6, -6, -6,
+    -6, -6, -6, -5, -6, -6, -6, -5,
+    -6, -6, -6, -6, -5, -6, -6, -5,
+    -5, -6, -6, -5, -6, -6, -5, -6,
+    -6, -5, -6, -6, -6, -5, -6, -6,
+    -5, -5, -5, -5, -5, -6, -6, -6,
+    -5, -6, -6, -5, -5, -6, -6, -6,
+    -6, -5, -5, -5, -6, -5, -5, -5,
+    -5, -5, -6, -6, -6, -5, -6, -6,
+    -6, -5, -6, -5, -5, -5, -6, -6,
+    -6, -6, -6, -6, -6, -6, -6, -6,
+    -5, -5, -6, -5, -5, -5, -5, -6,
+    -6, -6, -5, -6, -5, -6, -6, -6,
+    -6, -5, -6, -5, -6, -5, -6, -5,
+    -5, -5, -6, -5, -6, -6, -5, -5,
+    -5, -6, -6, -5, -6, -5, -5, -6,
+    -5, -6, -6, -5, -5, -6, -6, -5,
+    -5, -6, -5, -5, -5, -5, -5, -5,
+    -5, -5, -6, -5, -6, -6, -6, -5,
+    -5, -5, -6, -6, -6, -5, -5, -6,
+    -6, -5, -6, -6, -6, -5, -5, -6,
+    -5, -6, -6, -6, -5, -6, -6, -5,
+    -6, -6, -6, -6, -5, -6, -6, -6,
+    -6, -6, -5, -5, -5, -5, -6, -5,
+    -6, -6, -6, -6, -6, -5, -5, -6,
+    -5, -6, -5, -6, -6, -6, -5, -5,
+    -5, -6, -6, -5, -5, -5, -6, -6,
+    -6, -6, -5, -6, -5, -5, -6, -6,
+    -6, -6, -6, -5, -6, -5, -6, -5,
+    -6, -6, -5, -5, -6, -6, -5, -5,
+    -5, -6, -5, -5, -6, -5, -6, -5,
+    -5, -5, -6, -6, -5, -6, -5, -5,
+    -5, -5, -5, -6, -5, -5, -5, -5,
+    -5, -6, -5, -6, -5, -5, -5, -6,
+    -5, -5, -5, -6, -6, -5, -6, -5,
+    -6, -5, -5, -6, -6, -6, -5, -5,
+    -5, -5, -5, -5, -5, -5, -5, -6,
+    -6, -6, -6, -6, -5, -5, -5, -5,
+    -6, -6, -5, -5, -5, -6, -6, -6,
+    -5, -5, -5, -5, -6, -6, -5, -6,
+    -5, -6, -6, -5, -5, -5, -6, -6,
+    -6, -5, -6, -6, -5, -6, -6, -6,
+    -6, -6, -6, -6, -5, -5, -5, -5,
+    -5, -6, -5, -5, -6, -6, -6, -6,
+    -5, -5, -6, -5, -5, -5, -6, -5,
+    -5, -5, -5, -5, -5, -6, -6, -5,
+    -5, -5, -6, -6, -6, -5, -5, -6,
+    -5, -6, -5, -5, -5, -5, -6, -5,
+};
+
+constexpr data_dims_t kConvIn62 = {3, 3, 112, 1};
+constexpr data_dims_t kConvFilter62 = {1, 1, 0, 0};
+constexpr data_dims_t kConvOut62 = {3, 3, 1280, 1};
+
+constexpr conv_params_t kConvParams62 = {8, -128, {1, 1}, {0, 0}, {0, 0}, {-128, 127}};
+
+constexpr int32_t kFcMult64[16] = {
+    1571625848, 1338159621, 1379944939, 1268129232, 1522476036, 1533796912, 1321080592, 1475042095,
+    1590982252, 1453336005, 1419156005, 1800701572, 1411987739, 1199845893, 1755842681, 1241844229,
+};
+
+constexpr int32_t kFcShift64[16] = {
+    -10, -10, -10, -10, -10, -10, -10, -10,
+    -10, -10, -10, -10, -10, -10, -10, -10,
+};
+
+constexpr int32_t kFcMult65[4] = {
+    1554223573, 1401279014, 1312229607, 1578484120,
+};
+
+constexpr int32_t kFcShift65[4] = {
+    -8, -8, -8, -8,
+};
+
+size_t ScratchSize() {
+  size_t size = 0;
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn1, &kConvFilter1, &kConvOut1, &kConvParams1));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn2, &kDwFilter2, &kDwOut2, &kDwParams2));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn3, &kConvFilter3, &kConvOut3, &kConvParams3));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn4, &kConvFilter4, &kConvOut4, &kConvParams4));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn5, &kDwFilter5, &kDwOut5, &kDwParams5));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn6, &kConvFilter6, &kConvOut6, &kConvParams6));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn7, &kConvFilter7, &kConvOut7, &kConvParams7));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn8, &kDwFilter8, &kDwOut8, &kDwParams8));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn9, &kConvFilter9, &kConvOut9, &kConvParams9));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(4608));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn11, &kConvFilter11, &kConvOut11, &kConvParams11));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn12, &kDwFilter12, &kDwOut12, &kDwParams12));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn13, &kConvFilter13, &kConvOut13, &kConvParams13));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn14, &kConvFilter14, &kConvOut14, &kConvParams14));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn15, &kDwFilter15, &kDwOut15, &kDwParams15));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn16, &kConvFilter16, &kConvOut16, &kConvParams16));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(2304));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn18, &kConvFilter18, &kConvOut18, &kConvParams18));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn19, &kDwFilter19, &kDwOut19, &kDwParams19));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn20, &kConvFilter20, &kConvOut20, &kConvParams20));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(2304));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn22, &kConvFilter22, &kConvOut22, &kConvParams22));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn23, &kDwFilter23, &kDwOut23, &kDwParams23));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn24, &kConvFilter24, &kConvOut24, &kConvParams24));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn25, &kConvFilter25, &kConvOut25, &kConvParams25));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn26, &kDwFilter26, &kDwOut26, &kDwParams26));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn27, &kConvFilter27, &kConvOut27, &kConvParams27));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(864));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn29, &kConvFilter29, &kConvOut29, &kConvParams29));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn30, &kDwFilter30, &kDwOut30, &kDwParams30));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn31, &kConvFilter31, &kConvOut31, &kConvParams31));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(864));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn33, &kConvFilter33, &kConvOut33, &kConvParams33));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn34, &kDwFilter34, &kDwOut34, &kDwParams34));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn35, &kConvFilter35, &kConvOut35, &kConvParams35));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(864));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn37, &kConvFilter37, &kConvOut37, &kConvParams37));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn38, &kDwFilter38, &kDwOut38, &kDwParams38));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn39, &kConvFilter39, &kConvOut39, &kConvParams39));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn40, &kConvFilter40, &kConvOut40, &kConvParams40));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn41, &kDwFilter41, &kDwOut41, &kDwParams41));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn42, &kConvFilter42, &kConvOut42, &kConvParams42));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(1152));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn44, &kConvFilter44, &kConvOut44, &kConvParams44));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn45, &kDwFilter45, &kDwOut45, &kDwParams45));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn46, &kConvFilter46, &kConvOut46, &kConvParams46));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(1152));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn48, &kConvFilter48, &kConvOut48, &kConvParams48));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn49, &kDwFilter49, &kDwOut49, &kDwParams49));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn50, &kConvFilter50, &kConvOut50, &kConvParams50));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn51, &kConvFilter51, &kConvOut51, &kConvParams51));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn52, &kDwFilter52, &kDwOut52, &kDwParams52));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn53, &kConvFilter53, &kConvOut53, &kConvParams53));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(504));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn55, &kConvFilter55, &kConvOut55, &kConvParams55));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn56, &kDwFilter56, &kDwOut56, &kDwParams56));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn57, &kConvFilter57, &kConvOut57, &kConvParams57));
+  size = std::max<size_t>(size, esp_nn_get_add_scratch_size(504));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn59, &kConvFilter59, &kConvOut59, &kConvParams59));
+  size = std::max<size_t>(size, esp_nn_get_depthwise_conv_scratch_size(&kDwIn60, &kDwFilter60, &kDwOut60, &kDwParams60));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn61, &kConvFilter61, &kConvOut61, &kConvParams61));
+  size = std::max<size_t>(size, esp_nn_get_conv_scratch_size(&kConvIn62, &kConvFilter62, &kConvOut62, &kConvParams62));
+  size = std::max<size_t>(size, 1280 * sizeof(int32_t));
+  size = std::max<size_t>(size, esp_nn_get_softmax_scratch_size(4, 1));
+  return size;
+}
+
+}  // namespace
+
+size_t RequiredArenaSize() {
+  static const size_t size = kActivationBytes + ScratchSize();
+  return size;
+}
+
+TfLiteStatus Invoke(const uint8_t* model, uint8_t* arena, size_t arena_size) {
+  if (arena_size < RequiredArenaSize() ||
+      reinterpret_cast<uintptr_t>(arena) % 16 != 0) {
+    return kTfLiteError;
+  }
+  void* scratch = arena + kActivationBytes;
+
+  // 0: QUANTIZE t0[1, 96, 96, 3] -> t110[1, 96, 96, 3]
+  tflite::reference_ops::Requantize(
+      reinterpret_cast<const uint8_t*>(arena + kTensor0), 27648, 1073741824, 1, 0, -128,
+      reinterpret_cast<int8_t*>(arena + kTensor110));
+  // 1: CONV_2D t110[1, 96, 96, 3] -> t111[1, 48, 48, 16]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift1),
+                                const_cast<int32_t*>(kConvMult1)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn1, Act(arena, kTensor110), &kConvFilter1,
+        Weights(model, kConst109), Bias(model, kConst108),
+        &kConvOut1, Act(arena, kTensor111), &kConvParams1, &quant);
+  }
+  // 2: DEPTHWISE_CONV_2D t111[1, 48, 48, 16] -> t112[1, 48, 48, 16]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift2),
+                                const_cast<int32_t*>(kDwMult2)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn2, Act(arena, kTensor111), &kDwFilter2,
+        Weights(model, kConst107), Bias(model, kConst106),
+        &kDwOut2, Act(arena, kTensor112), &kDwParams2, &quant);
+  }
+  // 3: CONV_2D t112[1, 48, 48, 16] -> t113[1, 48, 48, 8]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift3),
+                                const_cast<int32_t*>(kConvMult3)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn3, Act(arena, kTensor112), &kConvFilter3,
+        Weights(model, kConst105), Bias(model, kConst104),
+        &kConvOut3, Act(arena, kTensor113), &kConvParams3, &quant);
+  }
+  // 4: CONV_2D t113[1, 48, 48, 8] -> t114[1, 48, 48, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift4),
+                                const_cast<int32_t*>(kConvMult4)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn4, Act(arena, kTensor113), &kConvFilter4,
+        Weights(model, kConst103), Bias(model, kConst102),
+        &kConvOut4, Act(arena, kTensor114), &kConvParams4, &quant);
+  }
+  // 5: DEPTHWISE_CONV_2D t114[1, 48, 48, 48] -> t115[1, 24, 24, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift5),
+                                const_cast<int32_t*>(kDwMult5)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn5, Act(arena, kTensor114), &kDwFilter5,
+        Weights(model, kConst101), Bias(model, kConst100),
+        &kDwOut5, Act(arena, kTensor115), &kDwParams5, &quant);
+  }
+  // 6: CONV_2D t115[1, 24, 24, 48] -> t116[1, 24, 24, 8]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift6),
+                                const_cast<int32_t*>(kConvMult6)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn6, Act(arena, kTensor115), &kConvFilter6,
+        Weights(model, kConst99), Bias(model, kConst98),
+        &kConvOut6, Act(arena, kTensor116), &kConvParams6, &quant);
+  }
+  // 7: CONV_2D t116[1, 24, 24, 8] -> t117[1, 24, 24, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift7),
+                                const_cast<int32_t*>(kConvMult7)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn7, Act(arena, kTensor116), &kConvFilter7,
+        Weights(model, kConst97), Bias(model, kConst96),
+        &kConvOut7, Act(arena, kTensor117), &kConvParams7, &quant);
+  }
+  // 8: DEPTHWISE_CONV_2D t117[1, 24, 24, 48] -> t118[1, 24, 24, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift8),
+                                const_cast<int32_t*>(kDwMult8)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn8, Act(arena, kTensor117), &kDwFilter8,
+        Weights(model, kConst95), Bias(model, kConst94),
+        &kDwOut8, Act(arena, kTensor118), &kDwParams8, &quant);
+  }
+  // 9: CONV_2D t118[1, 24, 24, 48] -> t119[1, 24, 24, 8]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift9),
+                                const_cast<int32_t*>(kConvMult9)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn9, Act(arena, kTensor118), &kConvFilter9,
+        Weights(model, kConst93), Bias(model, kConst92),
+        &kConvOut9, Act(arena, kTensor119), &kConvParams9, &quant);
+  }
+  // 10: ADD t116[1, 24, 24, 8] t119[1, 24, 24, 8] -> t120[1, 24, 24, 8]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor116),
+                            Act(arena, kTensor119),
+                            -27, 20, 1327443066, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor120),
+                            -6, 1214559198, -18, -128, 127, 4608);
+  // 11: CONV_2D t120[1, 24, 24, 8] -> t121[1, 24, 24, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift11),
+                                const_cast<int32_t*>(kConvMult11)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn11, Act(arena, kTensor120), &kConvFilter11,
+        Weights(model, kConst91), Bias(model, kConst90),
+        &kConvOut11, Act(arena, kTensor121), &kConvParams11, &quant);
+  }
+  // 12: DEPTHWISE_CONV_2D t121[1, 24, 24, 48] -> t122[1, 12, 12, 48]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift12),
+                                const_cast<int32_t*>(kDwMult12)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn12, Act(arena, kTensor121), &kDwFilter12,
+        Weights(model, kConst89), Bias(model, kConst88),
+        &kDwOut12, Act(arena, kTensor122), &kDwParams12, &quant);
+  }
+  // 13: CONV_2D t122[1, 12, 12, 48] -> t123[1, 12, 12, 16]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift13),
+                                const_cast<int32_t*>(kConvMult13)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn13, Act(arena, kTensor122), &kConvFilter13,
+        Weights(model, kConst87), Bias(model, kConst86),
+        &kConvOut13, Act(arena, kTensor123), &kConvParams13, &quant);
+  }
+  // 14: CONV_2D t123[1, 12, 12, 16] -> t124[1, 12, 12, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift14),
+                                const_cast<int32_t*>(kConvMult14)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn14, Act(arena, kTensor123), &kConvFilter14,
+        Weights(model, kConst85), Bias(model, kConst84),
+        &kConvOut14, Act(arena, kTensor124), &kConvParams14, &quant);
+  }
+  // 15: DEPTHWISE_CONV_2D t124[1, 12, 12, 96] -> t125[1, 12, 12, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift15),
+                                const_cast<int32_t*>(kDwMult15)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn15, Act(arena, kTensor124), &kDwFilter15,
+        Weights(model, kConst83), Bias(model, kConst82),
+        &kDwOut15, Act(arena, kTensor125), &kDwParams15, &quant);
+  }
+  // 16: CONV_2D t125[1, 12, 12, 96] -> t126[1, 12, 12, 16]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift16),
+                                const_cast<int32_t*>(kConvMult16)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn16, Act(arena, kTensor125), &kConvFilter16,
+        Weights(model, kConst81), Bias(model, kConst80),
+        &kConvOut16, Act(arena, kTensor126), &kConvParams16, &quant);
+  }
+  // 17: ADD t123[1, 12, 12, 16] t126[1, 12, 12, 16] -> t127[1, 12, 12, 16]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor123),
+                            Act(arena, kTensor126),
+                            -4, -5, 2015790809, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor127),
+                            6, 1080931036, -18, -128, 127, 2304);
+  // 18: CONV_2D t127[1, 12, 12, 16] -> t128[1, 12, 12, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift18),
+                                const_cast<int32_t*>(kConvMult18)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn18, Act(arena, kTensor127), &kConvFilter18,
+        Weights(model, kConst79), Bias(model, kConst78),
+        &kConvOut18, Act(arena, kTensor128), &kConvParams18, &quant);
+  }
+  // 19: DEPTHWISE_CONV_2D t128[1, 12, 12, 96] -> t129[1, 12, 12, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift19),
+                                const_cast<int32_t*>(kDwMult19)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn19, Act(arena, kTensor128), &kDwFilter19,
+        Weights(model, kConst77), Bias(model, kConst76),
+        &kDwOut19, Act(arena, kTensor129), &kDwParams19, &quant);
+  }
+  // 20: CONV_2D t129[1, 12, 12, 96] -> t130[1, 12, 12, 16]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift20),
+                                const_cast<int32_t*>(kConvMult20)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn20, Act(arena, kTensor129), &kConvFilter20,
+        Weights(model, kConst75), Bias(model, kConst74),
+        &kConvOut20, Act(arena, kTensor130), &kConvParams20, &quant);
+  }
+  // 21: ADD t127[1, 12, 12, 16] t130[1, 12, 12, 16] -> t131[1, 12, 12, 16]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor127),
+                            Act(arena, kTensor130),
+                            -6, -11, 1794961295, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor131),
+                            11, 1073741824, -18, -128, 127, 2304);
+  // 22: CONV_2D t131[1, 12, 12, 16] -> t132[1, 12, 12, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift22),
+                                const_cast<int32_t*>(kConvMult22)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn22, Act(arena, kTensor131), &kConvFilter22,
+        Weights(model, kConst73), Bias(model, kConst72),
+        &kConvOut22, Act(arena, kTensor132), &kConvParams22, &quant);
+  }
+  // 23: DEPTHWISE_CONV_2D t132[1, 12, 12, 96] -> t133[1, 6, 6, 96]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift23),
+                                const_cast<int32_t*>(kDwMult23)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn23, Act(arena, kTensor132), &kDwFilter23,
+        Weights(model, kConst71), Bias(model, kConst70),
+        &kDwOut23, Act(arena, kTensor133), &kDwParams23, &quant);
+  }
+  // 24: CONV_2D t133[1, 6, 6, 96] -> t134[1, 6, 6, 24]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift24),
+                                const_cast<int32_t*>(kConvMult24)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn24, Act(arena, kTensor133), &kConvFilter24,
+        Weights(model, kConst69), Bias(model, kConst68),
+        &kConvOut24, Act(arena, kTensor134), &kConvParams24, &quant);
+  }
+  // 25: CONV_2D t134[1, 6, 6, 24] -> t135[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift25),
+                                const_cast<int32_t*>(kConvMult25)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn25, Act(arena, kTensor134), &kConvFilter25,
+        Weights(model, kConst67), Bias(model, kConst66),
+        &kConvOut25, Act(arena, kTensor135), &kConvParams25, &quant);
+  }
+  // 26: DEPTHWISE_CONV_2D t135[1, 6, 6, 144] -> t136[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift26),
+                                const_cast<int32_t*>(kDwMult26)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn26, Act(arena, kTensor135), &kDwFilter26,
+        Weights(model, kConst65), Bias(model, kConst64),
+        &kDwOut26, Act(arena, kTensor136), &kDwParams26, &quant);
+  }
+  // 27: CONV_2D t136[1, 6, 6, 144] -> t137[1, 6, 6, 24]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift27),
+                                const_cast<int32_t*>(kConvMult27)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn27, Act(arena, kTensor136), &kConvFilter27,
+        Weights(model, kConst63), Bias(model, kConst62),
+        &kConvOut27, Act(arena, kTensor137), &kConvParams27, &quant);
+  }
+  // 28: ADD t134[1, 6, 6, 24] t137[1, 6, 6, 24] -> t138[1, 6, 6, 24]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor134),
+                            Act(arena, kTensor137),
+                            6, 5, 2040932013, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor138),
+                            -5, 1073741824, -18, -128, 127, 864);
+  // 29: CONV_2D t138[1, 6, 6, 24] -> t139[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift29),
+                                const_cast<int32_t*>(kConvMult29)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn29, Act(arena, kTensor138), &kConvFilter29,
+        Weights(model, kConst61), Bias(model, kConst60),
+        &kConvOut29, Act(arena, kTensor139), &kConvParams29, &quant);
+  }
+  // 30: DEPTHWISE_CONV_2D t139[1, 6, 6, 144] -> t140[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift30),
+                                const_cast<int32_t*>(kDwMult30)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn30, Act(arena, kTensor139), &kDwFilter30,
+        Weights(model, kConst59), Bias(model, kConst58),
+        &kDwOut30, Act(arena, kTensor140), &kDwParams30, &quant);
+  }
+  // 31: CONV_2D t140[1, 6, 6, 144] -> t141[1, 6, 6, 24]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift31),
+                                const_cast<int32_t*>(kConvMult31)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn31, Act(arena, kTensor140), &kConvFilter31,
+        Weights(model, kConst57), Bias(model, kConst56),
+        &kConvOut31, Act(arena, kTensor141), &kConvParams31, &quant);
+  }
+  // 32: ADD t138[1, 6, 6, 24] t141[1, 6, 6, 24] -> t142[1, 6, 6, 24]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor138),
+                            Act(arena, kTensor141),
+                            5, 5, 2143746772, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor142),
+                            -5, 1073741824, -18, -128, 127, 864);
+  // 33: CONV_2D t142[1, 6, 6, 24] -> t143[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift33),
+                                const_cast<int32_t*>(kConvMult33)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn33, Act(arena, kTensor142), &kConvFilter33,
+        Weights(model, kConst55), Bias(model, kConst54),
+        &kConvOut33, Act(arena, kTensor143), &kConvParams33, &quant);
+  }
+  // 34: DEPTHWISE_CONV_2D t143[1, 6, 6, 144] -> t144[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift34),
+                                const_cast<int32_t*>(kDwMult34)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn34, Act(arena, kTensor143), &kDwFilter34,
+        Weights(model, kConst53), Bias(model, kConst52),
+        &kDwOut34, Act(arena, kTensor144), &kDwParams34, &quant);
+  }
+  // 35: CONV_2D t144[1, 6, 6, 144] -> t145[1, 6, 6, 24]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift35),
+                                const_cast<int32_t*>(kConvMult35)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn35, Act(arena, kTensor144), &kConvFilter35,
+        Weights(model, kConst51), Bias(model, kConst50),
+        &kConvOut35, Act(arena, kTensor145), &kConvParams35, &quant);
+  }
+  // 36: ADD t142[1, 6, 6, 24] t145[1, 6, 6, 24] -> t146[1, 6, 6, 24]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor142),
+                            Act(arena, kTensor145),
+                            5, -19, 1667919565, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor146),
+                            19, 1073741824, -18, -128, 127, 864);
+  // 37: CONV_2D t146[1, 6, 6, 24] -> t147[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift37),
+                                const_cast<int32_t*>(kConvMult37)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn37, Act(arena, kTensor146), &kConvFilter37,
+        Weights(model, kConst49), Bias(model, kConst48),
+        &kConvOut37, Act(arena, kTensor147), &kConvParams37, &quant);
+  }
+  // 38: DEPTHWISE_CONV_2D t147[1, 6, 6, 144] -> t148[1, 6, 6, 144]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift38),
+                                const_cast<int32_t*>(kDwMult38)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn38, Act(arena, kTensor147), &kDwFilter38,
+        Weights(model, kConst47), Bias(model, kConst46),
+        &kDwOut38, Act(arena, kTensor148), &kDwParams38, &quant);
+  }
+  // 39: CONV_2D t148[1, 6, 6, 144] -> t149[1, 6, 6, 32]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift39),
+                                const_cast<int32_t*>(kConvMult39)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn39, Act(arena, kTensor148), &kConvFilter39,
+        Weights(model, kConst45), Bias(model, kConst44),
+        &kConvOut39, Act(arena, kTensor149), &kConvParams39, &quant);
+  }
+  // 40: CONV_2D t149[1, 6, 6, 32] -> t150[1, 6, 6, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift40),
+                                const_cast<int32_t*>(kConvMult40)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn40, Act(arena, kTensor149), &kConvFilter40,
+        Weights(model, kConst43), Bias(model, kConst42),
+        &kConvOut40, Act(arena, kTensor150), &kConvParams40, &quant);
+  }
+  // 41: DEPTHWISE_CONV_2D t150[1, 6, 6, 192] -> t151[1, 6, 6, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift41),
+                                const_cast<int32_t*>(kDwMult41)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn41, Act(arena, kTensor150), &kDwFilter41,
+        Weights(model, kConst41), Bias(model, kConst40),
+        &kDwOut41, Act(arena, kTensor151), &kDwParams41, &quant);
+  }
+  // 42: CONV_2D t151[1, 6, 6, 192] -> t152[1, 6, 6, 32]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift42),
+                                const_cast<int32_t*>(kConvMult42)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn42, Act(arena, kTensor151), &kConvFilter42,
+        Weights(model, kConst39), Bias(model, kConst38),
+        &kConvOut42, Act(arena, kTensor152), &kConvParams42, &quant);
+  }
+  // 43: ADD t149[1, 6, 6, 32] t152[1, 6, 6, 32] -> t153[1, 6, 6, 32]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor149),
+                            Act(arena, kTensor152),
+                            2, 15, 1492707025, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor153),
+                            -15, 1073741824, -18, -128, 127, 1152);
+  // 44: CONV_2D t153[1, 6, 6, 32] -> t154[1, 6, 6, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift44),
+                                const_cast<int32_t*>(kConvMult44)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn44, Act(arena, kTensor153), &kConvFilter44,
+        Weights(model, kConst37), Bias(model, kConst36),
+        &kConvOut44, Act(arena, kTensor154), &kConvParams44, &quant);
+  }
+  // 45: DEPTHWISE_CONV_2D t154[1, 6, 6, 192] -> t155[1, 6, 6, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift45),
+                                const_cast<int32_t*>(kDwMult45)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn45, Act(arena, kTensor154), &kDwFilter45,
+        Weights(model, kConst35), Bias(model, kConst34),
+        &kDwOut45, Act(arena, kTensor155), &kDwParams45, &quant);
+  }
+  // 46: CONV_2D t155[1, 6, 6, 192] -> t156[1, 6, 6, 32]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift46),
+                                const_cast<int32_t*>(kConvMult46)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn46, Act(arena, kTensor155), &kConvFilter46,
+        Weights(model, kConst33), Bias(model, kConst32),
+        &kConvOut46, Act(arena, kTensor156), &kConvParams46, &quant);
+  }
+  // 47: ADD t153[1, 6, 6, 32] t156[1, 6, 6, 32] -> t157[1, 6, 6, 32]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor153),
+                            Act(arena, kTensor156),
+                            15, 8, 2053045497, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor157),
+                            -8, 1073741824, -18, -128, 127, 1152);
+  // 48: CONV_2D t157[1, 6, 6, 32] -> t158[1, 6, 6, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift48),
+                                const_cast<int32_t*>(kConvMult48)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn48, Act(arena, kTensor157), &kConvFilter48,
+        Weights(model, kConst31), Bias(model, kConst30),
+        &kConvOut48, Act(arena, kTensor158), &kConvParams48, &quant);
+  }
+  // 49: DEPTHWISE_CONV_2D t158[1, 6, 6, 192] -> t159[1, 3, 3, 192]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift49),
+                                const_cast<int32_t*>(kDwMult49)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn49, Act(arena, kTensor158), &kDwFilter49,
+        Weights(model, kConst29), Bias(model, kConst28),
+        &kDwOut49, Act(arena, kTensor159), &kDwParams49, &quant);
+  }
+  // 50: CONV_2D t159[1, 3, 3, 192] -> t160[1, 3, 3, 56]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift50),
+                                const_cast<int32_t*>(kConvMult50)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn50, Act(arena, kTensor159), &kConvFilter50,
+        Weights(model, kConst27), Bias(model, kConst26),
+        &kConvOut50, Act(arena, kTensor160), &kConvParams50, &quant);
+  }
+  // 51: CONV_2D t160[1, 3, 3, 56] -> t161[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift51),
+                                const_cast<int32_t*>(kConvMult51)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn51, Act(arena, kTensor160), &kConvFilter51,
+        Weights(model, kConst25), Bias(model, kConst24),
+        &kConvOut51, Act(arena, kTensor161), &kConvParams51, &quant);
+  }
+  // 52: DEPTHWISE_CONV_2D t161[1, 3, 3, 336] -> t162[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift52),
+                                const_cast<int32_t*>(kDwMult52)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn52, Act(arena, kTensor161), &kDwFilter52,
+        Weights(model, kConst23), Bias(model, kConst22),
+        &kDwOut52, Act(arena, kTensor162), &kDwParams52, &quant);
+  }
+  // 53: CONV_2D t162[1, 3, 3, 336] -> t163[1, 3, 3, 56]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift53),
+                                const_cast<int32_t*>(kConvMult53)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn53, Act(arena, kTensor162), &kConvFilter53,
+        Weights(model, kConst21), Bias(model, kConst20),
+        &kConvOut53, Act(arena, kTensor163), &kConvParams53, &quant);
+  }
+  // 54: ADD t160[1, 3, 3, 56] t163[1, 3, 3, 56] -> t164[1, 3, 3, 56]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor160),
+                            Act(arena, kTensor163),
+                            -18, 5, 1827839483, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor164),
+                            -4, 1081139939, -18, -128, 127, 504);
+  // 55: CONV_2D t164[1, 3, 3, 56] -> t165[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift55),
+                                const_cast<int32_t*>(kConvMult55)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn55, Act(arena, kTensor164), &kConvFilter55,
+        Weights(model, kConst19), Bias(model, kConst18),
+        &kConvOut55, Act(arena, kTensor165), &kConvParams55, &quant);
+  }
+  // 56: DEPTHWISE_CONV_2D t165[1, 3, 3, 336] -> t166[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift56),
+                                const_cast<int32_t*>(kDwMult56)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn56, Act(arena, kTensor165), &kDwFilter56,
+        Weights(model, kConst17), Bias(model, kConst16),
+        &kDwOut56, Act(arena, kTensor166), &kDwParams56, &quant);
+  }
+  // 57: CONV_2D t166[1, 3, 3, 336] -> t167[1, 3, 3, 56]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift57),
+                                const_cast<int32_t*>(kConvMult57)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn57, Act(arena, kTensor166), &kConvFilter57,
+        Weights(model, kConst15), Bias(model, kConst14),
+        &kConvOut57, Act(arena, kTensor167), &kConvParams57, &quant);
+  }
+  // 58: ADD t164[1, 3, 3, 56] t167[1, 3, 3, 56] -> t168[1, 3, 3, 56]
+  esp_nn_set_add_scratch_buf(scratch);
+  esp_nn_add_elementwise_s8(Act(arena, kTensor164),
+                            Act(arena, kTensor167),
+                            4, 4, 2025533309, 1073741824, -1, 0, 20,
+                            Act(arena, kTensor168),
+                            -4, 1073741824, -18, -128, 127, 504);
+  // 59: CONV_2D t168[1, 3, 3, 56] -> t169[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift59),
+                                const_cast<int32_t*>(kConvMult59)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn59, Act(arena, kTensor168), &kConvFilter59,
+        Weights(model, kConst13), Bias(model, kConst12),
+        &kConvOut59, Act(arena, kTensor169), &kConvParams59, &quant);
+  }
+  // 60: DEPTHWISE_CONV_2D t169[1, 3, 3, 336] -> t170[1, 3, 3, 336]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kDwShift60),
+                                const_cast<int32_t*>(kDwMult60)};
+    esp_nn_set_depthwise_conv_scratch_buf(scratch);
+    esp_nn_depthwise_conv_s8(&kDwIn60, Act(arena, kTensor169), &kDwFilter60,
+        Weights(model, kConst11), Bias(model, kConst10),
+        &kDwOut60, Act(arena, kTensor170), &kDwParams60, &quant);
+  }
+  // 61: CONV_2D t170[1, 3, 3, 336] -> t171[1, 3, 3, 112]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift61),
+                                const_cast<int32_t*>(kConvMult61)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn61, Act(arena, kTensor170), &kConvFilter61,
+        Weights(model, kConst9), Bias(model, kConst8),
+        &kConvOut61, Act(arena, kTensor171), &kConvParams61, &quant);
+  }
+  // 62: CONV_2D t171[1, 3, 3, 112] -> t172[1, 3, 3, 1280]
+  {
+    const quant_data_t quant = {const_cast<int32_t*>(kConvShift62),
+                                const_cast<int32_t*>(kConvMult62)};
+    esp_nn_set_conv_scratch_buf(scratch);
+    esp_nn_conv_s8(&kConvIn62, Act(arena, kTensor171), &kConvFilter62,
+        Weights(model, kConst7), Bias(model, kConst6),
+        &kConvOut62, Act(arena, kTensor172), &kConvParams62, &quant);
+  }
+  // 63: MEAN t172[1, 3, 3, 1280] -> t173[1, 1280]
+  {
+    int32_t* sum = reinterpret_cast<int32_t*>(scratch);
+    const int8_t* in = Act(arena, kTensor172);
+    for (int c = 0; c < 1280; ++c) sum[c] = 0;
+    for (int i = 0; i < 9; ++i, in += 1280) {
+      for (int c = 0; c < 1280; ++c) sum[c] += in[c];
+    }
+    int8_t* out = Act(arena, kTensor173);
+    for (int c = 0; c < 1280; ++c) {
+      const int32_t value = tflite::MultiplyByQuantizedMultiplier(
+                                sum[c] - (-1152), 954437176, -2) + (-128);
+      out[c] = static_cast<int8_t>(std::min(std::max(value, -128), 127));
+    }
+  }
+  // 64: FULLY_CONNECTED t173[1, 1280] -> t174[1, 16]
+  esp_nn_fully_connected_per_ch_s8(
+      Act(arena, kTensor173), 128, 1280,
+      Weights(model, kConst5), 0, Bias(model, kConst4),
+      Act(arena, kTensor174), 16, -128,
+      const_cast<int32_t*>(kFcShift64),
+      const_cast<int32_t*>(kFcMult64), -128, 127);
+  // 65: FULLY_CONNECTED t174[1, 16] -> t175[1, 4]
+  esp_nn_fully_connected_per_ch_s8(
+      Act(arena, kTensor174), 128, 16,
+      Weights(model, kConst3), 0, Bias(model, kConst2),
+      Act(arena, kTensor175), 4, 41,
+      const_cast<int32_t*>(kFcShift65),
+      const_cast<int32_t*>(kFcMult65), -128, 127);
+  // 66: SOFTMAX t175[1, 4] -> t176[1, 4]
+  esp_nn_set_softmax_scratch_buf(scratch);
+  esp_nn_softmax_s8(Act(arena, kTensor175), 1, 4, 1968790784, 22, -496,
+                    Act(arena, kTensor176));
+  // 67: QUANTIZE t176[1, 4] -> t177[1, 4]
+  tflite::reference_ops::Requantize(
+      reinterpret_cast<const int8_t*>(arena + kTensor176), 4, 1073741824, 1, -128, 0,
+      reinterpret_cast<uint8_t*>(arena + kTensor177));
+
+  return kTfLiteOk;
+}
+
+}  // namespace model_codegen
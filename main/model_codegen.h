@@ -0,0 +1,44 @@
+// Generated by tools/tflite_codegen.py from model_data.h.
+// Do not edit; regenerate whenever the model changes.
+
+#ifndef MODEL_CODEGEN_H_
+#define MODEL_CODEGEN_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+namespace model_codegen {
+
+// Size of the model image the constant tensors are addressed in.
+constexpr size_t kModelSize = 642752;
+
+// Bytes of arena taken by the activation tensors; the esp-nn scratch buffer
+// follows them (see RequiredArenaSize()).
+constexpr size_t kActivationBytes = 138240;
+
+constexpr size_t kInputBytes = 27648;
+constexpr size_t kOutputBytes = 4;
+constexpr int kNumOps = 68;
+constexpr long long kMacs = 10674672LL;
+
+// Arena size needed by Invoke() on the current target, including the
+// scratch buffer requested by the selected esp-nn kernels.
+size_t RequiredArenaSize();
+
+// Input (uint8_t [1, 96, 96, 3]) and output (uint8_t [1, 4]) buffers inside the arena.
+inline uint8_t* Input(uint8_t* arena) {
+  return reinterpret_cast<uint8_t*>(arena + 0);
+}
+inline const uint8_t* Output(const uint8_t* arena) {
+  return reinterpret_cast<const uint8_t*>(arena + 0);
+}
+
+// Runs the whole network.  `model` must be the image this file was
+// generated from and `arena` must be 16-byte aligned.
+TfLiteStatus Invoke(const uint8_t* model, uint8_t* arena, size_t arena_size);
+
+}  // namespace model_codegen
+
+#endif  // MODEL_CODEGEN_H_
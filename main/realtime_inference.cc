@@ -0,0 +1,142 @@
+#include "realtime_inference.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+namespace {
+
+const char* TAG = "REALTIME";
+
+constexpr uint32_t kStackSize = 8 * 1024;
+
+// Smallest cache line of the targets: reading every 32 bytes touches every
+// line whatever the configured line size.
+constexpr size_t kCacheLineBytes = 32;
+
+constexpr int kBarWidth = 40;
+
+}  // namespace
+
+void LatencyHistogram::Reset(uint32_t base_us, uint32_t width_us) {
+  base_us_ = base_us;
+  width_us_ = width_us > 0 ? width_us : 1;
+  for (uint32_t& bucket : buckets_) {
+    bucket = 0;
+  }
+  count_ = 0;
+  min_us_ = 0;
+  max_us_ = 0;
+}
+
+void LatencyHistogram::Record(uint32_t latency_us) {
+  int bucket = 0;
+  if (latency_us >= base_us_) {
+    const uint32_t offset = (latency_us - base_us_) / width_us_;
+    bucket = offset < kNumBuckets ? static_cast<int>(offset) : kNumBuckets - 1;
+  }
+  buckets_[bucket]++;
+  if (count_ == 0 || latency_us < min_us_) {
+    min_us_ = latency_us;
+  }
+  if (count_ == 0 || latency_us > max_us_) {
+    max_us_ = latency_us;
+  }
+  count_++;
+}
+
+uint32_t LatencyHistogram::Percentile(float fraction) const {
+  const uint32_t rank = static_cast<uint32_t>(fraction * count_ + 0.5f);
+  uint32_t seen = 0;
+  for (int b = 0; b < kNumBuckets; b++) {
+    seen += buckets_[b];
+    if (seen >= rank && seen > 0 && b < kNumBuckets - 1) {
+      const uint32_t edge = base_us_ + (b + 1) * width_us_;
+      return edge < max_us_ ? edge : max_us_;
+    }
+  }
+  return max_us_;
+}
+
+void LatencyHistogram::Log(const char* tag) const {
+  uint32_t largest = 0;
+  for (uint32_t bucket : buckets_) {
+    largest = bucket > largest ? bucket : largest;
+  }
+  char bar[kBarWidth + 1];
+  for (int b = 0; b < kNumBuckets; b++) {
+    if (buckets_[b] == 0) {
+      continue;
+    }
+    const int length = static_cast<int>(
+        (static_cast<uint64_t>(buckets_[b]) * kBarWidth + largest - 1) /
+        largest);
+    for (int i = 0; i < length; i++) {
+      bar[i] = '#';
+    }
+    bar[length] = '\0';
+    ESP_LOGI(tag, "%s%6u us %5u %s", b == kNumBuckets - 1 ? ">=" : "  ",
+             (unsigned)(base_us_ + b * width_us_), (unsigned)buckets_[b], bar);
+  }
+  ESP_LOGI(tag, "%u frames: min %u us, p50 %u us, p99 %u us, max %u us, "
+           "jitter %u us", (unsigned)count_, (unsigned)min_us_,
+           (unsigned)Percentile(0.5f), (unsigned)Percentile(0.99f),
+           (unsigned)max_us_, (unsigned)jitter_us());
+}
+
+RealtimeInference::RealtimeInference(tflite::MicroInterpreter& interpreter,
+                                     const Config& config)
+    : interpreter_(interpreter),
+      config_(config),
+      caller_(nullptr),
+      frames_(0),
+      writer_(nullptr),
+      writer_arg_(nullptr),
+      status_(kTfLiteOk) {}
+
+TfLiteStatus RealtimeInference::Run(int frames, InputWriter writer,
+                                    void* arg) {
+  caller_ = xTaskGetCurrentTaskHandle();
+  frames_ = frames;
+  writer_ = writer;
+  writer_arg_ = arg;
+  status_ = kTfLiteOk;
+  if (xTaskCreatePinnedToCore(InferenceTask, "realtime", kStackSize, this,
+                              config_.priority, nullptr,
+                              config_.core) != pdPASS) {
+    ESP_LOGE(TAG, "Cannot start the inference task on core %d",
+             (int)config_.core);
+    return kTfLiteError;
+  }
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  return status_;
+}
+
+void RealtimeInference::InferenceTask(void* arg) {
+  RealtimeInference* self = static_cast<RealtimeInference*>(arg);
+  uint32_t latency_us = 0;
+  self->status_ = self->RunFrame(0, &latency_us);
+  self->histogram_.Reset(latency_us - latency_us / 8, latency_us / 128);
+  for (int frame = 1; self->status_ == kTfLiteOk && frame < self->frames_;
+       frame++) {
+    self->status_ = self->RunFrame(frame, &latency_us);
+    self->histogram_.Record(latency_us);
+  }
+  xTaskNotifyGive(self->caller_);
+  vTaskDelete(nullptr);
+}
+
+TfLiteStatus RealtimeInference::RunFrame(int frame, uint32_t* latency_us) {
+  writer_(interpreter_.input(0), frame, writer_arg_);
+  Pretouch();
+  const int64_t start = esp_timer_get_time();
+  const TfLiteStatus status = interpreter_.Invoke();
+  *latency_us = static_cast<uint32_t>(esp_timer_get_time() - start);
+  return status;
+}
+
+void RealtimeInference::Pretouch() const {
+  const volatile uint8_t* bytes = config_.arena;
+  for (size_t i = 0; i < config_.arena_bytes; i += kCacheLineBytes) {
+    (void)bytes[i];
+  }
+}
@@ -0,0 +1,116 @@
+#ifndef REALTIME_INFERENCE_H_
+#define REALTIME_INFERENCE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+// Latency histogram with fixed-width buckets and the exact minimum and
+// maximum. Record() neither allocates nor formats, so it can run between
+// two frames.
+class LatencyHistogram {
+ public:
+  static constexpr int kNumBuckets = 32;
+
+  // Bucket b counts latencies in [base_us + b * width_us,
+  // base_us + (b + 1) * width_us); the first and last buckets also take
+  // everything below and above that range.
+  void Reset(uint32_t base_us, uint32_t width_us);
+  void Record(uint32_t latency_us);
+
+  uint32_t count() const { return count_; }
+  uint32_t min_us() const { return min_us_; }
+  uint32_t max_us() const { return max_us_; }
+  uint32_t jitter_us() const { return count_ > 0 ? max_us_ - min_us_ : 0; }
+
+  // Upper edge of the bucket holding the `fraction` quantile, capped at the
+  // maximum: a latency that `fraction` of the samples meet.
+  uint32_t Percentile(float fraction) const;
+
+  // One line per non-empty bucket, with a bar proportional to its count.
+  void Log(const char* tag) const;
+
+ private:
+  uint32_t base_us_ = 0;
+  uint32_t width_us_ = 1;
+  uint32_t buckets_[kNumBuckets] = {};
+  uint32_t count_ = 0;
+  uint32_t min_us_ = 0;
+  uint32_t max_us_ = 0;
+};
+
+// Deterministic latency mode, for the sorting line: a late verdict makes the
+// diverter paddle miss the item, so the worst case matters, not the mean.
+//
+// Run() serves every frame from one task pinned to `core` at `priority`, with
+// nothing else of the application on that core. On the ESP32 each core has
+// its own flash/PSRAM cache, so no other task evicts the kernels, weights or
+// arena lines the inference uses, and only interrupts allocated on that core
+// and the IDF IPC task can preempt it. Before each frame it writes the input
+// and then reads the used part of the arena, one cache line at a time. A
+// read of a range larger than the cache evicts every other line, so the
+// dirty lines the previous frame left are written back before the clock
+// starts rather than during the first layers, and the cache ends up holding
+// the end of that range whatever it held before: every frame starts from the
+// same cache contents. The ESP32 has no cache writeback API to do this
+// without the reads. Only Invoke() is timed.
+//
+// The jitter of a run, max - min over its frames, only reflects the
+// inference itself when:
+//  - nothing writes or erases flash during the run: the write disables the
+//    cache of both cores and holds this one off through an IPC call, and
+//    the weights (flash) and the arena (PSRAM) are read through that cache,
+//    so the frame stalls for the whole operation wherever the kernel code
+//    is, NN_KERNELS_IN_IRAM included;
+//  - no peripheral interrupt is allocated on `core`: drivers allocate theirs
+//    on the core that installs them, so install them from the other core;
+//  - the same model and input size run on every frame, so the same kernels
+//    and the same arena lines are touched.
+class RealtimeInference {
+ public:
+  struct Config {
+    BaseType_t core;
+    UBaseType_t priority;
+    // The start of the arena and the bytes read from it before each frame,
+    // normally the interpreter's arena_used_bytes(), which covers the
+    // planned tensors. It must be larger than the cache (32 KB on the
+    // ESP32); reading it lengthens the frame period but not the measured
+    // latency.
+    const uint8_t* arena;
+    size_t arena_bytes;
+  };
+
+  // Writes frame `frame` into `input`; runs on the inference task, before
+  // the pre-touch.
+  typedef void (*InputWriter)(TfLiteTensor* input, int frame, void* arg);
+
+  RealtimeInference(tflite::MicroInterpreter& interpreter,
+                    const Config& config);
+
+  // Runs `frames` frames on the pinned task and waits for them. The first
+  // frame is not recorded: it loads the caches and centres the histogram on
+  // its latency.
+  TfLiteStatus Run(int frames, InputWriter writer, void* arg);
+
+  const LatencyHistogram& histogram() const { return histogram_; }
+
+ private:
+  static void InferenceTask(void* arg);
+  TfLiteStatus RunFrame(int frame, uint32_t* latency_us);
+  void Pretouch() const;
+
+  tflite::MicroInterpreter& interpreter_;
+  const Config config_;
+  LatencyHistogram histogram_;
+  TaskHandle_t caller_;
+  int frames_;
+  InputWriter writer_;
+  void* writer_arg_;
+  TfLiteStatus status_;
+};
+
+#endif  // REALTIME_INFERENCE_H_
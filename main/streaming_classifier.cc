@@ -0,0 +1,108 @@
+#include "streaming_classifier.h"
+
+#include <cmath>
+
+#include "esp_log.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace {
+
+const char* TAG = "STREAMING";
+
+constexpr int kSliceSize = AudioFrontend::kNumChannels;
+constexpr int kWindowSize = AudioFrontend::kNumSlices * kSliceSize;
+
+}  // namespace
+
+StreamingClassifier::StreamingClassifier(
+    const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+    uint8_t* arena, size_t arena_size)
+    : interpreter_(model, resolver, arena, arena_size),
+      input_(nullptr),
+      streaming_(false),
+      input_scale_(1.0f),
+      input_zero_point_(0) {}
+
+TfLiteStatus StreamingClassifier::Init() {
+  if (interpreter_.AllocateTensors() != kTfLiteOk) {
+    ESP_LOGE(TAG, "AllocateTensors failed");
+    return kTfLiteError;
+  }
+  input_ = interpreter_.input(0);
+  if (input_->type != kTfLiteInt8 && input_->type != kTfLiteUInt8) {
+    ESP_LOGE(TAG, "Unsupported input type %d", input_->type);
+    return kTfLiteError;
+  }
+  if (input_->bytes == kSliceSize) {
+    streaming_ = true;
+  } else if (input_->bytes == kWindowSize) {
+    streaming_ = false;
+  } else {
+    ESP_LOGE(TAG, "Input of %u values is neither one slice (%d) nor the "
+             "spectrogram (%d)", (unsigned)input_->bytes, kSliceSize,
+             kWindowSize);
+    return kTfLiteError;
+  }
+  input_scale_ = input_->params.scale;
+  input_zero_point_ = input_->params.zero_point;
+  ESP_LOGI(TAG, "%s model, arena %u bytes",
+           streaming_ ? "Streaming" : "Windowed",
+           (unsigned)interpreter_.arena_used_bytes());
+  return Reset();
+}
+
+TfLiteStatus StreamingClassifier::Reset() { return interpreter_.Reset(); }
+
+void StreamingClassifier::Quantize(const int16_t* features, int count,
+                                   int offset) {
+  const int32_t min = input_->type == kTfLiteInt8 ? -128 : 0;
+  const int32_t max = input_->type == kTfLiteInt8 ? 127 : 255;
+  for (int i = 0; i < count; i++) {
+    const float feature = features[i] / kFeatureDivisor;
+    int32_t q = static_cast<int32_t>(lroundf(feature / input_scale_)) +
+                input_zero_point_;
+    q = q < min ? min : (q > max ? max : q);
+    if (input_->type == kTfLiteInt8) {
+      input_->data.int8[offset + i] = static_cast<int8_t>(q);
+    } else {
+      input_->data.uint8[offset + i] = static_cast<uint8_t>(q);
+    }
+  }
+}
+
+TfLiteStatus StreamingClassifier::Update(const AudioFrontend& frontend,
+                                         int new_slices, bool* ready) {
+  *ready = false;
+  if (new_slices <= 0) {
+    return kTfLiteOk;
+  }
+
+  if (!streaming_) {
+    // The arena reuses the input once the first layer has read it, so the
+    // whole window is written again before every run.
+    for (int age = AudioFrontend::kNumSlices - 1; age >= 0; age--) {
+      Quantize(frontend.Slice(age), kSliceSize,
+               (AudioFrontend::kNumSlices - 1 - age) * kSliceSize);
+    }
+    TF_LITE_ENSURE_STATUS(interpreter_.Invoke());
+    *ready = true;
+    return kTfLiteOk;
+  }
+
+  // Oldest first. Slices beyond the spectrogram length were overwritten in
+  // the front end before we saw them; an aborted run (a CIRCULAR_BUFFER
+  // between strides) may reuse the output buffer, so only the newest slice's
+  // result is reported.
+  if (new_slices > AudioFrontend::kNumSlices) {
+    new_slices = AudioFrontend::kNumSlices;
+  }
+  for (int age = new_slices - 1; age >= 0; age--) {
+    Quantize(frontend.Slice(age), kSliceSize, 0);
+    const TfLiteStatus status = interpreter_.Invoke();
+    if (status != kTfLiteOk && status != tflite::kTfLiteAbort) {
+      return status;
+    }
+    *ready = status == kTfLiteOk;
+  }
+  return kTfLiteOk;
+}
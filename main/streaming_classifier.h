@@ -0,0 +1,62 @@
+#ifndef STREAMING_CLASSIFIER_H_
+#define STREAMING_CLASSIFIER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "audio_frontend.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Runs the impact-sound model over the spectrogram of AudioFrontend as it
+// grows, one hop at a time.
+//
+// Two model layouts are accepted, told apart by the input size:
+//  * streaming: the input is a single slice (kNumChannels values). Conv
+//    layers over time keep their past inputs in CIRCULAR_BUFFER ops whose
+//    state lives in variable tensors, so each hop only feeds the new slice
+//    and only the new output columns are computed. Hops between the strides
+//    of those buffers end with kTfLiteAbort and produce no output.
+//  * windowed: the input is the whole spectrogram (kNumSlices x
+//    kNumChannels), re-run from scratch on every hop.
+// Reset() clears the layer state between items through
+// MicroInterpreter::Reset(), i.e. ResetVariableTensors().
+class StreamingClassifier {
+ public:
+  // Divides the front end's int16 output into the float features the model
+  // was trained on, as in the micro_speech example.
+  static constexpr float kFeatureDivisor = 25.6f;
+
+  StreamingClassifier(const tflite::Model* model,
+                      const tflite::MicroOpResolver& resolver, uint8_t* arena,
+                      size_t arena_size);
+
+  // Allocates the arena and picks the mode from the input tensor.
+  TfLiteStatus Init();
+
+  bool streaming() const { return streaming_; }
+
+  // Forgets the previous item: clears the CIRCULAR_BUFFER histories and
+  // restarts their strides.
+  TfLiteStatus Reset();
+
+  // Consumes the `new_slices` slices the last frontend.Process() call
+  // produced. Sets `*ready` when output() holds a result computed from them.
+  TfLiteStatus Update(const AudioFrontend& frontend, int new_slices,
+                      bool* ready);
+
+  TfLiteTensor* output() { return interpreter_.output(0); }
+
+ private:
+  void Quantize(const int16_t* features, int count, int offset);
+
+  tflite::MicroInterpreter interpreter_;
+  TfLiteTensor* input_;
+  bool streaming_;
+  float input_scale_;
+  int32_t input_zero_point_;
+};
+
+#endif  // STREAMING_CLASSIFIER_H_
@@ -23,11 +23,17 @@
 #include "esp_nn_ansi_headers.h"
 
 #define esp_nn_add_elementwise_s8 esp_nn_add_elementwise_s8_ansi
+#define esp_nn_get_add_scratch_size esp_nn_get_add_scratch_size_ansi
+#define esp_nn_set_add_scratch_buf esp_nn_set_add_scratch_buf_ansi
 #define esp_nn_mul_elementwise_s8 esp_nn_mul_elementwise_s8_ansi
 
 #define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_ansi
+#define esp_nn_depthwise_conv_s16 esp_nn_depthwise_conv_s16_ansi
+#define esp_nn_depthwise_conv_dilated_s8 esp_nn_depthwise_conv_s8_ansi
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_ansi
+#define esp_nn_conv_s16 esp_nn_conv_s16_ansi
+#define esp_nn_conv_dilated_s8 esp_nn_conv_s8_ansi
 
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_ansi
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_ansi
@@ -42,6 +48,7 @@
 
 #define esp_nn_fully_connected_s8 esp_nn_fully_connected_s8_ansi
 #define esp_nn_fully_connected_per_ch_s8 esp_nn_fully_connected_per_ch_s8_ansi
+#define esp_nn_fully_connected_s16 esp_nn_fully_connected_s16_ansi
 
 #define esp_nn_get_softmax_scratch_size esp_nn_get_softmax_scratch_size_ansi
 #define esp_nn_set_softmax_scratch_buf esp_nn_set_softmax_scratch_buf_ansi
@@ -45,6 +45,24 @@ void esp_nn_add_elementwise_s8_ansi(const int8_t *input1_data,
                                     const int32_t activation_min,
                                     const int32_t activation_max,
                                     const int32_t size);
+/**
+ * @brief   Get scratch buffer size needed by elementwise add function
+ *
+ * @param   size    number of elements to be added
+ * @return  size in bytes, 0 if the function needs no scratch buffer
+ *
+ * @note    buffer must be 4 byte aligned
+ */
+int32_t esp_nn_get_add_scratch_size_ansi(const int32_t size);
+
+/**
+ * @brief   Set scratch buffer to be used by elementwise add function
+ *
+ * @param   buffer  this can be NULL if one needs to unset it
+ *                  must be aligned to 4 bytes
+ */
+void esp_nn_set_add_scratch_buf_ansi(void *buffer);
+
 /**
  * @brief       elementwise multiplication
  *
@@ -79,6 +97,8 @@ void esp_nn_mul_elementwise_s8_ansi(const int8_t *input1_data,
  *
  *              optimization notes: Though input_offset is int32 type,
  *              offset values are contained in 8 bits [-128, 127]
+ *
+ *              dilation of 0 or 1 means no dilation
  */
 void esp_nn_depthwise_conv_s8_ansi(const data_dims_t *input_dims,
                                    const int8_t *input_data,
@@ -97,6 +117,7 @@ void esp_nn_depthwise_conv_s8_ansi(const data_dims_t *input_dims,
  *
  *              inputs type: int8_t, output: int8_t
  *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ *              dilation of 0 or 1 means no dilation
  */
 void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
                          const int8_t *input_data,
@@ -108,6 +129,45 @@ void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
                          const conv_params_t *conv_params,
                          const quant_data_t *quant_data);
 
+/**
+ * @brief       depthwise convolution per channel, 16x8 quantization
+ *
+ * @note        inputs type: int16_t, filter: int8_t, bias: int64_t,
+ *              output: int16_t
+ *              int16 activations are symmetric: there are no input and
+ *              output offsets, and conv_params->in_offset/out_offset are
+ *              ignored.
+ */
+void esp_nn_depthwise_conv_s16_ansi(const data_dims_t *input_dims,
+                                    const int16_t *input_data,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int64_t *bias,
+                                    const data_dims_t *output_dims,
+                                    int16_t *out_data,
+                                    const dw_conv_params_t *conv_params,
+                                    const quant_data_t *quant_data);
+
+/**
+ * @brief       2d-convolution channelwise, 16x8 quantization
+ *
+ * @note        operation: result += input * filter
+ *
+ *              inputs type: int16_t, filter: int8_t, bias: int64_t,
+ *              output: int16_t
+ *              int16 activations are symmetric: conv_params->in_offset and
+ *              out_offset are ignored.
+ */
+void esp_nn_conv_s16_ansi(const data_dims_t *input_dims,
+                          const int16_t *input_data,
+                          const data_dims_t *filter_dims,
+                          const int8_t *filter_data,
+                          const int64_t *bias,
+                          const data_dims_t *output_dims,
+                          int16_t *out_data,
+                          const conv_params_t *conv_params,
+                          const quant_data_t *quant_data);
+
 int esp_nn_get_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                       const data_dims_t *filter_dims,
                                       const data_dims_t *output_dims,
@@ -220,6 +280,25 @@ void esp_nn_fully_connected_per_ch_s8_ansi(const int8_t *input_data,
                                     const int32_t activation_min,
                                     const int32_t activation_max);
 
+/**
+ * @brief       fully connected, 16x8 quantization
+ *
+ * @note        inputs type: int16_t, filter: int8_t, bias: int64_t,
+ *              output: int16_t
+ *              int16 activations and int8 weights are symmetric, hence
+ *              there are no offsets.
+ */
+void esp_nn_fully_connected_s16_ansi(const int16_t *input_data,
+                                     const uint16_t row_len,
+                                     const int8_t *filter_data,
+                                     const int64_t *bias,
+                                     int16_t *out_data,
+                                     const uint16_t out_channels,
+                                     const int32_t out_shift,
+                                     const int32_t out_mult,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max);
+
 /**
  * @brief   Get scratch buffer size needed by softmax function
  *
@@ -256,8 +335,67 @@ void esp_nn_softmax_s8_ansi(const int8_t *input_data,
                             int8_t *output_data);
 
 
+/************************** Resize functions ********************************/
+
+/**
+ * @brief       bilinear resize, reference version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              Same fixed-point (10 bit) source coordinates and rounding as
+ *              tflite's ResizeBilinearInteger. The channels of the input are
+ *              those of the output.
+ */
+void esp_nn_resize_bilinear_s8_ansi(const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *output_dims,
+                                    int8_t *output_data,
+                                    const resize_params_t *params);
+
+/**
+ * @brief       bilinear resize, reference version
+ *
+ * @note        inputs type: uint8_t, output: uint8_t
+ */
+void esp_nn_resize_bilinear_u8_ansi(const data_dims_t *input_dims,
+                                    const uint8_t *input_data,
+                                    const data_dims_t *output_dims,
+                                    uint8_t *output_data,
+                                    const resize_params_t *params);
+
+
 //////////////////////////// Generic optimisations /////////////////////////////
 
+/************************** Basic math functions ****************************/
+
+/**
+ * @brief       elementwise addition optimized version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              Bit-exact with the ANSI version. Processes 4 elements per
+ *              iteration with word loads/stores when all pointers are 4 byte
+ *              aligned. If a scratch buffer is set, the input rescale is
+ *              precomputed for all 256 int8 values of each input.
+ */
+void esp_nn_add_elementwise_s8_opt(const int8_t *input1_data,
+                                   const int8_t *input2_data,
+                                   const int32_t input1_offset,
+                                   const int32_t input2_offset,
+                                   const int32_t input1_mult,
+                                   const int32_t input2_mult,
+                                   const int32_t input1_shift,
+                                   const int32_t input2_shift,
+                                   const int32_t left_shift,
+                                   int8_t *output,
+                                   const int32_t out_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t size);
+
+int32_t esp_nn_get_add_scratch_size_opt(const int32_t size);
+void esp_nn_set_add_scratch_buf_opt(void *buffer);
+
 /************************** Convolution functions *****************************/
 
 /**
@@ -267,6 +405,7 @@ void esp_nn_softmax_s8_ansi(const int8_t *input_data,
  *
  *              inputs type: int8_t, output: int8_t
  *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ *              dilation of 0 or 1 means no dilation
  */
 void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                         const int8_t *input_data,
@@ -289,6 +428,9 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
  *
  *              optimization notes: Though input_offset is int32 type,
  *              offset values are contained in 8 bits [-128, 127]
+ *
+ *              dilation of 0 or 1 means no dilation. ch_mult > 1 has its
+ *              own path that loads each input once per four output channels.
  */
 void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
                                   const int8_t *input_data,
@@ -300,6 +442,38 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
                                   const dw_conv_params_t *conv_params,
                                   const quant_data_t *quant_data);
 
+/**
+ * @brief       2d-convolution channelwise optimized version, 16x8 quantization
+ *
+ * @note        Bit-exact with the ANSI version. Products are summed in 32
+ *              bits and widened to 64 bits once per filter row.
+ */
+void esp_nn_conv_s16_opt(const data_dims_t *input_dims,
+                         const int16_t *input_data,
+                         const data_dims_t *filter_dims,
+                         const int8_t *filter_data,
+                         const int64_t *bias,
+                         const data_dims_t *output_dims,
+                         int16_t *out_data,
+                         const conv_params_t *conv_params,
+                         const quant_data_t *quant_data);
+
+/**
+ * @brief       depthwise convolution optimized version, 16x8 quantization
+ *
+ * @note        Bit-exact with the ANSI version. Filters of up to 511 taps
+ *              are summed entirely in 32 bits.
+ */
+void esp_nn_depthwise_conv_s16_opt(const data_dims_t *input_dims,
+                                   const int16_t *input_data,
+                                   const data_dims_t *filter_dims,
+                                   const int8_t *filter_data,
+                                   const int64_t *bias,
+                                   const data_dims_t *output_dims,
+                                   int16_t *out_data,
+                                   const dw_conv_params_t *conv_params,
+                                   const quant_data_t *quant_data);
+
 int esp_nn_get_conv_scratch_size_opt(const data_dims_t *input_dims,
                                      const data_dims_t *filter_dims,
                                      const data_dims_t *output_dims,
@@ -312,6 +486,122 @@ int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
                                                const dw_conv_params_t *conv_params);
 void esp_nn_set_depthwise_conv_scratch_buf_opt(const void *buf);
 
+/**
+ * @brief       depthwise convolution, filter (3,3) and ch_mult 1, on an input
+ *              that is already padded
+ *
+ * @note        Bit-exact with esp_nn_depthwise_conv_s8_opt. The input holds
+ *              padded_dims->height rows of padded_dims->width pixels,
+ *              `row_pitch` bytes apart, with the padding border filled with
+ *              the input zero point; conv_params->padding is ignored.
+ *
+ *              esp_nn_get_depthwise_conv_padded_dims_opt() gives the padded
+ *              size for a layer and esp_nn_depthwise_conv_pad_input_s8_opt()
+ *              builds it from the unpadded input.
+ */
+void esp_nn_depthwise_conv_s8_3x3_padded_opt(const data_dims_t *padded_dims,
+                                             const int8_t *padded_data,
+                                             int32_t row_pitch,
+                                             const int8_t *filter_data,
+                                             const int32_t *bias,
+                                             const data_dims_t *output_dims,
+                                             int8_t *out_data,
+                                             const dw_conv_params_t *conv_params,
+                                             const quant_data_t *quant_data);
+
+void esp_nn_get_depthwise_conv_padded_dims_opt(const data_dims_t *input_dims,
+                                               const data_dims_t *output_dims,
+                                               const dw_conv_params_t *conv_params,
+                                               data_dims_t *padded_dims);
+void esp_nn_depthwise_conv_pad_input_s8_opt(const data_dims_t *input_dims,
+                                            const int8_t *input_data,
+                                            const dw_conv_params_t *conv_params,
+                                            const data_dims_t *padded_dims,
+                                            int32_t row_pitch,
+                                            int8_t *padded_data);
+
+/**
+ * @brief       Winograd F(2x2, 3x3) version of esp_nn_conv_s8_opt
+ *
+ * @note        For filter (3,3), stride (1,1) and up to 1024 input channels;
+ *              check with esp_nn_conv_s8_winograd_supported_opt().
+ *              Bit-exact with esp_nn_conv_s8_opt. Computes each 2x2 output
+ *              tile with 16 instead of 36 multiplies per channel pair.
+ *
+ *              The filter is transformed once, into a buffer of
+ *              esp_nn_get_conv_winograd_filter_size_opt() bytes, with
+ *              esp_nn_conv_winograd_transform_filter_opt(). The kernel needs
+ *              a scratch buffer of esp_nn_get_conv_winograd_scratch_size_opt()
+ *              bytes, set with esp_nn_set_conv_winograd_scratch_buf_opt().
+ */
+void esp_nn_conv_s8_winograd_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const int16_t *wg_filter,
+                                 const int32_t *bias,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const quant_data_t *quant_data);
+
+int esp_nn_conv_s8_winograd_supported_opt(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const conv_params_t *conv_params);
+int esp_nn_get_conv_winograd_filter_size_opt(const data_dims_t *input_dims,
+                                             const data_dims_t *output_dims);
+void esp_nn_conv_winograd_transform_filter_opt(const data_dims_t *input_dims,
+                                               const int8_t *filter_data,
+                                               const data_dims_t *output_dims,
+                                               int16_t *wg_filter);
+int esp_nn_get_conv_winograd_scratch_size_opt(const data_dims_t *input_dims);
+void esp_nn_set_conv_winograd_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       im2col + GEMM version of esp_nn_conv_s8_opt
+ *
+ * @note        Bit-exact with esp_nn_conv_s8_opt. Copies the input patches
+ *              of a block of output pixels into scratch memory and multiplies
+ *              them with tiles of four output channels.
+ *
+ *              The block is as large as the scratch buffer, set with
+ *              esp_nn_set_conv_im2col_scratch_buf_opt(), allows;
+ *              esp_nn_get_conv_im2col_scratch_size_opt() gives the size for
+ *              `block_pixels` pixels. Runs esp_nn_conv_s8_opt if the buffer
+ *              holds fewer than two pixels.
+ */
+void esp_nn_conv_s8_im2col_opt(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *filter_data,
+                               const int32_t *bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data);
+
+int esp_nn_get_conv_im2col_scratch_size_opt(const data_dims_t *input_dims,
+                                            const data_dims_t *filter_dims,
+                                            const data_dims_t *output_dims,
+                                            int32_t block_pixels);
+void esp_nn_set_conv_im2col_scratch_buf_opt(const void *buf, int32_t size);
+
+/************************** Fully connected functions ***********************/
+
+/**
+ * @brief       fully connected optimized version, 16x8 quantization
+ *
+ * @note        Bit-exact with the ANSI version.
+ */
+void esp_nn_fully_connected_s16_opt(const int16_t *input_data,
+                                    const uint16_t row_len,
+                                    const int8_t *filter_data,
+                                    const int64_t *bias,
+                                    int16_t *out_data,
+                                    const uint16_t out_channels,
+                                    const int32_t out_shift,
+                                    const int32_t out_mult,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max);
+
 /* ANSI C function to be hooked up when optimised version needed */
 void esp_nn_set_softmax_scratch_buf_opt(void *buffer);
 
@@ -328,3 +618,78 @@ void esp_nn_softmax_s8_opt(const int8_t *input_data,
                            const int32_t shift,
                            const int32_t diff_min,
                            int8_t *output_data);
+
+/**
+ * @brief       fill the exp() table of esp_nn_softmax_s8_lut_opt
+ *
+ * @param       lut     ESP_NN_SOFTMAX_LUT_SIZE entries, 4 byte aligned
+ *
+ * @note        mult, shift and diff_min as for esp_nn_softmax_s8_opt. Build
+ *              it once, e.g. when preparing the op.
+ */
+void esp_nn_softmax_init_lut_opt(int32_t *lut,
+                                 const int32_t mult,
+                                 const int32_t shift,
+                                 const int32_t diff_min);
+
+/**
+ * @brief       softmax using a precomputed exp() table
+ *
+ * @note        Bit-exact with esp_nn_softmax_s8_ansi. Needs no scratch
+ *              buffer; meant for narrow rows such as classifier heads, where
+ *              computing exp() per element dominates.
+ */
+void esp_nn_softmax_s8_lut_opt(const int8_t *input_data,
+                               const int32_t height,
+                               const int32_t width,
+                               const int32_t *lut,
+                               int8_t *output_data);
+
+/************************** Resize functions ********************************/
+
+/**
+ * @brief       crop and bilinear resize, optimized version
+ *
+ * @note        Bit-exact with esp_nn_resize_bilinear_s8_ansi() run on each
+ *              roi. Source offsets and weights come from a table built for
+ *              one (roi, output) size pair, and each source row is
+ *              interpolated horizontally once for all the output rows that
+ *              read it.
+ *
+ *              The table takes esp_nn_get_resize_bilinear_table_size_opt()
+ *              bytes, 4 byte aligned, and is built with
+ *              esp_nn_resize_bilinear_init_table_opt(); it also holds the
+ *              interpolated rows, so it can't be used by two tasks at once.
+ *
+ *              `input_dims` is the whole frame. All `num_rois` rois must
+ *              have the width and height the table was built for and lie
+ *              inside the frame; their outputs are written one after the
+ *              other to `output_data`.
+ */
+void esp_nn_crop_resize_bilinear_s8_opt(void *table,
+                                        const data_dims_t *input_dims,
+                                        const int8_t *input_data,
+                                        const roi_t *rois,
+                                        const int32_t num_rois,
+                                        int8_t *output_data);
+
+/**
+ * @brief       crop and bilinear resize, optimized version
+ *
+ * @note        inputs type: uint8_t, output: uint8_t, e.g. camera frames.
+ *              Bit-exact with esp_nn_resize_bilinear_u8_ansi() run on each
+ *              roi.
+ */
+void esp_nn_crop_resize_bilinear_u8_opt(void *table,
+                                        const data_dims_t *input_dims,
+                                        const uint8_t *input_data,
+                                        const roi_t *rois,
+                                        const int32_t num_rois,
+                                        uint8_t *output_data);
+
+int32_t esp_nn_get_resize_bilinear_table_size_opt(const data_dims_t *roi_dims,
+                                                  const data_dims_t *output_dims);
+void esp_nn_resize_bilinear_init_table_opt(void *table,
+                                           const data_dims_t *roi_dims,
+                                           const data_dims_t *output_dims,
+                                           const resize_params_t *params);
@@ -16,6 +16,12 @@
 
 #include <stdint.h>
 
+/**
+ * @brief entries of the exp() table of esp_nn_softmax_s8_lut_opt, one per
+ * possible difference between an int8 input and its row max
+ */
+#define ESP_NN_SOFTMAX_LUT_SIZE     256
+
 /**
  * @brief structure to club data dims
  * this structure can be used for input, output and filter
@@ -81,3 +87,23 @@ typedef struct dw_conv_params {
     data_2d_t dilation;
     act_params_t activation;
 } dw_conv_params_t;
+
+/**
+ * @brief region of interest, (x, y) being its top left corner
+ */
+typedef struct roi {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+} roi_t;
+
+/**
+ * @brief params specific to bilinear resize
+ *
+ * @note half_pixel_centers and align_corners can't be both set
+ */
+typedef struct resize_params {
+    int32_t align_corners;
+    int32_t half_pixel_centers;
+} resize_params_t;
@@ -231,9 +231,14 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 /********************** function defines ***************************/
 
 #define esp_nn_add_elementwise_s8 esp_nn_add_elementwise_s8_esp32s3
+#define esp_nn_get_add_scratch_size esp_nn_get_add_scratch_size_ansi
+#define esp_nn_set_add_scratch_buf esp_nn_set_add_scratch_buf_ansi
 #define esp_nn_mul_elementwise_s8 esp_nn_mul_elementwise_s8_esp32s3
 
 #define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_esp32s3
+#define esp_nn_depthwise_conv_s16 esp_nn_depthwise_conv_s16_opt
+/* target kernel ignores dilation */
+#define esp_nn_depthwise_conv_dilated_s8 esp_nn_depthwise_conv_s8_opt
 
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_esp32s3
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_esp32s3
@@ -242,6 +247,9 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 #define esp_nn_set_depthwise_conv_scratch_buf esp_nn_set_depthwise_conv_scratch_buf_esp32s3
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_esp32s3
+#define esp_nn_conv_s16 esp_nn_conv_s16_opt
+/* target kernel ignores dilation */
+#define esp_nn_conv_dilated_s8 esp_nn_conv_s8_opt
 
 #define esp_nn_relu6_s8 esp_nn_relu6_s8_esp32s3
 
@@ -250,6 +258,7 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 
 #define esp_nn_fully_connected_s8 esp_nn_fully_connected_s8_esp32s3
 #define esp_nn_fully_connected_per_ch_s8 esp_nn_fully_connected_per_ch_s8_esp32s3
+#define esp_nn_fully_connected_s16 esp_nn_fully_connected_s16_opt
 
 #define esp_nn_get_softmax_scratch_size esp_nn_get_softmax_scratch_size_opt
 #define esp_nn_set_softmax_scratch_buf esp_nn_set_softmax_scratch_buf_opt
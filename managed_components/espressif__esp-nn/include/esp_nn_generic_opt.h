@@ -22,12 +22,18 @@
 #include "esp_nn_defs.h"
 #include "esp_nn_ansi_headers.h"
 
-#define esp_nn_add_elementwise_s8 esp_nn_add_elementwise_s8_ansi
+#define esp_nn_add_elementwise_s8 esp_nn_add_elementwise_s8_opt
+#define esp_nn_get_add_scratch_size esp_nn_get_add_scratch_size_opt
+#define esp_nn_set_add_scratch_buf esp_nn_set_add_scratch_buf_opt
 #define esp_nn_mul_elementwise_s8 esp_nn_mul_elementwise_s8_ansi
 
 #define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_opt
+#define esp_nn_depthwise_conv_s16 esp_nn_depthwise_conv_s16_opt
+#define esp_nn_depthwise_conv_dilated_s8 esp_nn_depthwise_conv_s8_opt
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_opt
+#define esp_nn_conv_s16 esp_nn_conv_s16_opt
+#define esp_nn_conv_dilated_s8 esp_nn_conv_s8_opt
 
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_opt
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_opt
@@ -42,6 +48,7 @@
 
 #define esp_nn_fully_connected_s8 esp_nn_fully_connected_s8_ansi
 #define esp_nn_fully_connected_per_ch_s8 esp_nn_fully_connected_per_ch_s8_ansi
+#define esp_nn_fully_connected_s16 esp_nn_fully_connected_s16_opt
 
 #define esp_nn_get_softmax_scratch_size esp_nn_get_softmax_scratch_size_opt
 #define esp_nn_set_softmax_scratch_buf esp_nn_set_softmax_scratch_buf_opt
@@ -95,3 +95,14 @@ void esp_nn_add_elementwise_s8_ansi(const int8_t *input1_data,
         output[i] = (int8_t) out;
     }
 }
+
+int32_t esp_nn_get_add_scratch_size_ansi(const int32_t size)
+{
+    (void) size;
+    return 0;
+}
+
+void esp_nn_set_add_scratch_buf_ansi(void *buffer)
+{
+    (void) buffer;
+}
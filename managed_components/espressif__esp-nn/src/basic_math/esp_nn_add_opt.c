@@ -0,0 +1,158 @@
+// Copyright 2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <common_functions.h>
+#include <esp_nn_ansi_headers.h>
+
+/**
+ * Each input goes through `div(srdhm((in + offset) << left_shift, mult), shift)`
+ * which only depends on the 8 bit input value, so with a scratch buffer both
+ * rescales are looked up from two 256 entry tables built per call. Below this
+ * many elements filling the tables costs more than it saves.
+ */
+#define ADD_LUT_MIN_SIZE    256
+#define ADD_LUT_ENTRIES     256
+
+/* Set and used by the same task; one per task so two cores can run models. */
+static __thread int32_t *scratch_buf = NULL;
+
+/**
+ * @brief   Get scratch buffer size needed by elementwise add function
+ *
+ * @param   size    number of elements to be added
+ * @return  size in bytes
+ *
+ * @note    buffer must be 4 byte aligned
+ */
+int32_t esp_nn_get_add_scratch_size_opt(const int32_t size)
+{
+    if (size < ADD_LUT_MIN_SIZE) {
+        return 0;
+    }
+    return 2 * ADD_LUT_ENTRIES * sizeof(int32_t);
+}
+
+/**
+ * @brief   Set scratch buffer to be used by elementwise add function
+ *
+ * @param   buffer  this can be NULL if one needs to unset it
+ *                  must be aligned to 4 bytes
+ */
+void esp_nn_set_add_scratch_buf_opt(void *buffer)
+{
+    scratch_buf = (int32_t *) buffer;
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_add_rescale_input(int32_t in, const int32_t offset,
+                                                     const int32_t left_shift,
+                                                     const int32_t mult,
+                                                     const int32_t shift)
+{
+    int32_t tmp = (in + offset) << left_shift;
+    tmp = esp_nn_sat_round_doubling_high_mul(tmp, mult);
+    return esp_nn_div_by_power_of_two(tmp, -shift);
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_add_rescale_output(int32_t sum, const int32_t out_offset,
+                                                      const int32_t out_mult,
+                                                      const int32_t out_shift,
+                                                      const int32_t activation_min,
+                                                      const int32_t activation_max)
+{
+    int32_t out = esp_nn_sat_round_doubling_high_mul(sum, out_mult);
+    out = esp_nn_div_by_power_of_two(out, -out_shift);
+    out = out + out_offset;
+    return max(activation_min, min(out, activation_max));
+}
+
+/* table is indexed with `(uint8_t) in`, i.e. two's complement bit pattern */
+static void esp_nn_add_fill_lut(int32_t *lut, const int32_t offset,
+                                const int32_t left_shift, const int32_t mult,
+                                const int32_t shift)
+{
+    for (int32_t in = INT8_MIN; in <= INT8_MAX; in++) {
+        lut[(uint8_t) in] = esp_nn_add_rescale_input(in, offset, left_shift, mult, shift);
+    }
+}
+
+void esp_nn_add_elementwise_s8_opt(const int8_t *input1_data,
+                                   const int8_t *input2_data,
+                                   const int32_t input1_offset,
+                                   const int32_t input2_offset,
+                                   const int32_t input1_mult,
+                                   const int32_t input2_mult,
+                                   const int32_t input1_shift,
+                                   const int32_t input2_shift,
+                                   const int32_t left_shift,
+                                   int8_t *output,
+                                   const int32_t out_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const int32_t size)
+{
+    if (scratch_buf == NULL || size < ADD_LUT_MIN_SIZE) {
+        esp_nn_add_elementwise_s8_ansi(input1_data, input2_data, input1_offset, input2_offset,
+                                       input1_mult, input2_mult, input1_shift, input2_shift,
+                                       left_shift, output, out_offset, out_mult, out_shift,
+                                       activation_min, activation_max, size);
+        return;
+    }
+
+    int32_t *lut1 = scratch_buf;
+    int32_t *lut2 = scratch_buf + ADD_LUT_ENTRIES;
+    esp_nn_add_fill_lut(lut1, input1_offset, left_shift, input1_mult, input1_shift);
+    esp_nn_add_fill_lut(lut2, input2_offset, left_shift, input2_mult, input2_shift);
+
+    int32_t i = 0;
+    const uintptr_t align = (uintptr_t) input1_data | (uintptr_t) input2_data | (uintptr_t) output;
+    if ((align & 3) == 0) {
+        /* 4 elements at a time: one word load per input, one word store */
+        const uint32_t *in1_w = (const uint32_t *) __builtin_assume_aligned(input1_data, 4);
+        const uint32_t *in2_w = (const uint32_t *) __builtin_assume_aligned(input2_data, 4);
+        uint32_t *out_w = (uint32_t *) __builtin_assume_aligned(output, 4);
+        for (; i < (size & ~3); i += 4) {
+            uint32_t w1, w2;
+            memcpy(&w1, in1_w++, 4);
+            memcpy(&w2, in2_w++, 4);
+
+            int32_t out0 = lut1[w1 & 0xff] + lut2[w2 & 0xff];
+            int32_t out1 = lut1[(w1 >> 8) & 0xff] + lut2[(w2 >> 8) & 0xff];
+            int32_t out2 = lut1[(w1 >> 16) & 0xff] + lut2[(w2 >> 16) & 0xff];
+            int32_t out3 = lut1[w1 >> 24] + lut2[w2 >> 24];
+
+            out0 = esp_nn_add_rescale_output(out0, out_offset, out_mult, out_shift,
+                                             activation_min, activation_max);
+            out1 = esp_nn_add_rescale_output(out1, out_offset, out_mult, out_shift,
+                                             activation_min, activation_max);
+            out2 = esp_nn_add_rescale_output(out2, out_offset, out_mult, out_shift,
+                                             activation_min, activation_max);
+            out3 = esp_nn_add_rescale_output(out3, out_offset, out_mult, out_shift,
+                                             activation_min, activation_max);
+
+            uint32_t packed = (uint8_t) out0 | ((uint32_t) (uint8_t) out1 << 8) |
+                              ((uint32_t) (uint8_t) out2 << 16) | ((uint32_t) (uint8_t) out3 << 24);
+            memcpy(out_w++, &packed, 4);
+        }
+    }
+
+    for (; i < size; i++) {
+        int32_t out = lut1[(uint8_t) input1_data[i]] + lut2[(uint8_t) input2_data[i]];
+        output[i] = (int8_t) esp_nn_add_rescale_output(out, out_offset, out_mult, out_shift,
+                                                       activation_min, activation_max);
+    }
+}
@@ -170,6 +170,87 @@ __NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_fast(int32_t x, in
     return result;
 }
 
+/**
+ * First filter tap, along one dimension, that lands inside the input for a
+ * window starting at `base` with taps `dilation` apart.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_dilated_filter_start(int32_t base, int32_t dilation)
+{
+    return base < 0 ? (dilation - 1 - base) / dilation : 0;
+}
+
+/**
+ * One past the last filter tap that lands inside an input of `input_size`.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_dilated_filter_end(int32_t base, int32_t dilation,
+                                                      int32_t input_size, int32_t filter_size)
+{
+    return min(filter_size, (input_size - base + dilation - 1) / dilation);
+}
+
+/**
+ * 64 bit accumulator version used by the s16 (16x8) kernels.
+ * Same as tflite's MultiplyByQuantizedMultiplier(int64_t, ...): the
+ * multiplier is rounded to 16 bits and a single rounding shift is applied.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_s64(int64_t x, int32_t mult, int32_t shift)
+{
+    const int32_t reduced_mult = mult < 0x7FFF0000 ? (mult + (1 << 15)) >> 16 : 0x7FFF;
+    const int32_t total_shift = 15 - shift;
+    const int64_t result = x * reduced_mult + ((int64_t) 1 << (total_shift - 1));
+    return (int32_t) (result >> total_shift);
+}
+
+/**
+ * fast version
+ * Unlike the 32 bit fast version this is exact: accumulators that fit in
+ * 32 bits, the common case, only need a 32x32 -> 64 bit multiply.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_s64_fast(int64_t x, int32_t mult, int32_t shift)
+{
+    const int32_t reduced_mult = mult < 0x7FFF0000 ? (mult + (1 << 15)) >> 16 : 0x7FFF;
+    const int32_t total_shift = 15 - shift;
+    const int64_t round = (int64_t) 1 << (total_shift - 1);
+    if (x == (int32_t) x) {
+        return (int32_t) (((int64_t) (int32_t) x * reduced_mult + round) >> total_shift);
+    }
+    return (int32_t) ((x * reduced_mult + round) >> total_shift);
+}
+
+/**
+ * Number of int16 x int8 products an int32 accumulator holds without
+ * overflow: 511 * (-32768 * -128) < 2^31.
+ */
+#define ESP_NN_S16_MAX_INT32_TERMS 511
+
+/**
+ * @brief       dot product of int16 input and int8 filter
+ *
+ * @note        accumulates in 32 bits, in chunks short enough not to
+ *              overflow, and widens to 64 bits once per chunk.
+ */
+__NN_FORCE_INLINE__ int64_t esp_nn_dot_s16_s8(const int16_t *input, const int8_t *filter, int32_t len)
+{
+    int64_t result = 0;
+    while (len > 0) {
+        const int32_t chunk = min(len, ESP_NN_S16_MAX_INT32_TERMS);
+        int32_t acc = 0;
+        int32_t i = 0;
+        for (; i < chunk - 3; i += 4) {
+            acc += *input++ * *filter++;
+            acc += *input++ * *filter++;
+            acc += *input++ * *filter++;
+            acc += *input++ * *filter++;
+        }
+        for (; i < chunk; i++) {
+            acc += *input++ * *filter++;
+        }
+        result += acc;
+        len -= chunk;
+    }
+    return result;
+}
+
 static void esp_nn_aligned_s8_pad_with_value(const int8_t *src, int8_t *dst,
                                              const uint16_t input_wd,
                                              const uint16_t input_ht,
@@ -52,7 +52,7 @@
 
 #include <common_functions.h>
 
-static int16_t *scratch_buffer = NULL;
+static __thread int16_t *scratch_buffer = NULL;
 
 __attribute__ ((noinline))
 static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
@@ -89,7 +89,8 @@ static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
 /**
  * Assumption 1: i/p channels == o/p channels
  * Assumption 2: Pointers are valid
- * Assumption 3: dialation width = 1
+ *
+ * dilation of 0 is treated as 1; it has no effect on 1x1 filters
  */
 void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                         const int8_t *input_data,
@@ -124,6 +125,8 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
     const uint16_t out_channels = output_dims->channels;
     const int32_t activation_min = conv_params->activation.min;
     const int32_t activation_max = conv_params->activation.max;
+    const int32_t dilation_wd = max(conv_params->dilation.width, 1);
+    const int32_t dilation_ht = max(conv_params->dilation.height, 1);
 
     int32_t out_ch_idx, out_y, out_x, filter_y_idx, filter_x_idx;
 
@@ -137,16 +140,16 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
                 const int32_t base_y = stride_ht * out_y - pad_ht;
                 const int32_t base_x = stride_wd * out_x - pad_wd;
 
-                const int32_t filter_y_start = max(0, -base_y);
-                const int32_t filter_x_start = max(0, -base_x);
+                const int32_t filter_y_start = esp_nn_dilated_filter_start(base_y, dilation_ht);
+                const int32_t filter_x_start = esp_nn_dilated_filter_start(base_x, dilation_wd);
 
-                const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
-                const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+                const int32_t filter_y_end = esp_nn_dilated_filter_end(base_y, dilation_ht, input_ht, filter_ht);
+                const int32_t filter_x_end = esp_nn_dilated_filter_end(base_x, dilation_wd, input_wd, filter_wd);
 
                 for (filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
                     for (filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                        const int32_t in_row = base_y + filter_y_idx;
-                        const int32_t in_col = base_x + filter_x_idx;
+                        const int32_t in_row = base_y + filter_y_idx * dilation_ht;
+                        const int32_t in_col = base_x + filter_x_idx * dilation_wd;
 
                         const int8_t *input_ptr = input_data +
                                         (in_row * input_wd + in_col) * in_channels;
@@ -177,3 +180,508 @@ void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
         }
     }
 }
+
+/**
+ * Assumption 1: i/p channels == o/p channels
+ * Assumption 2: Pointers are valid
+ * Assumption 3: dialation width = 1
+ *
+ * Products are summed in 32 bits over each filter row that lies inside
+ * the input, and widened to 64 bits once per row.
+ */
+void esp_nn_conv_s16_opt(const data_dims_t *input_dims,
+                         const int16_t *input_data,
+                         const data_dims_t *filter_dims,
+                         const int8_t *filter_data,
+                         const int64_t *bias,
+                         const data_dims_t *output_dims,
+                         int16_t *out_data,
+                         const conv_params_t *conv_params,
+                         const quant_data_t *quant_data)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t filter_size = filter_wd * filter_ht * in_channels;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = stride_ht * out_y - pad_ht;
+        const int32_t filter_y_start = max(0, -base_y);
+        const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t base_x = stride_wd * out_x - pad_wd;
+            const int32_t filter_x_start = max(0, -base_x);
+            const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+            /* in_channels values are contiguous along a filter row, and so are the inputs */
+            const int32_t row_len = (filter_x_end - filter_x_start) * in_channels;
+
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+            const int8_t *filter_base_ptr = filter_data;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                int64_t conv_out = 0;
+                for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                    const int16_t *input_ptr = input_data +
+                        ((base_y + filter_y_idx) * input_wd + base_x + filter_x_start) * in_channels;
+                    const int8_t *filter_ptr = filter_base_ptr +
+                        (filter_y_idx * filter_wd + filter_x_start) * in_channels;
+                    conv_out += esp_nn_dot_s16_s8(input_ptr, filter_ptr, row_len);
+                }
+                if (bias) {
+                    conv_out += bias[out_ch_idx];
+                }
+                int32_t result = esp_nn_multiply_by_quantized_mult_s64_fast(conv_out, *out_mult++, *out_shift++);
+                result = max(result, activation_min);
+                result = min(result, activation_max);
+                *out_data++ = (int16_t) result;
+                filter_base_ptr += filter_size;
+            }
+        }
+    }
+}
+
+/**
+ * Winograd F(2x2, 3x3): Y = A' [(G g G') . (B' d B)] A
+ *
+ * G is scaled by 2 so the filter transform stays integer; the sum then comes
+ * out as 4 * Y and is divided back exactly, which keeps the result bit-exact
+ * with the direct convolution. With |d| <= 255 the transformed input fits
+ * int16 (|V| <= 4 * 255) and so does the filter (|U| <= 9 * 128).
+ *
+ * Transformed filter layout: [out_ch][16][in_ch]
+ */
+#define ESP_NN_WINOGRAD_MAX_IN_CH 1024
+
+static __thread int16_t *winograd_scratch = NULL;
+
+int esp_nn_conv_s8_winograd_supported_opt(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const conv_params_t *conv_params)
+{
+    return filter_dims->width == 3 && filter_dims->height == 3 &&
+           conv_params->stride.width == 1 && conv_params->stride.height == 1 &&
+           conv_params->dilation.width <= 1 && conv_params->dilation.height <= 1 &&
+           input_dims->channels <= ESP_NN_WINOGRAD_MAX_IN_CH;
+}
+
+int esp_nn_get_conv_winograd_filter_size_opt(const data_dims_t *input_dims,
+                                             const data_dims_t *output_dims)
+{
+    return 16 * input_dims->channels * output_dims->channels * sizeof(int16_t);
+}
+
+int esp_nn_get_conv_winograd_scratch_size_opt(const data_dims_t *input_dims)
+{
+    return 16 * input_dims->channels * sizeof(int16_t);
+}
+
+void esp_nn_set_conv_winograd_scratch_buf_opt(const void *buf)
+{
+    winograd_scratch = (int16_t *) buf;
+}
+
+void esp_nn_conv_winograd_transform_filter_opt(const data_dims_t *input_dims,
+                                               const int8_t *filter_data,
+                                               const data_dims_t *output_dims,
+                                               int16_t *wg_filter)
+{
+    const int32_t in_ch = input_dims->channels;
+    const int32_t out_ch = output_dims->channels;
+
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_ch; out_ch_idx++) {
+        for (int32_t in_ch_idx = 0; in_ch_idx < in_ch; in_ch_idx++) {
+            const int8_t *g = filter_data + out_ch_idx * 9 * in_ch + in_ch_idx;
+            int16_t *u = wg_filter + out_ch_idx * 16 * in_ch + in_ch_idx;
+            int32_t t[4][3];
+
+            /* 2G g */
+            for (int col = 0; col < 3; col++) {
+                const int32_t g0 = g[(0 * 3 + col) * in_ch];
+                const int32_t g1 = g[(1 * 3 + col) * in_ch];
+                const int32_t g2 = g[(2 * 3 + col) * in_ch];
+                t[0][col] = 2 * g0;
+                t[1][col] = g0 + g1 + g2;
+                t[2][col] = g0 - g1 + g2;
+                t[3][col] = 2 * g2;
+            }
+            /* (2G g) 2G' */
+            for (int row = 0; row < 4; row++) {
+                u[(row * 4 + 0) * in_ch] = 2 * t[row][0];
+                u[(row * 4 + 1) * in_ch] = t[row][0] + t[row][1] + t[row][2];
+                u[(row * 4 + 2) * in_ch] = t[row][0] - t[row][1] + t[row][2];
+                u[(row * 4 + 3) * in_ch] = 2 * t[row][2];
+            }
+        }
+    }
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_dot_s16_s16(const int16_t *a, const int16_t *b, int32_t len)
+{
+    int32_t acc0 = 0, acc1 = 0;
+    int32_t i = 0;
+    for (; i < len - 3; i += 4) {
+        acc0 += a[i + 0] * b[i + 0];
+        acc1 += a[i + 1] * b[i + 1];
+        acc0 += a[i + 2] * b[i + 2];
+        acc1 += a[i + 3] * b[i + 3];
+    }
+    for (; i < len; i++) {
+        acc0 += a[i] * b[i];
+    }
+    return acc0 + acc1;
+}
+
+/**
+ * Assumption: i/p channels == filter channels, filter (3,3), stride (1,1),
+ * scratch buffer set with esp_nn_set_conv_winograd_scratch_buf_opt()
+ */
+void esp_nn_conv_s8_winograd_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const int16_t *wg_filter,
+                                 const int32_t *bias,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const quant_data_t *quant_data)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t in_ch = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t pad_ht = conv_params->padding.height;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t out_ch = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    int16_t *v = winograd_scratch;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y += 2) {
+        const int32_t base_y = out_y - pad_ht;
+        const int32_t rows = min(out_ht - out_y, 2);
+        for (int32_t out_x = 0; out_x < out_wd; out_x += 2) {
+            const int32_t base_x = out_x - pad_wd;
+            const int32_t cols = min(out_wd - out_x, 2);
+
+            /* gather the 4x4 input tile with offset; padding is 0 after offset */
+            for (int32_t r = 0; r < 4; r++) {
+                const int32_t in_y = base_y + r;
+                for (int32_t c = 0; c < 4; c++) {
+                    const int32_t in_x = base_x + c;
+                    int16_t *dst = v + (r * 4 + c) * in_ch;
+                    if (in_y < 0 || in_y >= input_ht || in_x < 0 || in_x >= input_wd) {
+                        memset(dst, 0, in_ch * sizeof(int16_t));
+                        continue;
+                    }
+                    const int8_t *src = input_data + (in_y * input_wd + in_x) * in_ch;
+                    for (int32_t ch = 0; ch < in_ch; ch++) {
+                        dst[ch] = src[ch] + input_offset;
+                    }
+                }
+            }
+
+            /* B' d B, in place */
+            for (int32_t ch = 0; ch < in_ch; ch++) {
+                int16_t *d = v + ch;
+                int32_t t[4][4];
+                for (int32_t c = 0; c < 4; c++) {
+                    const int32_t d0 = d[(0 * 4 + c) * in_ch];
+                    const int32_t d1 = d[(1 * 4 + c) * in_ch];
+                    const int32_t d2 = d[(2 * 4 + c) * in_ch];
+                    const int32_t d3 = d[(3 * 4 + c) * in_ch];
+                    t[0][c] = d0 - d2;
+                    t[1][c] = d1 + d2;
+                    t[2][c] = d2 - d1;
+                    t[3][c] = d1 - d3;
+                }
+                for (int32_t r = 0; r < 4; r++) {
+                    d[(r * 4 + 0) * in_ch] = t[r][0] - t[r][2];
+                    d[(r * 4 + 1) * in_ch] = t[r][1] + t[r][2];
+                    d[(r * 4 + 2) * in_ch] = t[r][2] - t[r][1];
+                    d[(r * 4 + 3) * in_ch] = t[r][1] - t[r][3];
+                }
+            }
+
+            const int16_t *u = wg_filter;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_ch; out_ch_idx++) {
+                /* |m| <= 1152 * 1020 * in_ch fits int32 for in_ch <= 1024 */
+                int32_t m[16];
+                for (int32_t k = 0; k < 16; k++) {
+                    m[k] = esp_nn_dot_s16_s16(u, v + k * in_ch, in_ch);
+                    u += in_ch;
+                }
+
+                /* A' m A; the final values are exact, intermediates may wrap */
+                uint32_t t0[4], t1[4];
+                for (int32_t c = 0; c < 4; c++) {
+                    t0[c] = (uint32_t) m[c] + (uint32_t) m[4 + c] + (uint32_t) m[8 + c];
+                    t1[c] = (uint32_t) m[4 + c] - (uint32_t) m[8 + c] - (uint32_t) m[12 + c];
+                }
+                int32_t y[2][2];
+                y[0][0] = (int32_t) (t0[0] + t0[1] + t0[2]) >> 2;
+                y[0][1] = (int32_t) (t0[1] - t0[2] - t0[3]) >> 2;
+                y[1][0] = (int32_t) (t1[0] + t1[1] + t1[2]) >> 2;
+                y[1][1] = (int32_t) (t1[1] - t1[2] - t1[3]) >> 2;
+
+                const int32_t out_bias = bias ? bias[out_ch_idx] : 0;
+                const int32_t mult = quant_data->mult[out_ch_idx];
+                const int32_t shift = quant_data->shift[out_ch_idx];
+                for (int32_t r = 0; r < rows; r++) {
+                    for (int32_t c = 0; c < cols; c++) {
+                        int32_t result = y[r][c] + out_bias;
+                        result = esp_nn_multiply_by_quantized_mult_fast(result, mult, shift);
+                        result += out_offset;
+                        result = max(result, activation_min);
+                        result = min(result, activation_max);
+                        out_data[((out_y + r) * out_wd + out_x + c) * out_ch + out_ch_idx] = (int8_t) result;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * im2col + GEMM: the patches of a block of output pixels are laid out as rows
+ * in scratch memory, then every tile of four output channels is multiplied
+ * with the whole block, so the four filter rows stay in cache while the block
+ * is reused.
+ *
+ * Patches hold raw input values, with padding set to the input zero point
+ * (-in_offset), so the micro-kernel is a plain int8 dot product; the offset
+ * is applied once per output channel as in_offset * sum(filter). Integer
+ * sums are exact, which keeps the result bit-exact with esp_nn_conv_s8_opt.
+ *
+ * Scratch layout: [out_ch] int32 bias + offset terms, then the patch block.
+ */
+static __thread int8_t *im2col_scratch = NULL;
+static __thread int32_t im2col_scratch_size = 0;
+
+int esp_nn_get_conv_im2col_scratch_size_opt(const data_dims_t *input_dims,
+                                            const data_dims_t *filter_dims,
+                                            const data_dims_t *output_dims,
+                                            int32_t block_pixels)
+{
+    const int32_t patch_size = filter_dims->width * filter_dims->height * input_dims->channels;
+    return output_dims->channels * sizeof(int32_t) + block_pixels * patch_size;
+}
+
+void esp_nn_set_conv_im2col_scratch_buf_opt(const void *buf, int32_t size)
+{
+    im2col_scratch = (int8_t *) buf;
+    im2col_scratch_size = buf ? size : 0;
+}
+
+static void esp_nn_im2col_s8(const int8_t *input_data,
+                             int32_t input_wd, int32_t input_ht, int32_t in_ch,
+                             int32_t filter_wd, int32_t filter_ht,
+                             const conv_params_t *conv_params,
+                             int32_t out_wd, int32_t pixel, int32_t count,
+                             int8_t *patches)
+{
+    const int32_t pad_val = -conv_params->in_offset;
+    const int32_t stride_wd = conv_params->stride.width;
+    const int32_t stride_ht = conv_params->stride.height;
+    const int32_t dilation_wd = max(conv_params->dilation.width, 1);
+    const int32_t dilation_ht = max(conv_params->dilation.height, 1);
+    int32_t out_y = pixel / out_wd;
+    int32_t out_x = pixel - out_y * out_wd;
+
+    for (int32_t i = 0; i < count; i++) {
+        const int32_t base_y = out_y * stride_ht - conv_params->padding.height;
+        const int32_t base_x = out_x * stride_wd - conv_params->padding.width;
+        for (int32_t filter_y = 0; filter_y < filter_ht; filter_y++) {
+            const int32_t in_y = base_y + filter_y * dilation_ht;
+            if (in_y < 0 || in_y >= input_ht) {
+                memset(patches, pad_val, filter_wd * in_ch);
+                patches += filter_wd * in_ch;
+                continue;
+            }
+            const int8_t *row = input_data + in_y * input_wd * in_ch;
+            if (dilation_wd == 1 && base_x >= 0 && base_x + filter_wd <= input_wd) {
+                memcpy(patches, row + base_x * in_ch, filter_wd * in_ch);
+                patches += filter_wd * in_ch;
+                continue;
+            }
+            for (int32_t filter_x = 0; filter_x < filter_wd; filter_x++) {
+                const int32_t in_x = base_x + filter_x * dilation_wd;
+                if (in_x < 0 || in_x >= input_wd) {
+                    memset(patches, pad_val, in_ch);
+                } else {
+                    memcpy(patches, row + in_x * in_ch, in_ch);
+                }
+                patches += in_ch;
+            }
+        }
+        if (++out_x == out_wd) {
+            out_x = 0;
+            out_y++;
+        }
+    }
+}
+
+/* Dot products of two patches with four consecutive filter rows */
+__NN_FORCE_INLINE__ void esp_nn_gemm_s8_2x4(const int8_t *patch0, const int8_t *patch1,
+                                            const int8_t *filter, int32_t len, int32_t *acc)
+{
+    const int8_t *filter0 = filter;
+    const int8_t *filter1 = filter0 + len;
+    const int8_t *filter2 = filter1 + len;
+    const int8_t *filter3 = filter2 + len;
+    int32_t acc00 = 0, acc01 = 0, acc02 = 0, acc03 = 0;
+    int32_t acc10 = 0, acc11 = 0, acc12 = 0, acc13 = 0;
+
+    for (int32_t i = 0; i < len; i++) {
+        const int32_t in0 = patch0[i];
+        const int32_t in1 = patch1[i];
+        const int32_t f0 = filter0[i];
+        const int32_t f1 = filter1[i];
+        const int32_t f2 = filter2[i];
+        const int32_t f3 = filter3[i];
+        acc00 += in0 * f0;
+        acc01 += in0 * f1;
+        acc02 += in0 * f2;
+        acc03 += in0 * f3;
+        acc10 += in1 * f0;
+        acc11 += in1 * f1;
+        acc12 += in1 * f2;
+        acc13 += in1 * f3;
+    }
+    acc[0] = acc00; acc[1] = acc01; acc[2] = acc02; acc[3] = acc03;
+    acc[4] = acc10; acc[5] = acc11; acc[6] = acc12; acc[7] = acc13;
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_dot_s8_s8(const int8_t *a, const int8_t *b, int32_t len)
+{
+    int32_t acc = 0;
+    for (int32_t i = 0; i < len; i++) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+__NN_FORCE_INLINE__ int8_t esp_nn_requant_s8(int32_t acc, int32_t mult, int32_t shift,
+                                             int32_t out_offset,
+                                             int32_t activation_min, int32_t activation_max)
+{
+    acc = esp_nn_multiply_by_quantized_mult_fast(acc, mult, shift);
+    acc += out_offset;
+    acc = max(acc, activation_min);
+    acc = min(acc, activation_max);
+    return (int8_t) acc;
+}
+
+/**
+ * Assumption 1: i/p channels == filter channels
+ * Assumption 2: scratch buffer set with esp_nn_set_conv_im2col_scratch_buf_opt();
+ *               falls back to esp_nn_conv_s8_opt if it holds fewer than two patches
+ *
+ * 1x1 filters with stride 1 and no padding multiply the input in place.
+ */
+void esp_nn_conv_s8_im2col_opt(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *filter_data,
+                               const int32_t *bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t in_ch = input_dims->channels;
+    const int32_t filter_wd = filter_dims->width;
+    const int32_t filter_ht = filter_dims->height;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ch = output_dims->channels;
+    const int32_t out_size = out_wd * output_dims->height;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t patch_size = filter_wd * filter_ht * in_ch;
+    const int32_t in_place = filter_wd == 1 && filter_ht == 1 &&
+                             conv_params->stride.width == 1 && conv_params->stride.height == 1 &&
+                             conv_params->padding.width == 0 && conv_params->padding.height == 0;
+    const int32_t block = (im2col_scratch_size - out_ch * (int32_t) sizeof(int32_t)) / patch_size;
+
+    if (block < 2) {
+        esp_nn_conv_s8_opt(input_dims, input_data, filter_dims, filter_data, bias,
+                           output_dims, out_data, conv_params, quant_data);
+        return;
+    }
+
+    int32_t *acc_base = (int32_t *) im2col_scratch;
+    int8_t *patches = im2col_scratch + out_ch * sizeof(int32_t);
+    const int8_t *filter_ptr = filter_data;
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_ch; out_ch_idx++) {
+        int32_t filter_sum = 0;
+        for (int32_t i = 0; i < patch_size; i++) {
+            filter_sum += *filter_ptr++;
+        }
+        acc_base[out_ch_idx] = (bias ? bias[out_ch_idx] : 0) + input_offset * filter_sum;
+    }
+
+    for (int32_t pixel = 0; pixel < out_size; pixel += block) {
+        const int32_t count = min(block, out_size - pixel);
+        const int8_t *block_data = patches;
+        if (in_place) {
+            block_data = input_data + pixel * in_ch;
+        } else {
+            esp_nn_im2col_s8(input_data, input_wd, input_ht, in_ch, filter_wd, filter_ht,
+                             conv_params, out_wd, pixel, count, patches);
+        }
+        int8_t *out_block = out_data + pixel * out_ch;
+
+        int32_t out_ch_idx = 0;
+        for (; out_ch_idx < out_ch - 3; out_ch_idx += 4) {
+            const int8_t *filter = filter_data + out_ch_idx * patch_size;
+            const int32_t *mult = quant_data->mult + out_ch_idx;
+            const int32_t *shift = quant_data->shift + out_ch_idx;
+            for (int32_t i = 0; i < count; i += 2) {
+                const int8_t *patch0 = block_data + i * patch_size;
+                /* an odd last pixel is computed twice and stored once */
+                const int32_t pair = i + 1 < count;
+                const int8_t *patch1 = pair ? patch0 + patch_size : patch0;
+                int32_t acc[8];
+                esp_nn_gemm_s8_2x4(patch0, patch1, filter, patch_size, acc);
+                int8_t *out0 = out_block + i * out_ch + out_ch_idx;
+                for (int32_t k = 0; k < 4; k++) {
+                    out0[k] = esp_nn_requant_s8(acc[k] + acc_base[out_ch_idx + k], mult[k], shift[k],
+                                                out_offset, activation_min, activation_max);
+                }
+                if (pair) {
+                    int8_t *out1 = out0 + out_ch;
+                    for (int32_t k = 0; k < 4; k++) {
+                        out1[k] = esp_nn_requant_s8(acc[4 + k] + acc_base[out_ch_idx + k], mult[k], shift[k],
+                                                    out_offset, activation_min, activation_max);
+                    }
+                }
+            }
+        }
+        for (; out_ch_idx < out_ch; out_ch_idx++) {
+            const int8_t *filter = filter_data + out_ch_idx * patch_size;
+            for (int32_t i = 0; i < count; i++) {
+                const int32_t acc = esp_nn_dot_s8_s8(block_data + i * patch_size, filter, patch_size);
+                out_block[i * out_ch + out_ch_idx] =
+                    esp_nn_requant_s8(acc + acc_base[out_ch_idx], quant_data->mult[out_ch_idx],
+                                      quant_data->shift[out_ch_idx], out_offset,
+                                      activation_min, activation_max);
+            }
+        }
+    }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
 #include <common_functions.h>
 
 int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
@@ -55,6 +56,8 @@ static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
     const uint16_t out_ht = output_dims->height;
     const int32_t activation_min = conv_params->activation.min;
     const int32_t activation_max = conv_params->activation.max;
+    const int32_t dilation_wd = max(conv_params->dilation.width, 1);
+    const int32_t dilation_ht = max(conv_params->dilation.height, 1);
 
     int out_idx = 0;
     for (int out_y = 0; out_y < out_ht; out_y++) { //height loop
@@ -66,10 +69,10 @@ static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
             const int32_t *out_mult = quant_data->mult;
 
             /* Select filter so as the point doesn't lie outside block */
-            int filter_y_start = max(0, -base_y);
-            int filter_x_start = max(0, -base_x);
-            int filter_y_end = min(filter_ht, input_ht - base_y);
-            int filter_x_end = min(filter_wd, input_wd - base_x);
+            int filter_y_start = esp_nn_dilated_filter_start(base_y, dilation_ht);
+            int filter_x_start = esp_nn_dilated_filter_start(base_x, dilation_wd);
+            int filter_y_end = esp_nn_dilated_filter_end(base_y, dilation_ht, input_ht, filter_ht);
+            int filter_x_end = esp_nn_dilated_filter_end(base_x, dilation_wd, input_wd, filter_wd);
 
             int ch_idx = 0;
             for (; ch_idx < channels - 3; ch_idx += 4) {//channel_loop
@@ -79,9 +82,9 @@ static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
                 int32_t result3 = 0;
 
                 for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
-                    const int32_t idx_y = base_y + filter_y_idx;
+                    const int32_t idx_y = base_y + filter_y_idx * dilation_ht;
                     for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                        const int32_t idx_x = base_x + filter_x_idx;
+                        const int32_t idx_x = base_x + filter_x_idx * dilation_wd;
                         int32_t input_index = (idx_y * input_wd + idx_x) * channels + ch_idx;
                         int32_t filter_index = (filter_y_idx * filter_wd + filter_x_idx) * (channels) + ch_idx;
                         int32_t input_val0 = input_data[input_index + 0] + input_offset;
@@ -133,9 +136,9 @@ static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
                 int32_t result = 0;
 
                 for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
-                    const int32_t idx_y = base_y + filter_y_idx;
+                    const int32_t idx_y = base_y + filter_y_idx * dilation_ht;
                     for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                        const int32_t idx_x = base_x + filter_x_idx;
+                        const int32_t idx_x = base_x + filter_x_idx * dilation_wd;
                         int32_t input_index = (idx_y * input_wd + idx_x) * channels + ch_idx;
                         int32_t filter_index = (filter_y_idx * filter_wd + filter_x_idx) * (channels) + ch_idx;
                         int32_t input_val = input_data[input_index] + input_offset;
@@ -157,22 +160,24 @@ static void esp_nn_depthwise_conv_s8_ch_mult_1(const data_dims_t *input_dims,
     }
 }
 
-void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
-                                  const int8_t *input_data,
-                                  const data_dims_t *filter_dims,
-                                  const int8_t *filter_data,
-                                  const int32_t *bias,
-                                  const data_dims_t *output_dims,
-                                  int8_t *out_data,
-                                  const dw_conv_params_t *conv_params,
-                                  const quant_data_t *quant_data)
+/**
+ * channel multiplier > 1
+ *
+ * Each input value is loaded once per group of up to four output channels
+ * it feeds, and the taps are walked with pointer increments; the part of the
+ * window inside the input is worked out once per output pixel.
+ */
+__attribute__ ((noinline))
+static void esp_nn_depthwise_conv_s8_ch_mult_n(const data_dims_t *input_dims,
+                                               const int8_t *input_data,
+                                               const data_dims_t *filter_dims,
+                                               const int8_t *filter_data,
+                                               const int32_t *bias,
+                                               const data_dims_t *output_dims,
+                                               int8_t *out_data,
+                                               const dw_conv_params_t *conv_params,
+                                               const quant_data_t *quant_data)
 {
-    const uint16_t ch_mult = conv_params->ch_mult;
-    if (ch_mult == 1) {
-        esp_nn_depthwise_conv_s8_ch_mult_1(input_dims, input_data, filter_dims, filter_data,
-                                           bias, output_dims, out_data, conv_params, quant_data);
-        return;
-    }
     const uint16_t input_wd = input_dims->width;
     const uint16_t input_ht = input_dims->height;
     const uint16_t channels = input_dims->channels;
@@ -188,47 +193,60 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
     const uint16_t out_ht = output_dims->height;
     const int32_t activation_min = conv_params->activation.min;
     const int32_t activation_max = conv_params->activation.max;
+    const uint16_t ch_mult = conv_params->ch_mult;
+    const int32_t dilation_wd = max(conv_params->dilation.width, 1);
+    const int32_t dilation_ht = max(conv_params->dilation.height, 1);
+
+    const int32_t out_channels = channels * ch_mult;
+    const int32_t input_col_step = dilation_wd * channels;
+    const int32_t input_row_step = dilation_ht * input_wd * channels;
+    const int32_t filter_row_step = filter_wd * out_channels;
 
     int out_idx = 0;
     for (int out_y = 0; out_y < out_ht; out_y++) { //height loop
-        const int16_t base_y = (out_y * stride_ht) - pad_ht;
+        const int32_t base_y = (out_y * stride_ht) - pad_ht;
+        const int32_t filter_y_start = esp_nn_dilated_filter_start(base_y, dilation_ht);
+        const int32_t filter_y_end = esp_nn_dilated_filter_end(base_y, dilation_ht, input_ht, filter_ht);
         for (int out_x = 0; out_x < out_wd; out_x++) { //width_loop
-            const int16_t base_x = (out_x * stride_wd) - pad_wd;
+            const int32_t base_x = (out_x * stride_wd) - pad_wd;
+            const int32_t filter_x_start = esp_nn_dilated_filter_start(base_x, dilation_wd);
+            const int32_t filter_x_end = esp_nn_dilated_filter_end(base_x, dilation_wd, input_wd, filter_wd);
+            const int32_t filter_x_cnt = filter_x_end - filter_x_start;
+
+            const int8_t *input_start = input_data +
+                    ((base_y + filter_y_start * dilation_ht) * input_wd +
+                     base_x + filter_x_start * dilation_wd) * channels;
+            const int8_t *filter_start = filter_data +
+                    (filter_y_start * filter_wd + filter_x_start) * out_channels;
 
             const int32_t *out_shift = quant_data->shift;
             const int32_t *out_mult = quant_data->mult;
 
-            /* Select filter so as the point doesn't lie outside block */
-            int filter_y_start = max(0, -base_y);
-            int filter_x_start = max(0, -base_x);
-            int filter_y_end = min(filter_ht, input_ht - base_y);
-            int filter_x_end = min(filter_wd, input_wd - base_x);
-
             for (int ch_idx = 0; ch_idx < channels; ch_idx++) {//channel_loop
                 int ch_mult_idx = 0;
                 for (; ch_mult_idx < ch_mult - 3; ch_mult_idx += 4) {
+                    const int out_ch_idx = ch_idx * ch_mult + ch_mult_idx;
                     int32_t result0 = 0;
                     int32_t result1 = 0;
                     int32_t result2 = 0;
                     int32_t result3 = 0;
-                    const int out_ch_idx =  ch_idx * ch_mult + ch_mult_idx;
 
+                    const int8_t *input_row = input_start + ch_idx;
+                    const int8_t *filter_row = filter_start + out_ch_idx;
                     for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
-                        const int32_t idx_y = base_y + filter_y_idx;
-                        for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                            const int32_t idx_x = base_x + filter_x_idx;
-                            int32_t input_index = (idx_y * input_wd + idx_x) * channels + ch_idx;
-                            int32_t filter_index = (filter_y_idx * filter_wd + filter_x_idx) * (channels * ch_mult) + out_ch_idx;
-                            int32_t input_val = input_data[input_index] + input_offset;
-                            int32_t filter_val0 = filter_data[filter_index + 0];
-                            int32_t filter_val1 = filter_data[filter_index + 1];
-                            int32_t filter_val2 = filter_data[filter_index + 2];
-                            int32_t filter_val3 = filter_data[filter_index + 3];
-                            result0 += input_val * filter_val0;
-                            result1 += input_val * filter_val1;
-                            result2 += input_val * filter_val2;
-                            result3 += input_val * filter_val3;
+                        const int8_t *input_ptr = input_row;
+                        const int8_t *filter_ptr = filter_row;
+                        for (int filter_x_idx = 0; filter_x_idx < filter_x_cnt; filter_x_idx++) {
+                            const int32_t input_val = *input_ptr + input_offset;
+                            result0 += input_val * filter_ptr[0];
+                            result1 += input_val * filter_ptr[1];
+                            result2 += input_val * filter_ptr[2];
+                            result3 += input_val * filter_ptr[3];
+                            input_ptr += input_col_step;
+                            filter_ptr += out_channels;
                         }
+                        input_row += input_row_step;
+                        filter_row += filter_row_step;
                     }
                     if (bias) {
                         result0 += bias[out_ch_idx + 0];
@@ -260,20 +278,60 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
                     out_data[out_idx++] = result2;
                     out_data[out_idx++] = result3;
                 }
+                for (; ch_mult_idx < ch_mult - 1; ch_mult_idx += 2) {
+                    const int out_ch_idx = ch_idx * ch_mult + ch_mult_idx;
+                    int32_t result0 = 0;
+                    int32_t result1 = 0;
+
+                    const int8_t *input_row = input_start + ch_idx;
+                    const int8_t *filter_row = filter_start + out_ch_idx;
+                    for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                        const int8_t *input_ptr = input_row;
+                        const int8_t *filter_ptr = filter_row;
+                        for (int filter_x_idx = 0; filter_x_idx < filter_x_cnt; filter_x_idx++) {
+                            const int32_t input_val = *input_ptr + input_offset;
+                            result0 += input_val * filter_ptr[0];
+                            result1 += input_val * filter_ptr[1];
+                            input_ptr += input_col_step;
+                            filter_ptr += out_channels;
+                        }
+                        input_row += input_row_step;
+                        filter_row += filter_row_step;
+                    }
+                    if (bias) {
+                        result0 += bias[out_ch_idx + 0];
+                        result1 += bias[out_ch_idx + 1];
+                    }
+                    result0 = esp_nn_multiply_by_quantized_mult_fast(result0, *out_mult++, *out_shift++);
+                    result1 = esp_nn_multiply_by_quantized_mult_fast(result1, *out_mult++, *out_shift++);
+
+                    result0 += out_offset;
+                    result1 += out_offset;
+
+                    result0 = max(result0, activation_min);
+                    result1 = max(result1, activation_min);
+                    result0 = min(result0, activation_max);
+                    result1 = min(result1, activation_max);
+
+                    out_data[out_idx++] = result0;
+                    out_data[out_idx++] = result1;
+                }
                 for (; ch_mult_idx < ch_mult; ch_mult_idx++) {
+                    const int out_ch_idx = ch_idx * ch_mult + ch_mult_idx;
                     int32_t result = 0;
-                    const int out_ch_idx =  ch_idx * ch_mult + ch_mult_idx;
 
+                    const int8_t *input_row = input_start + ch_idx;
+                    const int8_t *filter_row = filter_start + out_ch_idx;
                     for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
-                        const int32_t idx_y = base_y + filter_y_idx;
-                        for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
-                            const int32_t idx_x = base_x + filter_x_idx;
-                            int32_t input_index = (idx_y * input_wd + idx_x) * channels + ch_idx;
-                            int32_t filter_index = (filter_y_idx * filter_wd + filter_x_idx) * (channels * ch_mult) + out_ch_idx;
-                            int32_t input_val = input_data[input_index] + input_offset;
-                            int32_t filter_val = filter_data[filter_index];
-                            result += input_val * filter_val;
+                        const int8_t *input_ptr = input_row;
+                        const int8_t *filter_ptr = filter_row;
+                        for (int filter_x_idx = 0; filter_x_idx < filter_x_cnt; filter_x_idx++) {
+                            result += (*input_ptr + input_offset) * *filter_ptr;
+                            input_ptr += input_col_step;
+                            filter_ptr += out_channels;
                         }
+                        input_row += input_row_step;
+                        filter_row += filter_row_step;
                     }
                     if (bias) {
                         result += bias[out_ch_idx];
@@ -289,3 +347,281 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
         }
     }
 }
+
+/* dilation of 0 is treated as 1 */
+void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const dw_conv_params_t *conv_params,
+                                  const quant_data_t *quant_data)
+{
+    if (conv_params->ch_mult == 1) {
+        esp_nn_depthwise_conv_s8_ch_mult_1(input_dims, input_data, filter_dims, filter_data,
+                                           bias, output_dims, out_data, conv_params, quant_data);
+    } else {
+        esp_nn_depthwise_conv_s8_ch_mult_n(input_dims, input_data, filter_dims, filter_data,
+                                           bias, output_dims, out_data, conv_params, quant_data);
+    }
+}
+
+/**
+ * s16 input, s8 filter, s64 bias.
+ *
+ * A depthwise output sums filter_wd * filter_ht products, so for any
+ * filter up to ESP_NN_S16_MAX_INT32_TERMS taps the whole sum is done in 32
+ * bits and only the bias add and requantization are 64 bit.
+ */
+void esp_nn_depthwise_conv_s16_opt(const data_dims_t *input_dims,
+                                   const int16_t *input_data,
+                                   const data_dims_t *filter_dims,
+                                   const int8_t *filter_data,
+                                   const int64_t *bias,
+                                   const data_dims_t *output_dims,
+                                   int16_t *out_data,
+                                   const dw_conv_params_t *conv_params,
+                                   const quant_data_t *quant_data)
+{
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    if (filter_wd * filter_ht > ESP_NN_S16_MAX_INT32_TERMS) {
+        esp_nn_depthwise_conv_s16_ansi(input_dims, input_data, filter_dims, filter_data,
+                                       bias, output_dims, out_data, conv_params, quant_data);
+        return;
+    }
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t channels = input_dims->channels;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const uint16_t ch_mult = conv_params->ch_mult;
+    const int32_t out_channels = channels * ch_mult;
+
+    for (int out_y = 0; out_y < out_ht; out_y++) { //height loop
+        const int16_t base_y = (out_y * stride_ht) - pad_ht;
+        const int filter_y_start = max(0, -base_y);
+        const int filter_y_end = min(filter_ht, input_ht - base_y);
+        for (int out_x = 0; out_x < out_wd; out_x++) { //width_loop
+            const int16_t base_x = (out_x * stride_wd) - pad_wd;
+            const int filter_x_start = max(0, -base_x);
+            const int filter_x_end = min(filter_wd, input_wd - base_x);
+
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+
+            int ch_idx = 0;
+            if (ch_mult == 1) {
+                for (; ch_idx < channels - 3; ch_idx += 4) {//channel_loop
+                    int32_t result0 = 0;
+                    int32_t result1 = 0;
+                    int32_t result2 = 0;
+                    int32_t result3 = 0;
+
+                    for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                        const int16_t *input_ptr = input_data +
+                            ((base_y + filter_y_idx) * input_wd + base_x + filter_x_start) * channels + ch_idx;
+                        const int8_t *filter_ptr = filter_data +
+                            (filter_y_idx * filter_wd + filter_x_start) * channels + ch_idx;
+                        for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                            result0 += input_ptr[0] * filter_ptr[0];
+                            result1 += input_ptr[1] * filter_ptr[1];
+                            result2 += input_ptr[2] * filter_ptr[2];
+                            result3 += input_ptr[3] * filter_ptr[3];
+                            input_ptr += channels;
+                            filter_ptr += channels;
+                        }
+                    }
+                    int64_t acc0 = result0;
+                    int64_t acc1 = result1;
+                    int64_t acc2 = result2;
+                    int64_t acc3 = result3;
+                    if (bias) {
+                        acc0 += bias[ch_idx + 0];
+                        acc1 += bias[ch_idx + 1];
+                        acc2 += bias[ch_idx + 2];
+                        acc3 += bias[ch_idx + 3];
+                    }
+                    result0 = esp_nn_multiply_by_quantized_mult_s64_fast(acc0, *out_mult++, *out_shift++);
+                    result1 = esp_nn_multiply_by_quantized_mult_s64_fast(acc1, *out_mult++, *out_shift++);
+                    result2 = esp_nn_multiply_by_quantized_mult_s64_fast(acc2, *out_mult++, *out_shift++);
+                    result3 = esp_nn_multiply_by_quantized_mult_s64_fast(acc3, *out_mult++, *out_shift++);
+
+                    result0 = max(result0, activation_min);
+                    result1 = max(result1, activation_min);
+                    result2 = max(result2, activation_min);
+                    result3 = max(result3, activation_min);
+
+                    result0 = min(result0, activation_max);
+                    result1 = min(result1, activation_max);
+                    result2 = min(result2, activation_max);
+                    result3 = min(result3, activation_max);
+
+                    *out_data++ = (int16_t) result0;
+                    *out_data++ = (int16_t) result1;
+                    *out_data++ = (int16_t) result2;
+                    *out_data++ = (int16_t) result3;
+                }
+            }
+            for (; ch_idx < channels; ch_idx++) {//channel_loop
+                for (int ch_mult_idx = 0; ch_mult_idx < ch_mult; ch_mult_idx++) {
+                    const int out_ch_idx = ch_idx * ch_mult + ch_mult_idx;
+                    int32_t result = 0;
+
+                    for (int filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                        const int16_t *input_ptr = input_data +
+                            ((base_y + filter_y_idx) * input_wd + base_x + filter_x_start) * channels + ch_idx;
+                        const int8_t *filter_ptr = filter_data +
+                            (filter_y_idx * filter_wd + filter_x_start) * out_channels + out_ch_idx;
+                        for (int filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                            result += *input_ptr * *filter_ptr;
+                            input_ptr += channels;
+                            filter_ptr += out_channels;
+                        }
+                    }
+                    int64_t acc = result;
+                    if (bias) {
+                        acc += bias[out_ch_idx];
+                    }
+                    result = esp_nn_multiply_by_quantized_mult_s64_fast(acc, *out_mult++, *out_shift++);
+                    result = max(result, activation_min);
+                    result = min(result, activation_max);
+
+                    *out_data++ = (int16_t) result;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Pre-padded 3x3 depthwise convolution: the input is copied once into a
+ * buffer whose border holds the input zero point, so every filter window
+ * lies inside it and contributes 0 where it overlaps the padding. The kernel
+ * then needs no per pixel clamping and the 9 taps are fully unrolled.
+ */
+void esp_nn_get_depthwise_conv_padded_dims_opt(const data_dims_t *input_dims,
+                                               const data_dims_t *output_dims,
+                                               const dw_conv_params_t *conv_params,
+                                               data_dims_t *padded_dims)
+{
+    padded_dims->width = (output_dims->width - 1) * conv_params->stride.width + 3;
+    padded_dims->height = (output_dims->height - 1) * conv_params->stride.height + 3;
+    padded_dims->channels = input_dims->channels;
+    padded_dims->extra = 1;
+}
+
+void esp_nn_depthwise_conv_pad_input_s8_opt(const data_dims_t *input_dims,
+                                            const int8_t *input_data,
+                                            const dw_conv_params_t *conv_params,
+                                            const data_dims_t *padded_dims,
+                                            int32_t row_pitch,
+                                            int8_t *padded_data)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t channels = input_dims->channels;
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t pad_ht = conv_params->padding.height;
+    const int32_t padded_wd = padded_dims->width;
+    const int32_t pad_val = -conv_params->in_offset;
+    /* input columns inside the padded buffer, which may stop short of the input's right edge */
+    const int32_t copy_wd = min(input_wd, padded_wd - pad_wd);
+    const int32_t right_wd = padded_wd - pad_wd - copy_wd;
+
+    for (int32_t y = 0; y < padded_dims->height; y++) {
+        int8_t *dst = padded_data + y * row_pitch;
+        const int32_t in_y = y - pad_ht;
+        if (in_y < 0 || in_y >= input_ht) {
+            memset(dst, pad_val, padded_wd * channels);
+            continue;
+        }
+        memset(dst, pad_val, pad_wd * channels);
+        dst += pad_wd * channels;
+        memcpy(dst, input_data + in_y * input_wd * channels, copy_wd * channels);
+        dst += copy_wd * channels;
+        if (right_wd > 0) {
+            memset(dst, pad_val, right_wd * channels);
+        }
+    }
+}
+
+/* one channel of a 3x3 window whose rows are `row_pitch` apart */
+__NN_FORCE_INLINE__ int32_t esp_nn_depthwise_3x3_window(const int8_t *input, const int8_t *filter,
+                                                        int32_t row_pitch, int32_t channels,
+                                                        int32_t input_offset)
+{
+    const int8_t *row0 = input;
+    const int8_t *row1 = row0 + row_pitch;
+    const int8_t *row2 = row1 + row_pitch;
+    const int8_t *filter0 = filter;
+    const int8_t *filter1 = filter0 + 3 * channels;
+    const int8_t *filter2 = filter1 + 3 * channels;
+    int32_t result = 0;
+    result += (row0[0] + input_offset) * filter0[0];
+    result += (row0[channels] + input_offset) * filter0[channels];
+    result += (row0[2 * channels] + input_offset) * filter0[2 * channels];
+    result += (row1[0] + input_offset) * filter1[0];
+    result += (row1[channels] + input_offset) * filter1[channels];
+    result += (row1[2 * channels] + input_offset) * filter1[2 * channels];
+    result += (row2[0] + input_offset) * filter2[0];
+    result += (row2[channels] + input_offset) * filter2[channels];
+    result += (row2[2 * channels] + input_offset) * filter2[2 * channels];
+    return result;
+}
+
+/**
+ * Assumption 1: filter (3,3), ch_mult 1, no dilation
+ * Assumption 2: input padded with esp_nn_depthwise_conv_pad_input_s8_opt();
+ *               padding in conv_params is already applied
+ */
+void esp_nn_depthwise_conv_s8_3x3_padded_opt(const data_dims_t *padded_dims,
+                                             const int8_t *padded_data,
+                                             int32_t row_pitch,
+                                             const int8_t *filter_data,
+                                             const int32_t *bias,
+                                             const data_dims_t *output_dims,
+                                             int8_t *out_data,
+                                             const dw_conv_params_t *conv_params,
+                                             const quant_data_t *quant_data)
+{
+    const int32_t channels = padded_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t stride_wd = conv_params->stride.width;
+    const int32_t stride_ht = conv_params->stride.height;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int8_t *row = padded_data + out_y * stride_ht * row_pitch;
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int8_t *input_ptr = row + out_x * stride_wd * channels;
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+
+            for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                int32_t result = esp_nn_depthwise_3x3_window(input_ptr + ch_idx, filter_data + ch_idx,
+                                                             row_pitch, channels, input_offset);
+                if (bias) {
+                    result += bias[ch_idx];
+                }
+                result = esp_nn_multiply_by_quantized_mult_fast(result, *out_mult++, *out_shift++);
+                result += out_offset;
+                result = max(result, activation_min);
+                result = min(result, activation_max);
+                *out_data++ = (int8_t) result;
+            }
+        }
+    }
+}
@@ -17,7 +17,7 @@
 
 #include <common_functions.h>
 
-static int16_t *scratch_buffer = NULL;
+static __thread int16_t *scratch_buffer = NULL;
 
 extern void esp_nn_depthwise_conv_s16_mult8_3x3_esp32s3(const int16_t *input_data,
                                                         const uint16_t input_wd,
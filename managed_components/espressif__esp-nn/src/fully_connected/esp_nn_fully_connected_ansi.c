@@ -81,3 +81,32 @@ void esp_nn_fully_connected_per_ch_s8_ansi(const int8_t *input_data,
         out_data[out_c] = (int8_t) result;
     }
 }
+
+void esp_nn_fully_connected_s16_ansi(const int16_t *input_data,
+                                     const uint16_t row_len,
+                                     const int8_t *filter_data,
+                                     const int64_t *bias,
+                                     int16_t *out_data,
+                                     const uint16_t out_channels,
+                                     const int32_t out_shift,
+                                     const int32_t out_mult,
+                                     const int32_t activation_min,
+                                     const int32_t activation_max)
+{
+    for (int32_t out_c = 0; out_c < out_channels; ++out_c) {
+        int64_t result = 0;
+        for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+            int32_t filter_index = row_len * out_c + data_idx;
+            int32_t input_val = input_data[data_idx];
+            int32_t filter_val = filter_data[filter_index];
+            result += (int64_t) filter_val * input_val;
+        }
+        if (bias) {
+            result += bias[out_c];
+        }
+        int32_t out_val = esp_nn_multiply_by_quantized_mult_s64(result, out_mult, out_shift);
+        out_val = max(out_val, activation_min);
+        out_val = min(out_val, activation_max);
+        out_data[out_c] = (int16_t) out_val;
+    }
+}
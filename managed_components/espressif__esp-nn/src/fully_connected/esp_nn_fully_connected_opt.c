@@ -0,0 +1,42 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+void esp_nn_fully_connected_s16_opt(const int16_t *input_data,
+                                    const uint16_t row_len,
+                                    const int8_t *filter_data,
+                                    const int64_t *bias,
+                                    int16_t *out_data,
+                                    const uint16_t out_channels,
+                                    const int32_t out_shift,
+                                    const int32_t out_mult,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max)
+{
+    const int8_t *filter_ptr = filter_data;
+    for (int32_t out_c = 0; out_c < out_channels; ++out_c) {
+        int64_t result = esp_nn_dot_s16_s8(input_data, filter_ptr, row_len);
+        if (bias) {
+            result += bias[out_c];
+        }
+        int32_t out_val = esp_nn_multiply_by_quantized_mult_s64_fast(result, out_mult, out_shift);
+        out_val = max(out_val, activation_min);
+        out_val = min(out_val, activation_max);
+        *out_data++ = (int16_t) out_val;
+        filter_ptr += row_len;
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright 2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <common_functions.h>
+#include <esp_nn_defs.h>
+
+/**
+ * Source position of output `value` in 10 bit fixed point, and the two
+ * source pixels around it.
+ */
+static void esp_nn_resize_source_position(const int32_t value, const int32_t scale_10,
+                                          const int32_t half_pixel_centers,
+                                          const int32_t input_size, int32_t *scaled_value,
+                                          int32_t *lower_bound, int32_t *upper_bound)
+{
+    if (half_pixel_centers) {
+        *scaled_value = value * scale_10 + scale_10 / 2 - (1 << 9);
+    } else {
+        *scaled_value = value * scale_10;
+    }
+    *lower_bound = max(*scaled_value / (1 << 10), 0);
+    *upper_bound = min((*scaled_value + (1 << 10) - 1) / (1 << 10), input_size - 1);
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_resize_load(const void *data, const int32_t idx,
+                                               const bool is_unsigned)
+{
+    return is_unsigned ? ((const uint8_t *) data)[idx] : ((const int8_t *) data)[idx];
+}
+
+static int32_t esp_nn_resize_scale_10(const int32_t input_size, const int32_t output_size,
+                                      const int32_t align_corners)
+{
+    if (align_corners && output_size > 1) {
+        return ((1 << 10) * (input_size - 1) + (output_size - 1) / 2) / (output_size - 1);
+    }
+    return ((1 << 10) * input_size + output_size / 2) / output_size;
+}
+
+static void esp_nn_resize_bilinear_ansi(const data_dims_t *input_dims,
+                                        const void *input_data,
+                                        const data_dims_t *output_dims,
+                                        void *output_data,
+                                        const resize_params_t *params,
+                                        const bool is_unsigned)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t channels = input_dims->channels;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t height_scale_10 = esp_nn_resize_scale_10(input_ht, out_ht, params->align_corners);
+    const int32_t width_scale_10 = esp_nn_resize_scale_10(input_wd, out_wd, params->align_corners);
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        int32_t in_y, y0, y1;
+        esp_nn_resize_source_position(out_y, height_scale_10, params->half_pixel_centers,
+                                      input_ht, &in_y, &y0, &y1);
+        const int32_t dy = in_y - (1 << 10) * y0;
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            int32_t in_x, x0, x1;
+            esp_nn_resize_source_position(out_x, width_scale_10, params->half_pixel_centers,
+                                          input_wd, &in_x, &x0, &x1);
+            const int32_t dx = in_x - (1 << 10) * x0;
+            const int32_t idx_00 = (y0 * input_wd + x0) * channels;
+            const int32_t idx_10 = (y1 * input_wd + x0) * channels;
+            const int32_t idx_01 = (y0 * input_wd + x1) * channels;
+            const int32_t idx_11 = (y1 * input_wd + x1) * channels;
+            for (int32_t ch = 0; ch < channels; ch++) {
+                const int32_t in_00 = esp_nn_resize_load(input_data, idx_00 + ch, is_unsigned);
+                const int32_t in_10 = esp_nn_resize_load(input_data, idx_10 + ch, is_unsigned);
+                const int32_t in_01 = esp_nn_resize_load(input_data, idx_01 + ch, is_unsigned);
+                const int32_t in_11 = esp_nn_resize_load(input_data, idx_11 + ch, is_unsigned);
+                const int64_t result = (int64_t) in_00 * ((1 << 10) - dy) * ((1 << 10) - dx) +
+                                       (int64_t) in_10 * dy * ((1 << 10) - dx) +
+                                       (int64_t) in_01 * ((1 << 10) - dy) * dx +
+                                       (int64_t) in_11 * dy * dx;
+                const int64_t round = result > 0 ? (1 << 19) : -(1 << 19);
+                const int32_t out = (int32_t) ((result + round) / (1 << 20));
+                const int32_t out_idx = (out_y * out_wd + out_x) * channels + ch;
+                if (is_unsigned) {
+                    ((uint8_t *) output_data)[out_idx] = (uint8_t) out;
+                } else {
+                    ((int8_t *) output_data)[out_idx] = (int8_t) out;
+                }
+            }
+        }
+    }
+}
+
+void esp_nn_resize_bilinear_s8_ansi(const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *output_dims,
+                                    int8_t *output_data,
+                                    const resize_params_t *params)
+{
+    esp_nn_resize_bilinear_ansi(input_dims, input_data, output_dims, output_data, params, false);
+}
+
+void esp_nn_resize_bilinear_u8_ansi(const data_dims_t *input_dims,
+                                    const uint8_t *input_data,
+                                    const data_dims_t *output_dims,
+                                    uint8_t *output_data,
+                                    const resize_params_t *params)
+{
+    esp_nn_resize_bilinear_ansi(input_dims, input_data, output_dims, output_data, params, true);
+}
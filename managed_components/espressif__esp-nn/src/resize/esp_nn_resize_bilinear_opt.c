@@ -0,0 +1,288 @@
+// Copyright 2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <common_functions.h>
+#include <esp_nn_defs.h>
+
+/**
+ * The 2x2 bilinear sum of the ANSI version,
+ *   in_00 * (1024 - dy) * (1024 - dx) + in_01 * (1024 - dy) * dx +
+ *   in_10 * dy * (1024 - dx) + in_11 * dy * dx,
+ * is computed in two passes: each source row is first interpolated
+ * horizontally, `in_0 * (1024 - dx) + in_1 * dx`, then two such rows are
+ * blended vertically. Both are exact integer sums, so the result is bit-exact,
+ * and a horizontally interpolated row is kept for the next output rows that
+ * read the same source row.
+ *
+ * Source offsets and weights only depend on the (roi, output) size pair and
+ * are looked up from tables built once.
+ */
+typedef struct resize_table {
+    int32_t roi_wd;
+    int32_t roi_ht;
+    int32_t out_wd;
+    int32_t out_ht;
+    int32_t channels;
+    /* source row held by each row buffer, -1 if none */
+    int32_t row_tag[2];
+} resize_table_t;
+
+typedef struct resize_table_parts {
+    int32_t *x_src;     /* (x0, x1) * channels, per output column */
+    int16_t *x_wt;      /* dx, per output column */
+    int32_t *y_src;     /* (y0, y1), per output row */
+    int16_t *y_wt;      /* dy, per output row */
+    int32_t *rows[2];   /* horizontally interpolated source rows */
+} resize_table_parts_t;
+
+__NN_FORCE_INLINE__ int32_t esp_nn_resize_align4(const int32_t size)
+{
+    return (size + 3) & ~3;
+}
+
+static int32_t esp_nn_resize_table_layout(const int32_t out_wd, const int32_t out_ht,
+                                          const int32_t channels, void *table,
+                                          resize_table_parts_t *parts)
+{
+    uint8_t *ptr = (uint8_t *) table + esp_nn_resize_align4(sizeof(resize_table_t));
+    uint8_t *x_src = ptr;
+    ptr += 2 * out_wd * sizeof(int32_t);
+    uint8_t *x_wt = ptr;
+    ptr += esp_nn_resize_align4(out_wd * sizeof(int16_t));
+    uint8_t *y_src = ptr;
+    ptr += 2 * out_ht * sizeof(int32_t);
+    uint8_t *y_wt = ptr;
+    ptr += esp_nn_resize_align4(out_ht * sizeof(int16_t));
+    uint8_t *row_0 = ptr;
+    ptr += out_wd * channels * sizeof(int32_t);
+    uint8_t *row_1 = ptr;
+    ptr += out_wd * channels * sizeof(int32_t);
+
+    if (parts) {
+        parts->x_src = (int32_t *) x_src;
+        parts->x_wt = (int16_t *) x_wt;
+        parts->y_src = (int32_t *) y_src;
+        parts->y_wt = (int16_t *) y_wt;
+        parts->rows[0] = (int32_t *) row_0;
+        parts->rows[1] = (int32_t *) row_1;
+    }
+    return ptr - (uint8_t *) table;
+}
+
+/* Same as the ANSI version */
+static int32_t esp_nn_resize_scale_10(const int32_t input_size, const int32_t output_size,
+                                      const int32_t align_corners)
+{
+    if (align_corners && output_size > 1) {
+        return ((1 << 10) * (input_size - 1) + (output_size - 1) / 2) / (output_size - 1);
+    }
+    return ((1 << 10) * input_size + output_size / 2) / output_size;
+}
+
+static void esp_nn_resize_axis_table(const int32_t input_size, const int32_t output_size,
+                                     const int32_t stride, const resize_params_t *params,
+                                     int32_t *src, int16_t *wt)
+{
+    const int32_t scale_10 = esp_nn_resize_scale_10(input_size, output_size,
+                                                    params->align_corners);
+    for (int32_t i = 0; i < output_size; i++) {
+        int32_t scaled = i * scale_10;
+        if (params->half_pixel_centers) {
+            scaled += scale_10 / 2 - (1 << 9);
+        }
+        const int32_t lower = max(scaled / (1 << 10), 0);
+        const int32_t upper = min((scaled + (1 << 10) - 1) / (1 << 10), input_size - 1);
+        src[2 * i + 0] = lower * stride;
+        src[2 * i + 1] = upper * stride;
+        wt[i] = scaled - (1 << 10) * lower;
+    }
+}
+
+int32_t esp_nn_get_resize_bilinear_table_size_opt(const data_dims_t *roi_dims,
+                                                  const data_dims_t *output_dims)
+{
+    return esp_nn_resize_table_layout(output_dims->width, output_dims->height,
+                                      roi_dims->channels, NULL, NULL);
+}
+
+void esp_nn_resize_bilinear_init_table_opt(void *table,
+                                           const data_dims_t *roi_dims,
+                                           const data_dims_t *output_dims,
+                                           const resize_params_t *params)
+{
+    resize_table_t *hdr = (resize_table_t *) table;
+    resize_table_parts_t parts;
+
+    hdr->roi_wd = roi_dims->width;
+    hdr->roi_ht = roi_dims->height;
+    hdr->out_wd = output_dims->width;
+    hdr->out_ht = output_dims->height;
+    hdr->channels = roi_dims->channels;
+    hdr->row_tag[0] = -1;
+    hdr->row_tag[1] = -1;
+    esp_nn_resize_table_layout(hdr->out_wd, hdr->out_ht, hdr->channels, table, &parts);
+
+    esp_nn_resize_axis_table(hdr->roi_wd, hdr->out_wd, hdr->channels, params,
+                             parts.x_src, parts.x_wt);
+    esp_nn_resize_axis_table(hdr->roi_ht, hdr->out_ht, 1, params,
+                             parts.y_src, parts.y_wt);
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_resize_load(const void *data, const int32_t idx,
+                                               const bool is_unsigned)
+{
+    return is_unsigned ? ((const uint8_t *) data)[idx] : ((const int8_t *) data)[idx];
+}
+
+/* Horizontal pass over one source row of the roi */
+__NN_FORCE_INLINE__ void esp_nn_resize_row(const void *src_row,
+                                           const resize_table_parts_t *parts,
+                                           const int32_t out_wd,
+                                           const int32_t channels,
+                                           int32_t *dst,
+                                           const bool is_unsigned)
+{
+    const int32_t *x_src = parts->x_src;
+    const int16_t *x_wt = parts->x_wt;
+
+    if (channels == 3) {
+        for (int32_t x = 0; x < out_wd; x++) {
+            const int32_t w_1 = x_wt[x];
+            const int32_t w_0 = (1 << 10) - w_1;
+            const int32_t src_0 = x_src[2 * x];
+            const int32_t src_1 = x_src[2 * x + 1];
+            *dst++ = esp_nn_resize_load(src_row, src_0 + 0, is_unsigned) * w_0 +
+                     esp_nn_resize_load(src_row, src_1 + 0, is_unsigned) * w_1;
+            *dst++ = esp_nn_resize_load(src_row, src_0 + 1, is_unsigned) * w_0 +
+                     esp_nn_resize_load(src_row, src_1 + 1, is_unsigned) * w_1;
+            *dst++ = esp_nn_resize_load(src_row, src_0 + 2, is_unsigned) * w_0 +
+                     esp_nn_resize_load(src_row, src_1 + 2, is_unsigned) * w_1;
+        }
+        return;
+    }
+    for (int32_t x = 0; x < out_wd; x++) {
+        const int32_t w_1 = x_wt[x];
+        const int32_t w_0 = (1 << 10) - w_1;
+        const int32_t src_0 = x_src[2 * x];
+        const int32_t src_1 = x_src[2 * x + 1];
+        for (int32_t ch = 0; ch < channels; ch++) {
+            *dst++ = esp_nn_resize_load(src_row, src_0 + ch, is_unsigned) * w_0 +
+                     esp_nn_resize_load(src_row, src_1 + ch, is_unsigned) * w_1;
+        }
+    }
+}
+
+/**
+ * Returns the row buffer holding source row `row` of the roi, filling the one
+ * not holding `keep` if neither does.
+ */
+__NN_FORCE_INLINE__ int32_t *esp_nn_resize_get_row(resize_table_t *hdr,
+                                                   const resize_table_parts_t *parts,
+                                                   const void *roi_data,
+                                                   const int32_t row_stride,
+                                                   const int32_t row,
+                                                   const int32_t keep,
+                                                   const bool is_unsigned)
+{
+    if (hdr->row_tag[0] == row) {
+        return parts->rows[0];
+    }
+    if (hdr->row_tag[1] == row) {
+        return parts->rows[1];
+    }
+    const int32_t slot = hdr->row_tag[0] == keep ? 1 : 0;
+    /* both element types are one byte */
+    const uint8_t *src_row = (const uint8_t *) roi_data + row * row_stride;
+    esp_nn_resize_row(src_row, parts, hdr->out_wd, hdr->channels, parts->rows[slot], is_unsigned);
+    hdr->row_tag[slot] = row;
+    return parts->rows[slot];
+}
+
+__NN_FORCE_INLINE__ void esp_nn_crop_resize_bilinear(void *table,
+                                                     const data_dims_t *input_dims,
+                                                     const void *input_data,
+                                                     const roi_t *rois,
+                                                     const int32_t num_rois,
+                                                     void *output_data,
+                                                     const bool is_unsigned)
+{
+    resize_table_t *hdr = (resize_table_t *) table;
+    resize_table_parts_t parts;
+    esp_nn_resize_table_layout(hdr->out_wd, hdr->out_ht, hdr->channels, table, &parts);
+
+    const int32_t channels = hdr->channels;
+    const int32_t row_stride = input_dims->width * channels;
+    const int32_t out_row_size = hdr->out_wd * channels;
+    int32_t out_idx = 0;
+
+    for (int32_t roi_idx = 0; roi_idx < num_rois; roi_idx++) {
+        const roi_t *roi = &rois[roi_idx];
+        const int32_t roi_offset = roi->y * row_stride + roi->x * channels;
+        const uint8_t *roi_data = (const uint8_t *) input_data + roi_offset;
+        hdr->row_tag[0] = -1;
+        hdr->row_tag[1] = -1;
+
+        for (int32_t out_y = 0; out_y < hdr->out_ht; out_y++) {
+            const int32_t y0 = parts.y_src[2 * out_y];
+            const int32_t y1 = parts.y_src[2 * out_y + 1];
+            const int32_t w_1 = parts.y_wt[out_y];
+            const int32_t w_0 = (1 << 10) - w_1;
+            const int32_t *top = esp_nn_resize_get_row(hdr, &parts, roi_data, row_stride,
+                                                       y0, y1, is_unsigned);
+            const int32_t *bottom = esp_nn_resize_get_row(hdr, &parts, roi_data, row_stride,
+                                                          y1, y0, is_unsigned);
+
+            if (is_unsigned) {
+                uint8_t *out = (uint8_t *) output_data + out_idx;
+                for (int32_t i = 0; i < out_row_size; i++) {
+                    /* never negative */
+                    const int32_t result = top[i] * w_0 + bottom[i] * w_1;
+                    out[i] = (uint8_t) ((result + (1 << 19)) >> 20);
+                }
+            } else {
+                int8_t *out = (int8_t *) output_data + out_idx;
+                for (int32_t i = 0; i < out_row_size; i++) {
+                    const int32_t result = top[i] * w_0 + bottom[i] * w_1;
+                    const int32_t round = result > 0 ? (1 << 19) : -(1 << 19);
+                    out[i] = (int8_t) ((result + round) / (1 << 20));
+                }
+            }
+            out_idx += out_row_size;
+        }
+    }
+}
+
+void esp_nn_crop_resize_bilinear_s8_opt(void *table,
+                                        const data_dims_t *input_dims,
+                                        const int8_t *input_data,
+                                        const roi_t *rois,
+                                        const int32_t num_rois,
+                                        int8_t *output_data)
+{
+    esp_nn_crop_resize_bilinear(table, input_dims, input_data, rois, num_rois,
+                                output_data, false);
+}
+
+void esp_nn_crop_resize_bilinear_u8_opt(void *table,
+                                        const data_dims_t *input_dims,
+                                        const uint8_t *input_data,
+                                        const roi_t *rois,
+                                        const int32_t num_rois,
+                                        uint8_t *output_data)
+{
+    esp_nn_crop_resize_bilinear(table, input_dims, input_data, rois, num_rois,
+                                output_data, true);
+}
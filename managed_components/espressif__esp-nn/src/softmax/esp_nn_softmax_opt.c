@@ -13,9 +13,11 @@
 // limitations under the License.
 
 #include "softmax_common.h"
+#include <esp_nn_defs.h>
 #include <stdio.h>
 
-static int32_t *scratch_buf = NULL;
+/* Set and used by the same task; one per task so two cores can run models. */
+static __thread int32_t *scratch_buf = NULL;
 
 /**
  * @brief   Get scratch buffer size needed by softmax function
@@ -106,3 +108,61 @@ void esp_nn_softmax_s8_opt(const int8_t *input_data,
         out_ptr += width;
     }
 }
+
+/**
+ * @brief   Fill the exp() table used by esp_nn_softmax_s8_lut_opt
+ *
+ * @note    Entry `i` holds the raw exp() of an input `i` below the row max,
+ *          or 0 when that difference is under diff_min. A zero exp() and a
+ *          skipped element both give -128, so no separate check is needed.
+ */
+void esp_nn_softmax_init_lut_opt(int32_t *lut,
+                                 const int32_t mult,
+                                 const int32_t shift,
+                                 const int32_t diff_min)
+{
+    const int32_t mask = (1 << shift);
+    for (int32_t i = 0; i < ESP_NN_SOFTMAX_LUT_SIZE; i++) {
+        const int32_t input_diff = -i;
+        if (input_diff >= diff_min) {
+            const int32_t input_diff_rescaled = SAT_HIGH_MUL(input_diff * mask, mult);
+            lut[i] = esp_nn_exp_on_negative_values(input_diff_rescaled);
+        } else {
+            lut[i] = 0;
+        }
+    }
+}
+
+void esp_nn_softmax_s8_lut_opt(const int8_t *input_data,
+                               const int32_t height,
+                               const int32_t width,
+                               const int32_t *lut,
+                               int8_t *output_data)
+{
+    const int8_t *in_ptr = input_data;
+    int8_t *out_ptr = output_data;
+
+    for (int row_idx = 0; row_idx < height; row_idx++) {
+        int8_t max_in_row = in_ptr[0];
+        for (int32_t col = 1; col < width; col++) {
+            max_in_row = max(max_in_row, in_ptr[col]);
+        }
+
+        int32_t sum_of_exps = 0;
+        for (int32_t col = 0; col < width; col++) {
+            sum_of_exps += DIV_POW2(lut[max_in_row - in_ptr[col]], ACCUM_BITS);
+        }
+
+        const int32_t headroom_plus1 = esp_nn_clz32((uint32_t) sum_of_exps);
+        const int32_t shifted_scale = ONE_OVER_ONE_X((sum_of_exps << headroom_plus1) - (1 << 31));
+        const int32_t bits_over_unit = ACCUM_BITS - headroom_plus1 + 31 - sizeof(int8_t) * 8;
+
+        for (int32_t col = 0; col < width; col++) {
+            const int32_t shifted_output = SAT_HIGH_MUL(shifted_scale, lut[max_in_row - in_ptr[col]]);
+            const int32_t result = DIV_POW2(shifted_output, bits_over_unit) - 128;
+            out_ptr[col] = (int8_t) esp_nn_saturate8(result);
+        }
+        in_ptr  += width;
+        out_ptr += width;
+    }
+}
@@ -63,6 +63,11 @@ void app_main()
     printf("mul, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
     esp_nn_depthwise_conv_s8_test();
     esp_nn_conv_s8_test();
+    esp_nn_depthwise_conv_dilated_s8_test();
+    esp_nn_conv_dilated_s8_test();
+    esp_nn_conv_s8_winograd_test();
+    esp_nn_conv_s8_im2col_test();
+    esp_nn_depthwise_conv_s8_padded_test();
 
     esp_nn_relu6_s8_test();
     printf("relu, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
@@ -74,8 +79,18 @@ void app_main()
     esp_nn_fully_connected_per_ch_s8_test();
     esp_nn_softmax_s8_test();
     printf("softmax, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
+    esp_nn_softmax_s8_lut_test();
+    esp_nn_crop_resize_bilinear_s8_test();
+    esp_nn_crop_resize_bilinear_u8_test();
     ESP_LOGI(TAG, "s8 tests done!\n");
 
+    /* s16 (16x8) tests */
+    ESP_LOGI(TAG, "Running s16 tests...");
+    esp_nn_depthwise_conv_s16_test();
+    esp_nn_conv_s16_test();
+    esp_nn_fully_connected_s16_test();
+    ESP_LOGI(TAG, "s16 tests done!\n");
+
     /* u8 tests */
     //ESP_LOGI(TAG, "Running u8 tests...");
     //esp_nn_add_elementwise_u8_test();
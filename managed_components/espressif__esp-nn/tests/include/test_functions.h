@@ -19,6 +19,11 @@ void esp_nn_mul_elementwise_s8_test();
 
 void esp_nn_depthwise_conv_s8_test();
 void esp_nn_conv_s8_test();
+void esp_nn_depthwise_conv_dilated_s8_test();
+void esp_nn_conv_dilated_s8_test();
+void esp_nn_conv_s8_winograd_test();
+void esp_nn_conv_s8_im2col_test();
+void esp_nn_depthwise_conv_s8_padded_test();
 
 void esp_nn_avg_pool_s8_test();
 void esp_nn_max_pool_s8_test();
@@ -29,6 +34,15 @@ void esp_nn_fully_connected_per_ch_s8_test();
 void esp_nn_relu6_s8_test();
 
 void esp_nn_softmax_s8_test();
+void esp_nn_softmax_s8_lut_test();
+
+void esp_nn_crop_resize_bilinear_s8_test();
+
+/* int16_t activation (16x8) ops tests */
+void esp_nn_depthwise_conv_s16_test();
+void esp_nn_conv_s16_test();
+
+void esp_nn_fully_connected_s16_test();
 
 /* uint8_t ops tests */
 void esp_nn_add_elementwise_u8_test();
@@ -41,6 +55,8 @@ void esp_nn_max_pool_u8_test();
 
 void esp_nn_fully_connected_u8_test();
 
+void esp_nn_crop_resize_bilinear_u8_test();
+
 /* instructions test functions */
 void compare_instructions_test();
 void arith_instructions_test();
@@ -61,6 +61,9 @@ void esp_nn_add_elementwise_s8_test()
     int8_t *input2_orig = NULL;
     int8_t *out_c_orig = NULL;
     int8_t *out_opt_orig = NULL;
+    int8_t *out_direct_orig = NULL;
+    int8_t *out_data_direct;
+    void *scratch_buf = NULL;
     int32_t input1_offset = 34;
     int32_t input2_offset = 35;
     int32_t output_offset = 36;
@@ -74,7 +77,7 @@ void esp_nn_add_elementwise_s8_test()
     int32_t activation_min = -128;
     int32_t activation_max = 127;
 
-    for (int itr = 0; itr < 10; itr++) {
+    for (int itr = 0; itr < 12; itr++) {
         switch (itr) {
         case 0: // all zeros
             input1_offset = 0;
@@ -137,6 +140,10 @@ void esp_nn_add_elementwise_s8_test()
             left_shift = 20;
             size = 216;
         break;
+        case 10: // table path (size >= 256), odd len to test leftover
+        case 11: // table path, residual add size of the waste model
+            size = itr == 10 ? 1600 + 8 + 7 : 4608;
+            /* fall through */
         default:  // practical random input
             input1_offset = rand() % 256 - 127; // range [-127, 128]
             input2_offset = rand() % 256 - 127; // range [-127, 128]
@@ -154,13 +161,24 @@ void esp_nn_add_elementwise_s8_test()
         input2_orig = (int8_t *) ESP_NN_TEST_ALLOC(size + 16);
         out_c_orig = (int8_t *) ESP_NN_TEST_ALLOC(size + 16);
         out_opt_orig = (int8_t *) ESP_NN_TEST_ALLOC(size + 16);
+        out_direct_orig = (int8_t *) ESP_NN_TEST_ALLOC(size + 16);
 
         if (input1_orig == NULL || input2_orig == NULL ||
-                out_c_orig == NULL || out_opt_orig == NULL) {
+                out_c_orig == NULL || out_opt_orig == NULL || out_direct_orig == NULL) {
             printf(ANSI_COLOR_RED"%s error allocating buffers\n"ANSI_COLOR_RESET, __FUNCTION__);
             goto elementwise_add_test_cleanup;
         }
 
+        int32_t scratch_size = esp_nn_get_add_scratch_size(size);
+        if (scratch_size > 0) {
+            scratch_buf = ESP_NN_TEST_ALLOC(scratch_size);
+            if (scratch_buf == NULL) {
+                printf(ANSI_COLOR_RED"%s scratch_buf alloc failed size %"PRIi32"\n"ANSI_COLOR_RESET,
+                       __FUNCTION__, scratch_size);
+                goto elementwise_add_test_cleanup;
+            }
+        }
+
         input1 = (int8_t *) (((uint32_t) input1_orig + 15) & ~15);
         input2 = (int8_t *) (((uint32_t) input2_orig + 15) & ~15);
         if (itr == 4) {
@@ -168,6 +186,7 @@ void esp_nn_add_elementwise_s8_test()
         }
         out_data_c = (int8_t *) (((uint32_t)out_c_orig + 15) & ~15);
         out_data_opt = (int8_t *) (((uint32_t)out_opt_orig + 15) & ~15);
+        out_data_direct = (int8_t *) (((uint32_t)out_direct_orig + 15) & ~15);
 
 
         if (itr == 4) {
@@ -196,6 +215,7 @@ void esp_nn_add_elementwise_s8_test()
         }
 
         /* Optimized function */
+        esp_nn_set_add_scratch_buf(scratch_buf);
         esp_nn_add_elementwise_s8(input1, input2, input1_offset, input2_offset,
                                   input1_mult, input2_mult, input1_shift, input2_shift,
                                   left_shift, out_data_opt, output_offset, output_mult,
@@ -205,7 +225,15 @@ void esp_nn_add_elementwise_s8_test()
             profile_opt_end();
         }
 
-        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, size);
+        /* Optimized function without scratch buffer */
+        esp_nn_set_add_scratch_buf(NULL);
+        esp_nn_add_elementwise_s8(input1, input2, input1_offset, input2_offset,
+                                  input1_mult, input2_mult, input1_shift, input2_shift,
+                                  left_shift, out_data_direct, output_offset, output_mult,
+                                  output_shift, activation_min, activation_max, size);
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, size) &&
+                   CHECK_EQUAL(out_data_c, out_data_direct, size);
         if (ret == false) {
             printf(ANSI_COLOR_RED"%s[%d] failed\n"ANSI_COLOR_RESET, __FUNCTION__, itr);
             printf("Output: \n");
@@ -237,6 +265,13 @@ elementwise_add_test_cleanup:
         if (out_opt_orig) {
             free(out_opt_orig);
         }
+        if (out_direct_orig) {
+            free(out_direct_orig);
+        }
+        if (scratch_buf) {
+            free(scratch_buf);
+            scratch_buf = NULL;
+        }
     }
 }
 
@@ -650,3 +650,1340 @@ void esp_nn_conv_s8_test()
         }
     }
 }
+
+void esp_nn_depthwise_conv_dilated_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t input_offset = 7;
+    const int32_t out_offset = -5;
+    const int32_t activation_min = -125;
+    const int32_t activation_max = 120;
+
+    /* independent variables */
+    int input_wd, input_ht, channels;
+    uint16_t filter_ht, filter_wd, ch_mult, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 8; itr++) {
+        switch (itr) {
+        case 0: // ch_mult 1, dilation (2,2), pad (2,2)
+            input_wd = 12;
+            input_ht = 12;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 1;
+            channels = 16;
+            pad_wd = 2;
+            pad_ht = 2;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 2;
+            dilation_ht = 2;
+            break;
+        case 1: // ch_mult 1, left-over channels, dilation (3,2), stride (2,2)
+            input_wd = 15;
+            input_ht = 13;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 1;
+            channels = 7;
+            pad_wd = 3;
+            pad_ht = 2;
+            stride_wd = 2;
+            stride_ht = 2;
+            dilation_wd = 3;
+            dilation_ht = 2;
+            break;
+        case 2: // ch_mult 2, no dilation
+            input_wd = 10;
+            input_ht = 10;
+            filter_ht = 5;
+            filter_wd = 5;
+            ch_mult = 2;
+            channels = 5;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 1;
+            dilation_ht = 1;
+            break;
+        case 3: // ch_mult 3, no dilation, pad (1,1)
+            input_wd = 10;
+            input_ht = 10;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 3;
+            channels = 5;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 1;
+            dilation_ht = 1;
+            break;
+        case 4: // ch_mult 2, dilation (2,2)
+            input_wd = 14;
+            input_ht = 14;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 2;
+            channels = 6;
+            pad_wd = 2;
+            pad_ht = 2;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 2;
+            dilation_ht = 2;
+            break;
+        case 5: // ch_mult 7, stride (2,2)
+            input_wd = 16;
+            input_ht = 16;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 7;
+            channels = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 2;
+            stride_ht = 2;
+            dilation_wd = 1;
+            dilation_ht = 1;
+            break;
+        case 6: // ch_mult 8, dilation (5,5): most taps fall in the padding
+            input_wd = 11;
+            input_ht = 11;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 8;
+            channels = 4;
+            pad_wd = 5;
+            pad_ht = 5;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 5;
+            dilation_ht = 5;
+            break;
+        default: // ch_mult 4, dilation (2,2), pad (0,0)
+            input_wd = 12;
+            input_ht = 12;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 4;
+            channels = 8;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 2;
+            dilation_ht = 2;
+            break;
+        }
+
+        out_wd = (input_wd + 2 * pad_wd - (filter_wd - 1) * dilation_wd - 1) / stride_wd + 1;
+        out_ht = (input_ht + 2 * pad_ht - (filter_ht - 1) * dilation_ht - 1) / stride_ht + 1;
+
+        int in_size = input_wd * input_ht * channels;
+        int out_size = out_wd * out_ht * channels * ch_mult;
+        int filter_size = filter_wd * filter_ht * channels * ch_mult;
+        int32_t out_shift[channels * ch_mult];
+        int32_t out_mult[channels * ch_mult];
+
+        int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+        int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int32_t *bias = ESP_NN_TEST_ALLOC(channels * ch_mult * sizeof(int32_t));
+
+        if (bias == NULL || input == NULL || filter_data == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto dc_dilated_s8_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < channels * ch_mult; ++i) {
+            bias[i] = rand() % INT16_MAX - INT16_MAX / 2;
+            out_shift[i] = -8 + rand() % 3;
+            out_mult[i] = 0x7eb0e200 + rand() % 50;
+        }
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = channels * ch_mult, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        dw_conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset, .ch_mult = ch_mult,
+                                        .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                        .dilation = {dilation_wd, dilation_ht},
+                                        .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_depthwise_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                                      bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_depthwise_conv_dilated_s8(&input_dims, input, &filter_dims, filter_data,
+                                         bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d), dilation: (%d, %d)"
+                   " out: (%3d,%3d), filter: (%d, %d,%3d), ch_mult %d]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht,
+                   out_wd, out_ht, filter_wd, filter_ht, channels, ch_mult);
+            goto dc_dilated_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d), dilation: (%d, %d)"
+               " out: (%3d,%3d), filter: (%d, %d,%3d), ch_mult %d]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht,
+               out_wd, out_ht, filter_wd, filter_ht, channels, ch_mult);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    dc_dilated_s8_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+    }
+}
+
+void esp_nn_conv_dilated_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t input_offset = 7;
+    const int32_t out_offset = -5;
+    const int32_t activation_min = -125;
+    const int32_t activation_max = 120;
+
+    /* independent variables */
+    int input_wd, input_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 5; itr++) {
+        switch (itr) {
+        case 0: // filter (3,3), dilation (2,2), pad (2,2)
+            input_wd = 12;
+            input_ht = 12;
+            in_channels = 8;
+            out_channels = 8;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 2;
+            pad_ht = 2;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 2;
+            dilation_ht = 2;
+            break;
+        case 1: // ch == 5, dilation (3,3), stride (2,2)
+            input_wd = 15;
+            input_ht = 13;
+            in_channels = 5;
+            out_channels = 6;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 3;
+            pad_ht = 3;
+            stride_wd = 2;
+            stride_ht = 2;
+            dilation_wd = 3;
+            dilation_ht = 3;
+            break;
+        case 2: // dilation (2,2), pad (0,0)
+            input_wd = 20;
+            input_ht = 20;
+            in_channels = 4;
+            out_channels = 4;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 2;
+            dilation_ht = 2;
+            break;
+        case 3: // filter (5,5), dilation (4,4)
+            input_wd = 9;
+            input_ht = 9;
+            in_channels = 3;
+            out_channels = 4;
+            filter_ht = 5;
+            filter_wd = 5;
+            pad_wd = 8;
+            pad_ht = 8;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 4;
+            dilation_ht = 4;
+            break;
+        default: // dilation in one direction only
+            input_wd = 16;
+            input_ht = 6;
+            in_channels = 16;
+            out_channels = 8;
+            filter_ht = 1;
+            filter_wd = 3;
+            pad_wd = 4;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation_wd = 4;
+            dilation_ht = 1;
+            break;
+        }
+
+        out_wd = (input_wd + 2 * pad_wd - (filter_wd - 1) * dilation_wd - 1) / stride_wd + 1;
+        out_ht = (input_ht + 2 * pad_ht - (filter_ht - 1) * dilation_ht - 1) / stride_ht + 1;
+
+        int in_size = input_wd * input_ht * in_channels;
+        int out_size = out_wd * out_ht * out_channels;
+        int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        int32_t out_shift[out_channels];
+        int32_t out_mult[out_channels];
+
+        int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+        int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int32_t *bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(int32_t));
+
+        if (bias == NULL || input == NULL || filter_data == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto conv_dilated_s8_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % INT16_MAX - INT16_MAX / 2;
+            out_shift[i] = -10 + rand() % 2;
+            out_mult[i] = 0x7f67f4f8 + rand() % 50;
+        }
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                     .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                     .dilation = {dilation_wd, dilation_ht},
+                                     .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                            bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_conv_dilated_s8(&input_dims, input, &filter_dims, filter_data,
+                               bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d), dilation: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht,
+                   out_wd, out_ht, out_channels, filter_wd, filter_ht, in_channels);
+            goto conv_dilated_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d), dilation: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation_wd, dilation_ht,
+               out_wd, out_ht, out_channels, filter_wd, filter_ht, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_dilated_s8_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+    }
+}
+
+void esp_nn_conv_s8_winograd_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    int32_t input_offset = 7;
+    const int32_t out_offset = -5;
+    const int32_t activation_min = -125;
+    const int32_t activation_max = 120;
+
+    /* independent variables */
+    int input_wd, input_ht, in_channels, out_channels;
+    uint16_t out_wd, out_ht, pad_wd, pad_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 6; itr++) {
+        switch (itr) {
+        case 0: // pad (1,1)
+            input_wd = 10;
+            input_ht = 10;
+            in_channels = 8;
+            out_channels = 16;
+            pad_wd = 1;
+            pad_ht = 1;
+            break;
+        case 1: // odd output size, ch == 3
+            input_wd = 9;
+            input_ht = 7;
+            in_channels = 3;
+            out_channels = 4;
+            pad_wd = 1;
+            pad_ht = 1;
+            break;
+        case 2: // pad (0,0)
+            input_wd = 12;
+            input_ht = 12;
+            in_channels = 16;
+            out_channels = 8;
+            pad_wd = 0;
+            pad_ht = 0;
+            break;
+        case 3: // odd output size, pad (0,0)
+            input_wd = 8;
+            input_ht = 11;
+            in_channels = 5;
+            out_channels = 7;
+            pad_wd = 0;
+            pad_ht = 0;
+            break;
+        case 4: // single output row
+            input_wd = 6;
+            input_ht = 3;
+            in_channels = 12;
+            out_channels = 3;
+            pad_wd = 0;
+            pad_ht = 0;
+            break;
+        default: // max in channels with extreme values
+            input_wd = 4;
+            input_ht = 4;
+            in_channels = 1024;
+            out_channels = 2;
+            pad_wd = 1;
+            pad_ht = 1;
+            break;
+        }
+
+        out_wd = input_wd + 2 * pad_wd - 2;
+        out_ht = input_ht + 2 * pad_ht - 2;
+
+        int in_size = input_wd * input_ht * in_channels;
+        int out_size = out_wd * out_ht * out_channels;
+        int filter_size = 3 * 3 * in_channels * out_channels;
+        int32_t out_shift[out_channels];
+        int32_t out_mult[out_channels];
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = 3, .height = 3, 0, 0};
+
+        int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+        int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int32_t *bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(int32_t));
+        int16_t *wg_filter = ESP_NN_TEST_ALLOC(esp_nn_get_conv_winograd_filter_size_opt(&input_dims, &output_dims));
+        void *scratch_buf = ESP_NN_TEST_ALLOC(esp_nn_get_conv_winograd_scratch_size_opt(&input_dims));
+
+        if (bias == NULL || input == NULL || filter_data == NULL || wg_filter == NULL ||
+                scratch_buf == NULL || out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto conv_wg_s8_cleanup;
+        }
+
+        /* The last iteration uses the extreme values only */
+        input_offset = itr == 5 ? -127 : 7;
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = itr == 5 ? INT8_MIN : rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = itr == 5 ? INT8_MIN : rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % INT16_MAX - INT16_MAX / 2;
+            out_shift[i] = (itr == 5 ? -24 : -10) + rand() % 2;
+            out_mult[i] = 0x7f67f4f8 + rand() % 50;
+        }
+
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                     .stride = {1, 1}, .padding = {pad_wd, pad_ht},
+                                     .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        if (!esp_nn_conv_s8_winograd_supported_opt(&input_dims, &filter_dims, &conv_params)) {
+            printf(ANSI_COLOR_RED"[%d] unexpectedly unsupported\n"ANSI_COLOR_RESET, itr);
+            goto conv_wg_s8_cleanup;
+        }
+        esp_nn_conv_winograd_transform_filter_opt(&input_dims, filter_data, &output_dims, wg_filter);
+        esp_nn_set_conv_winograd_scratch_buf_opt(scratch_buf);
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                            bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_conv_s8_winograd_opt(&input_dims, input, wg_filter,
+                                    bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), out: (%3d,%3d,%3d), filter: (3, 3,%4d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, out_wd, out_ht, out_channels, in_channels);
+            goto conv_wg_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), out: (%3d,%3d,%3d), filter: (3, 3,%4d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, out_wd, out_ht, out_channels, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_wg_s8_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+        if (wg_filter) {
+            free(wg_filter);
+        }
+        if (scratch_buf) {
+            free(scratch_buf);
+        }
+    }
+}
+
+void esp_nn_conv_s8_im2col_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t input_offset = 9;
+    const int32_t out_offset = -3;
+    const int32_t activation_min = -126;
+    const int32_t activation_max = 121;
+
+    /* independent variables */
+    int input_wd, input_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht, dilation;
+    int32_t block_pixels;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 6; itr++) {
+        switch (itr) {
+        case 0: // filter (3,3), pad (1,1), odd block
+            input_wd = 10;
+            input_ht = 10;
+            in_channels = 8;
+            out_channels = 16;
+            filter_wd = 3;
+            filter_ht = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation = 1;
+            block_pixels = 7;
+            break;
+        case 1: // stride (2,2), (out_channels % 4) != 0
+            input_wd = 11;
+            input_ht = 9;
+            in_channels = 3;
+            out_channels = 6;
+            filter_wd = 3;
+            filter_ht = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 2;
+            stride_ht = 2;
+            dilation = 1;
+            block_pixels = 5;
+            break;
+        case 2: // filter (1,1), stride (1,1): input used in place
+            input_wd = 12;
+            input_ht = 12;
+            in_channels = 16;
+            out_channels = 10;
+            filter_wd = 1;
+            filter_ht = 1;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation = 1;
+            block_pixels = 33;
+            break;
+        case 3: // filter (1,1), stride (2,2)
+            input_wd = 9;
+            input_ht = 9;
+            in_channels = 8;
+            out_channels = 8;
+            filter_wd = 1;
+            filter_ht = 1;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 2;
+            stride_ht = 2;
+            dilation = 1;
+            block_pixels = 4;
+            break;
+        case 4: // dilation 2
+            input_wd = 12;
+            input_ht = 12;
+            in_channels = 4;
+            out_channels = 5;
+            filter_wd = 3;
+            filter_ht = 3;
+            pad_wd = 2;
+            pad_ht = 2;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation = 2;
+            block_pixels = 3;
+            break;
+        default: // scratch too small: falls back to the direct kernel
+            input_wd = 6;
+            input_ht = 6;
+            in_channels = 4;
+            out_channels = 4;
+            filter_wd = 3;
+            filter_ht = 3;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            dilation = 1;
+            block_pixels = 1;
+            break;
+        }
+
+        out_wd = (input_wd + 2 * pad_wd - dilation * (filter_wd - 1) - 1) / stride_wd + 1;
+        out_ht = (input_ht + 2 * pad_ht - dilation * (filter_ht - 1) - 1) / stride_ht + 1;
+
+        int in_size = input_wd * input_ht * in_channels;
+        int out_size = out_wd * out_ht * out_channels;
+        int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        int32_t out_shift[out_channels];
+        int32_t out_mult[out_channels];
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        int scratch_size = esp_nn_get_conv_im2col_scratch_size_opt(&input_dims, &filter_dims,
+                                                                   &output_dims, block_pixels);
+
+        int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+        int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int32_t *bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(int32_t));
+        void *scratch_buf = ESP_NN_TEST_ALLOC(scratch_size);
+
+        if (bias == NULL || input == NULL || filter_data == NULL || scratch_buf == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto conv_im2col_s8_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % INT16_MAX - INT16_MAX / 2;
+            out_shift[i] = -10 + rand() % 2;
+            out_mult[i] = 0x7f67f4f8 + rand() % 50;
+        }
+
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                     .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                     .dilation = {dilation, dilation},
+                                     .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        esp_nn_set_conv_im2col_scratch_buf_opt(scratch_buf, scratch_size);
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                            bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_conv_s8_im2col_opt(&input_dims, input, &filter_dims, filter_data,
+                                  bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d), dilation: %d,"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d), block: %"PRIi32"]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation,
+                   out_wd, out_ht, out_channels, filter_wd, filter_ht, in_channels, block_pixels);
+            goto conv_im2col_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d), dilation: %d,"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d), block: %"PRIi32"]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, dilation,
+               out_wd, out_ht, out_channels, filter_wd, filter_ht, in_channels, block_pixels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_im2col_s8_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+        if (scratch_buf) {
+            free(scratch_buf);
+        }
+    }
+}
+
+void esp_nn_depthwise_conv_s8_padded_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t input_offset = 11;
+    const int32_t out_offset = -7;
+    const int32_t activation_min = -124;
+    const int32_t activation_max = 122;
+
+    /* independent variables */
+    int input_wd, input_ht, channels;
+    uint16_t out_wd, out_ht, pad_wd, pad_ht, stride_wd, stride_ht;
+    int in_place, extra_pitch;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 5; itr++) {
+        switch (itr) {
+        case 0: // pad (1,1), (channels % 8) == 0
+            input_wd = 10;
+            input_ht = 10;
+            channels = 16;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            in_place = 0;
+            extra_pitch = 0;
+            break;
+        case 1: // stride (2,2), pad (0,0), windows past the right and bottom edge
+            input_wd = 8;
+            input_ht = 8;
+            channels = 5;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 2;
+            stride_ht = 2;
+            in_place = 0;
+            extra_pitch = 0;
+            break;
+        case 2: // stride (2,2), pad (1,1), padded rows with spare bytes
+            input_wd = 11;
+            input_ht = 9;
+            channels = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 2;
+            stride_ht = 2;
+            in_place = 0;
+            extra_pitch = 5;
+            break;
+        case 3: // valid padding: input read in place
+            input_wd = 10;
+            input_ht = 9;
+            channels = 7;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            in_place = 1;
+            extra_pitch = 0;
+            break;
+        default: // valid padding with stride (2,2), odd input: in place
+            input_wd = 13;
+            input_ht = 11;
+            channels = 12;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 2;
+            stride_ht = 2;
+            in_place = 1;
+            extra_pitch = 0;
+            break;
+        }
+
+        out_wd = (input_wd + 2 * pad_wd - 3) / stride_wd + 1;
+        out_ht = (input_ht + 2 * pad_ht - 3) / stride_ht + 1;
+        if (itr == 1) {
+            /* SAME padding with an even input pads only the right and bottom edge */
+            out_wd = input_wd / stride_wd;
+            out_ht = input_ht / stride_ht;
+        }
+
+        int in_size = input_wd * input_ht * channels;
+        int out_size = out_wd * out_ht * channels;
+        int filter_size = 3 * 3 * channels;
+        int32_t out_shift[channels];
+        int32_t out_mult[channels];
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = channels, 1};
+        data_dims_t filter_dims = {.width = 3, .height = 3, 0, 0};
+        dw_conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset, .ch_mult = 1,
+                                        .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                        .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        data_dims_t padded_dims;
+        esp_nn_get_depthwise_conv_padded_dims_opt(&input_dims, &output_dims, &conv_params, &padded_dims);
+        int row_pitch = in_place ? input_wd * channels : (padded_dims.width + extra_pitch) * channels;
+
+        int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+        int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int32_t *bias = ESP_NN_TEST_ALLOC(channels * sizeof(int32_t));
+        int8_t *padded = in_place ? input : ESP_NN_TEST_ALLOC(padded_dims.height * row_pitch);
+
+        if (bias == NULL || input == NULL || filter_data == NULL || padded == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto dc_padded_s8_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < channels; ++i) {
+            bias[i] = rand() % INT16_MAX - INT16_MAX / 2;
+            out_shift[i] = -8 + rand() % 3;
+            out_mult[i] = 0x7eb0e200 + rand() % 50;
+        }
+
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_depthwise_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                                      bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function, including the padding */
+        if (!in_place) {
+            esp_nn_depthwise_conv_pad_input_s8_opt(&input_dims, input, &conv_params,
+                                                   &padded_dims, row_pitch, padded);
+        }
+        esp_nn_depthwise_conv_s8_3x3_padded_opt(&padded_dims, padded, row_pitch, filter_data,
+                                                bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d), in_place: %d,"
+                   " out: (%3d,%3d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, in_place, out_wd, out_ht, channels);
+            goto dc_padded_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d), in_place: %d,"
+               " out: (%3d,%3d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, in_place, out_wd, out_ht, channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    dc_padded_s8_cleanup:
+        if (padded && padded != input) {
+            free(padded);
+        }
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+    }
+}
+
+void esp_nn_depthwise_conv_s16_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t activation_min = -32000;
+    const int32_t activation_max = 32000;
+
+    /* independent variables */
+    int input_wd, input_ht, channels;
+    uint16_t filter_ht, filter_wd, ch_mult, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 8; itr++) {
+        switch (itr) {
+        case 0: // ch_mult 1, (channels % 4) = 0, filter (3,3), pad (1,1)
+            input_wd = 10;
+            input_ht = 10;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 1;
+            channels = 16;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 1: // ch_mult 1, left-over channels, stride (2,2)
+            input_wd = 11;
+            input_ht = 9;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 1;
+            channels = 7;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 2;
+            stride_ht = 2;
+            break;
+        case 2: // ch_mult 2
+            input_wd = 8;
+            input_ht = 8;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 2;
+            channels = 5;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 3: // ch_mult 8, filter (5,5)
+            input_wd = 9;
+            input_ht = 9;
+            filter_ht = 5;
+            filter_wd = 5;
+            ch_mult = 8;
+            channels = 3;
+            pad_wd = 2;
+            pad_ht = 2;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 4: // filter larger than what fits 32 bit accumulation
+            input_wd = 24;
+            input_ht = 24;
+            filter_ht = 23;
+            filter_wd = 23;
+            ch_mult = 1;
+            channels = 4;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        default: // ch_mult 1, filter (3,3), pad (0,0)
+            input_wd = 6;
+            input_ht = 6;
+            filter_ht = 3;
+            filter_wd = 3;
+            ch_mult = 1;
+            channels = 12;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        }
+
+        if (pad_wd) {
+            out_wd = (input_wd + stride_wd - 1) / stride_wd;
+        } else {
+            out_wd = (input_wd + stride_wd - filter_wd) / stride_wd;
+        }
+        if (pad_ht) {
+            out_ht = (input_ht + stride_ht - 1) / stride_ht;
+        } else {
+            out_ht = (input_ht + stride_ht - filter_ht) / stride_ht;
+        }
+
+        int in_size = input_wd * input_ht * channels;
+        int out_size = out_wd * out_ht * channels * ch_mult;
+        int filter_size = filter_wd * filter_ht * channels * ch_mult;
+        int32_t out_shift[channels * ch_mult];
+        int32_t out_mult[channels * ch_mult];
+
+        int16_t *input = ESP_NN_TEST_ALLOC(in_size * sizeof(int16_t));
+        int16_t *out_data_c = ESP_NN_TEST_ALLOC(out_size * sizeof(int16_t));
+        int16_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size * sizeof(int16_t));
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int64_t *bias = ESP_NN_TEST_ALLOC(channels * ch_mult * sizeof(int64_t));
+
+        if (bias == NULL || input == NULL || filter_data == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto dc_s16_cleanup;
+        }
+
+        /* Full int16 range; the last iteration uses the extreme values only */
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = itr == 7 ? INT16_MIN : rand() % 65536 - 32768;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = itr == 7 ? INT8_MIN : rand() % 256 - 128;
+        }
+        for (int i = 0; i < channels * ch_mult; ++i) {
+            bias[i] = ((int64_t) (rand() % 65536 - 32768)) << 8;
+            out_shift[i] = -12 - rand() % 4;
+            out_mult[i] = 0x40000000 + rand() % 0x3fff0000;
+        }
+
+        data_dims_t input_dims = {.width = input_wd, .height = input_ht, .channels = channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = channels * ch_mult, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        dw_conv_params_t conv_params = {.in_offset = 0, .out_offset = 0, .ch_mult = ch_mult,
+                                        .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                        .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_depthwise_conv_s16_ansi(&input_dims, input, &filter_dims, filter_data,
+                                       bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_depthwise_conv_s16(&input_dims, input, &filter_dims, filter_data,
+                                  bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d), filter: (%d, %d,%3d), ch_mult %d]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   filter_wd, filter_ht, channels, ch_mult);
+            goto dc_s16_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d), filter: (%d, %d,%3d), ch_mult %d]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd,
+               out_ht, filter_wd, filter_ht, channels, ch_mult);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    dc_s16_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+    }
+}
+
+void esp_nn_conv_s16_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t activation_min = -32000;
+    const int32_t activation_max = 32000;
+
+    /* independent variable */
+    int in_wd, in_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 8; itr++) {
+        switch (itr) {
+        case 0: // filter (1,1), padding (0,0)
+            in_wd = 10;
+            in_ht = 10;
+            in_channels = 16;
+            out_channels = 16;
+            filter_ht = 1;
+            filter_wd = 1;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 1: // filter (3,3), pad (1,1)
+            in_wd = 10;
+            in_ht = 10;
+            in_channels = 12;
+            out_channels = 8;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 2: // ch == 3, stride (2,2)
+            in_wd = 16;
+            in_ht = 16;
+            in_channels = 3;
+            out_channels = 8;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 2;
+            stride_ht = 2;
+            break;
+        case 3: // filter row longer than what fits 32 bit accumulation
+            in_wd = 4;
+            in_ht = 4;
+            in_channels = 300;
+            out_channels = 4;
+            filter_ht = 2;
+            filter_wd = 2;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 2;
+            stride_ht = 2;
+            break;
+        case 4: // left-over channels, pad (0,0)
+            in_wd = 7;
+            in_ht = 5;
+            in_channels = 5;
+            out_channels = 3;
+            filter_ht = 3;
+            filter_wd = 2;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        default: // filter (3,3), pad (1,1)
+            in_wd = 6;
+            in_ht = 6;
+            in_channels = 64;
+            out_channels = 4;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        }
+
+        if (pad_wd) {
+            out_wd = (in_wd + stride_wd - 1) / stride_wd;
+        } else {
+            out_wd = (in_wd + stride_wd - filter_wd) / stride_wd;
+        }
+        if (pad_ht) {
+            out_ht = (in_ht + stride_ht - 1) / stride_ht;
+        } else {
+            out_ht = (in_ht + stride_ht - filter_ht) / stride_ht;
+        }
+
+        int in_size = in_wd * in_ht * in_channels;
+        int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        int out_size = out_wd * out_ht * out_channels;
+
+        int16_t *input = ESP_NN_TEST_ALLOC(in_size * sizeof(int16_t));
+        int16_t *out_data_c = ESP_NN_TEST_ALLOC(out_size * sizeof(int16_t));
+        int16_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size * sizeof(int16_t));
+        int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        int64_t *bias = ESP_NN_TEST_ALLOC(sizeof(int64_t) * out_channels);
+        int32_t *out_shift = ESP_NN_TEST_ALLOC(sizeof(int32_t) * out_channels);
+        int32_t *out_mult = ESP_NN_TEST_ALLOC(sizeof(int32_t) * out_channels);
+
+        if (input == NULL || filter_data == NULL || out_data_c == NULL || out_data_opt == NULL ||
+                bias == NULL || out_shift == NULL || out_mult == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto conv_s16_cleanup;
+        }
+
+        /* Full int16 range; the last iteration uses the extreme values only */
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = itr == 7 ? INT16_MIN : rand() % 65536 - 32768;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = itr == 7 ? INT8_MIN : rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = ((int64_t) (rand() % 65536 - 32768)) << 8;
+            out_shift[i] = -14 - rand() % 4;
+            out_mult[i] = 0x40000000 + rand() % 0x3fff0000;
+        }
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        conv_params_t conv_params = {.in_offset = 0, .out_offset = 0,
+                                    .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                    .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_conv_s16_ansi(&input_dims, input, &filter_dims, filter_data,
+                             bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_conv_s16(&input_dims, input, &filter_dims, filter_data,
+                        bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   out_channels, filter_wd, filter_ht, in_channels);
+            goto conv_s16_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+               out_channels, filter_wd, filter_ht, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_s16_cleanup:
+        if (input) {
+            free(input);
+        }
+        if (filter_data) {
+            free(filter_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (bias) {
+            free(bias);
+        }
+        if (out_shift) {
+            free(out_shift);
+        }
+        if (out_mult) {
+            free(out_mult);
+        }
+    }
+}
@@ -274,3 +274,88 @@ void esp_nn_fully_connected_per_ch_s8_test()
         }
     }
 }
+
+void esp_nn_fully_connected_s16_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    /* prepare data */
+    const uint16_t max_row_len = 1024 + 7; /* longer than one 32 bit accumulation chunk */
+    const int32_t max_out_ch = 16;
+    uint16_t row_len = max_row_len;
+    uint16_t out_channels = 3;
+    int16_t input[max_row_len];
+    int8_t filter_data[max_row_len * max_out_ch];
+    int64_t bias[max_out_ch];
+    int16_t output_c[max_out_ch], output_opt[max_out_ch];
+    int32_t activation_min = -32768;
+    int32_t activation_max = 32767;
+    int32_t out_shift = -10;
+    int32_t out_mult = 0x59e492c4;
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 10; itr++) {
+        out_mult = 0x40000000 + rand() % 0x3fff0000;
+        out_shift = -16 - rand() % 4;
+        switch (itr) {
+        case 0:
+            break;
+        case 1: /* extreme values */
+            out_channels = 4;
+            break;
+        case 2:
+            row_len = 1;
+            out_channels = 16;
+            out_shift = -4;
+            break;
+        case 3:
+            row_len = 16;
+            out_channels = 8;
+            break;
+        case 4:
+            row_len = 511;
+            out_channels = 2;
+            break;
+        default:
+            row_len = rand() % 64 + 1;
+            out_channels = 8;
+            break;
+        }
+        /* Generate input, filter and bias data */
+        for (int i = 0; i < row_len; ++i) {
+            input[i] = itr == 1 ? INT16_MIN : rand() % 65536 - 32768;
+        }
+        for (int i = 0; i < row_len * out_channels; ++i) {
+            filter_data[i] = itr == 1 ? INT8_MIN : rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = ((int64_t) (rand() % 65536 - 32768)) << 8;
+        }
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_fully_connected_s16_ansi(input, row_len, filter_data, bias, output_c,
+                                        out_channels, out_shift, out_mult,
+                                        activation_min, activation_max);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_fully_connected_s16(input, row_len, filter_data, bias, output_opt,
+                                   out_channels, out_shift, out_mult,
+                                   activation_min, activation_max);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(output_c, output_opt, out_channels);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed\n"ANSI_COLOR_RESET, itr);
+            return;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [row_len %"PRIu16", out_ch %"PRIu16"]"ANSI_COLOR_RESET,
+               itr, row_len, out_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <inttypes.h>
+
+#include <esp_nn.h>
+#include "test_utils.h"
+
+#define RESIZE_TEST_ROIS    3
+
+/* Copies `roi` of the frame to `dst`, to run the reference version on it. */
+static void resize_test_crop(const uint8_t *frame, const int32_t frame_wd, const int32_t channels,
+                             const roi_t *roi, uint8_t *dst)
+{
+    for (int32_t y = 0; y < roi->height; y++) {
+        memcpy(dst + y * roi->width * channels,
+               frame + ((roi->y + y) * frame_wd + roi->x) * channels,
+               roi->width * channels);
+    }
+}
+
+static void esp_nn_crop_resize_bilinear_test(const bool is_unsigned)
+{
+    uint32_t total_c = 0, total_opt = 0;
+    int32_t frame_wd, frame_ht, channels, roi_wd, roi_ht, out_wd, out_ht;
+    resize_params_t params;
+
+    printf("\n######## Running %s (%s) ##########\n", __FUNCTION__, is_unsigned ? "u8" : "s8");
+    for (int itr = 0; itr < 6; itr++) {
+        params.align_corners = 0;
+        params.half_pixel_centers = 0;
+        switch (itr) {
+        case 0: // downscale, half pixel centers, rgb
+            frame_wd = 64;
+            frame_ht = 48;
+            channels = 3;
+            roi_wd = 40;
+            roi_ht = 30;
+            out_wd = 16;
+            out_ht = 16;
+            params.half_pixel_centers = 1;
+            break;
+        case 1: // upscale, half pixel centers: rows are reused
+            frame_wd = 32;
+            frame_ht = 32;
+            channels = 3;
+            roi_wd = 12;
+            roi_ht = 10;
+            out_wd = 24;
+            out_ht = 24;
+            params.half_pixel_centers = 1;
+            break;
+        case 2: // align corners, odd channels
+            frame_wd = 30;
+            frame_ht = 20;
+            channels = 5;
+            roi_wd = 17;
+            roi_ht = 13;
+            out_wd = 9;
+            out_ht = 11;
+            params.align_corners = 1;
+            break;
+        case 3: // neither, single channel
+            frame_wd = 40;
+            frame_ht = 40;
+            channels = 1;
+            roi_wd = 25;
+            roi_ht = 19;
+            out_wd = 31;
+            out_ht = 7;
+            break;
+        case 4: // same size
+            frame_wd = 20;
+            frame_ht = 20;
+            channels = 4;
+            roi_wd = 10;
+            roi_ht = 10;
+            out_wd = 10;
+            out_ht = 10;
+            params.half_pixel_centers = 1;
+            break;
+        default: // 1 pixel output, align corners
+            frame_wd = 16;
+            frame_ht = 16;
+            channels = 3;
+            roi_wd = 8;
+            roi_ht = 8;
+            out_wd = 1;
+            out_ht = 1;
+            params.align_corners = 1;
+            break;
+        }
+
+        const int32_t frame_size = frame_wd * frame_ht * channels;
+        const int32_t roi_size = roi_wd * roi_ht * channels;
+        const int32_t out_size = out_wd * out_ht * channels;
+        data_dims_t frame_dims = {.width = frame_wd, .height = frame_ht, .channels = channels, 1};
+        data_dims_t roi_dims = {.width = roi_wd, .height = roi_ht, .channels = channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = channels, 1};
+        roi_t rois[RESIZE_TEST_ROIS] = {
+            {.x = 0, .y = 0, .width = roi_wd, .height = roi_ht},
+            {.x = frame_wd - roi_wd, .y = frame_ht - roi_ht, .width = roi_wd, .height = roi_ht},
+            {.x = (frame_wd - roi_wd) / 3, .y = (frame_ht - roi_ht) / 2, .width = roi_wd, .height = roi_ht},
+        };
+        const int32_t table_size = esp_nn_get_resize_bilinear_table_size_opt(&roi_dims, &output_dims);
+
+        uint8_t *frame = ESP_NN_TEST_ALLOC(frame_size);
+        uint8_t *roi_data = ESP_NN_TEST_ALLOC(roi_size);
+        uint8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size * RESIZE_TEST_ROIS);
+        uint8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size * RESIZE_TEST_ROIS);
+        void *table = ESP_NN_TEST_ALLOC(table_size);
+
+        if (frame == NULL || roi_data == NULL || out_data_c == NULL ||
+                out_data_opt == NULL || table == NULL) {
+            printf(ANSI_COLOR_RED"[%d] allocations failed\n"ANSI_COLOR_RESET, itr);
+            goto crop_resize_cleanup;
+        }
+
+        for (int i = 0; i < frame_size; ++i) {
+            frame[i] = rand() % 256;
+        }
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        for (int r = 0; r < RESIZE_TEST_ROIS; r++) {
+            resize_test_crop(frame, frame_wd, channels, &rois[r], roi_data);
+            if (is_unsigned) {
+                esp_nn_resize_bilinear_u8_ansi(&roi_dims, roi_data, &output_dims,
+                                               out_data_c + r * out_size, &params);
+            } else {
+                esp_nn_resize_bilinear_s8_ansi(&roi_dims, (int8_t *) roi_data, &output_dims,
+                                               (int8_t *) out_data_c + r * out_size, &params);
+            }
+        }
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_resize_bilinear_init_table_opt(table, &roi_dims, &output_dims, &params);
+        if (is_unsigned) {
+            esp_nn_crop_resize_bilinear_u8_opt(table, &frame_dims, frame, rois,
+                                               RESIZE_TEST_ROIS, out_data_opt);
+        } else {
+            esp_nn_crop_resize_bilinear_s8_opt(table, &frame_dims, (int8_t *) frame, rois,
+                                               RESIZE_TEST_ROIS, (int8_t *) out_data_opt);
+        }
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size * RESIZE_TEST_ROIS);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [roi: (%3"PRIi32",%3"PRIi32",%"PRIi32"), "
+                   "out: (%3"PRIi32",%3"PRIi32"), align: %"PRIi32", half: %"PRIi32"]\n"
+                   ANSI_COLOR_RESET, itr, roi_wd, roi_ht, channels, out_wd, out_ht,
+                   params.align_corners, params.half_pixel_centers);
+            goto crop_resize_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [roi: (%3"PRIi32",%3"PRIi32",%"PRIi32"), "
+               "out: (%3"PRIi32",%3"PRIi32"), align: %"PRIi32", half: %"PRIi32"]"ANSI_COLOR_RESET,
+               itr, roi_wd, roi_ht, channels, out_wd, out_ht,
+               params.align_corners, params.half_pixel_centers);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    crop_resize_cleanup:
+        if (frame) {
+            free(frame);
+        }
+        if (roi_data) {
+            free(roi_data);
+        }
+        if (out_data_c) {
+            free(out_data_c);
+        }
+        if (out_data_opt) {
+            free(out_data_opt);
+        }
+        if (table) {
+            free(table);
+        }
+    }
+}
+
+void esp_nn_crop_resize_bilinear_s8_test()
+{
+    esp_nn_crop_resize_bilinear_test(false);
+}
+
+void esp_nn_crop_resize_bilinear_u8_test()
+{
+    esp_nn_crop_resize_bilinear_test(true);
+}
@@ -97,3 +97,109 @@ softmax_s8_cleanup:
         free (scratch_buf_orig);
     }
 }
+
+void esp_nn_softmax_s8_lut_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t height = 4;
+    int32_t width, mult, shift, diff_min;
+    int32_t *lut = ESP_NN_TEST_ALLOC(ESP_NN_SOFTMAX_LUT_SIZE * sizeof(int32_t));
+    int8_t *input = ESP_NN_TEST_ALLOC(32 * height);
+    int8_t *out_ansi = ESP_NN_TEST_ALLOC(32 * height);
+    int8_t *out_opt = ESP_NN_TEST_ALLOC(32 * height);
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    if (lut == NULL || input == NULL || out_ansi == NULL || out_opt == NULL) {
+        printf(ANSI_COLOR_RED"%s buffer allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+        goto softmax_lut_cleanup;
+    }
+
+    for (int itr = 0; itr < 10; itr++) {
+        switch (itr) {
+        case 0: // classifier head as converted by TFLite
+            width = 4;
+            mult = 1968790784;
+            shift = 22;
+            diff_min = -496;
+            break;
+        case 1: // some differences under diff_min
+            width = 16;
+            mult = INT32_MAX / 2;
+            shift = 7;
+            diff_min = -128;
+            break;
+        case 2: // single class
+            width = 1;
+            mult = 1073741824;
+            shift = 21;
+            diff_min = -248;
+            break;
+        case 3: // wider than the TFLite kernel uses it for
+            width = 32;
+            mult = 1518500250;
+            shift = 23;
+            diff_min = -64;
+            break;
+        default: // diff_min as TFLite's CalculateInputRadius() sets it
+            width = 2 + (itr - 4) * 2;
+            mult = 1073741824 + rand() % 1073741824;
+            shift = 18 + rand() % 8;
+            diff_min = -((31 << 26) >> shift);
+            break;
+        }
+        const int32_t size = width * height;
+
+        /* Generate input data between -128 -> +127 */
+        for (int i = 0; i < size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        /* a tie for the row max */
+        input[1 % width] = input[0];
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_softmax_s8_ansi(input, height, width, mult, shift, diff_min, out_ansi);
+
+        total_c = profile_c_end();
+
+        esp_nn_softmax_init_lut_opt(lut, mult, shift, diff_min);
+
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_softmax_s8_lut_opt(input, height, width, lut, out_opt);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_ansi, out_opt, size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [width %"PRIi32", shift %"PRIi32", diff_min %"PRIi32"]\n"
+                   ANSI_COLOR_RESET, itr, width, shift, diff_min);
+            printf("Output: \n");
+            PRINT_ARRAY_HEX(out_opt, width, height);
+            printf("Expected: \n");
+            PRINT_ARRAY_HEX(out_ansi, width, height);
+            goto softmax_lut_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [width %"PRIi32", shift %"PRIi32", diff_min %"PRIi32"]"
+               ANSI_COLOR_RESET, itr, width, shift, diff_min);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+    }
+
+softmax_lut_cleanup:
+    if (lut) {
+        free(lut);
+    }
+    if (input) {
+        free(input);
+    }
+    if (out_ansi) {
+        free(out_ansi);
+    }
+    if (out_opt) {
+        free(out_opt);
+    }
+}
@@ -28,6 +28,8 @@ namespace tflm_signal {
 // FFT for real valued time domain inputs.
 
 // 16-bit Integer input/output
+// Power-of-two lengths use a dedicated radix-4 engine whose output is within
+// log2(fft_length) LSB of kiss_fftr; other lengths run kiss_fftr itself.
 
 // Returns the size of the memory that an RFFT of `fft_length` needs
 size_t RfftInt16GetNeededMemory(int32_t fft_length);
@@ -45,6 +47,12 @@ void* RfftInt16Init(int32_t fft_length, void* state, size_t state_size);
 void RfftInt16Apply(void* state, const int16_t* input,
                     Complex<int16_t>* output);
 
+// Same as FftAutoScale() on `input` followed by RfftInt16Apply(), without
+// the intermediate copy: the left shift is applied while the input is
+// loaded. Returns the number of bits `input` was shifted by.
+int RfftInt16ApplyAutoScale(void* state, const int16_t* input,
+                            Complex<int16_t>* output);
+
 // 32-bit Integer input/output
 
 // Returns the size of the memory that an RFFT of `fft_length` needs
@@ -13,7 +13,11 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <esp_cpu.h>
+#include <esp_rom_sys.h>
 #include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <soc/soc_caps.h>
 #include "tensorflow/lite/micro/micro_time.h"
 
 namespace tflite {
@@ -22,4 +26,47 @@ uint32_t ticks_per_second() { return 1000000; }
 
 uint32_t GetCurrentTimeTicks() { return esp_timer_get_time(); }
 
+namespace {
+
+// The 32-bit CCOUNT register of each core, widened to 64 bits. Each core has
+// its own counter and they are not in sync, so the events measured must run
+// on a task pinned to one core. Wraps (every 26.8 s at 160 MHz) are only
+// counted while the clock is read at least once per period, so the absolute
+// count may fall behind while idle, but durations of events shorter than a
+// period stay exact.
+struct CycleCounter {
+  uint32_t last;
+  uint32_t wraps;
+};
+
+CycleCounter cycle_counters[SOC_CPU_CORES_NUM];
+
+// Taken around each read-compare-store of a counter: a task or interrupt that
+// preempts it between the read and the store would count a wrap twice or
+// store an older value over a newer one.
+portMUX_TYPE cycle_counters_lock = portMUX_INITIALIZER_UNLOCKED;
+
+}  // namespace
+
+// Follows the CPU frequency, including changes made by power management, but
+// events that span a change are measured in a mix of both rates.
+uint64_t cycles_per_second() {
+  return static_cast<uint64_t>(esp_rom_get_cpu_ticks_per_us()) * 1000000;
+}
+
+uint64_t GetCurrentTimeCycles() {
+  // The core is read inside the critical section, where the task cannot
+  // migrate, so the count and the counter belong to the same core.
+  portENTER_CRITICAL_SAFE(&cycle_counters_lock);
+  CycleCounter& counter = cycle_counters[esp_cpu_get_core_id()];
+  const uint32_t now = esp_cpu_get_cycle_count();
+  if (now < counter.last) {
+    counter.wraps++;
+  }
+  counter.last = now;
+  const uint32_t wraps = counter.wraps;
+  portEXIT_CRITICAL_SAFE(&cycle_counters_lock);
+  return static_cast<uint64_t>(wraps) << 32 | now;
+}
+
 }  // namespace tflite
@@ -105,6 +105,9 @@ TfLiteStatus ReluPrepare(TfLiteContext* context, TfLiteNode* node) {
     CalculateReluOpData<int16_t>(input, output, data);
   }
 
+  TF_LITE_ENSURE_STATUS(
+      micro_context->AllowInPlaceOutput(node, kActivationsInputTensor));
+
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(output);
 
@@ -133,6 +136,9 @@ TfLiteStatus Relu6Prepare(TfLiteContext* context, TfLiteNode* node) {
     TF_LITE_ENSURE(context, data->six >= INT16_MIN && data->six <= INT16_MAX);
   }
 
+  TF_LITE_ENSURE_STATUS(
+      micro_context->AllowInPlaceOutput(node, kActivationsInputTensor));
+
   micro_context->DeallocateTempTfLiteTensor(input);
 
   return kTfLiteOk;
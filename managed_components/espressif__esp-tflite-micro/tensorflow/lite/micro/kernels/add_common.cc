@@ -107,6 +107,14 @@ TfLiteStatus AddPrepare(TfLiteContext* context, TfLiteNode* node) {
                       kTfLiteNoQuantization);
   }
 
+  // Every output element only depends on the input elements at the same
+  // position (or on a broadcast input, which never matches the output size),
+  // so the output can overwrite either input.
+  TF_LITE_ENSURE_STATUS(
+      micro_context->AllowInPlaceOutput(node, kAddInputTensor1));
+  TF_LITE_ENSURE_STATUS(
+      micro_context->AllowInPlaceOutput(node, kAddInputTensor2));
+
   micro_context->DeallocateTempTfLiteTensor(input1);
   micro_context->DeallocateTempTfLiteTensor(input2);
   micro_context->DeallocateTempTfLiteTensor(output);
@@ -107,9 +107,18 @@ TfLiteStatus CircularBufferEval(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
+// MicroInterpreter::Reset() clears the buffered history (a variable tensor)
+// through ResetVariableTensors(); restart the stride with it so the first
+// output after a reset again needs cycles_max new inputs.
+void CircularBufferReset(TfLiteContext* context, void* buffer) {
+  OpDataCircularBuffer* op_data = static_cast<OpDataCircularBuffer*>(buffer);
+  op_data->cycles_until_run = op_data->cycles_max;
+}
+
 TFLMRegistration* Register_CIRCULAR_BUFFER() {
   static TFLMRegistration r = tflite::micro::RegisterOp(
-      CircularBufferInit, CircularBufferPrepare, CircularBufferEval);
+      CircularBufferInit, CircularBufferPrepare, CircularBufferEval,
+      /*free=*/nullptr, CircularBufferReset);
   return &r;
 }
 
@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <tuple>
 
@@ -98,16 +99,20 @@ struct OpData {
   bool use_regular_non_max_suppression;
   CenterSizeEncoding scale_values;
 
+  // Smallest quantized class prediction at or above
+  // non_max_suppression_score_threshold, for int8 and uint8 predictions.
+  int32_t quantized_score_threshold;
+
   // Scratch buffers indexes
-  int active_candidate_idx;
+  int candidates_idx;
   int decoded_boxes_idx;
-  int scores_idx;
   int score_buffer_idx;
   int keep_scores_idx;
   int scores_after_regular_non_max_suppression_idx;
   int sorted_values_idx;
   int keep_indices_idx;
   int sorted_indices_idx;
+  int sort_scratch_idx;
   int buffer_idx;
   int selected_idx;
 
@@ -117,6 +122,26 @@ struct OpData {
   TfLiteQuantizationParams input_anchors;
 };
 
+template <typename T>
+float Dequantize(T x, const TfLiteQuantizationParams& params) {
+  return (static_cast<float>(x) - params.zero_point) * params.scale;
+}
+
+// Smallest value of T whose dequantized value is at least `threshold`, or
+// one past the largest value of T if there is none. Comparing quantized
+// scores against it selects exactly the scores that would pass in float.
+template <typename T>
+int32_t QuantizedScoreThreshold(float threshold,
+                                const TfLiteQuantizationParams& params) {
+  int32_t value = std::numeric_limits<T>::min();
+  for (; value <= std::numeric_limits<T>::max(); ++value) {
+    if (Dequantize(static_cast<T>(value), params) >= threshold) {
+      break;
+    }
+  }
+  return value;
+}
+
 void* DetectionPostProcessInit(TfLiteContext* context, const char* buffer,
                                size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
@@ -183,40 +208,61 @@ TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
   op_data->input_anchors.scale = input_anchors->params.scale;
   op_data->input_anchors.zero_point = input_anchors->params.zero_point;
 
+  switch (input_class_predictions->type) {
+    case kTfLiteInt8:
+      op_data->quantized_score_threshold = QuantizedScoreThreshold<int8_t>(
+          op_data->non_max_suppression_score_threshold,
+          op_data->input_class_predictions);
+      break;
+    case kTfLiteUInt8:
+      op_data->quantized_score_threshold = QuantizedScoreThreshold<uint8_t>(
+          op_data->non_max_suppression_score_threshold,
+          op_data->input_class_predictions);
+      break;
+    default:
+      op_data->quantized_score_threshold = 0;
+      break;
+  }
+
   // Scratch tensors
-  context->RequestScratchBufferInArena(context, num_boxes,
-                                       &op_data->active_candidate_idx);
+  // Only the boxes of the anchors with a score above the threshold are
+  // decoded, but they are stored by anchor index.
   context->RequestScratchBufferInArena(context,
                                        num_boxes * kNumCoordBox * sizeof(float),
                                        &op_data->decoded_boxes_idx);
-  context->RequestScratchBufferInArena(
-      context,
-      input_class_predictions->dims->data[1] *
-          input_class_predictions->dims->data[2] * sizeof(float),
-      &op_data->scores_idx);
+  context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
+                                       &op_data->candidates_idx);
 
   // Additional buffers
-  context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
+  // Non-max suppression keeps at most detections_per_class boxes per class
+  // (regular) or max_detections boxes (fast), and the regular version merges
+  // the boxes of each class with the max_detections best ones so far.
+  const int max_selected =
+      std::max(op_data->max_detections, op_data->detections_per_class);
+  const int max_merged =
+      op_data->max_detections + op_data->detections_per_class;
+  context->RequestScratchBufferInArena(context, num_classes * sizeof(float),
                                        &op_data->score_buffer_idx);
   context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
                                        &op_data->keep_scores_idx);
   context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
+      context, max_merged * sizeof(float),
       &op_data->scores_after_regular_non_max_suppression_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
-      &op_data->sorted_values_idx);
+  context->RequestScratchBufferInArena(context, max_merged * sizeof(float),
+                                       &op_data->sorted_values_idx);
   context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
                                        &op_data->keep_indices_idx);
   context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(int),
+      context, std::max(num_boxes, max_merged) * sizeof(int),
       &op_data->sorted_indices_idx);
-  int buffer_size = std::max(num_classes, op_data->max_detections);
+  context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
+                                       &op_data->sort_scratch_idx);
   context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->buffer_idx);
-  buffer_size = std::min(num_boxes, op_data->max_detections);
+      context, std::max(num_classes, max_merged) * sizeof(int),
+      &op_data->buffer_idx);
   context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->selected_idx);
+      context, std::min(num_boxes, max_selected) * sizeof(int),
+      &op_data->selected_idx);
 
   // Outputs: detection_boxes, detection_scores, detection_classes,
   // num_detections
@@ -229,17 +275,40 @@ TfLiteStatus DetectionPostProcessPrepare(TfLiteContext* context,
   return kTfLiteOk;
 }
 
-class Dequantizer {
+// Class scores, read and compared with the score threshold in their own
+// type, so that quantized scores are only dequantized once they pass.
+template <typename T>
+class ClassScores {
  public:
-  Dequantizer(int zero_point, float scale)
-      : zero_point_(zero_point), scale_(scale) {}
-  float operator()(uint8_t x) {
-    return (static_cast<float>(x) - zero_point_) * scale_;
-  }
+  ClassScores(const TfLiteEvalTensor* tensor, const OpData* op_data)
+      : data_(tflite::micro::GetTensorData<T>(tensor)),
+        params_(op_data->input_class_predictions),
+        threshold_(op_data->quantized_score_threshold) {}
+
+  T Get(int index) const { return data_[index]; }
+  bool Passes(T score) const { return score >= threshold_; }
+  float Value(T score) const { return Dequantize(score, params_); }
+
+ private:
+  const T* data_;
+  TfLiteQuantizationParams params_;
+  int32_t threshold_;
+};
+
+template <>
+class ClassScores<float> {
+ public:
+  ClassScores(const TfLiteEvalTensor* tensor, const OpData* op_data)
+      : data_(tflite::micro::GetTensorData<float>(tensor)),
+        threshold_(op_data->non_max_suppression_score_threshold) {}
+
+  float Get(int index) const { return data_[index]; }
+  bool Passes(float score) const { return score >= threshold_; }
+  float Value(float score) const { return score; }
 
  private:
-  int zero_point_;
-  float scale_;
+  const float* data_;
+  float threshold_;
 };
 
 template <class T>
@@ -254,38 +323,71 @@ T ReInterpretTensor(TfLiteEvalTensor* tensor) {
   return reinterpret_cast<T>(tensor_base);
 }
 
+template <typename T>
+CenterSizeEncoding DequantizeEncoding(const T* values,
+                                      const TfLiteQuantizationParams& params) {
+  CenterSizeEncoding encoding;
+  encoding.y = Dequantize(values[0], params);
+  encoding.x = Dequantize(values[1], params);
+  encoding.h = Dequantize(values[2], params);
+  encoding.w = Dequantize(values[3], params);
+  return encoding;
+}
+
+// Reads the center-size encoding of box `idx` from `tensor`, whose rows are
+// its innermost dimension long (box encodings may carry keypoints after the
+// first kNumCoordBox values).
+TfLiteStatus ReadCenterSizeEncoding(const TfLiteEvalTensor* tensor, int idx,
+                                    const TfLiteQuantizationParams& params,
+                                    CenterSizeEncoding* encoding) {
+  const int offset = idx * tensor->dims->data[tensor->dims->size - 1];
+  switch (tensor->type) {
+    case kTfLiteFloat32:
+      *encoding = *reinterpret_cast<const CenterSizeEncoding*>(
+          &tflite::micro::GetTensorData<float>(tensor)[offset]);
+      return kTfLiteOk;
+    case kTfLiteInt8:
+      *encoding = DequantizeEncoding(
+          &tflite::micro::GetTensorData<int8_t>(tensor)[offset], params);
+      return kTfLiteOk;
+    case kTfLiteUInt8:
+      *encoding = DequantizeEncoding(
+          &tflite::micro::GetTensorData<uint8_t>(tensor)[offset], params);
+      return kTfLiteOk;
+    default:
+      // Unsupported type.
+      return kTfLiteError;
+  }
+}
+
+// Decodes the boxes of the `num_candidates` anchors in `candidates` into
+// temporary decoded_boxes, indexed by anchor. The boxes of the other anchors
+// are left undefined: no score of theirs passes the threshold, so they are
+// never selected.
 TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
-                                   OpData* op_data) {
+                                   OpData* op_data, const int* candidates,
+                                   int num_candidates) {
   // Parse input tensor boxencodings
   const TfLiteEvalTensor* input_box_encodings =
       tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
   TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
-  const int num_boxes = input_box_encodings->dims->data[1];
   TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
   const TfLiteEvalTensor* input_anchors =
       tflite::micro::GetEvalInput(context, node, kInputTensorAnchors);
+  float* decoded_boxes = reinterpret_cast<float*>(
+      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
 
   // Decode the boxes to get (ymin, xmin, ymax, xmax) based on the anchors
   CenterSizeEncoding box_centersize;
   CenterSizeEncoding scale_values = op_data->scale_values;
   CenterSizeEncoding anchor;
-  for (int idx = 0; idx < num_boxes; ++idx) {
-    switch (input_box_encodings->type) {
-        // Float
-      case kTfLiteFloat32: {
-        // Please see DequantizeBoxEncodings function for the support detail.
-        const int box_encoding_idx = idx * input_box_encodings->dims->data[2];
-        const float* boxes = &(tflite::micro::GetTensorData<float>(
-            input_box_encodings)[box_encoding_idx]);
-        box_centersize = *reinterpret_cast<const CenterSizeEncoding*>(boxes);
-        anchor =
-            ReInterpretTensor<const CenterSizeEncoding*>(input_anchors)[idx];
-        break;
-      }
-      default:
-        // Unsupported type.
-        return kTfLiteError;
-    }
+  for (int i = 0; i < num_candidates; ++i) {
+    const int idx = candidates[i];
+    TF_LITE_ENSURE_STATUS(ReadCenterSizeEncoding(
+        input_box_encodings, idx, op_data->input_box_encodings,
+        &box_centersize));
+    TF_LITE_ENSURE_STATUS(ReadCenterSizeEncoding(
+        input_anchors, idx, op_data->input_anchors, &anchor));
 
     float ycenter = static_cast<float>(static_cast<double>(box_centersize.y) /
                                            static_cast<double>(scale_values.y) *
@@ -308,13 +410,13 @@ TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
                                      static_cast<double>(scale_values.w))) *
                            static_cast<double>(anchor.w));
 
-    float* decoded_boxes = reinterpret_cast<float*>(
-        context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
     auto& box = reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[idx];
     box.ymin = ycenter - half_h;
     box.xmin = xcenter - half_w;
     box.ymax = ycenter + half_h;
     box.xmax = xcenter + half_w;
+    // ymax>=ymin, xmax>=xmin
+    TF_LITE_ENSURE(context, box.ymin < box.ymax && box.xmin < box.xmax);
   }
   return kTfLiteOk;
 }
@@ -379,31 +481,6 @@ void DecreasingArgSort(const float* values, int num_values, int* indices,
   });
 }
 
-int SelectDetectionsAboveScoreThreshold(const float* values, int size,
-                                        const float threshold,
-                                        float* keep_values, int* keep_indices) {
-  int counter = 0;
-  for (int i = 0; i < size; i++) {
-    if (values[i] >= threshold) {
-      keep_values[counter] = values[i];
-      keep_indices[counter] = i;
-      counter++;
-    }
-  }
-  return counter;
-}
-
-bool ValidateBoxes(const float* decoded_boxes, const int num_boxes) {
-  for (int i = 0; i < num_boxes; ++i) {
-    // ymax>=ymin, xmax>=xmin
-    auto& box = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
-    if (box.ymin >= box.ymax || box.xmin >= box.xmax) {
-      return false;
-    }
-  }
-  return true;
-}
-
 float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
                                    const int j) {
   auto& box_i = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
@@ -421,21 +498,31 @@ float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
   return intersection_area / (area_i + area_j - intersection_area);
 }
 
+// Returns true if boxes i and j do not overlap, in which case their
+// intersection over union is 0.
+bool Disjoint(const float* decoded_boxes, const int i, const int j) {
+  auto& box_i = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
+  auto& box_j = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[j];
+  return box_i.ymin >= box_j.ymax || box_j.ymin >= box_i.ymax ||
+         box_i.xmin >= box_j.xmax || box_j.xmin >= box_i.xmax;
+}
+
 // NonMaxSuppressionSingleClass() prunes out the box locations with high overlap
-// before selecting the highest scoring boxes (max_detections in number)
-// It assumes all boxes are good in beginning and sorts based on the scores.
-// If lower-scoring box has too much overlap with a higher-scoring box,
-// we get rid of the lower-scoring box.
-// Complexity is O(N^2) pairwise comparison between boxes
+// before selecting the highest scoring boxes (max_detections in number).
+// The `num_kept` boxes are those of the anchors in `keep_indices`, whose
+// scores, all above the score threshold, are in `keep_scores`. `selected`
+// receives the positions in keep_indices of the selected boxes, best first.
+// Going through the boxes in decreasing score order, a box is selected
+// unless it overlaps a box selected before it too much. This selects the
+// same boxes as getting rid of every lower-scoring box that overlaps each
+// selected box, but each box is only compared with the selected boxes, at
+// most max_detections of them, and boxes that do not overlap are rejected
+// without computing their intersection over union.
+// Complexity is O(N * max_detections) box comparisons
 TfLiteStatus NonMaxSuppressionSingleClassHelper(
-    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
-    const float* scores, int* selected, int* selected_size,
+    TfLiteContext* context, OpData* op_data, const int* keep_indices,
+    const float* keep_scores, int num_kept, int* selected, int* selected_size,
     int max_detections) {
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
-  const int num_boxes = input_box_encodings->dims->data[1];
-  const float non_max_suppression_score_threshold =
-      op_data->non_max_suppression_score_threshold;
   const float intersection_over_union_threshold =
       op_data->intersection_over_union_threshold;
   // Maximum detections should be positive.
@@ -444,84 +531,83 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
   // and should be less than 1.
   TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
                               (intersection_over_union_threshold <= 1.0f));
-  // Validate boxes
-  float* decoded_boxes = reinterpret_cast<float*>(
+  const float* decoded_boxes = reinterpret_cast<const float*>(
       context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-
-  TF_LITE_ENSURE(context, ValidateBoxes(decoded_boxes, num_boxes));
-
-  // threshold scores
-  int* keep_indices = reinterpret_cast<int*>(
-      context->GetScratchBuffer(context, op_data->keep_indices_idx));
-  float* keep_scores = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->keep_scores_idx));
-  int num_scores_kept = SelectDetectionsAboveScoreThreshold(
-      scores, num_boxes, non_max_suppression_score_threshold, keep_scores,
-      keep_indices);
   int* sorted_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  int* sort_scratch = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->sort_scratch_idx));
 
-  // Reusing keep_indices for scratch buffer and write back its values
-  // after the sorting is done.
-  DecreasingArgSort(keep_scores, num_scores_kept, sorted_indices, keep_indices);
-  int counter = 0;
-  for (int i = 0; i < num_boxes; i++) {
-    if (scores[i] >= non_max_suppression_score_threshold) {
-      keep_indices[counter] = i;
-      counter++;
+  // Stable, so that equal scores keep the anchor order.
+  DecreasingArgSort(keep_scores, num_kept, sorted_indices, sort_scratch);
+
+  const int output_size = std::min(num_kept, max_detections);
+  *selected_size = 0;
+  for (int i = 0; i < num_kept && *selected_size < output_size; ++i) {
+    const int candidate = keep_indices[sorted_indices[i]];
+    bool suppressed = false;
+    for (int j = 0; j < *selected_size; ++j) {
+      const int kept = keep_indices[selected[j]];
+      if (!Disjoint(decoded_boxes, kept, candidate) &&
+          ComputeIntersectionOverUnion(decoded_boxes, kept, candidate) >
+              intersection_over_union_threshold) {
+        suppressed = true;
+        break;
+      }
+    }
+    if (!suppressed) {
+      selected[(*selected_size)++] = sorted_indices[i];
     }
   }
 
-  const int num_boxes_kept = num_scores_kept;
-  const int output_size = std::min(num_boxes_kept, max_detections);
-  *selected_size = 0;
+  return kTfLiteOk;
+}
 
-  int num_active_candidate = num_boxes_kept;
-  uint8_t* active_box_candidate = reinterpret_cast<uint8_t*>(
-      context->GetScratchBuffer(context, op_data->active_candidate_idx));
+// Collects into `candidates` the anchors with a class score above the score
+// threshold, the only ones non-max suppression can select, and decodes their
+// boxes. If `max_scores` is not null it receives their highest class score.
+// Returns the number of candidates in `num_candidates`.
+template <typename T>
+TfLiteStatus SelectCandidates(TfLiteContext* context, TfLiteNode* node,
+                              OpData* op_data, const ClassScores<T>& scores,
+                              int num_classes_with_background, int label_offset,
+                              int* candidates, float* max_scores,
+                              int* num_candidates) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  const int num_classes = op_data->num_classes;
 
-  for (int row = 0; row < num_boxes_kept; row++) {
-    active_box_candidate[row] = 1;
-  }
-  for (int i = 0; i < num_boxes_kept; ++i) {
-    if (num_active_candidate == 0 || *selected_size >= output_size) break;
-    if (active_box_candidate[i] == 1) {
-      selected[(*selected_size)++] = keep_indices[sorted_indices[i]];
-      active_box_candidate[i] = 0;
-      num_active_candidate--;
-    } else {
-      continue;
+  int counter = 0;
+  for (int row = 0; row < num_boxes; row++) {
+    const int offset = row * num_classes_with_background + label_offset;
+    T max_score = scores.Get(offset);
+    for (int col = 1; col < num_classes; col++) {
+      max_score = std::max(max_score, scores.Get(offset + col));
     }
-    for (int j = i + 1; j < num_boxes_kept; ++j) {
-      if (active_box_candidate[j] == 1) {
-        float intersection_over_union = ComputeIntersectionOverUnion(
-            decoded_boxes, keep_indices[sorted_indices[i]],
-            keep_indices[sorted_indices[j]]);
-
-        if (intersection_over_union > intersection_over_union_threshold) {
-          active_box_candidate[j] = 0;
-          num_active_candidate--;
-        }
+    if (scores.Passes(max_score)) {
+      if (max_scores != nullptr) {
+        max_scores[counter] = scores.Value(max_score);
       }
+      candidates[counter++] = row;
     }
   }
-
-  return kTfLiteOk;
+  *num_candidates = counter;
+  return DecodeCenterSizeBoxes(context, node, op_data, candidates, counter);
 }
 
 // This function implements a regular version of Non Maximal Suppression (NMS)
 // for multiple classes where
 // 1) we do NMS separately for each class across all anchors and
 // 2) keep only the highest anchor scores across all classes
-// 3) The worst runtime of the regular NMS is O(K*N^2)
-// where N is the number of anchors and K the number of
-// classes.
-TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
-                                                      TfLiteNode* node,
-                                                      OpData* op_data,
-                                                      const float* scores) {
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+// 3) The worst runtime of the regular NMS is O(K*N*D)
+// where N is the number of anchors, K the number of classes and D the number
+// of detections per class. Only anchors with a score above the threshold
+// count in N.
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
+    const ClassScores<T>& scores) {
   const TfLiteEvalTensor* input_class_predictions =
       tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
   TfLiteEvalTensor* detection_boxes =
@@ -533,7 +619,6 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   TfLiteEvalTensor* num_detections =
       tflite::micro::GetEvalOutput(context, node, kOutputTensorNumDetections);
 
-  const int num_boxes = input_box_encodings->dims->data[1];
   const int num_classes = op_data->num_classes;
   const int num_detections_per_class = op_data->detections_per_class;
   const int max_detections = op_data->max_detections;
@@ -543,9 +628,18 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   int label_offset = num_classes_with_background - num_classes;
   TF_LITE_ENSURE(context, num_detections_per_class > 0);
 
+  int* candidates = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->candidates_idx));
+  int num_candidates = 0;
+  TF_LITE_ENSURE_STATUS(SelectCandidates(
+      context, node, op_data, scores, num_classes_with_background,
+      label_offset, candidates, nullptr, &num_candidates));
+
   // For each class, perform non-max suppression.
-  float* class_scores = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->score_buffer_idx));
+  int* keep_indices = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->keep_indices_idx));
+  float* keep_scores = reinterpret_cast<float*>(
+      context->GetScratchBuffer(context, op_data->keep_scores_idx));
   int* box_indices_after_regular_non_max_suppression = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
   float* scores_after_regular_non_max_suppression =
@@ -559,27 +653,33 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
       context->GetScratchBuffer(context, op_data->sorted_values_idx));
 
   for (int col = 0; col < num_classes; col++) {
-    for (int row = 0; row < num_boxes; row++) {
-      // Get scores of boxes corresponding to all anchors for single class
-      class_scores[row] =
-          *(scores + row * num_classes_with_background + col + label_offset);
+    // Get scores above the threshold of the candidate anchors for this class
+    int num_kept = 0;
+    for (int i = 0; i < num_candidates; i++) {
+      const T score = scores.Get(candidates[i] * num_classes_with_background +
+                                 col + label_offset);
+      if (scores.Passes(score)) {
+        keep_indices[num_kept] = candidates[i];
+        keep_scores[num_kept] = scores.Value(score);
+        num_kept++;
+      }
     }
     // Perform non-maximal suppression on single class
     int selected_size = 0;
     int* selected = reinterpret_cast<int*>(
         context->GetScratchBuffer(context, op_data->selected_idx));
     TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-        context, node, op_data, class_scores, selected, &selected_size,
-        num_detections_per_class));
+        context, op_data, keep_indices, keep_scores, num_kept, selected,
+        &selected_size, num_detections_per_class));
     // Add selected indices from non-max suppression of boxes in this class
     int output_index = size_of_sorted_indices;
     for (int i = 0; i < selected_size; i++) {
-      int selected_index = selected[i];
+      int selected_index = keep_indices[selected[i]];
 
       box_indices_after_regular_non_max_suppression[output_index] =
           (selected_index * num_classes_with_background + col + label_offset);
       scores_after_regular_non_max_suppression[output_index] =
-          class_scores[selected_index];
+          keep_scores[selected[i]];
       output_index++;
     }
     // Sort the max scores among the selected indices
@@ -646,15 +746,14 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
 // multiple classes where
 // 1) we keep the top-k scores for each anchor and
 // 2) during NMS, each anchor only uses the highest class score for sorting.
-// 3) Compared to standard NMS, the worst runtime of this version is O(N^2)
-// instead of O(KN^2) where N is the number of anchors and K the number of
-// classes.
-TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
-                                                   TfLiteNode* node,
-                                                   OpData* op_data,
-                                                   const float* scores) {
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+// 3) Compared to standard NMS, the worst runtime of this version is O(N*D)
+// instead of O(K*N*D) where N is the number of anchors, K the number of
+// classes and D the maximum number of detections.
+// Only the anchors that NMS selects get their classes sorted.
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClassFastHelper(
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
+    const ClassScores<T>& scores) {
   const TfLiteEvalTensor* input_class_predictions =
       tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
   TfLiteEvalTensor* detection_boxes =
@@ -667,7 +766,6 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   TfLiteEvalTensor* num_detections =
       tflite::micro::GetEvalOutput(context, node, kOutputTensorNumDetections);
 
-  const int num_boxes = input_box_encodings->dims->data[1];
   const int num_classes = op_data->num_classes;
   const int max_categories_per_anchor = op_data->max_classes_per_detection;
   const int num_classes_with_background =
@@ -678,38 +776,41 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   TF_LITE_ENSURE(context, (max_categories_per_anchor > 0));
   const int num_categories_per_anchor =
       std::min(max_categories_per_anchor, num_classes);
-  float* max_scores = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->score_buffer_idx));
-  int* sorted_class_indices = reinterpret_cast<int*>(
-      context->GetScratchBuffer(context, op_data->buffer_idx));
 
-  for (int row = 0; row < num_boxes; row++) {
-    const float* box_scores =
-        scores + row * num_classes_with_background + label_offset;
-    int* class_indices = sorted_class_indices + row * num_classes;
-    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
-                             class_indices);
-    max_scores[row] = box_scores[class_indices[0]];
-  }
+  int* candidates = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->candidates_idx));
+  float* max_scores = reinterpret_cast<float*>(
+      context->GetScratchBuffer(context, op_data->keep_scores_idx));
+  int num_candidates = 0;
+  TF_LITE_ENSURE_STATUS(SelectCandidates(
+      context, node, op_data, scores, num_classes_with_background,
+      label_offset, candidates, max_scores, &num_candidates));
 
   // Perform non-maximal suppression on max scores
   int selected_size = 0;
   int* selected = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->selected_idx));
   TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-      context, node, op_data, max_scores, selected, &selected_size,
-      op_data->max_detections));
+      context, op_data, candidates, max_scores, num_candidates, selected,
+      &selected_size, op_data->max_detections));
 
   // Allocate output tensors
+  float* box_scores = reinterpret_cast<float*>(
+      context->GetScratchBuffer(context, op_data->score_buffer_idx));
+  int* class_indices = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->buffer_idx));
   int output_box_index = 0;
 
   for (int i = 0; i < selected_size; i++) {
-    int selected_index = selected[i];
+    int selected_index = candidates[selected[i]];
 
-    const float* box_scores =
-        scores + selected_index * num_classes_with_background + label_offset;
-    const int* class_indices =
-        sorted_class_indices + selected_index * num_classes;
+    const int offset =
+        selected_index * num_classes_with_background + label_offset;
+    for (int col = 0; col < num_classes; ++col) {
+      box_scores[col] = scores.Value(scores.Get(offset + col));
+    }
+    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
+                             class_indices);
 
     for (int col = 0; col < num_categories_per_anchor; ++col) {
       int box_offset = num_categories_per_anchor * output_box_index + col;
@@ -736,6 +837,18 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   return kTfLiteOk;
 }
 
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
+                                         TfLiteNode* node, OpData* op_data,
+                                         const TfLiteEvalTensor* predictions) {
+  const ClassScores<T> scores(predictions, op_data);
+  if (op_data->use_regular_non_max_suppression) {
+    return NonMaxSuppressionMultiClassRegularHelper(context, node, op_data,
+                                                    scores);
+  }
+  return NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores);
+}
+
 TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
                                          TfLiteNode* node, OpData* op_data) {
   // Get the input tensors
@@ -755,25 +868,20 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
   TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
   TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
 
-  const float* scores;
   switch (input_class_predictions->type) {
     case kTfLiteFloat32:
-      scores = tflite::micro::GetTensorData<float>(input_class_predictions);
-      break;
+      return NonMaxSuppressionMultiClass<float>(context, node, op_data,
+                                                input_class_predictions);
+    case kTfLiteInt8:
+      return NonMaxSuppressionMultiClass<int8_t>(context, node, op_data,
+                                                 input_class_predictions);
+    case kTfLiteUInt8:
+      return NonMaxSuppressionMultiClass<uint8_t>(context, node, op_data,
+                                                  input_class_predictions);
     default:
       // Unsupported type.
       return kTfLiteError;
   }
-
-  if (op_data->use_regular_non_max_suppression) {
-    TF_LITE_ENSURE_STATUS(NonMaxSuppressionMultiClassRegularHelper(
-        context, node, op_data, scores));
-  } else {
-    TF_LITE_ENSURE_STATUS(
-        NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores));
-  }
-
-  return kTfLiteOk;
 }
 
 TfLiteStatus DetectionPostProcessEval(TfLiteContext* context,
@@ -787,15 +895,12 @@ TfLiteStatus DetectionPostProcessEval(TfLiteContext* context,
   // and do all calculations in float. Mixed quantized/float calculations are
   // currently not supported in TFLite.
 
-  // This fills in temporary decoded_boxes
-  // by transforming input_box_encodings and input_anchors from
-  // CenterSizeEncodings to BoxCornerEncoding
-  TF_LITE_ENSURE_STATUS(DecodeCenterSizeBoxes(context, node, op_data));
-
   // This fills in the output tensors
   // by choosing effective set of decoded boxes
   // based on Non Maximal Suppression, i.e. selecting
-  // highest scoring non-overlapping boxes.
+  // highest scoring non-overlapping boxes. Only the anchors with a score
+  // above the threshold have their box decoded, from CenterSizeEncoding to
+  // BoxCornerEncoding, into temporary decoded_boxes.
   TF_LITE_ENSURE_STATUS(NonMaxSuppressionMultiClass(context, node, op_data));
 
   return kTfLiteOk;
@@ -37,6 +37,16 @@ limitations under the License.
 long long add_total_time = 0;
 
 namespace tflite {
+namespace {
+
+struct NodeData {
+  OpDataAdd op_data;
+#if ESP_NN
+  int buffer_idx;
+#endif
+};
+
+}  // namespace
 
 TfLiteStatus EvalAdd(TfLiteContext* context, TfLiteNode* node,
                      TfLiteAddParams* params, const OpDataAdd* data,
@@ -194,14 +204,40 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
 
 void* AddInit(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataAdd));
+  return context->AllocatePersistentBuffer(context, sizeof(NodeData));
+}
+
+static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(AddPrepare(context, node));
+
+#if ESP_NN
+  NodeData* data = static_cast<NodeData*>(node->user_data);
+  data->buffer_idx = -1;
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kAddOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  if (output->type == kTfLiteInt8 && !data->op_data.requires_broadcast) {
+    int scratch_buf_size = esp_nn_get_add_scratch_size(NumElements(output));
+    if (scratch_buf_size > 0) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, scratch_buf_size, &data->buffer_idx));
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(output);
+#endif
+  return kTfLiteOk;
 }
 
 TfLiteStatus AddEval(TfLiteContext* context, TfLiteNode* node) {
   auto* params = reinterpret_cast<TfLiteAddParams*>(node->builtin_data);
 
   TFLITE_DCHECK(node->user_data != nullptr);
-  const OpDataAdd* data = static_cast<const OpDataAdd*>(node->user_data);
+  const NodeData* node_data = static_cast<const NodeData*>(node->user_data);
+  const OpDataAdd* data = &node_data->op_data;
 
   const TfLiteEvalTensor* input1 =
       tflite::micro::GetEvalInput(context, node, kAddInputTensor1);
@@ -212,6 +248,14 @@ TfLiteStatus AddEval(TfLiteContext* context, TfLiteNode* node) {
 
   long long start_time = esp_timer_get_time();
 
+#if ESP_NN
+  void* scratch_buf = nullptr;
+  if (node_data->buffer_idx > -1) {
+    scratch_buf = context->GetScratchBuffer(context, node_data->buffer_idx);
+  }
+  esp_nn_set_add_scratch_buf(scratch_buf);
+#endif
+
   if (output->type == kTfLiteFloat32 || output->type == kTfLiteInt32) {
     TF_LITE_ENSURE_OK(
         context, EvalAdd(context, node, params, data, input1, input2, output));
@@ -229,7 +273,7 @@ TfLiteStatus AddEval(TfLiteContext* context, TfLiteNode* node) {
 }
 
 TFLMRegistration Register_ADD() {
-  return tflite::micro::RegisterOp(AddInit, AddPrepare, AddEval);
+  return tflite::micro::RegisterOp(AddInit, Prepare, AddEval);
 }
 
 }  // namespace tflite
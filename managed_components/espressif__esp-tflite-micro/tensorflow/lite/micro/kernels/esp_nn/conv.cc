@@ -28,6 +28,8 @@ limitations under the License.
 
 #if ESP_NN
 #include <esp_nn.h>
+
+#include "tensorflow/lite/micro/kernels/esp_nn/conv_specialized.h"
 #endif
 
 
@@ -40,6 +42,16 @@ struct NodeData {
   OpDataConv op_data;
 #if ESP_NN
   int buffer_idx;
+  // Shape-specialized kernel picked in Prepare, or nullptr for the generic
+  // esp_nn kernel.
+  EspNnConvFn specialized_fn;
+  // Winograd-domain filter built in Prepare, or nullptr if the layer runs a
+  // direct kernel, and the index of the Winograd kernel's scratch buffer.
+  const int16_t* winograd_filter;
+  int winograd_buffer_idx;
+  // Scratch buffer of the im2col engine, or -1 if the layer does not use it.
+  int im2col_buffer_idx;
+  int im2col_buffer_size;
 #endif
 };
 
@@ -158,6 +170,47 @@ static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     } else {
       data->buffer_idx = -1;
     }
+
+    data->specialized_fn = nullptr;
+    if (params.dilation_width_factor == 1 &&
+        params.dilation_height_factor == 1) {
+      data->specialized_fn =
+          SelectSpecializedConv(input_dims, filter_dims, conv_params);
+    }
+
+    // The filter is constant, so its Winograd transform is done once here.
+    data->winograd_filter = nullptr;
+    int16_t* winograd_filter = nullptr;
+    if (filter->type == kTfLiteInt8 && filter->data.int8 != nullptr &&
+        input_channels == filter_input_channels &&
+        params.dilation_width_factor == 1 &&
+        params.dilation_height_factor == 1 &&
+        UseWinogradConv(input_dims, filter_dims, output_dims, conv_params)) {
+      winograd_filter = static_cast<int16_t*>(
+          micro_context->AllocateOptionalPersistentBuffer(
+              esp_nn_get_conv_winograd_filter_size_opt(&input_dims,
+                                                       &output_dims)));
+    }
+    if (winograd_filter != nullptr) {
+      esp_nn_conv_winograd_transform_filter_opt(
+          &input_dims, filter->data.int8, &output_dims, winograd_filter);
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+          context, esp_nn_get_conv_winograd_scratch_size_opt(&input_dims),
+          &data->winograd_buffer_idx));
+      data->winograd_filter = winograd_filter;
+    }
+
+    data->im2col_buffer_idx = -1;
+    data->im2col_buffer_size = 0;
+    if (filter->type == kTfLiteInt8 && data->winograd_filter == nullptr &&
+        input_channels == filter_input_channels) {
+      data->im2col_buffer_size = Im2colConvScratchSize(
+          input_dims, filter_dims, output_dims, data->specialized_fn);
+    }
+    if (data->im2col_buffer_size > 0) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+          context, data->im2col_buffer_size, &data->im2col_buffer_idx));
+    }
   }
 #endif
 
@@ -178,100 +231,163 @@ inline void EvalQuantizedPerChannel(
   const int dilation_width_factor = params.dilation_width_factor;
   const int dilation_height_factor = params.dilation_height_factor;
 
-  if (dilation_width_factor == 1 && dilation_height_factor == 1) {
-    // Get parameters.
-    RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
-    RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
-    RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
-    RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
-
-    const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
-    int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
-
-    const int32_t input_offset = -data.op_data.input_zero_point;
-    const int32_t output_offset = data.op_data.output_zero_point;
-    const int stride_width = params.stride_width;
-    const int stride_height = params.stride_height;
-    const int pad_width = data.op_data.padding.width;
-    const int pad_height = data.op_data.padding.height;
-
-    const int input_height = input_shape.Dims(1);
-    const int input_width = input_shape.Dims(2);
-    const int filter_height = filter_shape.Dims(1);
-    const int filter_width = filter_shape.Dims(2);
-    const int output_height = output_shape.Dims(1);
-    const int output_width = output_shape.Dims(2);
-
-    // Set min and max value of the output.
-    const int32_t activation_min = data.op_data.output_activation_min;
-    const int32_t activation_max = data.op_data.output_activation_max;
-
-    // Consistency check.
-    TFLITE_DCHECK_LE(activation_min, activation_max);
-    TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
-    TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
-    TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
-    const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
-    const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-    const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-
-    if (tflite::micro::GetTensorData<int8_t>(bias)) {
-      TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
-    }
+  // Get parameters.
+  RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
+
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  const int32_t input_offset = -data.op_data.input_zero_point;
+  const int32_t output_offset = data.op_data.output_zero_point;
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = data.op_data.padding.width;
+  const int pad_height = data.op_data.padding.height;
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  // Set min and max value of the output.
+  const int32_t activation_min = data.op_data.output_activation_min;
+  const int32_t activation_max = data.op_data.output_activation_max;
+
+  // Consistency check.
+  TFLITE_DCHECK_LE(activation_min, activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+
+  if (tflite::micro::GetTensorData<int8_t>(bias)) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  }
 
-    void *scratch_buf = NULL;
-    if (data.buffer_idx > -1) {
-      scratch_buf = context->GetScratchBuffer(context, data.buffer_idx);
+  void *scratch_buf = NULL;
+  if (data.buffer_idx > -1) {
+    scratch_buf = context->GetScratchBuffer(context, data.buffer_idx);
+  }
+  esp_nn_set_conv_scratch_buf(scratch_buf);
+
+  const int input_size = input_width * input_height * input_depth;
+  const int output_size = output_width * output_height * output_depth;
+
+  data_dims_t input_dims =  {
+                              .width = input_width, .height = input_height,
+                              .channels = input_depth, .extra = 1
+                            };
+  data_dims_t output_dims = {
+                              .width = output_width, .height = output_height,
+                              .channels = output_depth, .extra = 1
+                            };
+  data_dims_t filter_dims = {
+                              .width = filter_width, .height = filter_height,
+                              .channels = 0, .extra = 0
+                            };
+  conv_params_t conv_params = {
+                                .in_offset = input_offset, .out_offset = output_offset,
+                                .stride = {stride_width, stride_height},
+                                .padding = {pad_width, pad_height},
+                                .dilation = {dilation_width_factor, dilation_height_factor},
+                                .activation = {activation_min, activation_max}
+                              };
+  quant_data_t quant_data = {
+                              .shift = data.op_data.per_channel_output_shift,
+                              .mult = data.op_data.per_channel_output_multiplier
+                            };
+
+  if (data.winograd_filter != nullptr) {
+    esp_nn_set_conv_winograd_scratch_buf_opt(
+        context->GetScratchBuffer(context, data.winograd_buffer_idx));
+    for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+      esp_nn_conv_s8_winograd_opt(
+          &input_dims, input_data + i_batch * input_size, data.winograd_filter,
+          tflite::micro::GetTensorData<int32_t>(bias), &output_dims,
+          output_data + i_batch * output_size, &conv_params, &quant_data);
     }
-    esp_nn_set_conv_scratch_buf(scratch_buf);
+    return;
+  }
 
-    const int input_size = input_width * input_height * input_depth;
-    const int output_size = output_width * output_height * output_depth;
+  // The im2col engine handles dilation; the specialized kernels and some
+  // targets' default kernel assume none.
+  EspNnConvFn conv_fn = esp_nn_conv_s8;
+  if (data.im2col_buffer_idx > -1) {
+    esp_nn_set_conv_im2col_scratch_buf_opt(
+        context->GetScratchBuffer(context, data.im2col_buffer_idx),
+        data.im2col_buffer_size);
+    conv_fn = esp_nn_conv_s8_im2col_opt;
+  } else if (dilation_width_factor != 1 || dilation_height_factor != 1) {
+    conv_fn = esp_nn_conv_dilated_s8;
+  } else if (data.specialized_fn != nullptr) {
+    conv_fn = data.specialized_fn;
+  }
+  for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+    conv_fn(&input_dims, input_data + i_batch * input_size,
+            &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+            tflite::micro::GetTensorData<int32_t>(bias),
+            &output_dims, output_data + i_batch * output_size,
+            &conv_params, &quant_data);
+  }
+}
 
-    data_dims_t input_dims =  {
-                                .width = input_width, .height = input_height,
-                                .channels = input_depth, .extra = 1
-                              };
-    data_dims_t output_dims = {
-                                .width = output_width, .height = output_height,
-                                .channels = output_depth, .extra = 1
+// 16x8 (int16 activations, int8 weights, int64 bias) convolution wrapper.
+// Eval only calls it without dilation or groups.
+inline void EvalQuantizedPerChannel16x8(
+    const TfLiteConvParams& params, const NodeData& data,
+    const TfLiteEvalTensor* input, const TfLiteEvalTensor* filter,
+    const TfLiteEvalTensor* bias, TfLiteEvalTensor* output) {
+  RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+
+  const int16_t *input_data = tflite::micro::GetTensorData<int16_t>(input);
+  int16_t *output_data = tflite::micro::GetTensorData<int16_t>(output);
+
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+
+  data_dims_t input_dims =  {
+                              .width = input_shape.Dims(2), .height = input_shape.Dims(1),
+                              .channels = input_depth, .extra = 1
+                            };
+  data_dims_t output_dims = {
+                              .width = output_shape.Dims(2), .height = output_shape.Dims(1),
+                              .channels = output_depth, .extra = 1
+                            };
+  data_dims_t filter_dims = {
+                              .width = filter_shape.Dims(2), .height = filter_shape.Dims(1),
+                              .channels = 0, .extra = 0
+                            };
+  conv_params_t conv_params = {
+                                .in_offset = 0, .out_offset = 0,
+                                .stride = {params.stride_width, params.stride_height},
+                                .padding = {data.op_data.padding.width, data.op_data.padding.height},
+                                .dilation = {0, 0},
+                                .activation = {data.op_data.output_activation_min,
+                                               data.op_data.output_activation_max}
                               };
-    data_dims_t filter_dims = {
-                                .width = filter_width, .height = filter_height,
-                                .channels = 0, .extra = 0
-                              };
-    conv_params_t conv_params = {
-                                  .in_offset = input_offset, .out_offset = output_offset,
-                                  .stride = {stride_width, stride_height},
-                                  .padding = {pad_width, pad_height},
-                                  .dilation = {0, 0},
-                                  .activation = {activation_min, activation_max}
-                                };
-    quant_data_t quant_data = {
-                                .shift = data.op_data.per_channel_output_shift,
-                                .mult = data.op_data.per_channel_output_multiplier
-                              };
-
-    for (int i_batch = 0; i_batch < batch_size; i_batch++) {
-      esp_nn_conv_s8(&input_dims, input_data + i_batch * input_size,
-                     &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
-                     tflite::micro::GetTensorData<int32_t>(bias),
-                     &output_dims, output_data + i_batch * output_size,
-                     &conv_params, &quant_data);
-    }
-  } else {
-    reference_integer_ops::ConvPerChannel(
-        ConvParamsQuantized(params, data.op_data),
-        data.op_data.per_channel_output_multiplier,
-        data.op_data.per_channel_output_shift,
-        tflite::micro::GetTensorShape(input),
-        tflite::micro::GetTensorData<int8_t>(input),
-        tflite::micro::GetTensorShape(filter),
-        tflite::micro::GetTensorData<int8_t>(filter),
-        tflite::micro::GetTensorShape(bias),
-        tflite::micro::GetTensorData<int32_t>(bias),
-        tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+  quant_data_t quant_data = {
+                              .shift = data.op_data.per_channel_output_shift,
+                              .mult = data.op_data.per_channel_output_multiplier
+                            };
+
+  const int input_size = input_dims.width * input_dims.height * input_depth;
+  const int output_size = output_dims.width * output_dims.height * output_depth;
+  for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+    esp_nn_conv_s16(&input_dims, input_data + i_batch * input_size,
+                    &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+                    tflite::micro::GetOptionalTensorData<int64_t>(bias),
+                    &output_dims, output_data + i_batch * output_size,
+                    &conv_params, &quant_data);
   }
 }
 #endif
@@ -311,6 +427,15 @@ static TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       break;
     }
     case kTfLiteInt16: {
+#if ESP_NN
+      if ((bias == nullptr || bias->type == kTfLiteInt64) &&
+          params.dilation_width_factor == 1 &&
+          params.dilation_height_factor == 1 &&
+          input->dims->data[3] == filter->dims->data[3]) {
+        EvalQuantizedPerChannel16x8(params, data, input, filter, bias, output);
+        break;
+      }
+#endif
       if (bias == nullptr || bias->type == kTfLiteInt32) {
         reference_integer_ops::ConvPerChannel(
             ConvParamsQuantized(params, data.op_data),
@@ -0,0 +1,373 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#if ESP_NN
+
+#include "tensorflow/lite/micro/kernels/esp_nn/conv_specialized.h"
+
+#include <algorithm>
+#include <cstdint>
+
+// The specialized kernels reproduce the generic esp_nn *_opt kernels. The
+// reference (ANSI) kernels round differently and the ESP32-S3/P4 kernels are
+// hand written assembly, so nothing is specialized for those builds.
+#if defined(CONFIG_NN_OPTIMIZED) && !defined(ARCH_ESP32_S3) && \
+    !defined(ARCH_ESP32_P4)
+#define ESP_NN_SPECIALIZED_CONV 1
+#else
+#define ESP_NN_SPECIALIZED_CONV 0
+#endif
+
+namespace tflite {
+namespace {
+
+#if ESP_NN_SPECIALIZED_CONV
+
+// Same arithmetic as esp_nn_multiply_by_quantized_mult_fast() followed by the
+// output offset and activation clamp of the *_opt kernels.
+inline int8_t Requantize(int32_t acc, int32_t mult, int32_t shift,
+                         int32_t out_offset, int32_t activation_min,
+                         int32_t activation_max) {
+  const int32_t left_shift = shift > 0 ? shift : 0;
+  const int32_t right_shift = left_shift - shift;
+  const int64_t shifted = static_cast<int32_t>(static_cast<uint32_t>(acc)
+                                               << left_shift);
+  int32_t result = static_cast<int32_t>((shifted * mult + (1 << 30)) >> 31);
+  if (right_shift) {
+    result = (result + (1 << (right_shift - 1)) - (result < 0)) >> right_shift;
+  }
+  result += out_offset;
+  result = std::max(result, activation_min);
+  result = std::min(result, activation_max);
+  return static_cast<int8_t>(result);
+}
+
+// Accumulates one output channel over the [y_start, y_end) x [x_start, x_end)
+// part of a kFilterH x kFilterW window whose top-left input element is at
+// `origin`. Interior windows pass the full, compile-time bounds, which lets
+// the compiler unroll the whole window.
+template <int kFilterW, int kCinMultiple>
+inline int32_t ConvWindow(const int8_t* input_data, int origin,
+                          const int8_t* filter, int input_wd, int in_channels,
+                          int32_t input_offset, int y_start, int y_end,
+                          int x_start, int x_end) {
+  int32_t acc = 0;
+  for (int fy = y_start; fy < y_end; fy++) {
+    for (int fx = x_start; fx < x_end; fx++) {
+      const int8_t* input_ptr =
+          input_data + (origin + (fy * input_wd + fx) * in_channels);
+      const int8_t* filter_ptr = filter + (fy * kFilterW + fx) * in_channels;
+      for (int in_ch = 0; in_ch < in_channels; in_ch += kCinMultiple) {
+        for (int i = 0; i < kCinMultiple; i++) {
+          acc += (input_ptr[in_ch + i] + input_offset) * filter_ptr[in_ch + i];
+        }
+      }
+    }
+  }
+  return acc;
+}
+
+// Convolution for a fixed filter size and stride whose input channel count is
+// a multiple of kCinMultiple. Filters are [out_ch][kh][kw][in_ch] as in
+// esp_nn_conv_s8_opt(), and padding is handled by clipping the window.
+template <int kFilterH, int kFilterW, int kStrideH, int kStrideW,
+          int kCinMultiple>
+struct Conv {
+  static void Run(const data_dims_t* input_dims, const int8_t* input_data,
+                  const data_dims_t* filter_dims, const int8_t* filter_data,
+                  const int32_t* bias, const data_dims_t* output_dims,
+                  int8_t* out_data, const conv_params_t* conv_params,
+                  const quant_data_t* quant_data) {
+    const int input_wd = input_dims->width;
+    const int input_ht = input_dims->height;
+    const int in_channels = input_dims->channels;
+    const int out_wd = output_dims->width;
+    const int out_ht = output_dims->height;
+    const int out_channels = output_dims->channels;
+    const int pad_wd = conv_params->padding.width;
+    const int pad_ht = conv_params->padding.height;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int filter_size = kFilterH * kFilterW * in_channels;
+
+    for (int out_y = 0; out_y < out_ht; out_y++) {
+      const int base_y = out_y * kStrideH - pad_ht;
+      const int y_start = std::max(0, -base_y);
+      const int y_end = std::min(kFilterH, input_ht - base_y);
+      for (int out_x = 0; out_x < out_wd; out_x++) {
+        const int base_x = out_x * kStrideW - pad_wd;
+        const int x_start = std::max(0, -base_x);
+        const int x_end = std::min(kFilterW, input_wd - base_x);
+        const bool interior = y_start == 0 && x_start == 0 &&
+                              y_end == kFilterH && x_end == kFilterW;
+        const int origin = (base_y * input_wd + base_x) * in_channels;
+
+        const int8_t* filter = filter_data;
+        for (int out_ch = 0; out_ch < out_channels; out_ch++) {
+          int32_t acc;
+          if (interior) {
+            acc = ConvWindow<kFilterW, kCinMultiple>(
+                input_data, origin, filter, input_wd, in_channels,
+                input_offset, 0, kFilterH, 0, kFilterW);
+          } else {
+            acc = ConvWindow<kFilterW, kCinMultiple>(
+                input_data, origin, filter, input_wd, in_channels,
+                input_offset, y_start, y_end, x_start, x_end);
+          }
+          if (bias) {
+            acc += bias[out_ch];
+          }
+          *out_data++ = Requantize(acc, quant_data->mult[out_ch],
+                                   quant_data->shift[out_ch], out_offset,
+                                   activation_min, activation_max);
+          filter += filter_size;
+        }
+      }
+    }
+  }
+};
+
+// 1x1 convolution: no padding or clipping, and four output channels share
+// every input load.
+template <int kStrideH, int kStrideW, int kCinMultiple>
+struct Conv<1, 1, kStrideH, kStrideW, kCinMultiple> {
+  static void Run(const data_dims_t* input_dims, const int8_t* input_data,
+                  const data_dims_t* filter_dims, const int8_t* filter_data,
+                  const int32_t* bias, const data_dims_t* output_dims,
+                  int8_t* out_data, const conv_params_t* conv_params,
+                  const quant_data_t* quant_data) {
+    const int input_wd = input_dims->width;
+    const int in_channels = input_dims->channels;
+    const int out_wd = output_dims->width;
+    const int out_ht = output_dims->height;
+    const int out_channels = output_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const int32_t* out_mult = quant_data->mult;
+    const int32_t* out_shift = quant_data->shift;
+
+    for (int out_y = 0; out_y < out_ht; out_y++) {
+      for (int out_x = 0; out_x < out_wd; out_x++) {
+        const int8_t* input_ptr =
+            input_data +
+            (out_y * kStrideH * input_wd + out_x * kStrideW) * in_channels;
+        const int8_t* filter = filter_data;
+        int out_ch = 0;
+        for (; out_ch < out_channels - 3; out_ch += 4) {
+          const int8_t* filter0 = filter;
+          const int8_t* filter1 = filter0 + in_channels;
+          const int8_t* filter2 = filter1 + in_channels;
+          const int8_t* filter3 = filter2 + in_channels;
+          int32_t acc0 = 0;
+          int32_t acc1 = 0;
+          int32_t acc2 = 0;
+          int32_t acc3 = 0;
+          for (int in_ch = 0; in_ch < in_channels; in_ch += kCinMultiple) {
+            for (int i = 0; i < kCinMultiple; i++) {
+              const int32_t input_val = input_ptr[in_ch + i] + input_offset;
+              acc0 += input_val * filter0[in_ch + i];
+              acc1 += input_val * filter1[in_ch + i];
+              acc2 += input_val * filter2[in_ch + i];
+              acc3 += input_val * filter3[in_ch + i];
+            }
+          }
+          if (bias) {
+            acc0 += bias[out_ch + 0];
+            acc1 += bias[out_ch + 1];
+            acc2 += bias[out_ch + 2];
+            acc3 += bias[out_ch + 3];
+          }
+          out_data[0] = Requantize(acc0, out_mult[out_ch + 0],
+                                   out_shift[out_ch + 0], out_offset,
+                                   activation_min, activation_max);
+          out_data[1] = Requantize(acc1, out_mult[out_ch + 1],
+                                   out_shift[out_ch + 1], out_offset,
+                                   activation_min, activation_max);
+          out_data[2] = Requantize(acc2, out_mult[out_ch + 2],
+                                   out_shift[out_ch + 2], out_offset,
+                                   activation_min, activation_max);
+          out_data[3] = Requantize(acc3, out_mult[out_ch + 3],
+                                   out_shift[out_ch + 3], out_offset,
+                                   activation_min, activation_max);
+          out_data += 4;
+          filter += 4 * in_channels;
+        }
+        for (; out_ch < out_channels; out_ch++) {
+          int32_t acc = 0;
+          for (int in_ch = 0; in_ch < in_channels; in_ch += kCinMultiple) {
+            for (int i = 0; i < kCinMultiple; i++) {
+              acc += (input_ptr[in_ch + i] + input_offset) * filter[in_ch + i];
+            }
+          }
+          if (bias) {
+            acc += bias[out_ch];
+          }
+          *out_data++ = Requantize(acc, out_mult[out_ch], out_shift[out_ch],
+                                   out_offset, activation_min, activation_max);
+          filter += in_channels;
+        }
+      }
+    }
+  }
+};
+
+// Dispatch table, searched in order. Add an entry here when a model brings a
+// new hot layer shape that neither the im2col engine nor Winograd takes;
+// anything unmatched runs the generic esp_nn kernel.
+struct ConvKernelEntry {
+  int filter_height;
+  int filter_width;
+  int stride_height;
+  int stride_width;
+  int channel_multiple;
+  EspNnConvFn fn;
+};
+
+// The 1x1 entries run on every pointwise layer of the model. The im2col
+// engine takes every larger filter (see Im2colConvScratchSize()), so the
+// 3x3/s2 entry for the 3-channel input layer is only the fallback for builds
+// with ESP_NN_CONV_IM2COL_SCRATCH_BYTES set to 0, where it is 1.39x the
+// generic kernel.
+const ConvKernelEntry kConvKernels[] = {
+    {1, 1, 1, 1, 16, Conv<1, 1, 1, 1, 16>::Run},
+    {1, 1, 1, 1, 8, Conv<1, 1, 1, 1, 8>::Run},
+    {3, 3, 2, 2, 3, Conv<3, 3, 2, 2, 3>::Run},
+};
+
+bool Matches(const ConvKernelEntry& entry, const data_dims_t& input_dims,
+             const data_dims_t& filter_dims, int stride_width,
+             int stride_height) {
+  return entry.filter_height == filter_dims.height &&
+         entry.filter_width == filter_dims.width &&
+         entry.stride_height == stride_height &&
+         entry.stride_width == stride_width &&
+         input_dims.channels % entry.channel_multiple == 0;
+}
+
+// Measured against the kernel each layer would otherwise run (im2col, or the
+// direct kernel when the im2col block holds fewer than two pixels) with the
+// C kernels built for the host: the Winograd transforms cost more than they
+// save with fewer than 4 input channels or a single output channel, and
+// above 128 input channels the direct kernel stays faster unless there is at
+// least one output channel per 32 input channels.
+constexpr int kMinWinogradInputChannels = 4;
+constexpr int kMinWinogradOutputChannels = 2;
+constexpr int kWinogradDeepInputChannels = 128;
+constexpr int kWinogradInputChannelsPerOutputChannel = 32;
+
+// Largest padded input copy, in bytes, a depthwise layer requests from the
+// arena.
+constexpr int kMaxPaddedInputBytes = 64 * 1024;
+
+#endif  // ESP_NN_SPECIALIZED_CONV
+
+}  // namespace
+
+EspNnConvFn SelectSpecializedConv(const data_dims_t& input_dims,
+                                  const data_dims_t& filter_dims,
+                                  const conv_params_t& conv_params) {
+#if ESP_NN_SPECIALIZED_CONV
+  for (const ConvKernelEntry& entry : kConvKernels) {
+    if (Matches(entry, input_dims, filter_dims, conv_params.stride.width,
+                conv_params.stride.height)) {
+      return entry.fn;
+    }
+  }
+#endif
+  return nullptr;
+}
+
+bool UseWinogradConv(const data_dims_t& input_dims,
+                     const data_dims_t& filter_dims,
+                     const data_dims_t& output_dims,
+                     const conv_params_t& conv_params) {
+#if ESP_NN_SPECIALIZED_CONV
+  if (input_dims.channels < kMinWinogradInputChannels ||
+      output_dims.channels < kMinWinogradOutputChannels) {
+    return false;
+  }
+  if (input_dims.channels > kWinogradDeepInputChannels &&
+      output_dims.channels * kWinogradInputChannelsPerOutputChannel <
+          input_dims.channels) {
+    return false;
+  }
+  return esp_nn_conv_s8_winograd_supported_opt(&input_dims, &filter_dims,
+                                               &conv_params) &&
+         output_dims.width >= 2 && output_dims.height >= 2;
+#else
+  return false;
+#endif
+}
+
+int Im2colConvScratchSize(const data_dims_t& input_dims,
+                          const data_dims_t& filter_dims,
+                          const data_dims_t& output_dims,
+                          EspNnConvFn specialized_fn) {
+#if ESP_NN_SPECIALIZED_CONV
+  const bool is_1x1 = filter_dims.width == 1 && filter_dims.height == 1;
+  if (is_1x1 && specialized_fn != nullptr) {
+    return 0;
+  }
+  const int out_pixels = output_dims.width * output_dims.height;
+  const int fixed_size = esp_nn_get_conv_im2col_scratch_size_opt(
+      &input_dims, &filter_dims, &output_dims, 0);
+  const int patch_size = esp_nn_get_conv_im2col_scratch_size_opt(
+                             &input_dims, &filter_dims, &output_dims, 1) -
+                         fixed_size;
+  const int block_pixels = std::min(
+      out_pixels, (ESP_NN_CONV_IM2COL_SCRATCH_BYTES - fixed_size) / patch_size);
+  if (block_pixels < 2) {
+    return 0;
+  }
+  return fixed_size + block_pixels * patch_size;
+#else
+  return 0;
+#endif
+}
+
+bool UsePaddedDepthwiseConv(const data_dims_t& input_dims,
+                            const data_dims_t& filter_dims,
+                            const data_dims_t& output_dims,
+                            const dw_conv_params_t& conv_params,
+                            int* padded_bytes) {
+  *padded_bytes = 0;
+#if ESP_NN_SPECIALIZED_CONV
+  if (conv_params.ch_mult != 1 || filter_dims.width != 3 ||
+      filter_dims.height != 3) {
+    return false;
+  }
+  data_dims_t padded_dims;
+  esp_nn_get_depthwise_conv_padded_dims_opt(&input_dims, &output_dims,
+                                            &conv_params, &padded_dims);
+  if (conv_params.padding.width == 0 && conv_params.padding.height == 0 &&
+      padded_dims.width <= input_dims.width &&
+      padded_dims.height <= input_dims.height) {
+    return true;
+  }
+  *padded_bytes =
+      padded_dims.width * padded_dims.height * padded_dims.channels;
+  return *padded_bytes <= kMaxPaddedInputBytes;
+#else
+  return false;
+#endif
+}
+
+}  // namespace tflite
+
+#endif  // ESP_NN
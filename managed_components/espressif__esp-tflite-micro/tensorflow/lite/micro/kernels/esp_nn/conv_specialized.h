@@ -0,0 +1,99 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_ESP_NN_CONV_SPECIALIZED_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_ESP_NN_CONV_SPECIALIZED_H_
+
+#include <esp_nn.h>
+
+// Scratch arena, in bytes, a convolution may request for the im2col engine's
+// patch block; 0 turns the engine off.
+#ifndef ESP_NN_CONV_IM2COL_SCRATCH_BYTES
+#define ESP_NN_CONV_IM2COL_SCRATCH_BYTES (4 * 1024)
+#endif
+
+namespace tflite {
+
+// Same signatures as esp_nn_conv_s8() and esp_nn_depthwise_conv_s8(), so a
+// kernel wrapper can pick the kernel it calls once per layer.
+typedef void (*EspNnConvFn)(const data_dims_t* input_dims,
+                            const int8_t* input_data,
+                            const data_dims_t* filter_dims,
+                            const int8_t* filter_data, const int32_t* bias,
+                            const data_dims_t* output_dims, int8_t* out_data,
+                            const conv_params_t* conv_params,
+                            const quant_data_t* quant_data);
+
+typedef void (*EspNnDepthwiseConvFn)(const data_dims_t* input_dims,
+                                     const int8_t* input_data,
+                                     const data_dims_t* filter_dims,
+                                     const int8_t* filter_data,
+                                     const int32_t* bias,
+                                     const data_dims_t* output_dims,
+                                     int8_t* out_data,
+                                     const dw_conv_params_t* conv_params,
+                                     const quant_data_t* quant_data);
+
+// Returns a convolution kernel compiled for this layer's filter size, stride
+// and input channel multiple, or nullptr if the dispatch table has no match
+// and the generic esp_nn_conv_s8() should be used. Only dilation 1 layers may
+// use the result. The specialized kernels are bit-exact with
+// esp_nn_conv_s8_opt() and are only offered when that is the kernel ESP-NN
+// would run; the ESP32-S3/P4 assembly kernels are always kept.
+EspNnConvFn SelectSpecializedConv(const data_dims_t& input_dims,
+                                  const data_dims_t& filter_dims,
+                                  const conv_params_t& conv_params);
+
+// Returns true if a dilation 1 layer should run esp_nn_conv_s8_winograd_opt()
+// with a filter transformed in Prepare. Like the specialized kernels it is
+// bit-exact with esp_nn_conv_s8_opt() and only offered when that is the
+// kernel ESP-NN would run. Layers whose output is smaller than one 2x2 tile
+// in either dimension, and layers with too few input or output channels for
+// the transforms to pay off, keep the direct kernel. The transformed filter
+// (3.6x the int8 filter) comes from the interpreter's optional persistent
+// budget, see MicroInterpreter::SetOptionalPersistentBudget(); a layer that
+// does not fit in what is left of it keeps the direct kernel too.
+bool UseWinogradConv(const data_dims_t& input_dims,
+                     const data_dims_t& filter_dims,
+                     const data_dims_t& output_dims,
+                     const conv_params_t& conv_params);
+
+// Returns the scratch size, in bytes, esp_nn_conv_s8_im2col_opt() should get
+// for this layer, or 0 if it should keep `specialized_fn` (the result of
+// SelectSpecializedConv()) or the generic kernel. Measured on the model's
+// layers the im2col engine wins on every filter larger than 1x1 and ties the
+// specialized 1x1 kernels, so it takes larger filters and the 1x1 layers
+// without a specialized kernel. The patch block holds as many output pixels
+// as ESP_NN_CONV_IM2COL_SCRATCH_BYTES allows, and at least two.
+int Im2colConvScratchSize(const data_dims_t& input_dims,
+                          const data_dims_t& filter_dims,
+                          const data_dims_t& output_dims,
+                          EspNnConvFn specialized_fn);
+
+// Returns true if a dilation 1 depthwise layer should run
+// esp_nn_depthwise_conv_s8_3x3_padded_opt(), which is bit-exact with and
+// faster than esp_nn_depthwise_conv_s8_opt(). `*padded_bytes` is set to the
+// size of the zero-point bordered copy of the input the layer needs, or 0 if
+// every filter window already lies inside the input and the kernel can read
+// it in place.
+bool UsePaddedDepthwiseConv(const data_dims_t& input_dims,
+                            const data_dims_t& filter_dims,
+                            const data_dims_t& output_dims,
+                            const dw_conv_params_t& conv_params,
+                            int* padded_bytes);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_ESP_NN_CONV_SPECIALIZED_H_
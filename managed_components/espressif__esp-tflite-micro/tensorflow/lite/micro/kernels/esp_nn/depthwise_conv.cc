@@ -28,6 +28,8 @@ limitations under the License.
 
 #if ESP_NN
 #include <esp_nn.h>
+
+#include "tensorflow/lite/micro/kernels/esp_nn/conv_specialized.h"
 #endif
 
 long long dc_total_time = 0;
@@ -39,6 +41,12 @@ struct NodeData {
   OpDataConv op_data;
 #if ESP_NN
   int buffer_idx;
+  // Set if the layer runs the pre-padded 3x3 kernel. The input is copied
+  // into the scratch buffer at padded_buffer_idx with a zero-point border,
+  // or read in place if the index is -1.
+  bool use_padded_kernel;
+  int padded_buffer_idx;
+  data_dims_t padded_dims;
 #endif
 };
 
@@ -59,103 +67,175 @@ inline void EvalQuantizedPerChannel(TfLiteContext* context, TfLiteNode* node,
   const int dilation_width_factor = params.dilation_width_factor;
   const int dilation_height_factor = params.dilation_height_factor;
 
-  if (dilation_width_factor == 1 && dilation_height_factor == 1) {
-    // Get parameters.
-    RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
-    RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
-    RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
-    RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
-
-    TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
-    TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
-    TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
-
-    const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
-    int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
-
-    const int depth_multiplier = params.depth_multiplier;
-    const int32_t input_offset = -data.op_data.input_zero_point;
-    const int32_t output_offset = data.op_data.output_zero_point;
-    const int stride_width = params.stride_width;
-    const int stride_height = params.stride_height;
-    const int pad_width = data.op_data.padding.width;
-    const int pad_height = data.op_data.padding.height;
-
-    const int input_height = input_shape.Dims(1);
-    const int input_width = input_shape.Dims(2);
-    const int input_depth = input_shape.Dims(3);
-    const int filter_height = filter_shape.Dims(1);
-    const int filter_width = filter_shape.Dims(2);
-    const int output_height = output_shape.Dims(1);
-    const int output_width = output_shape.Dims(2);
-
-    // Set min and max value of the output.
-    const int32_t activation_min = data.op_data.output_activation_min;
-    const int32_t activation_max = data.op_data.output_activation_max;
-
-    // Consistency check.
-    TFLITE_DCHECK_LE(activation_min, activation_max);
-    const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
-    const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
-
-    TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
-    if (tflite::micro::GetTensorData<int8_t>(bias)) {
-      TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
-    }
-
-    const int input_size = input_width * input_height * input_depth;
-    const int output_size = output_width * output_height * output_depth;
-    void *scratch_buf = NULL;
-    if (data.buffer_idx > -1) {
-      scratch_buf = context->GetScratchBuffer(context, data.buffer_idx);
-    }
-
-    esp_nn_set_depthwise_conv_scratch_buf(scratch_buf);
+  // Get parameters.
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  RuntimeShape bias_shape = tflite::micro::GetTensorShape(bias);
+
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = -data.op_data.input_zero_point;
+  const int32_t output_offset = data.op_data.output_zero_point;
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = data.op_data.padding.width;
+  const int pad_height = data.op_data.padding.height;
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  // Set min and max value of the output.
+  const int32_t activation_min = data.op_data.output_activation_min;
+  const int32_t activation_max = data.op_data.output_activation_max;
+
+  // Consistency check.
+  TFLITE_DCHECK_LE(activation_min, activation_max);
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+
+  TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
+  if (tflite::micro::GetTensorData<int8_t>(bias)) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  }
 
-    data_dims_t input_dims =  {
-                                .width = input_width, .height = input_height,
-                                .channels = input_depth, .extra = 1
-                              };
-    data_dims_t output_dims = {
-                                .width = output_width, .height = output_height,
-                                .channels = output_depth, .extra = 1
-                              };
-    data_dims_t filter_dims = {
-                                .width = filter_width, .height = filter_height,
-                                .channels = 0, .extra = 0
-                              };
-    dw_conv_params_t conv_params =  {
-                                      .in_offset = input_offset, .out_offset = output_offset,
-                                      .ch_mult = depth_multiplier,
-                                      .stride = {stride_width, stride_height},
-                                      .padding = {pad_width, pad_height}, .dilation = {0, 0},
-                                      .activation = {activation_min, activation_max}
-                                    };
-    quant_data_t quant_data = {
-                                .shift = data.op_data.per_channel_output_shift,
-                                .mult = data.op_data.per_channel_output_multiplier
-                              };
+  const int input_size = input_width * input_height * input_depth;
+  const int output_size = output_width * output_height * output_depth;
+  void *scratch_buf = NULL;
+  if (data.buffer_idx > -1) {
+    scratch_buf = context->GetScratchBuffer(context, data.buffer_idx);
+  }
 
+  esp_nn_set_depthwise_conv_scratch_buf(scratch_buf);
+
+  data_dims_t input_dims =  {
+                              .width = input_width, .height = input_height,
+                              .channels = input_depth, .extra = 1
+                            };
+  data_dims_t output_dims = {
+                              .width = output_width, .height = output_height,
+                              .channels = output_depth, .extra = 1
+                            };
+  data_dims_t filter_dims = {
+                              .width = filter_width, .height = filter_height,
+                              .channels = 0, .extra = 0
+                            };
+  dw_conv_params_t conv_params =  {
+                                    .in_offset = input_offset, .out_offset = output_offset,
+                                    .ch_mult = depth_multiplier,
+                                    .stride = {stride_width, stride_height},
+                                    .padding = {pad_width, pad_height}, .dilation = {dilation_width_factor, dilation_height_factor},
+                                    .activation = {activation_min, activation_max}
+                                  };
+  quant_data_t quant_data = {
+                              .shift = data.op_data.per_channel_output_shift,
+                              .mult = data.op_data.per_channel_output_multiplier
+                            };
+
+  if (data.use_padded_kernel) {
+    int8_t* padded_data = nullptr;
+    int row_pitch = input_width * input_depth;
+    if (data.padded_buffer_idx > -1) {
+      padded_data = static_cast<int8_t*>(
+          context->GetScratchBuffer(context, data.padded_buffer_idx));
+      row_pitch = data.padded_dims.width * input_depth;
+    }
     for (int i_batch = 0; i_batch < batch_size; i_batch++) {
-      esp_nn_depthwise_conv_s8(&input_dims, input_data + i_batch * input_size,
-                               &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
-                               tflite::micro::GetTensorData<int32_t>(bias),
-                               &output_dims, output_data + i_batch * output_size,
-                               &conv_params, &quant_data);
+      const int8_t* batch_input = input_data + i_batch * input_size;
+      if (padded_data != nullptr) {
+        esp_nn_depthwise_conv_pad_input_s8_opt(&input_dims, batch_input,
+                                               &conv_params, &data.padded_dims,
+                                               row_pitch, padded_data);
+        batch_input = padded_data;
+      }
+      esp_nn_depthwise_conv_s8_3x3_padded_opt(
+          &data.padded_dims, batch_input, row_pitch,
+          tflite::micro::GetTensorData<int8_t>(filter),
+          tflite::micro::GetTensorData<int32_t>(bias), &output_dims,
+          output_data + i_batch * output_size, &conv_params, &quant_data);
     }
-  } else {
-    reference_integer_ops::DepthwiseConvPerChannel(
-        DepthwiseConvParamsQuantized(params, data.op_data),
-        data.op_data.per_channel_output_multiplier,
-        data.op_data.per_channel_output_shift,
-        tflite::micro::GetTensorShape(input),
-        tflite::micro::GetTensorData<int8_t>(input),
-        tflite::micro::GetTensorShape(filter),
-        tflite::micro::GetTensorData<int8_t>(filter),
-        tflite::micro::GetTensorShape(bias),
-        tflite::micro::GetTensorData<int32_t>(bias),
-        tflite::micro::GetTensorShape(output),
-        tflite::micro::GetTensorData<int8_t>(output));
+    return;
+  }
+
+  // Some targets' default kernel assumes no dilation.
+  EspNnDepthwiseConvFn conv_fn = esp_nn_depthwise_conv_s8;
+  if (dilation_width_factor != 1 || dilation_height_factor != 1) {
+    conv_fn = esp_nn_depthwise_conv_dilated_s8;
+  }
+  for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+    conv_fn(&input_dims, input_data + i_batch * input_size,
+            &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+            tflite::micro::GetTensorData<int32_t>(bias),
+            &output_dims, output_data + i_batch * output_size,
+            &conv_params, &quant_data);
+  }
+}
+
+// 16x8 (int16 activations, int8 weights, int64 bias) depthwise convolution
+// wrapper. Eval only calls it without dilation.
+inline void EvalQuantizedPerChannel16x8(const TfLiteDepthwiseConvParams& params,
+                                        const NodeData& data,
+                                        const TfLiteEvalTensor* input,
+                                        const TfLiteEvalTensor* filter,
+                                        const TfLiteEvalTensor* bias,
+                                        TfLiteEvalTensor* output) {
+  RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+
+  const int16_t *input_data = tflite::micro::GetTensorData<int16_t>(input);
+  int16_t *output_data = tflite::micro::GetTensorData<int16_t>(output);
+
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = input_shape.Dims(3);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  TFLITE_DCHECK_EQ(output_depth, input_depth * params.depth_multiplier);
+
+  data_dims_t input_dims =  {
+                              .width = input_shape.Dims(2), .height = input_shape.Dims(1),
+                              .channels = input_depth, .extra = 1
+                            };
+  data_dims_t output_dims = {
+                              .width = output_shape.Dims(2), .height = output_shape.Dims(1),
+                              .channels = output_depth, .extra = 1
+                            };
+  data_dims_t filter_dims = {
+                              .width = filter_shape.Dims(2), .height = filter_shape.Dims(1),
+                              .channels = 0, .extra = 0
+                            };
+  dw_conv_params_t conv_params =  {
+                                    .in_offset = 0, .out_offset = 0,
+                                    .ch_mult = params.depth_multiplier,
+                                    .stride = {params.stride_width, params.stride_height},
+                                    .padding = {data.op_data.padding.width, data.op_data.padding.height},
+                                    .dilation = {0, 0},
+                                    .activation = {data.op_data.output_activation_min,
+                                                   data.op_data.output_activation_max}
+                                  };
+  quant_data_t quant_data = {
+                              .shift = data.op_data.per_channel_output_shift,
+                              .mult = data.op_data.per_channel_output_multiplier
+                            };
+
+  const int input_size = input_dims.width * input_dims.height * input_depth;
+  const int output_size = output_dims.width * output_dims.height * output_depth;
+  for (int i_batch = 0; i_batch < batch_size; i_batch++) {
+    esp_nn_depthwise_conv_s16(&input_dims, input_data + i_batch * input_size,
+                              &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+                              tflite::micro::GetOptionalTensorData<int64_t>(bias),
+                              &output_dims, output_data + i_batch * output_size,
+                              &conv_params, &quant_data);
   }
 }
 #endif
@@ -283,6 +363,24 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     } else {
       data->buffer_idx = -1;
     }
+
+    // Padding is applied once per Invoke into a bordered copy of the input,
+    // so the kernel needs no per-pixel clamping.
+    int padded_bytes = 0;
+    data->use_padded_kernel =
+        filter->type == kTfLiteInt8 && params.dilation_width_factor == 1 &&
+        params.dilation_height_factor == 1 &&
+        UsePaddedDepthwiseConv(input_dims, filter_dims, output_dims,
+                               conv_params, &padded_bytes);
+    data->padded_buffer_idx = -1;
+    if (data->use_padded_kernel) {
+      esp_nn_get_depthwise_conv_padded_dims_opt(
+          &input_dims, &output_dims, &conv_params, &data->padded_dims);
+      if (padded_bytes > 0) {
+        TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+            context, padded_bytes, &data->padded_buffer_idx));
+      }
+    }
   }
 #endif
 
@@ -380,6 +478,14 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteInt16: {
       switch (filter->type) {
         case kTfLiteInt8: {
+#if ESP_NN
+          if (params.dilation_width_factor == 1 &&
+              params.dilation_height_factor == 1) {
+            EvalQuantizedPerChannel16x8(params, data, input, filter, bias,
+                                        output);
+            break;
+          }
+#endif
           reference_integer_ops::DepthwiseConvPerChannel(
               DepthwiseConvParamsQuantized(params, data.op_data),
               data.op_data.per_channel_output_multiplier,
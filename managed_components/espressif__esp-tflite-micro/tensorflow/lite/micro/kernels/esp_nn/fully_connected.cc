@@ -260,6 +260,41 @@ TfLiteStatus FullyConnectedEval(TfLiteContext* context, TfLiteNode* node) {
     case kTfLiteInt16: {
       switch (filter->type) {
         case kTfLiteInt8: {
+#if ESP_NN
+          // 16x8 quantization is symmetric; the esp_nn kernel has no offsets.
+          if (!data.is_per_channel && data.input_zero_point == 0 &&
+              data.filter_zero_point == 0 && data.output_zero_point == 0) {
+            const RuntimeShape& filter_shape = tflite::micro::GetTensorShape(filter);
+            const RuntimeShape& output_shape = tflite::micro::GetTensorShape(output);
+
+            TFLITE_DCHECK_GE(filter_shape.DimensionsCount(), 2);
+            TFLITE_DCHECK_GE(output_shape.DimensionsCount(), 1);
+            const int filter_dim_count = filter_shape.DimensionsCount();
+            const int output_dim_count = output_shape.DimensionsCount();
+            const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+            const int output_depth = output_shape.Dims(output_dim_count - 1);
+            TFLITE_DCHECK_LE(output_depth, filter_shape.Dims(filter_dim_count - 2));
+            const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+            const int64_t* bias_data =
+                tflite::micro::GetOptionalTensorData<int64_t>(bias);
+
+            const int16_t *input_data = tflite::micro::GetTensorData<int16_t>(input);
+            int16_t *output_data = tflite::micro::GetTensorData<int16_t>(output);
+            const int8_t *filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+
+            for (int b = 0; b < batches; ++b) {
+              esp_nn_fully_connected_s16(input_data, accum_depth, filter_data,
+                                         bias_data, output_data, output_depth,
+                                         data.output_shift, data.output_multiplier,
+                                         data.output_activation_min,
+                                         data.output_activation_max);
+              input_data += accum_depth;
+              output_data += output_depth;
+            }
+            break;
+          }
+#endif
           tflite::reference_integer_ops::FullyConnected(
               FullyConnectedParamsQuantized(data),
               tflite::micro::GetTensorShape(input),
@@ -0,0 +1,218 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/kernels/internal/reference/resize_bilinear.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/op_macros.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_utils.h"
+
+#include <esp_timer.h>
+
+#if ESP_NN
+#include <esp_nn.h>
+#endif
+
+long long resize_bilinear_total_time = 0;
+
+namespace tflite {
+namespace {
+
+constexpr int kInputTensor = 0;
+constexpr int kSizeTensor = 1;
+constexpr int kOutputTensor = 0;
+
+struct NodeData {
+  // Offsets and weights for the (input, output) size pair of this node,
+  // built once in Prepare. Only set for int8/uint8 with ESP_NN.
+  void* table;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(NodeData));
+}
+
+TfLiteStatus ResizeBilinearPrepare(TfLiteContext* context, TfLiteNode* node) {
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TF_LITE_ENSURE_EQ(context, NumInputs(node), 2);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* size =
+      micro_context->AllocateTempInputTensor(node, kSizeTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+
+  TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, NumDimensions(size), 1);
+
+  TF_LITE_ENSURE_EQ(context, size->type, kTfLiteInt32);
+  output->type = input->type;
+
+  TF_LITE_ENSURE_MSG(context, IsConstantTensor(size),
+                     "Non-constant >size< tensor is not supported");
+
+  // Ensure params are valid.
+  auto* params =
+      reinterpret_cast<TfLiteResizeBilinearParams*>(node->builtin_data);
+  if (params->half_pixel_centers && params->align_corners) {
+    MicroPrintf("If half_pixel_centers is True, align_corners must be False.");
+    return kTfLiteError;
+  }
+
+  NodeData* data = static_cast<NodeData*>(node->user_data);
+  data->table = nullptr;
+#if ESP_NN
+  if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) {
+    const int32_t* size_data = GetTensorData<int32_t>(size);
+    data_dims_t input_dims = {
+      .width = SizeOfDimension(input, 2), .height = SizeOfDimension(input, 1),
+      .channels = SizeOfDimension(input, 3), .extra = 1
+    };
+    data_dims_t output_dims = {
+      .width = size_data[1], .height = size_data[0],
+      .channels = SizeOfDimension(input, 3), .extra = 1
+    };
+    resize_params_t resize_params = {
+      .align_corners = params->align_corners,
+      .half_pixel_centers = params->half_pixel_centers
+    };
+    data->table = context->AllocatePersistentBuffer(
+        context, esp_nn_get_resize_bilinear_table_size_opt(&input_dims,
+                                                           &output_dims));
+    TF_LITE_ENSURE(context, data->table != nullptr);
+    esp_nn_resize_bilinear_init_table_opt(data->table, &input_dims,
+                                          &output_dims, &resize_params);
+  }
+#endif
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(size);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+#if ESP_NN
+inline void CropResize(void* table, const data_dims_t* input_dims,
+                       const int8_t* input_data, const roi_t* roi,
+                       int8_t* output_data) {
+  esp_nn_crop_resize_bilinear_s8_opt(table, input_dims, input_data, roi, 1,
+                                     output_data);
+}
+
+inline void CropResize(void* table, const data_dims_t* input_dims,
+                       const uint8_t* input_data, const roi_t* roi,
+                       uint8_t* output_data) {
+  esp_nn_crop_resize_bilinear_u8_opt(table, input_dims, input_data, roi, 1,
+                                     output_data);
+}
+#endif
+
+template <typename T>
+void ResizeBilinearQuantized(const TfLiteResizeBilinearParams* params,
+                             const NodeData* data,
+                             const TfLiteEvalTensor* input,
+                             const TfLiteEvalTensor* size,
+                             TfLiteEvalTensor* output) {
+#if ESP_NN
+  // Each batch is a single full frame roi of the table built in Prepare.
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_size = input_shape.FlatSize() / batches;
+  const int output_size = output_shape.FlatSize() / batches;
+  const data_dims_t input_dims = {
+    .width = input_shape.Dims(2), .height = input_shape.Dims(1),
+    .channels = input_shape.Dims(3), .extra = 1
+  };
+  const roi_t roi = {
+    .x = 0, .y = 0, .width = input_shape.Dims(2), .height = input_shape.Dims(1)
+  };
+  const T* input_data = tflite::micro::GetTensorData<T>(input);
+  T* output_data = tflite::micro::GetTensorData<T>(output);
+
+  for (int b = 0; b < batches; ++b) {
+    CropResize(data->table, &input_dims, input_data + b * input_size, &roi,
+               output_data + b * output_size);
+  }
+#else
+  tflite::ResizeBilinearParams op_params;
+  op_params.align_corners = params->align_corners;
+  op_params.half_pixel_centers = params->half_pixel_centers;
+  reference_ops::ResizeBilinearInteger(
+      op_params, tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<T>(input),
+      tflite::micro::GetTensorShape(size),
+      tflite::micro::GetTensorData<int32_t>(size),
+      tflite::micro::GetTensorShape(output),
+      tflite::micro::GetTensorData<T>(output));
+#endif
+}
+
+TfLiteStatus ResizeBilinearEval(TfLiteContext* context, TfLiteNode* node) {
+  auto* params =
+      reinterpret_cast<TfLiteResizeBilinearParams*>(node->builtin_data);
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const NodeData* data = static_cast<const NodeData*>(node->user_data);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, kInputTensor);
+  const TfLiteEvalTensor* size =
+      tflite::micro::GetEvalInput(context, node, kSizeTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  long long start_time = esp_timer_get_time();
+
+  if (output->type == kTfLiteFloat32) {
+    tflite::ResizeBilinearParams op_params;
+    op_params.align_corners = params->align_corners;
+    op_params.half_pixel_centers = params->half_pixel_centers;
+    reference_ops::ResizeBilinear(op_params,
+                                  tflite::micro::GetTensorShape(input),
+                                  tflite::micro::GetTensorData<float>(input),
+                                  tflite::micro::GetTensorShape(size),
+                                  tflite::micro::GetTensorData<int32_t>(size),
+                                  tflite::micro::GetTensorShape(output),
+                                  tflite::micro::GetTensorData<float>(output));
+  } else if (output->type == kTfLiteInt8) {
+    ResizeBilinearQuantized<int8_t>(params, data, input, size, output);
+  } else if (output->type == kTfLiteUInt8) {
+    ResizeBilinearQuantized<uint8_t>(params, data, input, size, output);
+  } else {
+    MicroPrintf("Output type is %d, requires float, int8 or uint8.",
+                output->type);
+    return kTfLiteError;
+  }
+  resize_bilinear_total_time += esp_timer_get_time() - start_time;
+
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration Register_RESIZE_BILINEAR() {
+  return tflite::micro::RegisterOp(Init, ResizeBilinearPrepare,
+                                   ResizeBilinearEval);
+}
+
+}  // namespace tflite
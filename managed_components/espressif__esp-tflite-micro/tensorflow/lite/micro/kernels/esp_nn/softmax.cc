@@ -38,11 +38,17 @@ namespace tflite {
 namespace {
 // Softmax parameter data that persists in user_data
 const int kInt16LUTArraySize = 513;
+#if ESP_NN
+// Up to this depth int8 rows go through a precomputed exp() table: with so
+// few elements per row, computing exp() dominates the op.
+const int kExpLutMaxDepth = 16;
+#endif
 
 struct NodeData {
   SoftmaxParams op_data;
 #if ESP_NN
   int buffer_idx;
+  const int32_t* exp_lut;
 #endif
 };
 
@@ -74,6 +80,11 @@ void SoftmaxQuantized(TfLiteContext* context, const TfLiteEvalTensor* input,
           MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
       const int8_t *in_ptr = tflite::micro::GetTensorData<int8_t>(input);
       int8_t *out_ptr = tflite::micro::GetTensorData<int8_t>(output);
+      if (data->exp_lut != nullptr) {
+        esp_nn_softmax_s8_lut_opt(in_ptr, outer_size, depth, data->exp_lut,
+                                  out_ptr);
+        return;
+      }
       void *scratch_buf = NULL;
       if (data->buffer_idx > -1) {
         scratch_buf = context->GetScratchBuffer(context, data->buffer_idx);
@@ -149,7 +160,17 @@ static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       CalculateSoftmaxParams(context, input, output, params, op_data);
 
 #if ESP_NN
-  if (output->type == kTfLiteInt8 && input->type == kTfLiteInt8) {
+  data->buffer_idx = -1;
+  data->exp_lut = nullptr;
+  if (output->type == kTfLiteInt8 && input->type == kTfLiteInt8 &&
+      SizeOfDimension(input, NumDimensions(input) - 1) <= kExpLutMaxDepth) {
+    int32_t* exp_lut = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+        context, ESP_NN_SOFTMAX_LUT_SIZE * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, exp_lut != nullptr);
+    esp_nn_softmax_init_lut_opt(exp_lut, op_data->input_multiplier,
+                                op_data->input_left_shift, op_data->diff_min);
+    data->exp_lut = exp_lut;
+  } else if (output->type == kTfLiteInt8 && input->type == kTfLiteInt8) {
     const int32_t input_width = input->dims->data[1];
     const int32_t input_height = input->dims->data[2];
     int scratch_buf_size = esp_nn_get_softmax_scratch_size(input_width,
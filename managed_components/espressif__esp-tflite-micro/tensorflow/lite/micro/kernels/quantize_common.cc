@@ -84,6 +84,12 @@ TfLiteStatus PrepareQuantizeReference(TfLiteContext* context,
 
   data->input_zero_point = input->params.zero_point;
 
+  // Quantize and requantize are element-wise. The planner shares the buffer
+  // when the input and output have the same byte length, and also lets the
+  // output of a QUANTIZE fused into a DEQUANTIZE take the start of the larger
+  // float input (see AllocationInfoBuilder::MarkInPlaceOutputs).
+  TF_LITE_ENSURE_STATUS(micro_context->AllowInPlaceOutput(node, 0));
+
   micro_context->DeallocateTempTfLiteTensor(input);
   micro_context->DeallocateTempTfLiteTensor(output);
   return kTfLiteOk;
@@ -29,6 +29,49 @@ namespace tflite {
 namespace {
 constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
 constexpr int kUninitializedLifetime = -1;
+
+// Returns true if the allocation gets its own online planned buffer and can
+// therefore be shared by the output of an in-place operator.
+bool IsOnlinePlannedBuffer(const AllocationInfo* current) {
+  return current->needs_allocating &&
+         current->offline_offset == kOnlinePlannedBuffer &&
+         current->in_place_root == nullptr;
+}
+
+bool IsSubgraphInput(const SubGraph* subgraph, int tensor_index) {
+  if (subgraph->inputs() == nullptr) {
+    return false;
+  }
+  for (const int input : *subgraph->inputs()) {
+    if (input == tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Tensor on the application side of boundary conversion `op`: the output of
+// a conversion of a subgraph input, the input of one of a subgraph output.
+int ApplicationTensor(const SubGraph* subgraph, const Operator* op) {
+  return IsSubgraphInput(subgraph, op->inputs()->Get(0))
+             ? op->outputs()->Get(0)
+             : op->inputs()->Get(0);
+}
+
+// The application fills or reads the tensors on its side of the boundary
+// conversions it does itself, like subgraph inputs and outputs.
+bool IsApplicationTensor(const SubGraph* subgraph,
+                         const NodeAndRegistration* node_and_registrations,
+                         int tensor_index) {
+  for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+    if (node_and_registrations[i].boundary_conversion &&
+        ApplicationTensor(subgraph, subgraph->operators()->Get(i)) ==
+            tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
 }  // namespace
 
 // Mark the given Allocation info as first created at the specified allocation
@@ -199,6 +242,7 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
 
       current->first_created = kUninitializedLifetime;
       current->last_used = kUninitializedLifetime;
+      current->in_place_root = nullptr;
       current->needs_allocating =
           (eval_tensors[i].data.data == nullptr) &&
           (!subgraph->tensors()->Get(i)->is_variable()) &&
@@ -216,6 +260,32 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
         current->offline_offset = kOnlinePlannedBuffer;
       }
     }
+
+    // Dead nodes are never invoked and nothing reads their outputs.
+    for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+      const auto* outputs = subgraph->operators()->Get(i)->outputs();
+      if (!allocations[subgraph_idx].node_and_registrations[i].dead ||
+          outputs == nullptr) {
+        continue;
+      }
+      for (size_t n = 0; n < outputs->size(); ++n) {
+        subgraph_allocation_info[outputs->Get(n)].needs_allocating = false;
+      }
+    }
+
+    // Nothing reads or writes the model side of a boundary conversion the
+    // application does itself.
+    for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+      if (!allocations[subgraph_idx].node_and_registrations[i]
+               .boundary_conversion) {
+        continue;
+      }
+      const auto* op = subgraph->operators()->Get(i);
+      const int tensor_index = IsSubgraphInput(subgraph, op->inputs()->Get(0))
+                                   ? op->inputs()->Get(0)
+                                   : op->outputs()->Get(0);
+      subgraph_allocation_info[tensor_index].needs_allocating = false;
+    }
   }
   // Initialize allocation info for every scratch buffer.
   AllocationInfo* scratch_allocation_info =
@@ -226,6 +296,7 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
     current->last_used = kUninitializedLifetime;
     current->needs_allocating = true;
     current->offline_offset = kOnlinePlannedBuffer;
+    current->in_place_root = nullptr;
   }
   return kTfLiteOk;
 }
@@ -253,6 +324,20 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
     // but not used in any ops also have a reasonable lifetime.
     UpdateLastUsed(current, allocation_scope_count_);
   }
+  // The application fills the outputs of the conversions of inputs it does
+  // itself before the invocation.
+  const NodeAndRegistration* node_and_registrations =
+      allocations[subgraph_idx].node_and_registrations;
+  for (uint32_t i = 0; i < operators_size; i++) {
+    const auto* op = subgraph->operators()->Get(i);
+    if (node_and_registrations[i].boundary_conversion &&
+        IsSubgraphInput(subgraph, op->inputs()->Get(0))) {
+      AllocationInfo* current =
+          &subgraph_allocation_info[op->outputs()->Get(0)];
+      UpdateFirstCreated(current, allocation_scope_count_);
+      UpdateLastUsed(current, allocation_scope_count_);
+    }
+  }
 
   for (uint32_t i = 0; i < operators_size; i++) {
     // Each operator has a new allocation scope.
@@ -330,6 +415,103 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
     UpdateFirstCreated(current, allocation_scope_count_);
     UpdateLastUsed(current, allocation_scope_count_);
   }
+  // And reads the inputs of the conversions of outputs after it.
+  for (uint32_t i = 0; i < operators_size; i++) {
+    const auto* op = subgraph->operators()->Get(i);
+    if (node_and_registrations[i].boundary_conversion &&
+        !IsSubgraphInput(subgraph, op->inputs()->Get(0))) {
+      UpdateLastUsed(&subgraph_allocation_info[op->inputs()->Get(0)],
+                     allocation_scope_count_);
+    }
+  }
+  return kTfLiteOk;
+}
+
+void AllocationInfoBuilder::PreserveSubgraphInputs(
+    SubgraphAllocations* allocations) {
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  AllocationInfo* subgraph_allocation_info =
+      &info_.allocation_info[info_.subgraph_offsets[0]];
+  for (size_t i = 0;
+       subgraph->inputs() != nullptr && i < subgraph->inputs()->size(); ++i) {
+    UpdateLastUsed(&subgraph_allocation_info[subgraph->inputs()->Get(i)],
+                   allocation_scope_count_);
+  }
+  for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+    const auto* op = subgraph->operators()->Get(i);
+    if (allocations[0].node_and_registrations[i].boundary_conversion &&
+        IsSubgraphInput(subgraph, op->inputs()->Get(0))) {
+      UpdateLastUsed(&subgraph_allocation_info[op->outputs()->Get(0)],
+                     allocation_scope_count_);
+    }
+  }
+}
+
+TfLiteStatus AllocationInfoBuilder::MarkInPlaceOutputs(
+    SubgraphAllocations* allocations, size_t* shared_bytes) {
+  *shared_bytes = 0;
+  for (size_t subgraph_idx = 0; subgraph_idx < model_->subgraphs()->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    AllocationInfo* subgraph_allocation_info =
+        &info_.allocation_info[info_.subgraph_offsets[subgraph_idx]];
+
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; i++) {
+      const NodeAndRegistration& node_and_registration =
+          allocations[subgraph_idx].node_and_registrations[i];
+      const uint32_t in_place_inputs = node_and_registration.in_place_inputs;
+      const auto* op = subgraph->operators()->Get(i);
+      if (in_place_inputs == 0 || op->inputs() == nullptr ||
+          op->outputs() == nullptr || op->outputs()->size() != 1) {
+        continue;
+      }
+      AllocationInfo* output = &subgraph_allocation_info[op->outputs()->Get(0)];
+      for (size_t n = 0;
+           IsOnlinePlannedBuffer(output) && n < op->inputs()->size(); ++n) {
+        const int tensor_index = op->inputs()->Get(n);
+        if ((in_place_inputs & (1u << n)) == 0 || tensor_index < 0) {
+          continue;
+        }
+        // Inputs that are themselves in-place outputs forward to the buffer
+        // that is actually planned, so chains of in-place operators collapse
+        // onto a single buffer.
+        AllocationInfo* input = &subgraph_allocation_info[tensor_index];
+        AllocationInfo* root =
+            input->in_place_root != nullptr ? input->in_place_root : input;
+        // The input must die at this node: its last use is the scope in which
+        // the output is created. The output of a fused node is written by
+        // the node it was folded into, so it may also take the start of a
+        // larger buffer, e.g. the float tensor of a collapsed DEQUANTIZE ->
+        // QUANTIZE chain.
+        const bool fits =
+            node_and_registration.fused_into >= 0
+                ? root->bytes >= output->bytes
+                : root->bytes == output->bytes;
+        if (!IsOnlinePlannedBuffer(root) || !fits ||
+            root->last_used != output->first_created ||
+            IsApplicationTensor(
+                subgraph, allocations[subgraph_idx].node_and_registrations,
+                root - subgraph_allocation_info)) {
+          continue;
+        }
+        root->last_used = output->last_used;
+        output->needs_allocating = false;
+        output->in_place_root = root;
+        *shared_bytes += output->bytes;
+        break;
+      }
+
+      // A fused node is never invoked, so its output only holds the right
+      // values if it is the producer's buffer.
+      if (node_and_registration.fused_into >= 0 &&
+          output->in_place_root == nullptr) {
+        MicroPrintf("Fused node %d cannot share the buffer of node %d", i,
+                    node_and_registration.fused_into);
+        return kTfLiteError;
+      }
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -31,6 +31,9 @@ struct AllocationInfo {
   int last_used;
   int32_t offline_offset;
   bool needs_allocating;
+  // When set, the buffer is not planned on its own but shares the buffer of
+  // this allocation (the output of an in-place operator).
+  AllocationInfo* in_place_root;
 };
 
 // Used to hold the allocation info list and related metadata for the entire
@@ -104,6 +107,24 @@ class AllocationInfoBuilder {
       ScratchBufferHandle* scratch_buffer_handles,
       SubgraphAllocations* allocations);
 
+  // Keeps the inputs of subgraph 0, and the tensors the application fills in
+  // their place, alive until the end of the subgraph, so that no buffer of a
+  // later tensor is planned over them. Must be called after
+  // MarkAllocationLifetimes and before MarkInPlaceOutputs.
+  void PreserveSubgraphInputs(SubgraphAllocations* allocations);
+
+  // Let output 0 of every node whose kernel allowed it share the buffer of an
+  // input that is last used by that node, provided both are planned online
+  // and have the same byte length. The output of a node fused into its
+  // producer may also take the start of a longer input, which the producer
+  // no longer writes, e.g. the float tensor of a collapsed DEQUANTIZE ->
+  // QUANTIZE chain. The shared buffer's lifetime is extended to cover the
+  // output. Must be called after MarkAllocationLifetimes. The number
+  // of output bytes that no longer need their own buffer is returned through
+  // `shared_bytes`.
+  TfLiteStatus MarkInPlaceOutputs(SubgraphAllocations* allocations,
+                                  size_t* shared_bytes);
+
   // Returns the number of allocations.
   int AllocationCount() const { return info_.allocation_info_count; }
 
@@ -141,6 +141,14 @@ TfLiteStatus CommitPlan(MicroMemoryPlanner* planner, uint8_t* starting_point,
       ++planner_index;
     }
   }
+  // Outputs of in-place operators point at the buffer they share, which has
+  // been placed by the loop above.
+  for (size_t i = 0; i < allocation_info_size; ++i) {
+    const AllocationInfo* current = &allocation_info[i];
+    if (current->in_place_root != nullptr) {
+      *current->output_ptr = *current->in_place_root->output_ptr;
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -733,6 +741,17 @@ TfLiteStatus MicroAllocator::RequestScratchBufferInArena(size_t bytes,
   return kTfLiteOk;
 }
 
+bool MicroAllocator::PlansInPlaceOutputs(const Model* model) {
+  if (!in_place_outputs_enabled_ || memory_planner_->preserves_all_tensors()) {
+    return false;
+  }
+  AllocationInfoBuilder builder(model, non_persistent_buffer_allocator_);
+  const int32_t* offline_planner_offsets = nullptr;
+  return builder.GetOfflinePlannedOffsets(&offline_planner_offsets) ==
+             kTfLiteOk &&
+         offline_planner_offsets == nullptr;
+}
+
 TfLiteStatus MicroAllocator::FinishPrepareNodeAllocations(int node_id) {
   // When a node has finished preparing, all temp allocations performed by the
   // kernel should be cleaned up:
@@ -1155,6 +1174,15 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
       GetScratchBufferRequests();
   TF_LITE_ENSURE_STATUS(builder.MarkAllocationLifetimes(
       0, scratch_buffer_requests, scratch_buffer_handles, allocations));
+  if (preserve_inputs_) {
+    builder.PreserveSubgraphInputs(allocations);
+  }
+
+  size_t in_place_bytes = 0;
+  if (in_place_outputs_enabled_ && !memory_planner_->preserves_all_tensors()) {
+    TF_LITE_ENSURE_STATUS(
+        builder.MarkInPlaceOutputs(allocations, &in_place_bytes));
+  }
   int allocation_info_count = builder.AllocationCount();
   AllocationInfo* allocation_info = builder.Finish();
 
@@ -1190,6 +1218,8 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
 
 #ifdef TF_LITE_SHOW_MEMORY_USE
   memory_planner_->PrintMemoryPlan();
+  MicroPrintf("In-place outputs: %d bytes share an input buffer",
+              in_place_bytes);
 #endif
   head_usage = memory_planner_->GetMaximumMemorySize();
 
@@ -79,9 +79,32 @@ enum class MemoryPlannerType {
   kLinear,
 };
 
+// Maximum number of node inputs a kernel can mark as in-place candidates.
+constexpr int kMaxInPlaceInputs = 32;
+
 struct NodeAndRegistration {
   TfLiteNode node;
   const TFLMRegistration* registration;
+  // Bit mask of the inputs whose buffer the kernel allows output 0 to share,
+  // set from Prepare through MicroContext::AllowInPlaceOutput().
+  uint32_t in_place_inputs;
+  // Index of the node this one was folded into by the load-time graph rewrite,
+  // or -1. A fused node is neither initialized, prepared nor invoked; its output
+  // must be planned into the buffer of its producer's output.
+  int fused_into;
+  // Set by the load-time graph rewrite for a node whose inputs are all
+  // constant: it is initialized and prepared, evaluated once into persistent
+  // output buffers at the end of AllocateTensors() and never invoked again.
+  bool constant_folded;
+  // Set by the load-time graph rewrite for a node whose outputs are never
+  // read. It is initialized and prepared but never invoked.
+  bool dead;
+  // Set for a QUANTIZE or DEQUANTIZE of a subgraph 0 input or output that the
+  // application does itself in its pre- or postprocessing. The node is neither
+  // initialized, prepared nor invoked, and the input or output tensor on the
+  // model side is not planned: the application fills or reads the tensor on
+  // the other side of the node instead.
+  bool boundary_conversion;
 };
 
 // Holds a pointer to a buffer for a scratch buffer requested by a kernel during
@@ -257,6 +280,29 @@ class MicroAllocator {
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // Enables or disables placing the output of an in-place safe kernel in the
+  // buffer of an input that is last used by that node. Enabled by default and
+  // ignored when all tensors are preserved. Comparing used_bytes() with this
+  // setting on and off gives the arena saved by in-place execution. Must be
+  // called before `FinishModelAllocation`.
+  void set_in_place_outputs_enabled(bool enabled) {
+    in_place_outputs_enabled_ = enabled;
+  }
+
+  // Keeps the input tensors of subgraph 0 intact through Invoke(), so that
+  // the caller may read them back or invoke again without refilling them.
+  // Disabled by default: like any tensor, an input buffer is then reused, in
+  // place or by a later tensor, once its last reader has run. Must be called
+  // before `FinishModelAllocation`.
+  void set_preserve_inputs(bool preserve_inputs) {
+    preserve_inputs_ = preserve_inputs;
+  }
+
+  // Returns true if outputs of `model` will be planned in place of dying
+  // inputs: in-place outputs are enabled, the planner does not preserve all
+  // tensors and the model has no offline memory plan.
+  bool PlansInPlaceOutputs(const Model* model);
+
   TfLiteBridgeBuiltinDataAllocator* GetBuiltinDataAllocator();
 
  protected:
@@ -360,6 +406,12 @@ class MicroAllocator {
   // to ensure that multi-tenant allocations can share the head for buffers.
   size_t max_head_buffer_usage_ = 0;
 
+  // Whether in-place safe outputs may share the buffer of a dying input.
+  bool in_place_outputs_enabled_ = true;
+
+  // Whether the inputs of subgraph 0 live until the end of Invoke().
+  bool preserve_inputs_ = false;
+
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
@@ -59,6 +59,29 @@ class MicroContext {
   // This method is only available in Eval stage.
   virtual void* GetScratchBuffer(int buffer_idx) = 0;
 
+  // Declares that the kernel computes output 0 of the node element by element
+  // from the same position of input `input_index`, reading each input element
+  // before writing the corresponding output element. The memory planner may
+  // then place the output in the buffer of that input when the input is not
+  // used after this node and both tensors have the same byte length.
+  // This method is only available in Prepare stage. The default implementation
+  // ignores the hint and always plans a separate output buffer.
+  virtual TfLiteStatus AllowInPlaceOutput(const TfLiteNode* node,
+                                          int input_index) {
+    return kTfLiteOk;
+  }
+
+  // Allocates a persistent buffer that the kernel only needs to run faster,
+  // e.g. a transformed copy of a constant filter, and counts it against the
+  // budget set with MicroInterpreter::SetOptionalPersistentBudget(). Returns
+  // nullptr when the buffer does not fit in what is left of that budget or of
+  // the arena; the kernel must then run without it.
+  // This method is only available in Init or Prepare stage. The default
+  // implementation has no budget and always returns nullptr.
+  virtual void* AllocateOptionalPersistentBuffer(size_t bytes) {
+    return nullptr;
+  }
+
   // Returns a temporary TfLiteTensor struct for a given index.
   virtual TfLiteTensor* AllocateTempTfLiteTensor(int tensor_idx) = 0;
 
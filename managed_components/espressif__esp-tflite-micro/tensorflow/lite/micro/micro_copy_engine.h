@@ -0,0 +1,48 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_COPY_ENGINE_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_COPY_ENGINE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// Interface for something that copies memory while the CPU does other work:
+// a DMA channel, or a task on another core. Copies complete in the order they
+// were submitted.
+class MicroCopyEngine {
+ public:
+  virtual ~MicroCopyEngine() {}
+
+  // Queues a copy of `bytes` bytes from `src` to `dst`. Returns a non-zero
+  // ticket identifying the copy, or 0 if it could not be queued.
+  virtual uint32_t Submit(void* dst, const void* src, size_t bytes) = 0;
+
+  // Returns true once the copy with `ticket`, and every copy submitted before
+  // it, has completed.
+  virtual bool IsDone(uint32_t ticket) = 0;
+
+  // Blocks until IsDone(ticket).
+  virtual void Wait(uint32_t ticket) = 0;
+
+  // Total GetCurrentTimeTicks() ticks spent performing copies so far.
+  virtual uint32_t busy_ticks() const = 0;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_COPY_ENGINE_H_
@@ -14,11 +14,13 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/micro/micro_interpreter.h"
 
+#include <cmath>
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/c_api_types.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
@@ -28,6 +30,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/micro/micro_utils.h"
 #include "tensorflow/lite/micro/tflite_bridge/flatbuffer_conversions_bridge.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/schema/schema_utils.h"
@@ -41,6 +44,222 @@ MemoryPlannerType FlagToMemoryPlannerType(bool preserve_all_tensors) {
     return MemoryPlannerType::kGreedy;
   }
 }
+
+// Number of operator inputs and subgraph outputs that read `tensor_index`.
+int CountTensorConsumers(const SubGraph* subgraph, int tensor_index) {
+  int consumers = 0;
+  for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+    const auto* inputs = subgraph->operators()->Get(i)->inputs();
+    for (size_t n = 0; inputs != nullptr && n < inputs->size(); ++n) {
+      consumers += inputs->Get(n) == tensor_index ? 1 : 0;
+    }
+  }
+  for (size_t n = 0;
+       subgraph->outputs() != nullptr && n < subgraph->outputs()->size(); ++n) {
+    consumers += subgraph->outputs()->Get(n) == tensor_index ? 1 : 0;
+  }
+  return consumers;
+}
+
+// Index of the operator before `operator_idx` that outputs `tensor_index`, or
+// -1 if the tensor is not produced by an operator.
+int FindTensorProducer(const SubGraph* subgraph, uint32_t operator_idx,
+                       int tensor_index) {
+  for (uint32_t i = 0; i < operator_idx; ++i) {
+    const auto* outputs = subgraph->operators()->Get(i)->outputs();
+    for (size_t n = 0; outputs != nullptr && n < outputs->size(); ++n) {
+      if (outputs->Get(n) == tensor_index) {
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+// Fused activation of the operators a following activation can be folded into.
+TfLiteFusedActivation* GetFusedActivation(
+    const NodeAndRegistration& node_and_registration) {
+  void* builtin_data = node_and_registration.node.builtin_data;
+  switch (node_and_registration.registration->builtin_code) {
+    case BuiltinOperator_CONV_2D:
+      return &static_cast<TfLiteConvParams*>(builtin_data)->activation;
+    case BuiltinOperator_DEPTHWISE_CONV_2D:
+      return &static_cast<TfLiteDepthwiseConvParams*>(builtin_data)->activation;
+    default:
+      return nullptr;
+  }
+}
+
+// True if a clamp quantized for one tensor gives the same values for the
+// other: both float, or both int8 with the same per-tensor scale and zero
+// point.
+bool HaveSameQuantization(const Tensor* a, const Tensor* b) {
+  if (a->type() != b->type()) {
+    return false;
+  }
+  if (a->type() == TensorType_FLOAT32) {
+    return true;
+  }
+  if (a->type() != TensorType_INT8) {
+    return false;
+  }
+  const QuantizationParameters* qa = a->quantization();
+  const QuantizationParameters* qb = b->quantization();
+  if (qa == nullptr || qb == nullptr || qa->scale() == nullptr ||
+      qb->scale() == nullptr || qa->zero_point() == nullptr ||
+      qb->zero_point() == nullptr || qa->scale()->size() != 1 ||
+      qb->scale()->size() != 1 || qa->zero_point()->size() != 1 ||
+      qb->zero_point()->size() != 1) {
+    return false;
+  }
+  return qa->scale()->Get(0) == qb->scale()->Get(0) &&
+         qa->zero_point()->Get(0) == qb->zero_point()->Get(0);
+}
+
+// Operators without state or side effects: a node can be evaluated once at
+// load time when its inputs are constant, or left out when nothing reads its
+// outputs.
+bool IsPureOperator(int32_t builtin_code) {
+  switch (builtin_code) {
+    case BuiltinOperator_ADD:
+    case BuiltinOperator_AVERAGE_POOL_2D:
+    case BuiltinOperator_CAST:
+    case BuiltinOperator_CONCATENATION:
+    case BuiltinOperator_CONV_2D:
+    case BuiltinOperator_DEPTHWISE_CONV_2D:
+    case BuiltinOperator_DEQUANTIZE:
+    case BuiltinOperator_EXPAND_DIMS:
+    case BuiltinOperator_FULLY_CONNECTED:
+    case BuiltinOperator_MAX_POOL_2D:
+    case BuiltinOperator_MEAN:
+    case BuiltinOperator_MUL:
+    case BuiltinOperator_PAD:
+    case BuiltinOperator_QUANTIZE:
+    case BuiltinOperator_RELU:
+    case BuiltinOperator_RELU6:
+    case BuiltinOperator_RESHAPE:
+    case BuiltinOperator_SOFTMAX:
+    case BuiltinOperator_SQUEEZE:
+    case BuiltinOperator_SUB:
+    case BuiltinOperator_TRANSPOSE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Node whose kernel writes the output buffer of node `node_idx`: the node
+// itself, or the node it was fused into.
+int WritingNode(const NodeAndRegistration* node_and_registrations,
+                int node_idx) {
+  while (node_and_registrations[node_idx].fused_into >= 0) {
+    node_idx = node_and_registrations[node_idx].fused_into;
+  }
+  return node_idx;
+}
+
+bool HasPerTensorQuantization(const Tensor* tensor) {
+  const QuantizationParameters* quantization = tensor->quantization();
+  return quantization != nullptr && quantization->scale() != nullptr &&
+         quantization->zero_point() != nullptr &&
+         quantization->scale()->size() == 1 &&
+         quantization->zero_point()->size() == 1;
+}
+
+// True if the QUANTIZE kernel converts `input` to `output` in one step.
+bool CanQuantize(const Tensor* input, const Tensor* output) {
+  const TensorType output_type = output->type();
+  if ((output_type != TensorType_INT8 && output_type != TensorType_UINT8 &&
+       output_type != TensorType_INT16 && output_type != TensorType_INT32) ||
+      !HasPerTensorQuantization(output)) {
+    return false;
+  }
+  if (input->type() == TensorType_FLOAT32) {
+    return true;
+  }
+  if (!HasPerTensorQuantization(input)) {
+    return false;
+  }
+  switch (input->type()) {
+    case TensorType_INT8:
+      return true;
+    case TensorType_UINT8:
+      return output_type == TensorType_INT8;
+    case TensorType_INT16:
+      return output_type != TensorType_UINT8;
+    case TensorType_INT32:
+      return output_type == TensorType_INT8 || output_type == TensorType_INT16;
+    default:
+      return false;
+  }
+}
+
+// Real values a per-tensor quantized tensor can hold.
+bool GetRealRange(const Tensor* tensor, float* min, float* max) {
+  int32_t min_value;
+  int32_t max_value;
+  switch (tensor->type()) {
+    case TensorType_INT8:
+      min_value = INT8_MIN;
+      max_value = INT8_MAX;
+      break;
+    case TensorType_UINT8:
+      min_value = 0;
+      max_value = UINT8_MAX;
+      break;
+    case TensorType_INT16:
+      min_value = INT16_MIN;
+      max_value = INT16_MAX;
+      break;
+    default:
+      return false;
+  }
+  if (!HasPerTensorQuantization(tensor)) {
+    return false;
+  }
+  const float scale = tensor->quantization()->scale()->Get(0);
+  const int64_t zero_point = tensor->quantization()->zero_point()->Get(0);
+  *min = scale * static_cast<float>(min_value - zero_point);
+  *max = scale * static_cast<float>(max_value - zero_point);
+  return true;
+}
+
+// Per-tensor scale of an int8 or uint8 tensor, or 1 for float32; 0 if the
+// tensor has neither.
+float LogitStep(const Tensor* tensor) {
+  if (tensor->type() == TensorType_FLOAT32) {
+    return 1.0f;
+  }
+  if (tensor->type() != TensorType_INT8 && tensor->type() != TensorType_UINT8) {
+    return 0.0f;
+  }
+  const QuantizationParameters* quantization = tensor->quantization();
+  if (quantization == nullptr || quantization->scale() == nullptr ||
+      quantization->scale()->size() != 1) {
+    return 0.0f;
+  }
+  return quantization->scale()->Get(0);
+}
+
+// Raw value `i` of an int8, uint8 or float32 tensor; the zero point cancels
+// out in the softmax.
+float LogitAt(const TfLiteEvalTensor* logits, int i) {
+  switch (logits->type) {
+    case kTfLiteInt8:
+      return logits->data.int8[i];
+    case kTfLiteUInt8:
+      return logits->data.uint8[i];
+    default:
+      return logits->data.f[i];
+  }
+}
+
+// True if `a` ranks after `b`: lower logit, or the same logit at a higher
+// index.
+bool RanksAfter(float logit_a, int a, float logit_b, int b) {
+  return logit_a < logit_b || (logit_a == logit_b && a > b);
+}
+
 }  // namespace
 
 MicroInterpreter::MicroInterpreter(const Model* model,
@@ -179,6 +398,20 @@ TfLiteStatus MicroInterpreter::PrepareNodeAndRegistrationDataFromFlatbuffer() {
       TfLiteIntArray* outputs_array =
           FlatBufferVectorToTfLiteTypeArray(op->outputs());
 
+      graph_.GetAllocations()[subgraph_idx]
+          .node_and_registrations[i]
+          .in_place_inputs = 0;
+      graph_.GetAllocations()[subgraph_idx]
+          .node_and_registrations[i]
+          .fused_into = -1;
+      graph_.GetAllocations()[subgraph_idx]
+          .node_and_registrations[i]
+          .constant_folded = false;
+      graph_.GetAllocations()[subgraph_idx].node_and_registrations[i].dead =
+          false;
+      graph_.GetAllocations()[subgraph_idx]
+          .node_and_registrations[i]
+          .boundary_conversion = false;
       TfLiteNode* node = &(
           graph_.GetAllocations()[subgraph_idx].node_and_registrations[i].node);
       *node = {};
@@ -197,6 +430,667 @@ TfLiteStatus MicroInterpreter::PrepareNodeAndRegistrationDataFromFlatbuffer() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreter::FuseActivations() {
+  if (!allocator_.PlansInPlaceOutputs(model_)) {
+    return kTfLiteOk;
+  }
+
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      NodeAndRegistration& activation = node_and_registrations[i];
+      if (activation.registration->builtin_code != BuiltinOperator_RELU6 ||
+          activation.node.inputs->size != 1 ||
+          activation.node.outputs->size != 1) {
+        continue;
+      }
+      const int tensor_index = activation.node.inputs->data[0];
+      if (tensor_index < 0 ||
+          CountTensorConsumers(subgraph, tensor_index) != 1) {
+        continue;
+      }
+      const int producer_idx = FindTensorProducer(subgraph, i, tensor_index);
+      if (producer_idx < 0) {
+        continue;
+      }
+      NodeAndRegistration& producer = node_and_registrations[producer_idx];
+      TfLiteFusedActivation* producer_activation = GetFusedActivation(producer);
+      if (producer_activation == nullptr ||
+          producer.node.outputs->size != 1 ||
+          !HaveSameQuantization(
+              subgraph->tensors()->Get(tensor_index),
+              subgraph->tensors()->Get(activation.node.outputs->data[0]))) {
+        continue;
+      }
+      // NONE, RELU and RELU6 followed by RELU6 all clamp to [0, 6].
+      if (*producer_activation != kTfLiteActNone &&
+          *producer_activation != kTfLiteActRelu &&
+          *producer_activation != kTfLiteActRelu6) {
+        continue;
+      }
+      *producer_activation = kTfLiteActRelu6;
+      activation.fused_into = producer_idx;
+      activation.in_place_inputs = 1u << 0;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::RemoveDeadNodes() {
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    const uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = operators_size; i-- > 0;) {
+      NodeAndRegistration& node_and_registration = node_and_registrations[i];
+      if (node_and_registration.fused_into >= 0 ||
+          node_and_registration.boundary_conversion ||
+          !IsPureOperator(node_and_registration.registration->builtin_code)) {
+        continue;
+      }
+      // The readers of an output are the subgraph outputs and the nodes
+      // after this one that are not dead themselves.
+      bool read = false;
+      const TfLiteIntArray* outputs = node_and_registration.node.outputs;
+      for (int n = 0; !read && n < outputs->size; ++n) {
+        const int tensor_index = outputs->data[n];
+        for (size_t k = 0; !read && subgraph->outputs() != nullptr &&
+                           k < subgraph->outputs()->size();
+             ++k) {
+          read = subgraph->outputs()->Get(k) == tensor_index;
+        }
+        for (uint32_t j = i + 1; !read && j < operators_size; ++j) {
+          if (node_and_registrations[j].dead) {
+            continue;
+          }
+          const TfLiteIntArray* inputs = node_and_registrations[j].node.inputs;
+          for (int m = 0; !read && m < inputs->size; ++m) {
+            read = inputs->data[m] == tensor_index;
+          }
+        }
+      }
+      node_and_registration.dead = !read;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::FoldConstantNodes() {
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    TfLiteEvalTensor* tensors = graph_.GetAllocations()[subgraph_idx].tensors;
+    const uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      NodeAndRegistration& node_and_registration = node_and_registrations[i];
+      if (node_and_registration.fused_into >= 0 || node_and_registration.dead ||
+          node_and_registration.boundary_conversion ||
+          !IsPureOperator(node_and_registration.registration->builtin_code)) {
+        continue;
+      }
+      // Constant tensors already point at their data: weights in the
+      // flatbuffer and the outputs of the nodes folded before this one.
+      const TfLiteIntArray* inputs = node_and_registration.node.inputs;
+      bool constant = false;
+      for (int n = 0; n < inputs->size; ++n) {
+        const int tensor_index = inputs->data[n];
+        if (tensor_index < 0) {
+          continue;
+        }
+        constant = tensors[tensor_index].data.data != nullptr &&
+                   !subgraph->tensors()->Get(tensor_index)->is_variable();
+        if (!constant) {
+          break;
+        }
+      }
+      // A node fused into this one shares its output buffer, which must be
+      // planned.
+      for (uint32_t j = i + 1; constant && j < operators_size; ++j) {
+        constant = node_and_registrations[j].fused_into != static_cast<int>(i);
+      }
+      if (!constant) {
+        continue;
+      }
+      const TfLiteIntArray* outputs = node_and_registration.node.outputs;
+      for (int n = 0; n < outputs->size; ++n) {
+        TfLiteEvalTensor* output = &tensors[outputs->data[n]];
+        size_t bytes;
+        TF_LITE_ENSURE_STATUS(TfLiteEvalTensorByteLength(output, &bytes));
+        output->data.data = allocator_.AllocatePersistentBuffer(bytes);
+        if (output->data.data == nullptr) {
+          MicroPrintf("Failed to allocate %d bytes for the folded output of "
+                      "node %u",
+                      static_cast<int>(bytes), i);
+          return kTfLiteError;
+        }
+      }
+      node_and_registration.constant_folded = true;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::CollapseRequantizeChains() {
+  if (!allocator_.PlansInPlaceOutputs(model_)) {
+    return kTfLiteOk;
+  }
+
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    const TfLiteEvalTensor* tensors =
+        graph_.GetAllocations()[subgraph_idx].tensors;
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      NodeAndRegistration& quantize = node_and_registrations[i];
+      if (quantize.registration->builtin_code != BuiltinOperator_QUANTIZE ||
+          quantize.fused_into >= 0 || quantize.constant_folded ||
+          quantize.dead || quantize.boundary_conversion ||
+          quantize.node.inputs->size != 1 ||
+          quantize.node.outputs->size != 1) {
+        continue;
+      }
+      const int middle_index = quantize.node.inputs->data[0];
+      const int output_index = quantize.node.outputs->data[0];
+      if (CountTensorConsumers(subgraph, middle_index) != 1) {
+        continue;
+      }
+      const int producer_idx = FindTensorProducer(subgraph, i, middle_index);
+      if (producer_idx < 0) {
+        continue;
+      }
+      // The writer of the middle tensor may itself be the head of a chain
+      // collapsed before.
+      const int head_idx = WritingNode(node_and_registrations, producer_idx);
+      NodeAndRegistration& head = node_and_registrations[head_idx];
+      if ((head.registration->builtin_code != BuiltinOperator_QUANTIZE &&
+           head.registration->builtin_code != BuiltinOperator_DEQUANTIZE) ||
+          head.constant_folded || head.boundary_conversion ||
+          head.node.inputs->size != 1 ||
+          head.node.outputs->size != 1 ||
+          head.node.outputs->data[0] != middle_index) {
+        continue;
+      }
+      const int source_index = head.node.inputs->data[0];
+      if (!CanQuantize(subgraph->tensors()->Get(source_index),
+                       subgraph->tensors()->Get(output_index))) {
+        continue;
+      }
+      // A quantized middle tensor clamps; that clamp only goes away with the
+      // node if the output clamps to a range inside it.
+      if (head.registration->builtin_code == BuiltinOperator_QUANTIZE) {
+        float middle_min, middle_max, output_min, output_max;
+        if (!GetRealRange(subgraph->tensors()->Get(middle_index), &middle_min,
+                          &middle_max) ||
+            !GetRealRange(subgraph->tensors()->Get(output_index), &output_min,
+                          &output_max) ||
+            output_min < middle_min || output_max > middle_max) {
+          continue;
+        }
+      }
+      // The head writes the new output into the buffer planned for its own
+      // flatbuffer output, which the planner may also share with the source:
+      // that is safe for elements no larger than the source's.
+      const int buffer_index =
+          subgraph->operators()->Get(head_idx)->outputs()->Get(0);
+      size_t source_size;
+      size_t output_size;
+      size_t buffer_bytes;
+      size_t output_bytes;
+      if (TfLiteTypeSizeOf(tensors[source_index].type, &source_size) !=
+              kTfLiteOk ||
+          TfLiteTypeSizeOf(tensors[output_index].type, &output_size) !=
+              kTfLiteOk ||
+          output_size > source_size ||
+          TfLiteEvalTensorByteLength(&tensors[buffer_index], &buffer_bytes) !=
+              kTfLiteOk ||
+          TfLiteEvalTensorByteLength(&tensors[output_index], &output_bytes) !=
+              kTfLiteOk ||
+          output_bytes > buffer_bytes) {
+        continue;
+      }
+      head.registration = quantize.registration;
+      head.node.builtin_data = quantize.node.builtin_data;
+      head.node.outputs = quantize.node.outputs;
+      quantize.fused_into = head_idx;
+      quantize.in_place_inputs = 1u << 0;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::RemoveIdentityNodes() {
+  if (!allocator_.PlansInPlaceOutputs(model_)) {
+    return kTfLiteOk;
+  }
+
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model_->subgraphs()->Get(subgraph_idx);
+    NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    const TfLiteEvalTensor* tensors =
+        graph_.GetAllocations()[subgraph_idx].tensors;
+    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      NodeAndRegistration& identity = node_and_registrations[i];
+      if (identity.fused_into >= 0 || identity.constant_folded ||
+          identity.dead || identity.boundary_conversion ||
+          identity.node.inputs->size < 1 ||
+          identity.node.outputs->size != 1) {
+        continue;
+      }
+      const int input_index = identity.node.inputs->data[0];
+      const int output_index = identity.node.outputs->data[0];
+      switch (identity.registration->builtin_code) {
+        case BuiltinOperator_RESHAPE:
+        case BuiltinOperator_SQUEEZE:
+        case BuiltinOperator_EXPAND_DIMS:
+          break;
+        case BuiltinOperator_QUANTIZE:
+          if (input_index >= 0 &&
+              HaveSameQuantization(subgraph->tensors()->Get(input_index),
+                                   subgraph->tensors()->Get(output_index))) {
+            break;
+          }
+          continue;
+        default:
+          continue;
+      }
+      size_t input_bytes;
+      size_t output_bytes;
+      if (input_index < 0 ||
+          tensors[input_index].type != tensors[output_index].type ||
+          TfLiteEvalTensorByteLength(&tensors[input_index], &input_bytes) !=
+              kTfLiteOk ||
+          TfLiteEvalTensorByteLength(&tensors[output_index], &output_bytes) !=
+              kTfLiteOk ||
+          input_bytes != output_bytes ||
+          CountTensorConsumers(subgraph, input_index) != 1) {
+        continue;
+      }
+      const int producer_idx = FindTensorProducer(subgraph, i, input_index);
+      if (producer_idx < 0) {
+        continue;
+      }
+      // The application writes the output of a boundary conversion, and may
+      // read it back, so nothing may take it over in place.
+      const int writer_idx = WritingNode(node_and_registrations, producer_idx);
+      if (node_and_registrations[writer_idx].constant_folded ||
+          node_and_registrations[writer_idx].boundary_conversion) {
+        continue;
+      }
+      identity.fused_into = writer_idx;
+      identity.in_place_inputs = 1u << 0;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetApplicationBoundaryConversions(bool enable) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetApplicationBoundaryConversions() called after "
+                "AllocateTensors()");
+    return kTfLiteError;
+  }
+  application_boundary_conversions_ = enable;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetLoadTimeGraphRewrites(bool enable) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetLoadTimeGraphRewrites() called after AllocateTensors()");
+    return kTfLiteError;
+  }
+  load_time_graph_rewrites_ = enable;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetRequantizeChainCollapse(bool enable) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetRequantizeChainCollapse() called after AllocateTensors()");
+    return kTfLiteError;
+  }
+  requantize_chain_collapse_ = enable;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetOptionalPersistentBudget(size_t bytes) {
+  if (tensors_allocated_) {
+    MicroPrintf("SetOptionalPersistentBudget() called after AllocateTensors()");
+    return kTfLiteError;
+  }
+  micro_context_.SetOptionalPersistentBudget(bytes);
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::MarkBoundaryConversions() {
+  if (!application_boundary_conversions_) {
+    return kTfLiteOk;
+  }
+
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  NodeAndRegistration* node_and_registrations =
+      graph_.GetAllocations()[0].node_and_registrations;
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+  for (uint32_t i = 0; i < operators_size; ++i) {
+    NodeAndRegistration& convert = node_and_registrations[i];
+    if ((convert.registration->builtin_code != BuiltinOperator_QUANTIZE &&
+         convert.registration->builtin_code != BuiltinOperator_DEQUANTIZE) ||
+        convert.node.inputs->size != 1 || convert.node.outputs->size != 1) {
+      continue;
+    }
+    const int input_index = convert.node.inputs->data[0];
+    const int output_index = convert.node.outputs->data[0];
+    bool converts_input = false;
+    bool converts_output = false;
+    for (size_t n = 0; subgraph->inputs() != nullptr &&
+                       n < subgraph->inputs()->size();
+         ++n) {
+      converts_input |= subgraph->inputs()->Get(n) == input_index;
+    }
+    for (size_t n = 0; subgraph->outputs() != nullptr &&
+                       n < subgraph->outputs()->size();
+         ++n) {
+      converts_output |= subgraph->outputs()->Get(n) == output_index;
+    }
+    // The model side tensor is not planned, so this node must be its only
+    // reader, or for an output its only writer with no reader but the caller.
+    if (converts_input == converts_output ||
+        (converts_input && CountTensorConsumers(subgraph, input_index) != 1) ||
+        (converts_output &&
+         CountTensorConsumers(subgraph, output_index) != 1)) {
+      continue;
+    }
+    // The application converts an input from the parameters
+    // GetModelInputQuantization() reports, which are per tensor.
+    const Tensor* model_input = subgraph->tensors()->Get(input_index);
+    if (converts_input && model_input->type() != TensorType_FLOAT32 &&
+        !HasPerTensorQuantization(model_input)) {
+      continue;
+    }
+    convert.boundary_conversion = true;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::GetModelInputQuantization(
+    size_t index, TfLiteType* type, TfLiteQuantizationParams* params) {
+  if (index >= inputs_size()) {
+    MicroPrintf("Input index %d out of range (length is %d)", index,
+                inputs_size());
+    return kTfLiteError;
+  }
+  const Tensor* tensor =
+      model_->subgraphs()->Get(0)->tensors()->Get(inputs().Get(index));
+  TF_LITE_ENSURE_STATUS(ConvertTensorType(tensor->type(), type));
+  *params = {};
+  if (HasPerTensorQuantization(tensor)) {
+    params->scale = tensor->quantization()->scale()->Get(0);
+    params->zero_point =
+        static_cast<int32_t>(tensor->quantization()->zero_point()->Get(0));
+  }
+  return kTfLiteOk;
+}
+
+int MicroInterpreter::ApplicationTensorIndex(int tensor_index) {
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  const NodeAndRegistration* node_and_registrations =
+      graph_.GetAllocations()[0].node_and_registrations;
+  for (uint32_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+    const NodeAndRegistration& convert = node_and_registrations[i];
+    if (!convert.boundary_conversion) {
+      continue;
+    }
+    if (convert.node.inputs->data[0] == tensor_index) {
+      return convert.node.outputs->data[0];
+    }
+    if (convert.node.outputs->data[0] == tensor_index) {
+      return convert.node.inputs->data[0];
+    }
+  }
+  return tensor_index;
+}
+
+int MicroInterpreter::OutputProducer(size_t output_idx) {
+  const int tensor_index = ApplicationTensorIndex(outputs().Get(output_idx));
+  const NodeAndRegistration* node_and_registrations =
+      graph_.GetAllocations()[0].node_and_registrations;
+  for (int i = static_cast<int>(NumSubgraphOperators(model_, 0)) - 1; i >= 0;
+       --i) {
+    const NodeAndRegistration& writer = node_and_registrations[i];
+    if (writer.boundary_conversion) {
+      continue;
+    }
+    bool writes_output = false;
+    for (int j = 0; j < writer.node.outputs->size; ++j) {
+      writes_output |= writer.node.outputs->data[j] == tensor_index;
+    }
+    if (!writes_output) {
+      continue;
+    }
+    int producer = i;
+    while (node_and_registrations[producer].fused_into >= 0) {
+      producer = node_and_registrations[producer].fused_into;
+    }
+    return node_and_registrations[producer].constant_folded ? -1 : producer;
+  }
+  return -1;
+}
+
+int MicroInterpreter::DeepestCompletedOutput() const {
+  if (output_producers_ == nullptr) {
+    return -1;
+  }
+  const int completed = static_cast<int>(graph_.completed_operators());
+  int deepest = -1;
+  for (size_t i = 0; i < outputs_size(); ++i) {
+    const int producer = output_producers_[i];
+    if (producer < completed &&
+        (deepest < 0 || producer > output_producers_[deepest])) {
+      deepest = static_cast<int>(i);
+    }
+  }
+  return deepest;
+}
+
+size_t MicroInterpreter::PrintEliminatedNodes() {
+  size_t fused_count = 0;
+  size_t folded_count = 0;
+  size_t dead_count = 0;
+  size_t boundary_count = 0;
+  size_t activation_bytes = 0;
+  size_t folded_bytes = 0;
+  for (int subgraph_idx = 0; subgraph_idx < graph_.NumSubgraphs();
+       subgraph_idx++) {
+    const NodeAndRegistration* node_and_registrations =
+        graph_.GetAllocations()[subgraph_idx].node_and_registrations;
+    const TfLiteEvalTensor* tensors =
+        graph_.GetAllocations()[subgraph_idx].tensors;
+    uint32_t operators_size =
+        NumSubgraphOperators(model_->subgraphs()->Get(subgraph_idx));
+    for (uint32_t i = 0; i < operators_size; ++i) {
+      const NodeAndRegistration& node = node_and_registrations[i];
+      if (node.fused_into < 0 && !node.constant_folded && !node.dead &&
+          !node.boundary_conversion) {
+        continue;
+      }
+      const char* op_name = EnumNameBuiltinOperator(
+          BuiltinOperator(node.registration->builtin_code));
+      if (node.boundary_conversion) {
+        // The subgraph input or output on the model side is never planned.
+        int model_index = node.node.outputs->data[0];
+        for (size_t n = 0; n < inputs_size(); ++n) {
+          if (inputs().Get(n) == node.node.inputs->data[0]) {
+            model_index = node.node.inputs->data[0];
+          }
+        }
+        const int application_index = ApplicationTensorIndex(model_index);
+        size_t model_bytes = 0;
+        TfLiteEvalTensorByteLength(&tensors[model_index], &model_bytes);
+        MicroPrintf("Left %s (number %u) to the application, which uses "
+                    "tensor %d instead of %d",
+                    op_name, i, application_index, model_index);
+        activation_bytes += model_bytes;
+        boundary_count++;
+        continue;
+      }
+      size_t bytes = 0;
+      for (int n = 0; n < node.node.outputs->size; ++n) {
+        size_t output_bytes = 0;
+        TfLiteEvalTensorByteLength(&tensors[node.node.outputs->data[n]],
+                                   &output_bytes);
+        bytes += output_bytes;
+      }
+      if (node.constant_folded) {
+        MicroPrintf("Folded %s (number %u) into %d bytes of constants",
+                    op_name, i, static_cast<int>(bytes));
+        folded_bytes += bytes;
+        folded_count++;
+        continue;
+      }
+      activation_bytes += bytes;
+      if (node.dead) {
+        MicroPrintf("Removed %s (number %u), its outputs are never read",
+                    op_name, i);
+        dead_count++;
+        continue;
+      }
+      const NodeAndRegistration& producer =
+          node_and_registrations[node.fused_into];
+      MicroPrintf("Fused %s (number %u) into %s (number %d)", op_name, i,
+                  EnumNameBuiltinOperator(
+                      BuiltinOperator(producer.registration->builtin_code)),
+                  node.fused_into);
+      fused_count++;
+    }
+  }
+  MicroPrintf("%d nodes fused, %d folded, %d dead, %d left to the "
+              "application; %d bytes of activations need no buffer of their "
+              "own, %d bytes of folded constants",
+              static_cast<int>(fused_count), static_cast<int>(folded_count),
+              static_cast<int>(dead_count), static_cast<int>(boundary_count),
+              static_cast<int>(activation_bytes),
+              static_cast<int>(folded_bytes));
+  return fused_count + folded_count + dead_count + boundary_count;
+}
+
+TfLiteStatus MicroInterpreter::SetTopKOutputMode(bool enable) {
+  if (!tensors_allocated_) {
+    MicroPrintf("SetTopKOutputMode() called before AllocateTensors()");
+    return kTfLiteError;
+  }
+  top_k_logits_ = nullptr;
+  graph_.SetSkippedTailOperators(0);
+  graph_.DiscardSuspendedInvoke();
+  if (!enable) {
+    return kTfLiteOk;
+  }
+
+  const SubGraph* subgraph = model_->subgraphs()->Get(0);
+  const NodeAndRegistration* node_and_registrations =
+      graph_.GetAllocations()[0].node_and_registrations;
+  const uint32_t operators_size = NumSubgraphOperators(subgraph);
+  uint32_t head_size = 0;
+  if (operators_size >= 1 &&
+      node_and_registrations[operators_size - 1].registration->builtin_code ==
+          BuiltinOperator_SOFTMAX) {
+    head_size = 1;
+  } else if (operators_size >= 2) {
+    const NodeAndRegistration& softmax =
+        node_and_registrations[operators_size - 2];
+    const NodeAndRegistration& convert =
+        node_and_registrations[operators_size - 1];
+    if (softmax.registration->builtin_code == BuiltinOperator_SOFTMAX &&
+        (convert.registration->builtin_code == BuiltinOperator_QUANTIZE ||
+         convert.registration->builtin_code == BuiltinOperator_DEQUANTIZE) &&
+        convert.node.inputs->size == 1 &&
+        convert.node.inputs->data[0] == softmax.node.outputs->data[0]) {
+      head_size = 2;
+    }
+  }
+  if (head_size == 0) {
+    MicroPrintf("Top-k output mode needs a model ending in SOFTMAX");
+    return kTfLiteError;
+  }
+
+  const NodeAndRegistration& softmax =
+      node_and_registrations[operators_size - head_size];
+  const int logits_index = softmax.node.inputs->data[0];
+  const float logit_step =
+      LogitStep(subgraph->tensors()->Get(logits_index));
+  const TfLiteEvalTensor* logits =
+      &graph_.GetAllocations()[0].tensors[logits_index];
+  const int depth = logits->dims->data[logits->dims->size - 1];
+  if (logit_step == 0.0f || ElementCount(*logits->dims) != depth) {
+    MicroPrintf("Top-k output mode needs one row of float, int8 or uint8 "
+                "logits");
+    return kTfLiteError;
+  }
+
+  top_k_logits_ = logits;
+  top_k_logit_scale_ =
+      static_cast<const TfLiteSoftmaxParams*>(softmax.node.builtin_data)->beta *
+      logit_step;
+  graph_.SetSkippedTailOperators(head_size);
+  return kTfLiteOk;
+}
+
+int MicroInterpreter::TopK(MicroTopKEntry* entries, int k, float temperature) {
+  if (top_k_logits_ == nullptr) {
+    MicroPrintf("TopK() called outside top-k output mode");
+    return -1;
+  }
+  const int depth = ElementCount(*top_k_logits_->dims);
+  const float scale = top_k_logit_scale_ / temperature;
+
+  // Repeated selection: each pass takes the best class ranking after the
+  // previous one, so no scratch memory is needed for the usual small k. The
+  // confidences hold the logits until they are known.
+  float previous_logit = 0.0f;
+  int written = 0;
+  for (; written < k && written < depth; ++written) {
+    int best = -1;
+    float best_logit = 0.0f;
+    for (int i = 0; i < depth; ++i) {
+      const float logit = LogitAt(top_k_logits_, i);
+      if (written > 0 &&
+          !RanksAfter(logit, i, previous_logit, entries[written - 1].index)) {
+        continue;
+      }
+      if (best < 0 || RanksAfter(best_logit, best, logit, i)) {
+        best = i;
+        best_logit = logit;
+      }
+    }
+    entries[written].index = best;
+    entries[written].confidence = best_logit;
+    previous_logit = best_logit;
+  }
+
+  // Logits relative to the best one keep every exp() in (0, 1].
+  const float top_logit = written > 0 ? entries[0].confidence : 0.0f;
+  float sum_of_exps = 0.0f;
+  for (int i = 0; i < depth; ++i) {
+    sum_of_exps += std::exp((LogitAt(top_k_logits_, i) - top_logit) * scale);
+  }
+  for (int n = 0; n < written; ++n) {
+    entries[n].confidence =
+        std::exp((entries[n].confidence - top_logit) * scale) / sum_of_exps;
+  }
+  return written;
+}
+
 TfLiteStatus MicroInterpreter::AllocateTensors() {
   SubgraphAllocations* allocations = allocator_.StartModelAllocation(model_);
 
@@ -209,6 +1103,16 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   graph_.SetSubgraphAllocations(allocations);
 
   TF_LITE_ENSURE_STATUS(PrepareNodeAndRegistrationDataFromFlatbuffer());
+  TF_LITE_ENSURE_STATUS(MarkBoundaryConversions());
+  if (load_time_graph_rewrites_) {
+    TF_LITE_ENSURE_STATUS(FuseActivations());
+    TF_LITE_ENSURE_STATUS(RemoveDeadNodes());
+    TF_LITE_ENSURE_STATUS(FoldConstantNodes());
+    if (requantize_chain_collapse_) {
+      TF_LITE_ENSURE_STATUS(CollapseRequantizeChains());
+    }
+    TF_LITE_ENSURE_STATUS(RemoveIdentityNodes());
+  }
 
   micro_context_.SetInterpreterState(
       MicroInterpreterContext::InterpreterState::kInit);
@@ -243,7 +1147,8 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
 
   for (size_t i = 0; i < inputs_size(); ++i) {
     input_tensors_[i] = allocator_.AllocatePersistentTfLiteTensor(
-        model_, graph_.GetAllocations(), inputs().Get(i), 0);
+        model_, graph_.GetAllocations(),
+        ApplicationTensorIndex(inputs().Get(i)), 0);
     if (input_tensors_[i] == nullptr) {
       MicroPrintf("Failed to initialize input tensor %d", i);
       return kTfLiteError;
@@ -265,19 +1170,32 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
 
   for (size_t i = 0; i < outputs_size(); ++i) {
     output_tensors_[i] = allocator_.AllocatePersistentTfLiteTensor(
-        model_, graph_.GetAllocations(), outputs().Get(i), 0);
+        model_, graph_.GetAllocations(),
+        ApplicationTensorIndex(outputs().Get(i)), 0);
     if (output_tensors_[i] == nullptr) {
       MicroPrintf("Failed to initialize output tensor %d", i);
       return kTfLiteError;
     }
   }
 
+  output_producers_ = reinterpret_cast<int*>(
+      allocator_.AllocatePersistentBuffer(sizeof(int) * outputs_size()));
+  if (output_producers_ == nullptr) {
+    MicroPrintf("Failed to allocate memory for output_producers_, "
+                "%d bytes required",
+                sizeof(int) * outputs_size());
+    return kTfLiteError;
+  }
+  for (size_t i = 0; i < outputs_size(); ++i) {
+    output_producers_[i] = OutputProducer(i);
+  }
+
   TF_LITE_ENSURE_STATUS(Reset());
 
   tensors_allocated_ = true;
   micro_context_.SetInterpreterState(
       MicroInterpreterContext::InterpreterState::kInvoke);
-  return kTfLiteOk;
+  return graph_.InvokeConstantFoldedNodes();
 }
 
 TfLiteStatus MicroInterpreter::Invoke() {
@@ -291,9 +1209,28 @@ TfLiteStatus MicroInterpreter::Invoke() {
   if (!tensors_allocated_) {
     TF_LITE_ENSURE_OK(&context_, AllocateTensors());
   }
+  graph_.DiscardSuspendedInvoke();
   return graph_.InvokeSubgraph(0);
 }
 
+TfLiteStatus MicroInterpreter::InvokeUntil(uint32_t deadline_ticks) {
+  graph_.SetInvokeDeadline(deadline_ticks);
+  const TfLiteStatus status = Invoke();
+  graph_.ClearInvokeDeadline();
+  return status;
+}
+
+TfLiteStatus MicroInterpreter::ResumeInvoke(uint32_t deadline_ticks) {
+  if (!graph_.invoke_suspended()) {
+    MicroPrintf("ResumeInvoke() called without a suspended inference");
+    return kTfLiteError;
+  }
+  graph_.SetInvokeDeadline(deadline_ticks);
+  const TfLiteStatus status = graph_.InvokeSubgraph(0);
+  graph_.ClearInvokeDeadline();
+  return status;
+}
+
 TfLiteTensor* MicroInterpreter::input(size_t index) {
   const size_t length = inputs_size();
   if (index >= length) {
@@ -313,6 +1250,7 @@ TfLiteTensor* MicroInterpreter::output(size_t index) {
 }
 
 TfLiteStatus MicroInterpreter::Reset() {
+  graph_.DiscardSuspendedInvoke();
   TfLiteStatus status = graph_.ResetSubgraphs();
   if (status != kTfLiteOk) {
     return status;
@@ -43,6 +43,13 @@ limitations under the License.
 
 namespace tflite {
 
+// One class ranked by MicroInterpreter::TopK().
+struct MicroTopKEntry {
+  int index;
+  // Softmax probability of the class.
+  float confidence;
+};
+
 class MicroInterpreter {
  public:
   // The lifetime of the model, op resolver, tensor arena, error reporter,
@@ -75,11 +82,76 @@ class MicroInterpreter {
   // intermediate tensors.
   TfLiteStatus AllocateTensors();
 
+  // Leaves a QUANTIZE or DEQUANTIZE that converts a subgraph 0 input for the
+  // rest of the model, or that converts an output for the caller, to the
+  // application's own pre- or postprocessing. input() and output() then
+  // return the tensor on the other side of that node, e.g. the int8 input of
+  // the first layer of a model that takes uint8 pixels, and neither the
+  // conversion pass nor the input or output tensor it converts takes time or
+  // arena. Must be called before AllocateTensors().
+  TfLiteStatus SetApplicationBoundaryConversions(bool enable);
+
+  // Runs the load-time graph rewrites, from FuseActivations() to
+  // RemoveIdentityNodes(), in AllocateTensors(). On by default; turned off,
+  // every node runs as the model describes it, e.g. to check that the
+  // rewrites leave the outputs unchanged. Must be called before
+  // AllocateTensors().
+  TfLiteStatus SetLoadTimeGraphRewrites(bool enable);
+
+  // Also runs CollapseRequantizeChains() with the load-time graph rewrites.
+  // Off by default: unlike the other rewrites it is not bit-exact, a value on
+  // a rounding boundary can land one quantization step away from the output
+  // of the two nodes it replaces. Must be called before AllocateTensors().
+  TfLiteStatus SetRequantizeChainCollapse(bool enable);
+
+  // Number of arena bytes that kernels may take, in total, for persistent
+  // buffers they only need to run faster, e.g. the transformed filters of
+  // layers run with the Winograd convolution. Kernels take them in operator
+  // order from the persistent section and run without them once the budget
+  // is spent, so the budget comes out of the arena the model can use for its
+  // tensors. 0 by default, i.e. no such buffers. Must be called before
+  // AllocateTensors().
+  TfLiteStatus SetOptionalPersistentBudget(size_t bytes);
+
+  // Type and quantization of subgraph 0 input `index` as the model declares
+  // it, i.e. of the values the application converts from when it takes over
+  // the input's boundary conversion, where input(index) returns the tensor
+  // converted to. Without a boundary conversion both describe input(index).
+  // A float input has zero quantization parameters.
+  TfLiteStatus GetModelInputQuantization(size_t index, TfLiteType* type,
+                                         TfLiteQuantizationParams* params);
+
   // In order to support partial graph runs for strided models, this can return
   // values other than kTfLiteOk and kTfLiteError.
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
   TfLiteStatus Invoke();
 
+  // Deadline-aware inference. InvokeUntil() starts an inference like Invoke()
+  // but stops before the first operator of subgraph 0 that would start once
+  // GetCurrentTimeTicks() has reached `deadline_ticks`. It then returns
+  // kTfLiteAbort and leaves the inference suspended. The operator that is
+  // running when the deadline passes still completes, so the call can return
+  // up to one operator late. The outputs whose producers have run are valid.
+  // For models with intermediate classification heads,
+  // DeepestCompletedOutput() picks the best of them.
+  //
+  // ResumeInvoke() continues a suspended inference from the operator where it
+  // stopped, with a new deadline. This works as long as nothing else writes
+  // to the inputs or to the arena in between. Invoke(), InvokeUntil(),
+  // Reset() and SetTopKOutputMode() discard a suspended inference.
+  TfLiteStatus InvokeUntil(uint32_t deadline_ticks);
+  TfLiteStatus ResumeInvoke(uint32_t deadline_ticks);
+  bool invoke_suspended() const { return graph_.invoke_suspended(); }
+
+  // Number of leading operators of subgraph 0 that the last or the
+  // suspended inference has run.
+  size_t completed_operators() const { return graph_.completed_operators(); }
+
+  // Returns the index of the output, among those the last or the suspended
+  // inference has already written, whose producer is deepest in subgraph 0.
+  // Returns -1 if it has written none.
+  int DeepestCompletedOutput() const;
+
   // This is the recommended API for an application to pass an external payload
   // pointer as an external context to kernels. The life time of the payload
   // pointer should be at least as long as this interpreter. TFLM supports only
@@ -137,6 +209,14 @@ class MicroInterpreter {
   // arena.
   TfLiteStatus PrepareNodeAndRegistrationDataFromFlatbuffer();
 
+  // Logs the nodes the load-time graph rewrite took out of Invoke(): fused
+  // into their producer (e.g. a RELU6 whose clamp became the activation range
+  // of the preceding CONV_2D, or an identity RESHAPE), constant folded, dead
+  // or left to the application, and the arena bytes involved. Returns the
+  // number of such nodes. It's only available after `AllocateTensors` has been
+  // called.
+  size_t PrintEliminatedNodes();
+
   // For debugging only.
   // Returns the actual used arena in bytes. This method gives the optimal arena
   // size. It's only available after `AllocateTensors` has been called.
@@ -145,6 +225,12 @@ class MicroInterpreter {
   // arena_used_bytes() + 16.
   size_t arena_used_bytes() const { return allocator_.used_bytes(); }
 
+  // Part of arena_used_bytes() taken from the budget set with
+  // SetOptionalPersistentBudget(). Only available after AllocateTensors().
+  size_t optional_persistent_bytes() const {
+    return micro_context_.optional_persistent_bytes();
+  }
+
   // Returns True if all Tensors are being preserves
   // TODO(b/297106074) : revisit making C++ example or test for
   // preserve_all_tesnors
@@ -160,6 +246,29 @@ class MicroInterpreter {
   // decompression subsystem.
   TfLiteStatus SetAlternateProfiler(MicroProfilerInterface* alt_profiler);
 
+  // Stages the constant inputs of upcoming operators into faster memory while
+  // the current one runs; see MicroWeightPrefetcher. nullptr disables it. Must
+  // not be called from inside Invoke().
+  void SetWeightPrefetcher(MicroWeightPrefetcher* prefetcher) {
+    graph_.SetWeightPrefetcher(prefetcher);
+  }
+
+  // Top-k output mode, for classifiers whose subgraph 0 ends in a SOFTMAX,
+  // optionally followed by a QUANTIZE or DEQUANTIZE of its output. While
+  // enabled, Invoke() stops before that head, leaving the outputs it writes
+  // stale, and TopK() ranks the softmax input logits instead. Fails if the
+  // model has no such head. It's only available after `AllocateTensors` has
+  // been called.
+  TfLiteStatus SetTopKOutputMode(bool enable);
+
+  // Writes the (at most) `k` best classes of the last Invoke() in top-k output
+  // mode to `entries`, best first and ties to the lower index, and returns how
+  // many were written, or -1 outside that mode. Confidences are
+  // softmax(beta * logits / temperature) of the single logits row, beta being
+  // the one of the SOFTMAX node; a temperature fitted offline on held-out data
+  // calibrates them.
+  int TopK(MicroTopKEntry* entries, int k, float temperature = 1.0f);
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Set the alternate decompression memory regions.
@@ -180,6 +289,51 @@ class MicroInterpreter {
   // error reporting during initialization.
   void Init(MicroProfilerInterface* profiler);
 
+  // Load-time graph rewrite: folds a RELU6 into the activation range of the
+  // CONV_2D or DEPTHWISE_CONV_2D producing its input when that input has no
+  // other consumer and the same quantization as the RELU6 output. The RELU6 is
+  // then skipped and its output planned into the producer's buffer, so this
+  // only runs when the allocator plans in-place outputs.
+  TfLiteStatus FuseActivations();
+
+  // Load-time graph rewrite: marks as dead the nodes of pure operators whose
+  // outputs nothing reads, last node first so that whole dead branches go.
+  TfLiteStatus RemoveDeadNodes();
+
+  // Load-time graph rewrite: marks as constant folded the nodes of pure
+  // operators whose inputs are all constant, including the outputs of other
+  // folded nodes, and gives their outputs persistent buffers. AllocateTensors
+  // evaluates them once after planning, so their outputs are constants from
+  // then on and never take planned activation memory.
+  TfLiteStatus FoldConstantNodes();
+
+  // Load-time graph rewrite: a QUANTIZE reading the only output of a
+  // DEQUANTIZE, or of a QUANTIZE whose output range covers its own, becomes
+  // part of that node, which requantizes in one step into its own buffer. A
+  // value on a rounding boundary can land one step away from the two-step
+  // result, so it only runs after SetRequantizeChainCollapse(true). Like
+  // FuseActivations, it also needs the allocator to plan in-place outputs.
+  TfLiteStatus CollapseRequantizeChains();
+
+  // Load-time graph rewrite: skips RESHAPE, SQUEEZE and EXPAND_DIMS, and a
+  // QUANTIZE that keeps the int8 quantization, when their input has no other
+  // reader. Their output is planned into the input buffer, so this only runs
+  // when the allocator plans in-place outputs.
+  TfLiteStatus RemoveIdentityNodes();
+
+  // Load-time graph rewrite: marks the boundary conversions left to the
+  // application, see SetApplicationBoundaryConversions().
+  TfLiteStatus MarkBoundaryConversions();
+
+  // Tensor that input() or output() returns for the subgraph 0 input or
+  // output `tensor_index`: the other side of its boundary conversion, if any.
+  int ApplicationTensorIndex(int tensor_index);
+
+  // Last operator of subgraph 0 that writes the tensor output() returns for
+  // output `output_idx`. Follows operators fused into others. Returns -1 for
+  // an output no operator writes at Invoke(), e.g. a constant folded one.
+  int OutputProducer(size_t output_idx);
+
   // Gets the current subgraph index used from within context methods.
   int get_subgraph_index() { return graph_.GetCurrentSubgraphIndex(); }
 
@@ -189,6 +343,9 @@ class MicroInterpreter {
   MicroAllocator& allocator_;
   MicroInterpreterGraph graph_;
   bool tensors_allocated_;
+  bool application_boundary_conversions_ = false;
+  bool load_time_graph_rewrites_ = true;
+  bool requantize_chain_collapse_ = false;
 
   TfLiteStatus initialization_status_;
 
@@ -199,6 +356,14 @@ class MicroInterpreter {
   TfLiteTensor** input_tensors_;
   TfLiteTensor** output_tensors_;
 
+  // OutputProducer() of each output, for DeepestCompletedOutput().
+  int* output_producers_ = nullptr;
+
+  // Softmax input ranked by TopK(), nullptr outside top-k output mode, and
+  // the real value of one logit step times the softmax beta.
+  const TfLiteEvalTensor* top_k_logits_ = nullptr;
+  float top_k_logit_scale_ = 0.0f;
+
   MicroInterpreterContext micro_context_;
 };
 
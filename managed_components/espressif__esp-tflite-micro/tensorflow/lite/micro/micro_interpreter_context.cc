@@ -65,6 +65,19 @@ void* MicroInterpreterContext::AllocatePersistentBuffer(size_t bytes) {
   return allocator_.AllocatePersistentBuffer(bytes);
 }
 
+void* MicroInterpreterContext::AllocateOptionalPersistentBuffer(size_t bytes) {
+  TFLITE_DCHECK(state_ == InterpreterState::kPrepare ||
+                state_ == InterpreterState::kInit);
+  if (bytes > optional_persistent_budget_ - optional_persistent_bytes_) {
+    return nullptr;
+  }
+  void* buffer = allocator_.AllocatePersistentBuffer(bytes);
+  if (buffer != nullptr) {
+    optional_persistent_bytes_ += bytes;
+  }
+  return buffer;
+}
+
 TfLiteStatus MicroInterpreterContext::RequestScratchBufferInArena(
     size_t bytes, int* buffer_idx) {
   TFLITE_DCHECK(state_ == InterpreterState::kPrepare);
@@ -72,6 +85,22 @@ TfLiteStatus MicroInterpreterContext::RequestScratchBufferInArena(
       bytes, graph_.GetCurrentSubgraphIndex(), buffer_idx);
 }
 
+TfLiteStatus MicroInterpreterContext::AllowInPlaceOutput(
+    const TfLiteNode* node, int input_index) {
+  TFLITE_DCHECK(state_ == InterpreterState::kPrepare);
+  if (input_index < 0 || input_index >= node->inputs->size ||
+      input_index >= kMaxInPlaceInputs) {
+    MicroPrintf("Invalid in-place input index %d", input_index);
+    return kTfLiteError;
+  }
+  NodeAndRegistration& node_and_registration =
+      graph_.GetAllocations()[graph_.GetCurrentSubgraphIndex()]
+          .node_and_registrations[graph_.GetCurrentOperatorIndex()];
+  TFLITE_DCHECK(&node_and_registration.node == node);
+  node_and_registration.in_place_inputs |= 1u << input_index;
+  return kTfLiteOk;
+}
+
 void* MicroInterpreterContext::GetScratchBuffer(int buffer_idx) {
   TFLITE_DCHECK(state_ == InterpreterState::kInvoke);
   ScratchBufferHandle* handle = scratch_buffer_handles_ + buffer_idx;
@@ -64,6 +64,16 @@ class MicroInterpreterContext : public MicroContext {
   // Virtual so that it can be faked for kernel tests.
   virtual void* GetScratchBuffer(int buffer_idx) override;
 
+  // Allocates a persistent buffer if it fits in what is left of the budget
+  // set with SetOptionalPersistentBudget().
+  // This method is only available in Init or Prepare stage.
+  void* AllocateOptionalPersistentBuffer(size_t bytes) override;
+
+  // Records that output 0 of the node may share the buffer of input
+  // `input_index`. This method is only available in Prepare stage.
+  TfLiteStatus AllowInPlaceOutput(const TfLiteNode* node,
+                                  int input_index) override;
+
   // Returns a temporary TfLiteTensor struct for a given index.
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteTensor* AllocateTempTfLiteTensor(int tensor_idx) override;
@@ -106,6 +116,18 @@ class MicroInterpreterContext : public MicroContext {
   // housekeeping in MicroInterpreterContext.
   void SetScratchBufferHandles(ScratchBufferHandle* scratch_buffer_handles);
 
+  // Not API between TFLM and kernels. Sets the number of arena bytes that
+  // AllocateOptionalPersistentBuffer() may hand out in total.
+  void SetOptionalPersistentBudget(size_t bytes) {
+    optional_persistent_budget_ = bytes;
+  }
+
+  // Not API between TFLM and kernels. Bytes handed out by
+  // AllocateOptionalPersistentBuffer() so far.
+  size_t optional_persistent_bytes() const {
+    return optional_persistent_bytes_;
+  }
+
 #ifdef USE_TFLM_COMPRESSION
 
   // Available during Prepare & Eval. Returns false if tensor is not
@@ -168,6 +190,8 @@ class MicroInterpreterContext : public MicroContext {
   ScratchBufferHandle* scratch_buffer_handles_ = nullptr;
   void* external_context_payload_ = nullptr;
   MicroProfilerInterface* alt_profiler_ = nullptr;
+  size_t optional_persistent_budget_ = 0;
+  size_t optional_persistent_bytes_ = 0;
 
 #ifdef USE_TFLM_COMPRESSION
 
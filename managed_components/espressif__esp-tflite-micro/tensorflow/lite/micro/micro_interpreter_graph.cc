@@ -25,6 +25,8 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_context.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/micro_utils.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 #ifdef USE_TFLM_COMPRESSION
@@ -44,6 +46,41 @@ const char* OpNameFromRegistration(const TFLMRegistration* registration) {
   }
 }
 
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+// Multiply-accumulates done by a conv, depthwise conv or fully connected
+// operator: each output element takes one filter slice. 0 for other
+// operators, whose cost is not dominated by MACs.
+uint64_t NodeMacs(const TFLMRegistration* registration, const TfLiteNode* node,
+                  const TfLiteEvalTensor* eval_tensors) {
+  int slice_dim;
+  switch (registration->builtin_code) {
+    case BuiltinOperator_CONV_2D:
+    case BuiltinOperator_FULLY_CONNECTED:
+      slice_dim = 0;
+      break;
+    case BuiltinOperator_DEPTHWISE_CONV_2D:
+      slice_dim = 3;
+      break;
+    default:
+      return 0;
+  }
+  if (node->inputs == nullptr || node->inputs->size < 2 ||
+      node->outputs == nullptr || node->outputs->size < 1 ||
+      node->inputs->data[1] < 0) {
+    return 0;
+  }
+  const TfLiteIntArray* filter_dims =
+      eval_tensors[node->inputs->data[1]].dims;
+  const TfLiteIntArray* output_dims =
+      eval_tensors[node->outputs->data[0]].dims;
+  if (filter_dims->size <= slice_dim || filter_dims->data[slice_dim] <= 0) {
+    return 0;
+  }
+  return static_cast<uint64_t>(ElementCount(*output_dims)) *
+         (ElementCount(*filter_dims) / filter_dims->data[slice_dim]);
+}
+#endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS)
+
 // Check tensor shapes to determine if there are dynamic tensors present.
 // Returns the index of the first dynamic tensor found, otherwise returns -1.
 int CheckDynamicTensors(const TfLiteIntArray* const tensor_indices,
@@ -95,6 +132,22 @@ MicroInterpreterGraph::MicroInterpreterGraph(
 
 MicroInterpreterGraph::~MicroInterpreterGraph() {}
 
+bool MicroInterpreterGraph::IsRemovedNode(int subgraph_idx,
+                                          uint32_t operator_idx) const {
+  const NodeAndRegistration& node_and_registration =
+      subgraph_allocations_[subgraph_idx].node_and_registrations[operator_idx];
+  return node_and_registration.fused_into >= 0 ||
+         node_and_registration.boundary_conversion;
+}
+
+bool MicroInterpreterGraph::IsSkippedAtInvoke(int subgraph_idx,
+                                              uint32_t operator_idx) const {
+  const NodeAndRegistration& node_and_registration =
+      subgraph_allocations_[subgraph_idx].node_and_registrations[operator_idx];
+  return IsRemovedNode(subgraph_idx, operator_idx) ||
+         node_and_registration.constant_folded || node_and_registration.dead;
+}
+
 TfLiteStatus MicroInterpreterGraph::InitSubgraphs() {
   int previous_subgraph_idx = current_subgraph_index_;
   uint32_t previous_operator_idx = current_operator_index_;
@@ -105,6 +158,9 @@ TfLiteStatus MicroInterpreterGraph::InitSubgraphs() {
     uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
     for (current_operator_index_ = 0; current_operator_index_ < operators_size;
          ++current_operator_index_) {
+      if (IsRemovedNode(subgraph_idx, current_operator_index_)) {
+        continue;
+      }
       TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                                .node_and_registrations[current_operator_index_]
                                .node);
@@ -142,6 +198,9 @@ TfLiteStatus MicroInterpreterGraph::PrepareSubgraphs() {
     uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
     for (current_operator_index_ = 0; current_operator_index_ < operators_size;
          ++current_operator_index_) {
+      if (IsRemovedNode(subgraph_idx, current_operator_index_)) {
+        continue;
+      }
       TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                                .node_and_registrations[current_operator_index_]
                                .node);
@@ -192,6 +251,9 @@ TfLiteStatus MicroInterpreterGraph::ResetSubgraphs() {
     uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
     for (current_operator_index_ = 0; current_operator_index_ < operators_size;
          ++current_operator_index_) {
+      if (IsRemovedNode(subgraph_idx, current_operator_index_)) {
+        continue;
+      }
       TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                                .node_and_registrations[current_operator_index_]
                                .node);
@@ -222,6 +284,9 @@ TfLiteStatus MicroInterpreterGraph::FreeSubgraphs() {
     uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
     for (current_operator_index_ = 0; current_operator_index_ < operators_size;
          ++current_operator_index_) {
+      if (IsRemovedNode(subgraph_idx, current_operator_index_)) {
+        continue;
+      }
       TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                                .node_and_registrations[current_operator_index_]
                                .node);
@@ -254,8 +319,56 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
   }
   TfLiteStatus invoke_status = kTfLiteOk;
   uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
-  for (current_operator_index_ = 0; current_operator_index_ < operators_size;
-       ++current_operator_index_) {
+  if (subgraph_idx == 0) {
+    operators_size -= skipped_tail_operators_;
+  }
+  // Only an inference of subgraph 0 can be suspended at a deadline, and it
+  // resumes at the operator where it stopped.
+  const bool resuming = subgraph_idx == 0 && invoke_suspended_;
+  const uint32_t first_operator_idx = resuming ? completed_operators_ : 0;
+  if (subgraph_idx == 0) {
+    invoke_suspended_ = false;
+  }
+  // Control flow subgraphs run nested inside an operator of subgraph 0, so
+  // only subgraph 0 drives the prefetcher.
+  MicroWeightPrefetcher* prefetcher =
+      subgraph_idx == 0 ? weight_prefetcher_ : nullptr;
+  if (prefetcher != nullptr) {
+    prefetcher->BeginInvoke(model_, &subgraph_allocations_[0],
+                            first_operator_idx);
+  }
+  // A resumed inference continues the invoke the profiler is in, so that its
+  // events keep lining up with the operators.
+  MicroProfilerInterface* profiler =
+      subgraph_idx == 0
+          ? reinterpret_cast<MicroProfilerInterface*>(context_->profiler)
+          : nullptr;
+  if (profiler != nullptr && !resuming) {
+    profiler->BeginInvoke();
+  }
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  // Per-operator events, with the op name and MAC lookups they need, are
+  // only made for a profiler that records the current inference.
+  MicroProfilerInterface* node_profiler =
+      reinterpret_cast<MicroProfilerInterface*>(context_->profiler);
+  if (node_profiler != nullptr && !node_profiler->IsInvokeSampled()) {
+    node_profiler = nullptr;
+  }
+  const bool node_macs =
+      node_profiler != nullptr && node_profiler->RecordsEventMacs();
+#endif
+  for (current_operator_index_ = first_operator_idx;
+       current_operator_index_ < operators_size; ++current_operator_index_) {
+    if (IsSkippedAtInvoke(subgraph_idx, current_operator_index_)) {
+      continue;
+    }
+    // Signed difference, so that the tick counter may wrap around.
+    if (subgraph_idx == 0 && has_deadline_ &&
+        static_cast<int32_t>(GetCurrentTimeTicks() - deadline_ticks_) >= 0) {
+      invoke_suspended_ = true;
+      invoke_status = kTfLiteAbort;
+      break;
+    }
     TfLiteNode* node = &(subgraph_allocations_[subgraph_idx]
                              .node_and_registrations[current_operator_index_]
                              .node);
@@ -264,13 +377,22 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
             .node_and_registrations[current_operator_index_]
             .registration;
 
+    if (prefetcher != nullptr) {
+      prefetcher->BeforeNode(current_operator_index_);
+    }
+
 // This ifdef is needed (even though ScopedMicroProfiler itself is a no-op with
 // -DTF_LITE_STRIP_ERROR_STRINGS) because the function OpNameFromRegistration is
 // only defined for builds with the error strings.
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
     ScopedMicroProfiler scoped_profiler(
-        OpNameFromRegistration(registration),
-        reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
+        node_profiler != nullptr ? OpNameFromRegistration(registration)
+                                 : nullptr,
+        node_profiler);
+    if (node_macs) {
+      scoped_profiler.SetMacs(NodeMacs(
+          registration, node, subgraph_allocations_[subgraph_idx].tensors));
+    }
 #endif
 
     TFLITE_DCHECK(registration->invoke);
@@ -278,6 +400,9 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
 #ifdef USE_TFLM_COMPRESSION
     GetMicroContext(context_)->ResetDecompressionMemoryAllocations();
 #endif  // USE_TFLM_COMPRESSION
+    if (prefetcher != nullptr) {
+      prefetcher->AfterNode(current_operator_index_);
+    }
 
     // All TfLiteTensor structs used in the kernel are allocated from temp
     // memory in the allocator. This creates a chain of allocations in the
@@ -295,6 +420,15 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
       break;
     }
   }
+  if (subgraph_idx == 0) {
+    completed_operators_ = current_operator_index_;
+  }
+  if (prefetcher != nullptr) {
+    prefetcher->EndInvoke();
+  }
+  if (profiler != nullptr && !invoke_suspended_) {
+    profiler->EndInvoke();
+  }
 
   current_subgraph_index_ = previous_subgraph_idx;
   current_operator_index_ = previous_operator_idx;
@@ -302,6 +436,44 @@ TfLiteStatus MicroInterpreterGraph::InvokeSubgraph(int subgraph_idx) {
   return invoke_status;
 }
 
+TfLiteStatus MicroInterpreterGraph::InvokeConstantFoldedNodes() {
+  int previous_subgraph_idx = current_subgraph_index_;
+  uint32_t previous_operator_idx = current_operator_index_;
+
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    current_subgraph_index_ = subgraph_idx;
+    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    for (current_operator_index_ = 0; current_operator_index_ < operators_size;
+         ++current_operator_index_) {
+      NodeAndRegistration& node_and_registration =
+          subgraph_allocations_[subgraph_idx]
+              .node_and_registrations[current_operator_index_];
+      if (!node_and_registration.constant_folded) {
+        continue;
+      }
+      const TFLMRegistration* registration =
+          node_and_registration.registration;
+      TFLITE_DCHECK(registration->invoke);
+      TfLiteStatus invoke_status =
+          registration->invoke(context_, &node_and_registration.node);
+      allocator_->ResetTempAllocations();
+      if (invoke_status != kTfLiteOk) {
+        MicroPrintf("Constant folded node %s (number %u) failed to invoke",
+                    OpNameFromRegistration(registration),
+                    current_operator_index_);
+        current_subgraph_index_ = previous_subgraph_idx;
+        current_operator_index_ = previous_operator_idx;
+        return kTfLiteError;
+      }
+    }
+  }
+  current_subgraph_index_ = previous_subgraph_idx;
+  current_operator_index_ = previous_operator_idx;
+
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroInterpreterGraph::ResetVariableTensors() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
@@ -20,6 +20,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_common.h"
 #include "tensorflow/lite/micro/micro_graph.h"
 #include "tensorflow/lite/micro/micro_resource_variable.h"
+#include "tensorflow/lite/micro/micro_weight_prefetcher.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
@@ -59,6 +60,10 @@ class MicroInterpreterGraph : public MicroGraph {
   // in the model.
   virtual TfLiteStatus InvokeSubgraph(int subgraph_idx);
 
+  // Invokes once the nodes of every subgraph that the load-time graph rewrite
+  // marked as constant folded; InvokeSubgraph() skips them afterwards.
+  TfLiteStatus InvokeConstantFoldedNodes();
+
   // Zeros out all variable tensors in all subgraphs in the model.
   virtual TfLiteStatus ResetVariableTensors();
 
@@ -98,7 +103,45 @@ class MicroInterpreterGraph : public MicroGraph {
   // Get the resource variables for this TFLM graph.
   MicroResourceVariables* GetResourceVariables() { return resource_variables_; }
 
+  // Stages the constant inputs of subgraph 0 through `prefetcher` during
+  // InvokeSubgraph(0); nullptr disables it.
+  void SetWeightPrefetcher(MicroWeightPrefetcher* prefetcher) {
+    weight_prefetcher_ = prefetcher;
+  }
+
+  // InvokeSubgraph(0) leaves out the last `count` operators of subgraph 0.
+  void SetSkippedTailOperators(uint32_t count) {
+    skipped_tail_operators_ = count;
+  }
+
+  // Before each operator of subgraph 0, InvokeSubgraph(0) checks whether
+  // GetCurrentTimeTicks() has reached `deadline_ticks`. If so, it returns
+  // kTfLiteAbort and leaves the inference suspended at that operator.
+  void SetInvokeDeadline(uint32_t deadline_ticks) {
+    has_deadline_ = true;
+    deadline_ticks_ = deadline_ticks;
+  }
+  void ClearInvokeDeadline() { has_deadline_ = false; }
+
+  // The next InvokeSubgraph(0) continues a suspended inference from the
+  // operator where it stopped. Discarding it makes that call start over.
+  bool invoke_suspended() const { return invoke_suspended_; }
+  void DiscardSuspendedInvoke() { invoke_suspended_ = false; }
+
+  // Number of leading operators of subgraph 0 that the last or the suspended
+  // inference has run. After an inference that completes, this is every
+  // operator except the skipped tail.
+  uint32_t completed_operators() const { return completed_operators_; }
+
  private:
+  // Returns true if the node was folded into its producer at load time, or is
+  // a boundary conversion left to the application, and must be skipped.
+  bool IsRemovedNode(int subgraph_idx, uint32_t operator_idx) const;
+
+  // Returns true if InvokeSubgraph() leaves the node out: it is removed,
+  // constant folded or dead.
+  bool IsSkippedAtInvoke(int subgraph_idx, uint32_t operator_idx) const;
+
   TfLiteContext* context_;
   const Model* model_;
   MicroAllocator* allocator_;
@@ -106,6 +149,12 @@ class MicroInterpreterGraph : public MicroGraph {
   int current_subgraph_index_;
   uint32_t current_operator_index_;
   MicroResourceVariables* resource_variables_;
+  MicroWeightPrefetcher* weight_prefetcher_ = nullptr;
+  uint32_t skipped_tail_operators_ = 0;
+  bool has_deadline_ = false;
+  uint32_t deadline_ticks_ = 0;
+  bool invoke_suspended_ = false;
+  uint32_t completed_operators_ = 0;
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs_ =
       nullptr;  // Initialized as nullptr to prevent any possible issues
                 // related to accessing uninitialized memory.
@@ -18,13 +18,22 @@ limitations under the License.
 #include <cinttypes>
 #include <cstdint>
 #include <cstring>
-#include <iterator>
 
 #include "tensorflow/lite/kernels/internal/compatibility.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_time.h"
 
 namespace tflite {
+namespace {
+
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+// Cycles per MAC in hundredths, printed as "%u.%02u"; 0 without MACs.
+uint32_t CentiCyclesPerMac(uint64_t cycles, uint64_t macs) {
+  return macs > 0 ? static_cast<uint32_t>(cycles * 100 / macs) : 0;
+}
+#endif
+
+}  // namespace
 
 uint32_t MicroProfiler::BeginEvent(const char* tag) {
   if (num_events_ == kMaxEvents) {
@@ -36,43 +45,73 @@ uint32_t MicroProfiler::BeginEvent(const char* tag) {
   }
 
   tags_[num_events_] = tag;
-  start_ticks_[num_events_] = GetCurrentTimeTicks();
-  end_ticks_[num_events_] = start_ticks_[num_events_] - 1;
+  macs_[num_events_] = 0;
+  cycles_[num_events_] = 0;
+  start_cycles_[num_events_] =
+      static_cast<uint32_t>(GetCurrentTimeCycles());
   return num_events_++;
 }
 
 void MicroProfiler::EndEvent(uint32_t event_handle) {
   TFLITE_DCHECK(event_handle < kMaxEvents);
-  end_ticks_[event_handle] = GetCurrentTimeTicks();
+  cycles_[event_handle] = static_cast<uint32_t>(GetCurrentTimeCycles()) -
+                          start_cycles_[event_handle];
+}
+
+void MicroProfiler::SetEventMacs(uint32_t event_handle, uint64_t macs) {
+  TFLITE_DCHECK(event_handle < kMaxEvents);
+  macs_[event_handle] =
+      static_cast<uint32_t>(std::min<uint64_t>(macs, UINT32_MAX));
 }
 
 uint32_t MicroProfiler::GetTotalTicks() const {
-  int32_t ticks = 0;
+  return static_cast<uint32_t>(
+      ScaleCycles(GetTotalCycles(), ticks_per_second()));
+}
+
+uint64_t MicroProfiler::GetTotalCycles() const {
+  uint64_t cycles = 0;
   for (int i = 0; i < num_events_; ++i) {
-    ticks += end_ticks_[i] - start_ticks_[i];
+    cycles += cycles_[i];
   }
-  return ticks;
+  return cycles;
 }
 
 void MicroProfiler::Log() const {
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
   for (int i = 0; i < num_events_; ++i) {
-    uint32_t ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%s took %u ticks (%d ms).", tags_[i], ticks, TicksToMs(ticks));
+    const uint64_t cycles = cycles_[i];
+    if (macs_[i] == 0) {
+      MicroPrintf("%s took %" PRIu64 " cycles (%" PRIu64 " us).", tags_[i],
+                  cycles, CyclesToUs(cycles));
+      continue;
+    }
+    const uint32_t centi = CentiCyclesPerMac(cycles, macs_[i]);
+    MicroPrintf("%s took %" PRIu64 " cycles (%" PRIu64
+                " us), %u.%02u cycles/MAC.",
+                tags_[i], cycles, CyclesToUs(cycles),
+                static_cast<unsigned>(centi / 100),
+                static_cast<unsigned>(centi % 100));
   }
 #endif
 }
 
 void MicroProfiler::LogCsv() const {
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
-  MicroPrintf("\"Event\",\"Tag\",\"Ticks\"");
+  MicroPrintf("\"Event\",\"Tag\",\"Cycles\",\"Us\",\"MACs\",\"Cycles/MAC\"");
   for (int i = 0; i < num_events_; ++i) {
+    const uint64_t cycles = cycles_[i];
+    const uint32_t centi = CentiCyclesPerMac(cycles, macs_[i]);
 #if defined(HEXAGON) || defined(CMSIS_NN)
-    int ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%d,%s,%d", i, tags_[i], ticks);
+    MicroPrintf("%d,%s,%d,%d,%d,%d.%02d", i, tags_[i],
+                static_cast<int>(cycles), static_cast<int>(CyclesToUs(cycles)),
+                static_cast<int>(macs_[i]), static_cast<int>(centi / 100),
+                static_cast<int>(centi % 100));
 #else
-    uint32_t ticks = end_ticks_[i] - start_ticks_[i];
-    MicroPrintf("%d,%s,%" PRIu32, i, tags_[i], ticks);
+    MicroPrintf("%d,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu32 ",%u.%02u", i,
+                tags_[i], cycles, CyclesToUs(cycles), macs_[i],
+                static_cast<unsigned>(centi / 100),
+                static_cast<unsigned>(centi % 100));
 #endif
   }
 #endif
@@ -81,52 +120,41 @@ void MicroProfiler::LogCsv() const {
 void MicroProfiler::LogTicksPerTagCsv() {
 #if !defined(TF_LITE_STRIP_ERROR_STRINGS)
   MicroPrintf(
-      "\"Unique Tag\",\"Total ticks across all events with that tag.\"");
-  int total_ticks = 0;
+      "\"Unique Tag\",\"Total cycles across all events with that tag.\","
+      "\"Us\",\"Cycles/MAC\"");
+  uint64_t total_cycles = 0;
   for (int i = 0; i < num_events_; ++i) {
-    uint32_t ticks = end_ticks_[i] - start_ticks_[i];
     TFLITE_DCHECK(tags_[i] != nullptr);
-    int position = FindExistingOrNextPosition(tags_[i]);
-    TFLITE_DCHECK(position >= 0);
-    total_ticks_per_tag_[position].tag = tags_[i];
-    total_ticks_per_tag_[position].ticks =
-        total_ticks_per_tag_[position].ticks + ticks;
-    total_ticks += ticks;
-  }
-
-  for (int i = 0; i < num_events_; ++i) {
-    TicksPerTag each_tag_entry = total_ticks_per_tag_[i];
-    if (each_tag_entry.tag == nullptr) {
-      break;
+    total_cycles += cycles_[i];
+    if (FirstEventWithTag(tags_[i]) < i) {
+      continue;
     }
-    MicroPrintf("%s, %d", each_tag_entry.tag, each_tag_entry.ticks);
+    uint64_t cycles = 0;
+    uint64_t macs = 0;
+    for (int j = i; j < num_events_; ++j) {
+      if (tags_[j] == tags_[i] || strcmp(tags_[j], tags_[i]) == 0) {
+        cycles += cycles_[j];
+        macs += macs_[j];
+      }
+    }
+    const uint32_t centi = CentiCyclesPerMac(cycles, macs);
+    MicroPrintf("%s, %" PRIu64 ", %" PRIu64 ", %u.%02u", tags_[i], cycles,
+                CyclesToUs(cycles), static_cast<unsigned>(centi / 100),
+                static_cast<unsigned>(centi % 100));
   }
-  MicroPrintf("\"total number of ticks\", %d", total_ticks);
+  MicroPrintf("\"total number of cycles\", %" PRIu64 ", %" PRIu64,
+              total_cycles, CyclesToUs(total_cycles));
 #endif
 }
 
-// This method finds a particular array element in the total_ticks_per_tag array
-// with the matching tag_name passed in the method. If it can find a
-// matching array element that has the same tag_name, then it will return the
-// position of the matching element. But if it unable to find a matching element
-// with the given tag_name, it will return the next available empty position
-// from the array.
-int MicroProfiler::FindExistingOrNextPosition(const char* tag_name) {
+int MicroProfiler::FirstEventWithTag(const char* tag_name) const {
   int pos = 0;
-  for (; pos < num_events_; pos++) {
-    TicksPerTag each_tag_entry = total_ticks_per_tag_[pos];
-    if (each_tag_entry.tag == nullptr ||
-        strcmp(each_tag_entry.tag, tag_name) == 0) {
-      return pos;
-    }
+  while (tags_[pos] != tag_name && strcmp(tags_[pos], tag_name) != 0) {
+    pos++;
   }
-  return pos < num_events_ ? pos : -1;
+  return pos;
 }
 
-void MicroProfiler::ClearEvents() {
-  std::fill_n(std::begin(total_ticks_per_tag_), num_events_, TicksPerTag{});
-
-  num_events_ = 0;
-}
+void MicroProfiler::ClearEvents() { num_events_ = 0; }
 
 }  // namespace tflite
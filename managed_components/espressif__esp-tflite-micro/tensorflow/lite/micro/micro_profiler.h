@@ -44,6 +44,11 @@ class MicroProfiler : public MicroProfilerInterface {
   // for a particular event_handle, the duration of that event will be 0 ticks.
   virtual void EndEvent(uint32_t event_handle) override;
 
+  // Records the multiply-accumulates done by the event. Log() and the CSV
+  // output add the cycles per MAC of events that have them.
+  virtual void SetEventMacs(uint32_t event_handle, uint64_t macs) override;
+  virtual bool RecordsEventMacs() const override { return true; }
+
   // Clears all the events that have been currently profiled.
   void ClearEvents();
 
@@ -52,6 +57,10 @@ class MicroProfiler : public MicroProfilerInterface {
   // event[i] <= start time of event[i+1]).
   uint32_t GetTotalTicks() const;
 
+  // Same as GetTotalTicks(), in cycles of the profiling clock
+  // (GetCurrentTimeCycles()), which events are timed with.
+  uint64_t GetTotalCycles() const;
+
   // Prints the profiling information of each of the events in human readable
   // form.
   void Log() const;
@@ -60,9 +69,11 @@ class MicroProfiler : public MicroProfilerInterface {
   // Separated Value) form.
   void LogCsv() const;
 
-  // Prints  total ticks for each unique tag in CSV format.
+  // Prints  total cycles for each unique tag in CSV format.
   // Output will have one row for each unique tag along with the
-  // total ticks summed across all events with that particular tag.
+  // total cycles summed across all events with that particular tag.
+  // The totals are summed while printing, in time proportional to the number
+  // of events times the number of unique tags.
   void LogTicksPerTagCsv();
 
  private:
@@ -71,22 +82,20 @@ class MicroProfiler : public MicroProfilerInterface {
   // of times. Increase this number if you need more events.
   static constexpr int kMaxEvents = 4096;
 
+  // Index of the first event whose tag matches `tag_name`.
+  int FirstEventWithTag(const char* tag_name) const;
+
+  // Each event keeps the low 32 bits of its start and its duration in 32
+  // bits, so one that lasts 2^32 cycles or more (26.8 s at 160 MHz) is
+  // measured modulo 2^32. Totals are summed in 64 bits when reported.
   const char* tags_[kMaxEvents];
-  uint32_t start_ticks_[kMaxEvents];
-  uint32_t end_ticks_[kMaxEvents];
+  uint32_t start_cycles_[kMaxEvents];
+  uint32_t cycles_[kMaxEvents];
+  // Saturated: no single operator comes close to 2^32 MACs on a
+  // microcontroller.
+  uint32_t macs_[kMaxEvents];
   int num_events_ = 0;
 
-  struct TicksPerTag {
-    const char* tag;
-    uint32_t ticks;
-  };
-  // In practice, the number of tags will be much lower than the number of
-  // events. But it is theoretically possible that each event to be unique and
-  // hence we allow total_ticks_per_tag to have kMaxEvents entries.
-  TicksPerTag total_ticks_per_tag_[kMaxEvents] = {};
-
-  int FindExistingOrNextPosition(const char* tag_name);
-
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
@@ -99,6 +108,7 @@ class ScopedMicroProfiler {
  public:
   explicit ScopedMicroProfiler(const char* tag,
                                MicroProfilerInterface* profiler) {}
+  void SetMacs(uint64_t macs) {}
 };
 
 #else
@@ -129,6 +139,13 @@ class ScopedMicroProfiler {
     }
   }
 
+  // Records the multiply-accumulates done inside the scope.
+  void SetMacs(uint64_t macs) {
+    if (profiler_ != nullptr) {
+      profiler_->SetEventMacs(event_handle_, macs);
+    }
+  }
+
  private:
   uint32_t event_handle_ = 0;
   MicroProfilerInterface* profiler_ = nullptr;
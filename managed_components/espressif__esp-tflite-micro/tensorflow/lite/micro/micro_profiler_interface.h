@@ -31,6 +31,24 @@ class MicroProfilerInterface {
 
   // Marks the end of an event associated with event_handle.
   virtual void EndEvent(uint32_t event_handle) = 0;
+
+  // Records the multiply-accumulates done by the event, for profilers that
+  // report cycles per MAC. Optional.
+  virtual void SetEventMacs(uint32_t event_handle, uint64_t macs) {}
+
+  // True for profilers that override SetEventMacs(). The interpreter only
+  // works out the MACs of each operator for them.
+  virtual bool RecordsEventMacs() const { return false; }
+
+  // Called by the interpreter before and after each Invoke(), for profilers
+  // that aggregate per inference. Optional.
+  virtual void BeginInvoke() {}
+  virtual void EndInvoke() {}
+
+  // Whether the events of the current Invoke() are recorded. When they are
+  // not, the interpreter skips the per-operator events, and with them the op
+  // name and MAC lookups. Optional.
+  virtual bool IsInvokeSampled() const { return true; }
 };
 
 }  // namespace tflite
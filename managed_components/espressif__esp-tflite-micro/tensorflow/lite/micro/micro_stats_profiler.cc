@@ -0,0 +1,223 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_stats_profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kSubBucketBits = 3;
+static_assert(1 << kSubBucketBits == MicroStatsProfiler::kSubBuckets,
+              "kSubBuckets must be 1 << kSubBucketBits");
+
+int Octave(uint32_t cycles) {
+  int octave = 0;
+  while (cycles >>= 1) {
+    octave++;
+  }
+  return octave;
+}
+
+// Histogram bucket of `cycles`: the octave above `first_octave`, then the
+// next kSubBucketBits bits below the leading one.
+int Bucket(uint32_t cycles, int first_octave) {
+  if (cycles == 0) {
+    return 0;
+  }
+  const int octave = Octave(cycles);
+  if (octave < first_octave) {
+    return 0;
+  }
+  const int sub =
+      octave >= kSubBucketBits
+          ? (cycles >> (octave - kSubBucketBits)) & ((1 << kSubBucketBits) - 1)
+          : (cycles << (kSubBucketBits - octave)) &
+                ((1 << kSubBucketBits) - 1);
+  const int bucket = (octave - first_octave) * MicroStatsProfiler::kSubBuckets +
+                     sub;
+  return std::min(bucket, MicroStatsProfiler::kBuckets - 1);
+}
+
+// First duration past `bucket`.
+uint64_t BucketEnd(int bucket, int first_octave) {
+  const int octave = first_octave + bucket / MicroStatsProfiler::kSubBuckets;
+  const uint64_t sub = bucket % MicroStatsProfiler::kSubBuckets;
+  return ((MicroStatsProfiler::kSubBuckets + sub + 1) << octave) >>
+         kSubBucketBits;
+}
+
+}  // namespace
+
+MicroStatsProfiler::MicroStatsProfiler(NodeStats* nodes, int max_nodes,
+                                       uint32_t sample_interval)
+    : nodes_(nodes), max_nodes_(max_nodes) {
+  set_sample_interval(sample_interval);
+  Reset();
+}
+
+void MicroStatsProfiler::set_sample_interval(uint32_t sample_interval) {
+  sample_interval_ = sample_interval > 0 ? sample_interval : 1;
+}
+
+void MicroStatsProfiler::Reset() {
+  std::fill_n(nodes_, max_nodes_, NodeStats{});
+  num_nodes_ = 0;
+  invokes_ = 0;
+  sampled_invokes_ = 0;
+  dropped_events_ = 0;
+  sampling_ = false;
+  next_event_ = 0;
+}
+
+void MicroStatsProfiler::BeginInvoke() {
+  sampling_ = invokes_ % sample_interval_ == 0;
+  invokes_++;
+  next_event_ = 0;
+}
+
+void MicroStatsProfiler::EndInvoke() {
+  if (sampling_) {
+    sampled_invokes_++;
+  }
+  sampling_ = false;
+}
+
+uint32_t MicroStatsProfiler::BeginEvent(const char* tag) {
+  if (!sampling_) {
+    return kNoEvent;
+  }
+  const int index = next_event_++;
+  if (index >= max_nodes_) {
+    dropped_events_++;
+    return kNoEvent;
+  }
+  NodeStats& stats = nodes_[index];
+  // A different operator at this position means the events no longer line
+  // up with what was recorded, e.g. another model is running.
+  if (stats.tag != tag) {
+    stats = NodeStats{};
+    stats.tag = tag;
+  }
+  num_nodes_ = std::max(num_nodes_, index + 1);
+  stats.start_cycles = GetCurrentTimeCycles();
+  return index;
+}
+
+void MicroStatsProfiler::EndEvent(uint32_t event_handle) {
+  if (event_handle == kNoEvent) {
+    return;
+  }
+  NodeStats& stats = nodes_[event_handle];
+  const uint64_t cycles = GetCurrentTimeCycles() - stats.start_cycles;
+  Record(&stats, static_cast<uint32_t>(std::min<uint64_t>(cycles, UINT32_MAX)));
+}
+
+void MicroStatsProfiler::Record(NodeStats* stats, uint32_t cycles) {
+  if (stats->count == 0) {
+    stats->first_octave = std::max(Octave(cycles) - 1, 0);
+    stats->min_cycles = cycles;
+    stats->max_cycles = cycles;
+  }
+  stats->count++;
+  stats->total_cycles += cycles;
+  stats->min_cycles = std::min(stats->min_cycles, cycles);
+  stats->max_cycles = std::max(stats->max_cycles, cycles);
+
+  uint16_t& bucket = stats->buckets[Bucket(cycles, stats->first_octave)];
+  if (bucket == UINT16_MAX) {
+    for (uint16_t& each_bucket : stats->buckets) {
+      each_bucket /= 2;
+    }
+  }
+  bucket++;
+}
+
+uint32_t MicroStatsProfiler::P95Cycles(const NodeStats& stats) {
+  uint32_t samples = 0;
+  for (const uint16_t each_bucket : stats.buckets) {
+    samples += each_bucket;
+  }
+  if (samples == 0) {
+    return 0;
+  }
+  const uint32_t target = samples - samples / 20;
+  uint32_t seen = 0;
+  int bucket = 0;
+  for (; bucket < kBuckets - 1; ++bucket) {
+    seen += stats.buckets[bucket];
+    if (seen >= target) {
+      break;
+    }
+  }
+  // The last bucket also holds everything above the histogram.
+  if (bucket == kBuckets - 1) {
+    return stats.max_cycles;
+  }
+  const uint64_t p95 = BucketEnd(bucket, stats.first_octave) - 1;
+  return static_cast<uint32_t>(
+      std::min<uint64_t>(std::max<uint64_t>(p95, stats.min_cycles),
+                         stats.max_cycles));
+}
+
+void MicroStatsProfiler::Log() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  MicroPrintf("Node stats: %u of %u inferences sampled (every %u), %u events "
+              "dropped",
+              static_cast<unsigned>(sampled_invokes_),
+              static_cast<unsigned>(invokes_),
+              static_cast<unsigned>(sample_interval_),
+              static_cast<unsigned>(dropped_events_));
+  for (int i = 0; i < num_nodes_; ++i) {
+    const NodeStats& stats = nodes_[i];
+    if (stats.count == 0) {
+      continue;
+    }
+    const uint64_t mean = stats.total_cycles / stats.count;
+    MicroPrintf(
+        "%3d %s: %u runs, cycles min %u mean %" PRIu64
+        " p95 %u max %u (mean %" PRIu64 " us)",
+        i, stats.tag, static_cast<unsigned>(stats.count),
+        static_cast<unsigned>(stats.min_cycles), mean,
+        static_cast<unsigned>(P95Cycles(stats)),
+        static_cast<unsigned>(stats.max_cycles), CyclesToUs(mean));
+  }
+#endif
+}
+
+void MicroStatsProfiler::LogCsv() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  MicroPrintf("\"Node\",\"Tag\",\"Count\",\"Min\",\"Mean\",\"P95\",\"Max\"");
+  for (int i = 0; i < num_nodes_; ++i) {
+    const NodeStats& stats = nodes_[i];
+    if (stats.count == 0) {
+      continue;
+    }
+    MicroPrintf("%d,%s,%u,%u,%" PRIu64 ",%u,%u", i, stats.tag,
+                static_cast<unsigned>(stats.count),
+                static_cast<unsigned>(stats.min_cycles),
+                stats.total_cycles / stats.count,
+                static_cast<unsigned>(P95Cycles(stats)),
+                static_cast<unsigned>(stats.max_cycles));
+  }
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,121 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_STATS_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_STATS_PROFILER_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+namespace tflite {
+
+// Profiler that can stay attached in production: instead of recording every
+// event like MicroProfiler, it folds each event into running statistics for
+// its node (count, min, mean, max and an approximate p95), so its memory is
+// fixed by the number of nodes and it never runs out of room.
+//
+// Events are matched to nodes by their order within an Invoke(), which is
+// the same from one inference to the next. Only every `sample_interval`-th
+// Invoke() is timed; the interpreter skips the per-operator events of the
+// others (see IsInvokeSampled()), and any other event costs one check.
+//
+// Log() and LogCsv() can be called at any time, e.g. from a console command,
+// to dump the statistics gathered so far. They read the statistics without
+// locking, so a dump that races with a sampled inference may mix values from
+// before and after it.
+class MicroStatsProfiler : public MicroProfilerInterface {
+ public:
+  // p95 comes from a histogram of kSubBuckets buckets per power of two over
+  // kOctaves octaves, placed around the first duration seen: from between 1/4
+  // and 1/2 of it up to between 8 and 16 times it. Durations outside land in
+  // the end buckets; min and max stay exact.
+  static constexpr int kSubBuckets = 8;
+  static constexpr int kOctaves = 5;
+  static constexpr int kBuckets = kSubBuckets * kOctaves;
+
+  struct NodeStats {
+    const char* tag;
+    uint64_t start_cycles;
+    uint64_t total_cycles;
+    uint32_t count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    // Octave of the first bucket, or -1 before the first sample.
+    int32_t first_octave;
+    // Halved when one of them would overflow, which also makes the
+    // percentile follow recent inferences on long running units.
+    uint16_t buckets[kBuckets];
+  };
+
+  // `nodes` holds the statistics of up to `max_nodes` events per Invoke(),
+  // usually one per operator of the model, and must outlive the profiler.
+  // Events beyond `max_nodes` are counted but not timed.
+  MicroStatsProfiler(NodeStats* nodes, int max_nodes,
+                     uint32_t sample_interval = 1);
+
+  virtual uint32_t BeginEvent(const char* tag) override;
+  virtual void EndEvent(uint32_t event_handle) override;
+  virtual void BeginInvoke() override;
+  virtual void EndInvoke() override;
+  virtual bool IsInvokeSampled() const override { return sampling_; }
+
+  void set_sample_interval(uint32_t sample_interval);
+
+  // Forgets all the statistics.
+  void Reset();
+
+  uint32_t invokes() const { return invokes_; }
+  uint32_t sampled_invokes() const { return sampled_invokes_; }
+  // Events of sampled inferences that had no NodeStats left.
+  uint32_t dropped_events() const { return dropped_events_; }
+  const NodeStats& node(int index) const { return nodes_[index]; }
+  int num_nodes() const { return num_nodes_; }
+
+  // Approximate 95th percentile of the durations of `stats`, in cycles of
+  // the profiling clock: the upper edge of the histogram bucket it falls in,
+  // clamped to [min, max].
+  static uint32_t P95Cycles(const NodeStats& stats);
+
+  // Prints the statistics of each node in human readable form.
+  void Log() const;
+
+  // Prints the statistics of each node in CSV form, in cycles.
+  void LogCsv() const;
+
+ private:
+  static constexpr uint32_t kNoEvent = UINT32_MAX;
+
+  static void Record(NodeStats* stats, uint32_t cycles);
+
+  NodeStats* nodes_;
+  int max_nodes_;
+  // Nodes seen so far: the events of the longest sampled inference.
+  int num_nodes_;
+  uint32_t sample_interval_;
+
+  uint32_t invokes_;
+  uint32_t sampled_invokes_;
+  uint32_t dropped_events_;
+  bool sampling_;
+  int next_event_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_STATS_PROFILER_H_
@@ -30,6 +30,14 @@ limitations under the License.
 #include <ctime>
 #endif
 
+#if defined(__linux__)
+#include <time.h>
+#if defined(TF_LITE_USE_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define TF_LITE_MICRO_TIME_RDTSC
+#endif
+#endif
+
 namespace tflite {
 
 #if !defined(TF_LITE_USE_CTIME)
@@ -55,4 +63,72 @@ uint32_t ticks_per_second() { return CLOCKS_PER_SEC; }
 uint32_t GetCurrentTimeTicks() { return clock(); }
 #endif
 
+#if defined(__linux__)
+
+namespace {
+
+uint64_t MonotonicNs() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000ull +
+         static_cast<uint64_t>(now.tv_nsec);
+}
+
+#if defined(TF_LITE_MICRO_TIME_RDTSC)
+// The TSC rate is not reported by the kernel, so it is measured once against
+// CLOCK_MONOTONIC over 10 ms.
+uint64_t MeasureTscRate() {
+  const timespec interval = {0, 10 * 1000 * 1000};
+  const uint64_t start_ns = MonotonicNs();
+  const uint64_t start_tsc = __rdtsc();
+  nanosleep(&interval, nullptr);
+  const uint64_t elapsed_tsc = __rdtsc() - start_tsc;
+  const uint64_t elapsed_ns = MonotonicNs() - start_ns;
+  return elapsed_ns > 0 ? elapsed_tsc * 1000000000ull / elapsed_ns : 0;
+}
+#endif
+
+}  // namespace
+
+#if defined(TF_LITE_MICRO_TIME_RDTSC)
+
+// Host builds with -DTF_LITE_USE_RDTSC count x86 time stamp counter cycles.
+// On current CPUs the TSC runs at a constant rate, so these are nominal
+// cycles, not the cycles of a core that is boosting or throttling.
+uint64_t cycles_per_second() {
+  static const uint64_t rate = MeasureTscRate();
+  return rate;
+}
+
+uint64_t GetCurrentTimeCycles() { return __rdtsc(); }
+
+#else
+
+// Other Linux host builds count nanoseconds of CLOCK_MONOTONIC.
+uint64_t cycles_per_second() { return 1000000000ull; }
+
+uint64_t GetCurrentTimeCycles() { return MonotonicNs(); }
+
+#endif  // defined(TF_LITE_MICRO_TIME_RDTSC)
+
+#else  // defined(__linux__)
+
+// Elsewhere the profiling clock is GetCurrentTimeTicks() widened to 64 bits.
+// Wraps are only counted while the clock is read at least once per period;
+// durations shorter than a period stay exact.
+uint64_t cycles_per_second() { return ticks_per_second(); }
+
+uint64_t GetCurrentTimeCycles() {
+  static uint32_t last_ticks = 0;
+  static uint64_t wraps = 0;
+  const uint32_t ticks = GetCurrentTimeTicks();
+  if (ticks < last_ticks) {
+    wraps++;
+  }
+  last_ticks = ticks;
+  return wraps << 32 | ticks;
+}
+
+#endif  // defined(__linux__)
+
 }  // namespace tflite
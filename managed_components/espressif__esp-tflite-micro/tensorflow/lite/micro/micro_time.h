@@ -34,6 +34,29 @@ inline uint32_t TicksToMs(int32_t ticks) {
                                static_cast<float>(_ticks_per_second));
 }
 
+// Profiling clock: a 64-bit count that does not wrap in practice, with the
+// finest resolution the platform has, typically the CPU cycle counter. Unlike
+// the ticks above it is only meant for measuring durations. Returns 0 on
+// platforms without one, like the ticks.
+uint64_t cycles_per_second();
+
+uint64_t GetCurrentTimeCycles();
+
+// Converts `cycles` to units of `units_per_second` without overflowing for
+// long intervals.
+inline uint64_t ScaleCycles(uint64_t cycles, uint64_t units_per_second) {
+  const uint64_t rate = cycles_per_second();
+  if (rate == 0) {
+    return 0;
+  }
+  return cycles / rate * units_per_second +
+         cycles % rate * units_per_second / rate;
+}
+
+inline uint64_t CyclesToUs(uint64_t cycles) {
+  return ScaleCycles(cycles, 1000000);
+}
+
 }  // namespace tflite
 
 #endif  // TENSORFLOW_LITE_MICRO_MICRO_TIME_H_
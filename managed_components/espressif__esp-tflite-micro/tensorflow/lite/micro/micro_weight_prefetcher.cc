@@ -0,0 +1,270 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_weight_prefetcher.h"
+
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+// Returns the flatbuffer data of tensor `tensor_idx` if it is a constant, and
+// its size in `bytes`; nullptr otherwise.
+const uint8_t* ConstantData(const Model* model, const SubGraph* subgraph,
+                            int tensor_idx, size_t* bytes) {
+  if (tensor_idx < 0 || subgraph->tensors() == nullptr ||
+      static_cast<uint32_t>(tensor_idx) >= subgraph->tensors()->size()) {
+    return nullptr;
+  }
+  const uint32_t buffer_idx = subgraph->tensors()->Get(tensor_idx)->buffer();
+  if (model->buffers() == nullptr || buffer_idx >= model->buffers()->size()) {
+    return nullptr;
+  }
+  const auto* data = model->buffers()->Get(buffer_idx)->data();
+  if (data == nullptr || data->size() == 0) {
+    return nullptr;
+  }
+  *bytes = data->size();
+  return data->data();
+}
+
+}  // namespace
+
+MicroWeightPrefetcher::MicroWeightPrefetcher(MicroCopyEngine* engine,
+                                             uint8_t* staging,
+                                             size_t staging_size)
+    : engine_(engine),
+      model_(nullptr),
+      subgraph_(nullptr),
+      allocations_(nullptr),
+      num_nodes_(0),
+      next_slot_(0),
+      active_slot_(-1),
+      busy_ticks_at_begin_(0) {
+  uint8_t* aligned = AlignPointerUp(staging, MicroArenaBufferAlignment());
+  const size_t usable =
+      staging_size > static_cast<size_t>(aligned - staging)
+          ? staging_size - static_cast<size_t>(aligned - staging)
+          : 0;
+  slot_size_ = (usable / kNumSlots) & ~(MicroArenaBufferAlignment() - 1);
+  for (int i = 0; i < kNumSlots; ++i) {
+    slot_data_[i] = aligned + i * slot_size_;
+    slots_[i].node = -1;
+    slots_[i].count = 0;
+  }
+  ResetStats();
+}
+
+size_t MicroWeightPrefetcher::LargestNodeBytes(const Model* model,
+                                               int subgraph_idx) {
+  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+  const uint32_t num_nodes = NumSubgraphOperators(subgraph);
+  size_t largest = 0;
+  for (uint32_t i = 0; i < num_nodes; ++i) {
+    const auto* inputs = subgraph->operators()->Get(i)->inputs();
+    if (inputs == nullptr) {
+      continue;
+    }
+    size_t total = 0;
+    for (uint32_t j = 0; j < inputs->size(); ++j) {
+      size_t bytes = 0;
+      if (ConstantData(model, subgraph, inputs->Get(j), &bytes) != nullptr) {
+        total += AlignSizeUp(bytes, MicroArenaBufferAlignment());
+      }
+    }
+    if (total > largest) {
+      largest = total;
+    }
+  }
+  return largest;
+}
+
+void MicroWeightPrefetcher::ResetStats() { stats_ = {}; }
+
+int MicroWeightPrefetcher::ConstantInputs(int node_idx, StagedInput* inputs,
+                                          uint32_t* bytes) const {
+  *bytes = 0;
+  const NodeAndRegistration& entry =
+      allocations_->node_and_registrations[node_idx];
+  // Fused, constant folded, dead and boundary conversion nodes are never
+  // invoked.
+  if (entry.fused_into >= 0 || entry.constant_folded || entry.dead ||
+      entry.boundary_conversion || entry.node.inputs == nullptr) {
+    return 0;
+  }
+  int count = 0;
+  for (int i = 0; i < entry.node.inputs->size; ++i) {
+    const int tensor_idx = entry.node.inputs->data[i];
+    size_t size = 0;
+    const uint8_t* data = ConstantData(model_, subgraph_, tensor_idx, &size);
+    TfLiteEvalTensor* tensor =
+        data != nullptr ? &allocations_->tensors[tensor_idx] : nullptr;
+    // Skips optional and non-constant inputs, and a constant that appears
+    // twice in the same operator (already repointed).
+    if (tensor == nullptr || tensor->data.data != data) {
+      continue;
+    }
+    if (count == kMaxStagedInputs) {
+      return -1;
+    }
+    inputs[count].tensor = tensor;
+    inputs[count].original = tensor->data.data;
+    inputs[count].staged = nullptr;
+    inputs[count].bytes = size;
+    count++;
+    *bytes += AlignSizeUp(size, MicroArenaBufferAlignment());
+  }
+  return count;
+}
+
+int MicroWeightPrefetcher::FindNextStageable(int node_idx) const {
+  StagedInput inputs[kMaxStagedInputs];
+  for (int i = node_idx + 1; i < num_nodes_; ++i) {
+    uint32_t bytes = 0;
+    if (ConstantInputs(i, inputs, &bytes) > 0 && bytes <= slot_size_) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void MicroWeightPrefetcher::Issue(int node_idx, Slot* slot) {
+  slot->node = -1;
+  slot->count = 0;
+  if (node_idx < 0) {
+    return;
+  }
+  uint8_t* dst = slot_data_[slot - slots_];
+  slot->count = ConstantInputs(node_idx, slot->inputs, &slot->bytes);
+  for (int i = 0; i < slot->count; ++i) {
+    StagedInput& input = slot->inputs[i];
+    const uint32_t ticket = engine_->Submit(dst, input.original, input.bytes);
+    if (ticket == 0) {
+      // Let the copies already queued into this slot land before giving up.
+      if (i > 0) {
+        engine_->Wait(slot->ticket);
+      }
+      slot->count = 0;
+      return;
+    }
+    input.staged = dst;
+    slot->ticket = ticket;
+    dst += AlignSizeUp(input.bytes, MicroArenaBufferAlignment());
+  }
+  slot->node = node_idx;
+}
+
+void MicroWeightPrefetcher::BeginInvoke(const Model* model,
+                                        SubgraphAllocations* allocations,
+                                        int first_node_idx) {
+  model_ = model;
+  subgraph_ = model->subgraphs()->Get(0);
+  allocations_ = allocations;
+  num_nodes_ = static_cast<int>(NumSubgraphOperators(subgraph_));
+  next_slot_ = 0;
+  active_slot_ = -1;
+  busy_ticks_at_begin_ = engine_->busy_ticks();
+  Issue(FindNextStageable(first_node_idx - 1), &slots_[next_slot_]);
+}
+
+void MicroWeightPrefetcher::BeforeNode(int node_idx) {
+  Slot& slot = slots_[next_slot_];
+  if (slot.node != node_idx) {
+    StagedInput inputs[kMaxStagedInputs];
+    uint32_t bytes = 0;
+    if (ConstantInputs(node_idx, inputs, &bytes) != 0) {
+      stats_.direct_nodes++;
+      stats_.direct_bytes += bytes;
+    }
+    return;
+  }
+
+  if (engine_->IsDone(slot.ticket)) {
+    stats_.ready_nodes++;
+  } else {
+    const uint32_t start = GetCurrentTimeTicks();
+    engine_->Wait(slot.ticket);
+    stats_.wait_ticks += GetCurrentTimeTicks() - start;
+  }
+  for (int i = 0; i < slot.count; ++i) {
+    slot.inputs[i].tensor->data.data = slot.inputs[i].staged;
+  }
+  stats_.staged_nodes++;
+  stats_.staged_bytes += slot.bytes;
+
+  active_slot_ = next_slot_;
+  next_slot_ = (next_slot_ + 1) % kNumSlots;
+  Issue(FindNextStageable(node_idx), &slots_[next_slot_]);
+}
+
+void MicroWeightPrefetcher::AfterNode(int node_idx) {
+  if (active_slot_ < 0 || slots_[active_slot_].node != node_idx) {
+    return;
+  }
+  Slot& slot = slots_[active_slot_];
+  for (int i = slot.count - 1; i >= 0; --i) {
+    slot.inputs[i].tensor->data.data = slot.inputs[i].original;
+  }
+  slot.node = -1;
+  active_slot_ = -1;
+}
+
+void MicroWeightPrefetcher::EndInvoke() {
+  // An aborted or failed Invoke may leave a copy in flight; it must land
+  // before the staging area can be reused.
+  Slot& slot = slots_[next_slot_];
+  if (slot.node >= 0) {
+    engine_->Wait(slot.ticket);
+    slot.node = -1;
+  }
+  stats_.copy_ticks += engine_->busy_ticks() - busy_ticks_at_begin_;
+  stats_.invokes++;
+}
+
+void MicroWeightPrefetcher::Log() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  const uint32_t hidden_ticks = stats_.copy_ticks > stats_.wait_ticks
+                                    ? stats_.copy_ticks - stats_.wait_ticks
+                                    : 0;
+  const uint32_t total_bytes = stats_.staged_bytes + stats_.direct_bytes;
+  MicroPrintf(
+      "Weight prefetch: %u invokes, %u operators staged (%u ready on start), "
+      "%u read in place",
+      static_cast<unsigned>(stats_.invokes),
+      static_cast<unsigned>(stats_.staged_nodes),
+      static_cast<unsigned>(stats_.ready_nodes),
+      static_cast<unsigned>(stats_.direct_nodes));
+  MicroPrintf("  %u of %u constant bytes read from staging (%u%%)",
+              static_cast<unsigned>(stats_.staged_bytes),
+              static_cast<unsigned>(total_bytes),
+              static_cast<unsigned>(
+                  total_bytes > 0
+                      ? 100ull * stats_.staged_bytes / total_bytes
+                      : 0));
+  MicroPrintf("  copies %u ticks, waits %u ticks, overlap %u%%",
+              static_cast<unsigned>(stats_.copy_ticks),
+              static_cast<unsigned>(stats_.wait_ticks),
+              static_cast<unsigned>(
+                  stats_.copy_ticks > 0
+                      ? 100ull * hidden_ticks / stats_.copy_ticks
+                      : 100));
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,136 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_WEIGHT_PREFETCHER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_WEIGHT_PREFETCHER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_copy_engine.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Stages the constant inputs (filters, biases) of upcoming operators from the
+// model flatbuffer, typically memory-mapped flash, into a faster staging area
+// while the current operator computes.
+//
+// The staging area is split into two slots. When an operator starts, its
+// copy, issued earlier through the MicroCopyEngine, is waited for and the
+// data pointers of its constant eval tensors are pointed at the slot, so
+// kernels read the staged copy without knowing about it; the pointers are
+// restored when it returns. The copy for the next operator that has
+// constants is then issued into the other slot. Operators whose constants do
+// not fit in a slot read them in place.
+//
+// Installed with MicroInterpreter::SetWeightPrefetcher(); only subgraph 0 is
+// staged. The engine and staging area must outlive the interpreter.
+class MicroWeightPrefetcher {
+ public:
+  struct Stats {
+    uint32_t invokes;
+    // Operators that read their constants from a slot, and how many of those
+    // found the copy already complete when they started.
+    uint32_t staged_nodes;
+    uint32_t ready_nodes;
+    // Operators with constants that were read in place.
+    uint32_t direct_nodes;
+    uint32_t staged_bytes;
+    uint32_t direct_bytes;
+    // Ticks the engine spent copying, and ticks operators spent waiting for
+    // their copy. Their difference is the copy time hidden behind compute.
+    uint32_t copy_ticks;
+    uint32_t wait_ticks;
+  };
+
+  MicroWeightPrefetcher(MicroCopyEngine* engine, uint8_t* staging,
+                        size_t staging_size);
+
+  // Bytes the constant inputs of the largest operator in `subgraph_idx` take
+  // in a slot. A 16-byte aligned staging area of twice this size stages
+  // every operator.
+  static size_t LargestNodeBytes(const Model* model, int subgraph_idx = 0);
+
+  // Hooks called by MicroInterpreterGraph::InvokeSubgraph(). A resumed
+  // inference begins at `first_node_idx`.
+  void BeginInvoke(const Model* model, SubgraphAllocations* allocations,
+                   int first_node_idx = 0);
+  void BeforeNode(int node_idx);
+  void AfterNode(int node_idx);
+  void EndInvoke();
+
+  const Stats& stats() const { return stats_; }
+  void ResetStats();
+
+  // Prints the stats with MicroPrintf.
+  void Log() const;
+
+ private:
+  static constexpr int kNumSlots = 2;
+  static constexpr int kMaxStagedInputs = 4;
+
+  struct StagedInput {
+    TfLiteEvalTensor* tensor;
+    void* original;
+    void* staged;
+    size_t bytes;
+  };
+
+  struct Slot {
+    int node;
+    int count;
+    uint32_t bytes;
+    uint32_t ticket;
+    StagedInput inputs[kMaxStagedInputs];
+  };
+
+  // Collects the constant inputs of `node_idx` into `inputs`. Returns their
+  // count (0 for fused operators) and their bytes in a slot, or -1 if there
+  // are more than kMaxStagedInputs.
+  int ConstantInputs(int node_idx, StagedInput* inputs, uint32_t* bytes) const;
+
+  // Returns the first operator after `node_idx` whose constants fit in a
+  // slot, or -1.
+  int FindNextStageable(int node_idx) const;
+
+  // Submits the copies of `node_idx` into `slot`; leaves the slot empty if
+  // `node_idx` is -1 or the engine refuses a copy.
+  void Issue(int node_idx, Slot* slot);
+
+  MicroCopyEngine* engine_;
+  uint8_t* slot_data_[kNumSlots];
+  size_t slot_size_;
+
+  const Model* model_;
+  const SubGraph* subgraph_;
+  SubgraphAllocations* allocations_;
+  int num_nodes_;
+
+  Slot slots_[kNumSlots];
+  // Slot holding the copy for the next staged operator, and the slot the
+  // running operator reads from (-1 if none).
+  int next_slot_;
+  int active_slot_;
+  uint32_t busy_ticks_at_begin_;
+
+  Stats stats_;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_WEIGHT_PREFETCHER_H_
@@ -0,0 +1,67 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/mock_copy_engine.h"
+
+#include <cstring>
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+
+MockCopyEngine::MockCopyEngine(bool immediate)
+    : immediate_(immediate),
+      submitted_(0),
+      completed_(0),
+      busy_ticks_(0),
+      submit_count_(0),
+      wait_count_(0),
+      copied_bytes_(0) {}
+
+uint32_t MockCopyEngine::Submit(void* dst, const void* src, size_t bytes) {
+  if (submitted_ - completed_ >= kMaxPending) {
+    return 0;
+  }
+  submitted_++;
+  submit_count_++;
+  pending_[submitted_ % kMaxPending] = {dst, src, bytes};
+  if (immediate_) {
+    CompleteUpTo(submitted_);
+  }
+  return submitted_;
+}
+
+bool MockCopyEngine::IsDone(uint32_t ticket) {
+  return static_cast<int32_t>(ticket - completed_) <= 0;
+}
+
+void MockCopyEngine::Wait(uint32_t ticket) {
+  wait_count_++;
+  CompleteUpTo(ticket);
+}
+
+void MockCopyEngine::CompleteUpTo(uint32_t ticket) {
+  while (static_cast<int32_t>(ticket - completed_) > 0 &&
+         completed_ != submitted_) {
+    completed_++;
+    const Copy& copy = pending_[completed_ % kMaxPending];
+    const uint32_t start = GetCurrentTimeTicks();
+    std::memcpy(copy.dst, copy.src, copy.bytes);
+    busy_ticks_ += GetCurrentTimeTicks() - start;
+    copied_bytes_ += copy.bytes;
+  }
+}
+
+}  // namespace tflite
@@ -0,0 +1,74 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MOCK_COPY_ENGINE_H_
+#define TENSORFLOW_LITE_MICRO_MOCK_COPY_ENGINE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_copy_engine.h"
+
+namespace tflite {
+
+// MockCopyEngine runs copies on the calling thread so that users of
+// MicroCopyEngine can be tested on a host.
+//
+// In deferred mode (the default) a submitted copy only happens when Wait() is
+// called for it or a later ticket, so a reader that skips the wait sees stale
+// data and every wait blocks: the worst case, no overlap. In immediate mode
+// copies happen inside Submit(), as if the engine always finished before
+// anyone waited: full overlap.
+class MockCopyEngine : public MicroCopyEngine {
+ public:
+  explicit MockCopyEngine(bool immediate = false);
+
+  uint32_t Submit(void* dst, const void* src, size_t bytes) override;
+  bool IsDone(uint32_t ticket) override;
+  void Wait(uint32_t ticket) override;
+  uint32_t busy_ticks() const override { return busy_ticks_; }
+
+  int submit_count() const { return submit_count_; }
+  int wait_count() const { return wait_count_; }
+  size_t copied_bytes() const { return copied_bytes_; }
+
+ private:
+  static constexpr int kMaxPending = 16;
+
+  struct Copy {
+    void* dst;
+    const void* src;
+    size_t bytes;
+  };
+
+  // Performs the pending copies up to and including `ticket`.
+  void CompleteUpTo(uint32_t ticket);
+
+  bool immediate_;
+  Copy pending_[kMaxPending];
+  uint32_t submitted_;
+  uint32_t completed_;
+  uint32_t busy_ticks_;
+  int submit_count_;
+  int wait_count_;
+  size_t copied_bytes_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MOCK_COPY_ENGINE_H_
@@ -0,0 +1,148 @@
+// Host benchmark for main/audio_frontend.cc.
+//
+// Streams each WAV file (16 kHz, 16-bit PCM, mono) through AudioRingBuffer in
+// 10 ms blocks, the way the I2S reader feeds it on the device, and times
+// AudioFrontend::Process(). Reports the cost per 10 ms hop.
+//
+// Build and run from the repository root:
+//
+//   T=managed_components/espressif__esp-tflite-micro
+//   SRCS="main/audio_frontend.cc $T/signal/src/*.cc $T/signal/src/kiss_fft_wrappers/*.cc"
+//   g++ -O2 -std=gnu++17 -Imain -I$T -I$T/third_party/kissfft
+//       tools/audio_frontend_bench.cc $SRCS -o audio_frontend_bench
+//   ./audio_frontend_bench impacts/*.wav
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "audio_frontend.h"
+#include "audio_ring_buffer.h"
+
+namespace {
+
+uint32_t ReadLe(const uint8_t* p, int bytes) {
+  uint32_t value = 0;
+  for (int i = bytes - 1; i >= 0; i--) {
+    value = (value << 8) | p[i];
+  }
+  return value;
+}
+
+// Returns false (with a message) unless `path` is a 16 kHz mono 16-bit WAV.
+bool LoadWav(const char* path, std::vector<int16_t>* samples) {
+  FILE* f = fopen(path, "rb");
+  if (f == nullptr) {
+    fprintf(stderr, "%s: cannot open\n", path);
+    return false;
+  }
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(f);
+
+  if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 ||
+      memcmp(data.data() + 8, "WAVE", 4) != 0) {
+    fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+    return false;
+  }
+  bool format_ok = false;
+  size_t pos = 12;
+  while (pos + 8 <= data.size()) {
+    const uint8_t* id = data.data() + pos;
+    const size_t size = ReadLe(id + 4, 4);
+    const uint8_t* body = id + 8;
+    if (pos + 8 + size > data.size()) {
+      break;
+    }
+    if (memcmp(id, "fmt ", 4) == 0 && size >= 16) {
+      const uint32_t format = ReadLe(body, 2);
+      const uint32_t channels = ReadLe(body + 2, 2);
+      const uint32_t rate = ReadLe(body + 4, 4);
+      const uint32_t bits = ReadLe(body + 14, 2);
+      if (format != 1 || channels != 1 || bits != 16 ||
+          rate != AudioFrontend::kSampleRate) {
+        fprintf(stderr,
+                "%s: need PCM mono 16-bit %d Hz (got format %u, %u ch, "
+                "%u bit, %u Hz)\n",
+                path, AudioFrontend::kSampleRate, format, channels, bits,
+                rate);
+        return false;
+      }
+      format_ok = true;
+    } else if (memcmp(id, "data", 4) == 0 && format_ok) {
+      samples->resize(size / 2);
+      for (size_t i = 0; i < samples->size(); i++) {
+        (*samples)[i] = static_cast<int16_t>(ReadLe(body + 2 * i, 2));
+      }
+      return true;
+    }
+    pos += 8 + size + (size & 1);
+  }
+  fprintf(stderr, "%s: no fmt/data chunk\n", path);
+  return false;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s file.wav...\n", argv[0]);
+    return 2;
+  }
+
+  static AudioFrontend frontend;
+  if (!frontend.Init()) {
+    fprintf(stderr, "AudioFrontend::Init failed\n");
+    return 1;
+  }
+  static int16_t storage[2048];
+  constexpr int kBlock = AudioFrontend::kHopSamples;
+
+  double total_us = 0.0;
+  double worst_us = 0.0;
+  long total_hops = 0;
+  int failures = 0;
+  for (int arg = 1; arg < argc; arg++) {
+    std::vector<int16_t> samples;
+    if (!LoadWav(argv[arg], &samples)) {
+      failures++;
+      continue;
+    }
+    AudioRingBuffer ring(storage, sizeof(storage) / sizeof(storage[0]));
+    frontend.Reset();
+
+    double file_us = 0.0;
+    long hops = 0;
+    for (size_t pos = 0; pos < samples.size(); pos += kBlock) {
+      const size_t count = std::min<size_t>(kBlock, samples.size() - pos);
+      ring.Write(samples.data() + pos, count);
+      const auto start = std::chrono::steady_clock::now();
+      const int slices = frontend.Process(&ring);
+      const double us = std::chrono::duration<double, std::micro>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+      if (slices > 0) {
+        file_us += us;
+        hops += slices;
+        worst_us = std::max(worst_us, us / slices);
+      }
+    }
+    printf("%s: %.2f s, %ld hops, %.2f us/hop\n", argv[arg],
+           static_cast<double>(samples.size()) / AudioFrontend::kSampleRate,
+           hops, hops ? file_us / hops : 0.0);
+    total_us += file_us;
+    total_hops += hops;
+  }
+  if (total_hops > 0) {
+    printf("total: %ld hops, mean %.2f us/hop, worst %.2f us/hop "
+           "(budget 10000 us)\n",
+           total_hops, total_us / total_hops, worst_us);
+  }
+  return failures ? 1 : 0;
+}
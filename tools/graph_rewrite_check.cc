@@ -0,0 +1,337 @@
+// Host check for the load-time graph rewrites of tflite::MicroInterpreter.
+//
+// Builds one small int8 model per rewrite: a dead branch (RemoveDeadNodes),
+// a constant subgraph (FoldConstantNodes), a DEQUANTIZE and a QUANTIZE chain
+// (CollapseRequantizeChains), RESHAPE, SQUEEZE and a QUANTIZE that keeps the
+// quantization (RemoveIdentityNodes), and a CONV_2D followed by RELU6
+// (FuseActivations). Each model runs on the same random inputs with the
+// rewrites on and off (MicroInterpreter::SetLoadTimeGraphRewrites); the
+// outputs must match exactly and the rewrites must take out the nodes the
+// case is built for. The requantize chains stay as they are by default and
+// are checked again with MicroInterpreter::SetRequantizeChainCollapse, which
+// may land one step away on a rounding boundary, so that run allows one step.
+//
+// Build and run from the repository root, with the reference kernels:
+//
+//   T=managed_components/espressif__esp-tflite-micro
+//   M=$T/tensorflow/lite/micro
+//   SRCS="$M/*.cc $M/kernels/*.cc $M/memory_planner/*.cc
+//         $M/arena_allocator/*.cc $M/tflite_bridge/*.cc
+//         $T/tensorflow/lite/core/c/common.cc $T/tensorflow/lite/core/api/*.cc
+//         $T/tensorflow/lite/kernels/kernel_util.cc
+//         $T/tensorflow/lite/kernels/internal/*.cc
+//         $T/tensorflow/lite/kernels/internal/reference/*.cc
+//         $T/tensorflow/compiler/mlir/lite/core/api/*.cc
+//         $T/tensorflow/compiler/mlir/lite/schema/*.cc
+//         $T/signal/micro/kernels/*.cc $T/signal/src/*.cc
+//         $T/signal/src/kiss_fft_wrappers/*.cc"
+//   g++ -O1 -std=gnu++17 -fno-rtti -fno-exceptions -DTF_LITE_STATIC_MEMORY
+//       -I$T -I$T/third_party/flatbuffers/include -I$T/third_party/gemmlowp
+//       -I$T/third_party/ruy -I$T/third_party/kissfft
+//       tools/graph_rewrite_check.cc $SRCS -o graph_rewrite_check
+//   ./graph_rewrite_check
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 64 * 1024;
+constexpr int kTrials = 64;
+
+// Builds a single-subgraph model with the flatbuffers object API.
+class ModelBuilder {
+ public:
+  ModelBuilder() {
+    model_.version = TFLITE_SCHEMA_VERSION;
+    model_.buffers.push_back(std::make_unique<tflite::BufferT>());
+    model_.subgraphs.push_back(std::make_unique<tflite::SubGraphT>());
+  }
+
+  // Per-tensor quantized unless `scale` is 0.
+  int AddTensor(tflite::TensorType type, std::vector<int32_t> shape,
+                float scale = 0.0f, int64_t zero_point = 0) {
+    auto tensor = std::make_unique<tflite::TensorT>();
+    tensor->type = type;
+    tensor->shape = std::move(shape);
+    if (scale != 0.0f) {
+      auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+      quantization->scale = {scale};
+      quantization->zero_point = {zero_point};
+      tensor->quantization = std::move(quantization);
+    }
+    subgraph().tensors.push_back(std::move(tensor));
+    return static_cast<int>(subgraph().tensors.size()) - 1;
+  }
+
+  void SetData(int tensor_index, const void* data, size_t bytes) {
+    auto buffer = std::make_unique<tflite::BufferT>();
+    const uint8_t* begin = static_cast<const uint8_t*>(data);
+    buffer->data.assign(begin, begin + bytes);
+    model_.buffers.push_back(std::move(buffer));
+    subgraph().tensors[tensor_index]->buffer =
+        static_cast<uint32_t>(model_.buffers.size()) - 1;
+  }
+
+  void SetPerChannelQuantization(int tensor_index, std::vector<float> scales) {
+    auto quantization = std::make_unique<tflite::QuantizationParametersT>();
+    quantization->zero_point.assign(scales.size(), 0);
+    quantization->scale = std::move(scales);
+    subgraph().tensors[tensor_index]->quantization = std::move(quantization);
+  }
+
+  void AddOperator(tflite::BuiltinOperator code, std::vector<int32_t> inputs,
+                   std::vector<int32_t> outputs,
+                   tflite::BuiltinOptionsUnion options = {}) {
+    auto op = std::make_unique<tflite::OperatorT>();
+    op->opcode_index = OpcodeIndex(code);
+    op->inputs = std::move(inputs);
+    op->outputs = std::move(outputs);
+    op->builtin_options = std::move(options);
+    subgraph().operators.push_back(std::move(op));
+  }
+
+  const tflite::Model* Finish(std::vector<int32_t> inputs,
+                              std::vector<int32_t> outputs) {
+    subgraph().inputs = std::move(inputs);
+    subgraph().outputs = std::move(outputs);
+    tflite::FinishModelBuffer(fbb_, tflite::Model::Pack(fbb_, &model_));
+    return tflite::GetModel(fbb_.GetBufferPointer());
+  }
+
+ private:
+  tflite::SubGraphT& subgraph() { return *model_.subgraphs[0]; }
+
+  uint32_t OpcodeIndex(tflite::BuiltinOperator code) {
+    for (size_t i = 0; i < model_.operator_codes.size(); i++) {
+      if (model_.operator_codes[i]->builtin_code == code) {
+        return static_cast<uint32_t>(i);
+      }
+    }
+    auto opcode = std::make_unique<tflite::OperatorCodeT>();
+    opcode->builtin_code = code;
+    opcode->deprecated_builtin_code = static_cast<int8_t>(code);
+    model_.operator_codes.push_back(std::move(opcode));
+    return static_cast<uint32_t>(model_.operator_codes.size()) - 1;
+  }
+
+  tflite::ModelT model_;
+  // The flatbuffers copy in TFLM does not fall back to the default allocator
+  // when given none.
+  flatbuffers::DefaultAllocator allocator_;
+  flatbuffers::FlatBufferBuilder fbb_{1024, &allocator_};
+};
+
+tflite::BuiltinOptionsUnion AddOptions() {
+  tflite::BuiltinOptionsUnion options;
+  options.Set(tflite::AddOptionsT());
+  return options;
+}
+
+// Outputs of every trial, one byte vector per output per trial.
+struct Run {
+  std::vector<std::vector<int8_t>> outputs;
+  size_t eliminated_nodes = 0;
+};
+
+bool RunModel(const tflite::Model* model, bool rewrites, bool collapse,
+              Run* run) {
+  static tflite::MicroMutableOpResolver<8> resolver;
+  static bool resolver_ready = false;
+  if (!resolver_ready) {
+    resolver_ready = true;
+    resolver.AddAdd();
+    resolver.AddConv2D();
+    resolver.AddDequantize();
+    resolver.AddQuantize();
+    resolver.AddRelu6();
+    resolver.AddReshape();
+    resolver.AddSqueeze();
+  }
+  static uint8_t arena[kArenaSize] __attribute__((aligned(16)));
+  tflite::MicroInterpreter interpreter(model, resolver, arena, kArenaSize);
+  if (interpreter.SetLoadTimeGraphRewrites(rewrites) != kTfLiteOk ||
+      interpreter.SetRequantizeChainCollapse(collapse) != kTfLiteOk ||
+      interpreter.AllocateTensors() != kTfLiteOk) {
+    return false;
+  }
+  run->eliminated_nodes = interpreter.PrintEliminatedNodes();
+
+  srand(1);
+  run->outputs.clear();
+  for (int trial = 0; trial < kTrials; trial++) {
+    // Every subgraph input is overwritten before each Invoke(): nothing
+    // asked the allocator to preserve them.
+    for (size_t i = 0; i < interpreter.inputs_size(); i++) {
+      TfLiteTensor* input = interpreter.input(i);
+      for (size_t b = 0; b < input->bytes; b++) {
+        input->data.int8[b] = static_cast<int8_t>(rand() & 0xff);
+      }
+    }
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    for (size_t i = 0; i < interpreter.outputs_size(); i++) {
+      const TfLiteTensor* output = interpreter.output(i);
+      run->outputs.emplace_back(output->data.int8,
+                                output->data.int8 + output->bytes);
+    }
+  }
+  return true;
+}
+
+// Runs `model` with the rewrites off and on, the requantize chain collapse
+// on if `collapse`, and compares the two.
+bool Check(const char* name, const tflite::Model* model, bool collapse,
+           size_t expected_eliminated, int tolerance) {
+  Run reference;
+  Run rewritten;
+  if (!RunModel(model, false, false, &reference) ||
+      !RunModel(model, true, collapse, &rewritten)) {
+    printf("%s: FAILED to run\n", name);
+    return false;
+  }
+  int worst = 0;
+  for (size_t i = 0; i < reference.outputs.size(); i++) {
+    for (size_t b = 0; b < reference.outputs[i].size(); b++) {
+      worst = std::max(worst, std::abs(reference.outputs[i][b] -
+                                       rewritten.outputs[i][b]));
+    }
+  }
+  const bool ok = reference.eliminated_nodes == 0 &&
+                  rewritten.eliminated_nodes == expected_eliminated &&
+                  worst <= tolerance;
+  printf("%s: %zu of %zu nodes taken out, largest difference %d over %d "
+         "inputs: %s\n",
+         name, rewritten.eliminated_nodes, expected_eliminated, worst,
+         kTrials, ok ? "OK" : "FAILED");
+  return ok;
+}
+
+// y = x + x; the branch d2 = (x + x) + x is never read.
+bool CheckDeadBranch() {
+  ModelBuilder b;
+  const int x = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.05f, -10);
+  const int y = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.1f, 0);
+  const int d1 = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.1f, 0);
+  const int d2 = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.15f, 0);
+  b.AddOperator(tflite::BuiltinOperator_ADD, {x, x}, {y}, AddOptions());
+  b.AddOperator(tflite::BuiltinOperator_ADD, {x, x}, {d1}, AddOptions());
+  b.AddOperator(tflite::BuiltinOperator_ADD, {d1, x}, {d2}, AddOptions());
+  return Check("dead branch", b.Finish({x}, {y}), false, 2, 0);
+}
+
+// y = x + (c + c) with a constant c.
+bool CheckConstantSubgraph() {
+  ModelBuilder b;
+  const int8_t data[8] = {-128, -60, -5, 0, 7, 31, 90, 127};
+  const int x = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.05f, -10);
+  const int c = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.05f, -10);
+  b.SetData(c, data, sizeof(data));
+  const int k = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.1f, 0);
+  const int y = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.15f, 0);
+  b.AddOperator(tflite::BuiltinOperator_ADD, {c, c}, {k}, AddOptions());
+  b.AddOperator(tflite::BuiltinOperator_ADD, {x, k}, {y}, AddOptions());
+  return Check("constant subgraph", b.Finish({x}, {y}), false, 1, 0);
+}
+
+// y1 = QUANTIZE(DEQUANTIZE(x)) and y2 = QUANTIZE(QUANTIZE(x)), the second
+// with an output range inside the middle one. Left alone unless `collapse`.
+bool CheckRequantizeChains(bool collapse) {
+  ModelBuilder b;
+  const int x = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.05f, -10);
+  const int f = b.AddTensor(tflite::TensorType_FLOAT32, {1, 8});
+  const int y1 = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.07f, 3);
+  const int m = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.08f, 0);
+  const int y2 = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.06f, 5);
+  b.AddOperator(tflite::BuiltinOperator_DEQUANTIZE, {x}, {f});
+  b.AddOperator(tflite::BuiltinOperator_QUANTIZE, {f}, {y1});
+  b.AddOperator(tflite::BuiltinOperator_QUANTIZE, {x}, {m});
+  b.AddOperator(tflite::BuiltinOperator_QUANTIZE, {m}, {y2});
+  return Check(collapse ? "requantize chains, collapsed" : "requantize chains",
+               b.Finish({x}, {y1, y2}), collapse, collapse ? 2 : 0,
+               collapse ? 1 : 0);
+}
+
+// y = d + d with d = QUANTIZE(SQUEEZE(RESHAPE(x + x))), the QUANTIZE keeping
+// the quantization.
+bool CheckIdentityNodes() {
+  ModelBuilder b;
+  const int32_t new_shape[2] = {1, 8};
+  const int x = b.AddTensor(tflite::TensorType_INT8, {1, 2, 4}, 0.05f, -10);
+  const int a = b.AddTensor(tflite::TensorType_INT8, {1, 2, 4}, 0.1f, 0);
+  const int shape = b.AddTensor(tflite::TensorType_INT32, {2});
+  b.SetData(shape, new_shape, sizeof(new_shape));
+  const int r = b.AddTensor(tflite::TensorType_INT8, {1, 8}, 0.1f, 0);
+  const int s = b.AddTensor(tflite::TensorType_INT8, {8}, 0.1f, 0);
+  const int q = b.AddTensor(tflite::TensorType_INT8, {8}, 0.1f, 0);
+  const int y = b.AddTensor(tflite::TensorType_INT8, {8}, 0.2f, 0);
+  tflite::ReshapeOptionsT reshape;
+  reshape.new_shape = {1, 8};
+  tflite::BuiltinOptionsUnion reshape_options;
+  reshape_options.Set(std::move(reshape));
+  tflite::SqueezeOptionsT squeeze;
+  squeeze.squeeze_dims = {0};
+  tflite::BuiltinOptionsUnion squeeze_options;
+  squeeze_options.Set(std::move(squeeze));
+  b.AddOperator(tflite::BuiltinOperator_ADD, {x, x}, {a}, AddOptions());
+  b.AddOperator(tflite::BuiltinOperator_RESHAPE, {a, shape}, {r},
+                std::move(reshape_options));
+  b.AddOperator(tflite::BuiltinOperator_SQUEEZE, {r}, {s},
+                std::move(squeeze_options));
+  b.AddOperator(tflite::BuiltinOperator_QUANTIZE, {s}, {q});
+  b.AddOperator(tflite::BuiltinOperator_ADD, {q, q}, {y}, AddOptions());
+  return Check("identity nodes", b.Finish({x}, {y}), false, 3, 0);
+}
+
+// y = RELU6(CONV_2D(x)), a 1x1 convolution without activation whose output
+// range goes past 6.
+bool CheckFusedActivation() {
+  ModelBuilder b;
+  const int8_t weights[4 * 3] = {127, -40, 90, -127, 64, 10,
+                                 35,  100, -90, 5,   -5, 127};
+  const int32_t bias[4] = {100, -200, 0, 50};
+  const float filter_scales[4] = {0.02f, 0.03f, 0.04f, 0.05f};
+  const int x = b.AddTensor(tflite::TensorType_INT8, {1, 2, 2, 3}, 0.05f, 0);
+  const int filter = b.AddTensor(tflite::TensorType_INT8, {4, 1, 1, 3});
+  b.SetData(filter, weights, sizeof(weights));
+  b.SetPerChannelQuantization(filter, {filter_scales, filter_scales + 4});
+  const int bias_tensor = b.AddTensor(tflite::TensorType_INT32, {4});
+  b.SetData(bias_tensor, bias, sizeof(bias));
+  b.SetPerChannelQuantization(
+      bias_tensor, {0.05f * filter_scales[0], 0.05f * filter_scales[1],
+                    0.05f * filter_scales[2], 0.05f * filter_scales[3]});
+  const int t = b.AddTensor(tflite::TensorType_INT8, {1, 2, 2, 4}, 0.05f, -128);
+  const int y = b.AddTensor(tflite::TensorType_INT8, {1, 2, 2, 4}, 0.05f, -128);
+  tflite::Conv2DOptionsT conv;
+  conv.padding = tflite::Padding_VALID;
+  conv.stride_w = 1;
+  conv.stride_h = 1;
+  tflite::BuiltinOptionsUnion conv_options;
+  conv_options.Set(std::move(conv));
+  b.AddOperator(tflite::BuiltinOperator_CONV_2D, {x, filter, bias_tensor}, {t},
+                std::move(conv_options));
+  b.AddOperator(tflite::BuiltinOperator_RELU6, {t}, {y});
+  return Check("fused activation", b.Finish({x}, {y}), false, 1, 0);
+}
+
+}  // namespace
+
+int main() {
+  int failures = 0;
+  failures += !CheckDeadBranch();
+  failures += !CheckConstantSubgraph();
+  failures += !CheckRequantizeChains(false);
+  failures += !CheckRequantizeChains(true);
+  failures += !CheckIdentityNodes();
+  failures += !CheckFusedActivation();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+// Host benchmark for the power-of-two path of tflm_signal::RfftInt16Apply.
+//
+// For each length, runs the same random, sine, full-scale square and sparse
+// impulse frames through RfftInt16Apply / RfftInt16ApplyAutoScale and through
+// kiss_fftr directly, reports the largest difference in LSB against the
+// documented log2(N) bound, and the best-of-15 time of both per transform.
+// app_main() logs the same comparison in CPU cycles on the board for the
+// front end's 512-point FFT.
+//
+// Build and run from the repository root:
+//
+//   T=managed_components/espressif__esp-tflite-micro
+//   SRCS="$T/signal/src/*.cc $T/signal/src/kiss_fft_wrappers/*.cc"
+//   g++ -O2 -std=gnu++17 -I$T -I$T/third_party/kissfft
+//       tools/rfft_int16_bench.cc $SRCS -o rfft_int16_bench
+//   ./rfft_int16_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "signal/src/fft_auto_scale.h"
+#include "signal/src/kiss_fft_wrappers/kiss_fft_int16.h"
+#include "signal/src/rfft.h"
+
+namespace {
+
+void FillFrame(int kind, int amplitude, std::vector<int16_t>* frame) {
+  const double freq = (rand() % 1000) / 2000.0;
+  for (size_t i = 0; i < frame->size(); i++) {
+    int16_t value;
+    switch (kind) {
+      case 0:
+        value = static_cast<int16_t>(rand() % (2 * amplitude + 1) - amplitude);
+        break;
+      case 1:
+        value = static_cast<int16_t>(amplitude * sin(2 * M_PI * freq * i));
+        break;
+      case 2:
+        value = static_cast<int16_t>((i & 1) ? -amplitude : amplitude);
+        break;
+      default:
+        value = static_cast<int16_t>(rand() % 8 == 0 ? amplitude : 0);
+        break;
+    }
+    (*frame)[i] = value;
+  }
+}
+
+int MaxDiff(const std::vector<Complex<int16_t>>& a,
+            const std::vector<Complex<int16_t>>& b) {
+  int diff = 0;
+  for (size_t k = 0; k < a.size(); k++) {
+    diff = std::max(diff, std::abs(a[k].real - b[k].real));
+    diff = std::max(diff, std::abs(a[k].imag - b[k].imag));
+  }
+  return diff;
+}
+
+}  // namespace
+
+int main() {
+  srand(1);
+  int failures = 0;
+  for (int n = 64; n <= 4096; n *= 2) {
+    std::vector<uint8_t> state(tflm_signal::RfftInt16GetNeededMemory(n));
+    void* rfft = tflm_signal::RfftInt16Init(n, state.data(), state.size());
+    size_t kiss_size = 0;
+    kiss_fft_fixed16::kiss_fftr_alloc(n, 0, nullptr, &kiss_size);
+    std::vector<uint8_t> kiss_state(kiss_size);
+    kiss_fft_fixed16::kiss_fftr_cfg kiss = kiss_fft_fixed16::kiss_fftr_alloc(
+        n, 0, kiss_state.data(), &kiss_size);
+    if (rfft == nullptr || kiss == nullptr) {
+      fprintf(stderr, "N=%d: init failed\n", n);
+      return 1;
+    }
+
+    std::vector<int16_t> frame(n);
+    std::vector<int16_t> scaled(n);
+    std::vector<Complex<int16_t>> out(n / 2 + 1);
+    std::vector<Complex<int16_t>> ref(n / 2 + 1);
+    auto run_kiss = [&](const int16_t* input) {
+      kiss_fft_fixed16::kiss_fftr(
+          kiss, reinterpret_cast<const kiss_fft_scalar*>(input),
+          reinterpret_cast<kiss_fft_fixed16::kiss_fft_cpx*>(ref.data()));
+    };
+
+    int worst = 0;
+    for (int trial = 0; trial < 400; trial++) {
+      const int amplitude = (trial % 5 == 0) ? 32767 : 1 + rand() % 32767;
+      FillFrame(trial % 4, amplitude, &frame);
+      tflm_signal::RfftInt16Apply(rfft, frame.data(), out.data());
+      run_kiss(frame.data());
+      worst = std::max(worst, MaxDiff(out, ref));
+
+      const int bits =
+          tflm_signal::RfftInt16ApplyAutoScale(rfft, frame.data(), out.data());
+      if (bits != tflite::tflm_signal::FftAutoScale(frame.data(), n,
+                                                    scaled.data())) {
+        fprintf(stderr, "N=%d: auto-scale bits differ\n", n);
+        return 1;
+      }
+      run_kiss(scaled.data());
+      worst = std::max(worst, MaxDiff(out, ref));
+    }
+    const int bound = static_cast<int>(log2(n));
+    if (worst > bound) {
+      failures++;
+    }
+
+    FillFrame(0, 1000, &frame);
+    const int reps = 200000 / n + 10;
+    double kiss_ns = 1e9;
+    double fast_ns = 1e9;
+    for (int round = 0; round < 15; round++) {
+      const auto t0 = std::chrono::steady_clock::now();
+      for (int r = 0; r < reps; r++) {
+        run_kiss(frame.data());
+      }
+      const auto t1 = std::chrono::steady_clock::now();
+      for (int r = 0; r < reps; r++) {
+        tflm_signal::RfftInt16Apply(rfft, frame.data(), out.data());
+      }
+      const auto t2 = std::chrono::steady_clock::now();
+      kiss_ns = std::min(
+          kiss_ns, std::chrono::duration<double, std::nano>(t1 - t0).count() /
+                       reps);
+      fast_ns = std::min(
+          fast_ns, std::chrono::duration<double, std::nano>(t2 - t1).count() /
+                       reps);
+    }
+    printf("N=%4d: max diff %d LSB (bound %d)%s, kiss %.0f ns, radix-4 "
+           "%.0f ns, %.2fx, state %zu bytes\n",
+           n, worst, bound, worst > bound ? " FAIL" : "", kiss_ns, fast_ns,
+           kiss_ns / fast_ns, state.size());
+  }
+  return failures ? 1 : 0;
+}
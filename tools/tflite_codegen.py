@@ -0,0 +1,843 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Compiles a quantized .tflite model into a straight-line C++ inference
+function that calls the esp-nn kernels directly.
+
+The generated source has no interpreter, op resolver or flatbuffer parsing:
+tensor placement is resolved to fixed arena offsets, layer shapes and
+requantization parameters become constexpr tables, and the constant tensors
+are addressed by their byte offset inside the same model image that the
+application already embeds.  The per-op parameters are derived exactly the
+way the TFLM kernels derive them in Prepare, so the output is bit-identical
+to MicroInterpreter.
+
+Only the operators used by the int8 image classifiers of this project are
+supported: QUANTIZE, CONV_2D, DEPTHWISE_CONV_2D, ADD, MEAN, FULLY_CONNECTED,
+SOFTMAX and RELU6 (the latter only when it can be folded into the preceding
+convolution).
+
+Usage:
+    tools/tflite_codegen.py model.tflite main/model_codegen
+    tools/tflite_codegen.py main/model_data.h main/model_codegen --array modelo_tflite
+"""
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+
+# BuiltinOperator values from tensorflow/lite/schema/schema_generated.h.
+OP_ADD = 0
+OP_CONV_2D = 3
+OP_DEPTHWISE_CONV_2D = 4
+OP_FULLY_CONNECTED = 9
+OP_RELU6 = 21
+OP_SOFTMAX = 25
+OP_MEAN = 40
+OP_QUANTIZE = 114
+
+OP_NAMES = {
+    OP_ADD: 'ADD',
+    OP_CONV_2D: 'CONV_2D',
+    OP_DEPTHWISE_CONV_2D: 'DEPTHWISE_CONV_2D',
+    OP_FULLY_CONNECTED: 'FULLY_CONNECTED',
+    OP_RELU6: 'RELU6',
+    OP_SOFTMAX: 'SOFTMAX',
+    OP_MEAN: 'MEAN',
+    OP_QUANTIZE: 'QUANTIZE',
+}
+
+# TensorType values.
+TYPE_INT32 = 2
+TYPE_UINT8 = 3
+TYPE_INT8 = 9
+TYPE_NAMES = {TYPE_INT32: 'int32_t', TYPE_UINT8: 'uint8_t', TYPE_INT8: 'int8_t'}
+TYPE_RANGE = {TYPE_UINT8: (0, 255), TYPE_INT8: (-128, 127)}
+
+# ActivationFunctionType and Padding values.
+ACT_NONE = 0
+ACT_RELU = 1
+ACT_RELU_N1_TO_1 = 2
+ACT_RELU6 = 3
+PADDING_SAME = 0
+
+# Matches kBufferAlignment in tensorflow/lite/micro/micro_arena_constants.h.
+ALIGNMENT = 16
+
+
+class CodegenError(Exception):
+  pass
+
+
+class Table:
+  """Minimal read-only flatbuffer table accessor."""
+
+  def __init__(self, buf, pos):
+    self.buf = buf
+    self.pos = pos
+    vtable = pos - struct.unpack_from('<i', buf, pos)[0]
+    self.vtable = vtable
+    self.vtable_size = struct.unpack_from('<H', buf, vtable)[0]
+
+  def _field(self, slot):
+    vt_off = 4 + 2 * slot
+    if vt_off >= self.vtable_size:
+      return 0
+    return struct.unpack_from('<H', self.buf, self.vtable + vt_off)[0]
+
+  def scalar(self, slot, fmt, default=0):
+    off = self._field(slot)
+    if not off:
+      return default
+    return struct.unpack_from('<' + fmt, self.buf, self.pos + off)[0]
+
+  def _indirect(self, slot):
+    off = self._field(slot)
+    if not off:
+      return None
+    loc = self.pos + off
+    return loc + struct.unpack_from('<I', self.buf, loc)[0]
+
+  def table(self, slot):
+    loc = self._indirect(slot)
+    return Table(self.buf, loc) if loc is not None else None
+
+  def vector_pos(self, slot):
+    """Returns (position of the first element, length) or None."""
+    loc = self._indirect(slot)
+    if loc is None:
+      return None
+    return loc + 4, struct.unpack_from('<I', self.buf, loc)[0]
+
+  def scalars(self, slot, fmt):
+    vec = self.vector_pos(slot)
+    if vec is None:
+      return []
+    pos, length = vec
+    size = struct.calcsize(fmt)
+    return [struct.unpack_from('<' + fmt, self.buf, pos + i * size)[0]
+            for i in range(length)]
+
+  def tables(self, slot):
+    vec = self.vector_pos(slot)
+    if vec is None:
+      return []
+    pos, length = vec
+    result = []
+    for i in range(length):
+      loc = pos + 4 * i
+      result.append(Table(self.buf, loc + struct.unpack_from('<I', self.buf,
+                                                             loc)[0]))
+    return result
+
+  def string(self, slot):
+    vec = self.vector_pos(slot)
+    if vec is None:
+      return ''
+    pos, length = vec
+    return self.buf[pos:pos + length].decode('utf-8', 'replace')
+
+
+# --- Arithmetic mirrored from tensorflow/lite/kernels/internal/ ------------
+
+
+def f32(value):
+  return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def tflite_round(value):
+  # TfLiteRound is std::round: halfway cases away from zero.
+  return math.copysign(math.floor(abs(value) + 0.5), value)
+
+
+def quantize_multiplier(real_multiplier):
+  """QuantizeMultiplier() without TFLITE_SINGLE_ROUNDING."""
+  if real_multiplier == 0.0:
+    return 0, 0
+  q, shift = math.frexp(real_multiplier)
+  q_fixed = int(tflite_round(q * (1 << 31)))
+  if q_fixed == (1 << 31):
+    q_fixed //= 2
+    shift += 1
+  if shift < -31:
+    shift = 0
+    q_fixed = 0
+  return q_fixed, shift
+
+
+def quantize_float(scale, zero_point, value):
+  """Quantize() from kernel_util.cc, evaluated in single precision."""
+  return zero_point + int(tflite_round(f32(f32(value) / scale)))
+
+
+def activation_range(activation, scale, zero_point, tensor_type):
+  qmin, qmax = TYPE_RANGE[tensor_type]
+  if activation == ACT_RELU:
+    return max(qmin, quantize_float(scale, zero_point, 0.0)), qmax
+  if activation == ACT_RELU6:
+    return (max(qmin, quantize_float(scale, zero_point, 0.0)),
+            min(qmax, quantize_float(scale, zero_point, 6.0)))
+  if activation == ACT_RELU_N1_TO_1:
+    return (max(qmin, quantize_float(scale, zero_point, -1.0)),
+            min(qmax, quantize_float(scale, zero_point, 1.0)))
+  return qmin, qmax
+
+
+def compute_padding(stride, in_size, filter_size, padding):
+  if padding == PADDING_SAME:
+    out_size = (in_size + stride - 1) // stride
+  else:
+    out_size = (in_size + stride - filter_size) // stride
+  total = max(0, (out_size - 1) * stride + filter_size - in_size)
+  return total // 2, out_size
+
+
+# --- Model ------------------------------------------------------------------
+
+
+class Tensor:
+
+  def __init__(self, index, table, buffers, model_buf):
+    self.index = index
+    self.shape = table.scalars(0, 'i')
+    self.type = table.scalar(1, 'b')
+    self.name = table.string(3)
+    self.scales = []
+    self.zero_points = []
+    quant = table.table(4)
+    if quant is not None:
+      self.scales = [f32(s) for s in quant.scalars(2, 'f')]
+      self.zero_points = quant.scalars(3, 'q')
+    self.data_offset = None
+    self.data_size = 0
+    buffer = buffers[table.scalar(2, 'I')]
+    data = buffer.vector_pos(0)
+    if data is not None and data[1] > 0:
+      self.data_offset, self.data_size = data
+    elif buffer.scalar(1, 'Q') > 1:
+      self.data_offset = buffer.scalar(1, 'Q')
+      self.data_size = buffer.scalar(2, 'Q')
+    if self.data_offset is not None:
+      if self.data_offset + self.data_size > len(model_buf):
+        raise CodegenError('tensor %d data lies outside the model' % index)
+
+  @property
+  def is_constant(self):
+    return self.data_offset is not None
+
+  @property
+  def scale(self):
+    return self.scales[0] if self.scales else 0.0
+
+  @property
+  def zero_point(self):
+    return self.zero_points[0] if self.zero_points else 0
+
+  @property
+  def num_elements(self):
+    n = 1
+    for d in self.shape:
+      n *= d
+    return n
+
+  @property
+  def nbytes(self):
+    return self.num_elements * (4 if self.type == TYPE_INT32 else 1)
+
+
+class Operator:
+
+  def __init__(self, index, table, opcodes):
+    self.index = index
+    self.code = opcodes[table.scalar(0, 'I')]
+    self.inputs = table.scalars(1, 'i')
+    self.outputs = table.scalars(2, 'i')
+    self.options = table.table(4)
+    self.fused_relu6 = None
+
+  @property
+  def name(self):
+    return OP_NAMES.get(self.code, 'OP_%d' % self.code)
+
+
+def load_model(buf):
+  model = Table(buf, struct.unpack_from('<I', buf, 0)[0])
+  opcodes = []
+  for code in model.tables(1):
+    deprecated = code.scalar(0, 'b')
+    builtin = code.scalar(3, 'i')
+    opcodes.append(max(deprecated, builtin))
+  subgraphs = model.tables(2)
+  if len(subgraphs) != 1:
+    raise CodegenError('only single-subgraph models are supported')
+  subgraph = subgraphs[0]
+  buffers = model.tables(4)
+  tensors = [Tensor(i, t, buffers, buf) for i, t in enumerate(subgraph.tables(0))]
+  operators = [Operator(i, t, opcodes) for i, t in enumerate(subgraph.tables(3))]
+  return tensors, operators, subgraph.scalars(1, 'i'), subgraph.scalars(2, 'i')
+
+
+def read_model_file(path, array):
+  if array is None:
+    with open(path, 'rb') as f:
+      return f.read()
+  with open(path) as f:
+    source = f.read()
+  match = re.search(r'\b%s\s*\[\s*\]\s*=\s*\{([^}]*)\}' % re.escape(array),
+                    source)
+  if not match:
+    raise CodegenError('array %s not found in %s' % (array, path))
+  return bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+',
+                                              match.group(1)))
+
+
+# --- Graph preparation --------------------------------------------------------
+
+
+def consumers(operators, graph_outputs, tensor_index):
+  count = sum(op.inputs.count(tensor_index) for op in operators)
+  return count + graph_outputs.count(tensor_index)
+
+
+def fold_relu6(tensors, operators, graph_outputs):
+  """Folds RELU6 nodes into the convolution producing their input, as
+  MicroInterpreter::FuseActivations does.  Returns the remaining operators."""
+  producer = {}
+  for op in operators:
+    for t in op.outputs:
+      producer[t] = op
+  kept = []
+  for op in operators:
+    if op.code != OP_RELU6:
+      kept.append(op)
+      continue
+    src = producer.get(op.inputs[0])
+    ok = (src is not None and src.code in (OP_CONV_2D, OP_DEPTHWISE_CONV_2D)
+          and consumers(operators, graph_outputs, op.inputs[0]) == 1)
+    if ok:
+      inp, out = tensors[op.inputs[0]], tensors[op.outputs[0]]
+      ok = (inp.scales == out.scales and inp.zero_points == out.zero_points
+            and conv_activation(src) in (ACT_NONE, ACT_RELU, ACT_RELU6))
+    if not ok:
+      raise CodegenError('RELU6 (number %d) cannot be folded into its producer'
+                         % op.index)
+    src.fused_relu6 = op.outputs[0]
+    src.outputs = [op.outputs[0]]
+  return kept
+
+
+def conv_activation(op):
+  if op.fused_relu6 is not None:
+    return ACT_RELU6
+  slot = 3 if op.code == OP_CONV_2D else 4
+  return op.options.scalar(slot, 'b') if op.options else ACT_NONE
+
+
+def plan_arena(tensors, operators, graph_inputs, graph_outputs):
+  """Greedy first-fit placement, largest buffers first, like
+  GreedyMemoryPlanner.  Element-wise ops write over an input that dies at
+  the same op, like the in-place planning of MicroAllocator."""
+  first, last = {}, {}
+  for t in graph_inputs:
+    first[t] = 0
+  for op in operators:
+    for t in op.inputs:
+      if t >= 0 and not tensors[t].is_constant:
+        first.setdefault(t, op.index)
+        last[t] = op.index
+    for t in op.outputs:
+      first.setdefault(t, op.index)
+      last.setdefault(t, op.index)
+  end = len(operators) and operators[-1].index
+  for t in graph_outputs:
+    last[t] = end
+
+  alias = {}
+  for op in operators:
+    if op.code not in (OP_ADD, OP_QUANTIZE):
+      continue
+    out = op.outputs[0]
+    for t in op.inputs:
+      root = alias.get(t, t)
+      if (t in graph_inputs or last[t] != op.index or
+          tensors[t].nbytes != tensors[out].nbytes):
+        continue
+      alias[out] = root
+      last[root] = max(last[root], last[out])
+      break
+
+  planned = sorted((t for t in first if t not in alias),
+                   key=lambda t: (-tensors[t].nbytes, first[t]))
+  offsets = {}
+  for t in planned:
+    size = tensors[t].nbytes
+    live = sorted((offsets[o], offsets[o] + tensors[o].nbytes) for o in offsets
+                  if first[o] <= last[t] and first[t] <= last[o])
+    candidate = 0
+    for start, stop in live:
+      if candidate + size <= start:
+        break
+      candidate = max(candidate, (stop + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT)
+    offsets[t] = candidate
+  for t, root in alias.items():
+    offsets[t] = offsets[root]
+  total = max((offsets[t] + tensors[t].nbytes for t in offsets), default=0)
+  return offsets, (total + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT, alias
+
+
+# --- Emission -------------------------------------------------------------------
+
+
+def c_array(values, indent='    ', per_line=8):
+  lines = []
+  for i in range(0, len(values), per_line):
+    lines.append(indent + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+  return '\n'.join(lines)
+
+
+class Emitter:
+
+  def __init__(self, model, tensors, offsets):
+    self.model = model
+    self.tensors = tensors
+    self.offsets = offsets
+    self.tables = []
+    self.body = []
+    self.scratch = []
+    self.const_tensors = set()
+    self.macs = 0
+
+  def act(self, t):
+    return 'arena + kTensor%d' % t
+
+  def s8(self, t):
+    return 'Act(arena, kTensor%d)' % t
+
+  def const(self, t, ctype):
+    tensor = self.tensors[t]
+    if not tensor.is_constant:
+      raise CodegenError('tensor %d is expected to be constant' % t)
+    if ctype == 'int32_t' and tensor.data_offset % 4:
+      raise CodegenError('bias tensor %d is not 4-byte aligned' % t)
+    self.const_tensors.add(t)
+    return '%s(model, kConst%d)' % ('Bias' if ctype == 'int32_t' else 'Weights',
+                                    t)
+
+  def per_channel(self, prefix, op, scales, in_scale, out_scale, count):
+    mults, shifts = [], []
+    for i in range(count):
+      filter_scale = scales[i] if len(scales) > 1 else scales[0]
+      m, s = quantize_multiplier(in_scale * filter_scale / out_scale)
+      mults.append(m)
+      shifts.append(s)
+    self.tables.append('constexpr int32_t k%sMult%d[%d] = {\n%s\n};' %
+                       (prefix, op.index, count, c_array(mults)))
+    self.tables.append('constexpr int32_t k%sShift%d[%d] = {\n%s\n};' %
+                       (prefix, op.index, count, c_array(shifts)))
+
+  def comment(self, op):
+    ins = ' '.join('t%d%s' % (t, list(self.tensors[t].shape)) for t in op.inputs
+                   if t >= 0 and not self.tensors[t].is_constant)
+    outs = ' '.join('t%d%s' % (t, list(self.tensors[t].shape))
+                    for t in op.outputs)
+    name = op.name + ('+RELU6' if op.fused_relu6 is not None else '')
+    return '  // %d: %s %s -> %s' % (op.index, name, ins, outs)
+
+  def emit(self, op):
+    handler = {
+        OP_QUANTIZE: self.emit_quantize,
+        OP_CONV_2D: self.emit_conv,
+        OP_DEPTHWISE_CONV_2D: self.emit_conv,
+        OP_ADD: self.emit_add,
+        OP_MEAN: self.emit_mean,
+        OP_FULLY_CONNECTED: self.emit_fully_connected,
+        OP_SOFTMAX: self.emit_softmax,
+    }.get(op.code)
+    if handler is None:
+      raise CodegenError('%s (number %d) is not supported' % (op.name, op.index))
+    self.body.append(self.comment(op))
+    handler(op)
+
+  def emit_quantize(self, op):
+    inp, out = self.tensors[op.inputs[0]], self.tensors[op.outputs[0]]
+    if inp.type not in TYPE_RANGE or out.type not in TYPE_RANGE:
+      raise CodegenError('QUANTIZE (number %d) must be a requantization'
+                         % op.index)
+    mult, shift = quantize_multiplier(inp.scale / out.scale)
+    self.body.append(
+        '  tflite::reference_ops::Requantize(\n'
+        '      reinterpret_cast<const %s*>(%s), %d, %d, %d, %d, %d,\n'
+        '      reinterpret_cast<%s*>(%s));' %
+        (TYPE_NAMES[inp.type], self.act(inp.index), inp.num_elements, mult,
+         shift, inp.zero_point, out.zero_point, TYPE_NAMES[out.type],
+         self.act(out.index)))
+
+  def emit_conv(self, op):
+    inp = self.tensors[op.inputs[0]]
+    flt = self.tensors[op.inputs[1]]
+    bias = op.inputs[2] if len(op.inputs) > 2 else -1
+    out = self.tensors[op.outputs[0]]
+    depthwise = op.code == OP_DEPTHWISE_CONV_2D
+    o = op.options
+    padding, stride_w, stride_h = o.scalar(0, 'b'), o.scalar(1, 'i'), o.scalar(2, 'i')
+    if depthwise:
+      ch_mult = o.scalar(3, 'i')
+      dil_w, dil_h = o.scalar(5, 'i', 1), o.scalar(6, 'i', 1)
+    else:
+      dil_w, dil_h = o.scalar(4, 'i', 1), o.scalar(5, 'i', 1)
+    if dil_w != 1 or dil_h != 1:
+      raise CodegenError('%s (number %d) is dilated' % (op.name, op.index))
+    if inp.type != TYPE_INT8 or flt.type != TYPE_INT8 or inp.shape[0] != 1:
+      raise CodegenError('%s (number %d) must be single-batch int8'
+                         % (op.name, op.index))
+    _, in_h, in_w, in_c = inp.shape
+    _, f_h, f_w, _ = flt.shape
+    pad_h, out_h = compute_padding(stride_h, in_h, f_h, padding)
+    pad_w, out_w = compute_padding(stride_w, in_w, f_w, padding)
+    out_c = out.shape[3]
+    if [out_h, out_w] != out.shape[1:3]:
+      raise CodegenError('%s (number %d) output shape mismatch'
+                         % (op.name, op.index))
+    act_min, act_max = activation_range(conv_activation(op), out.scale,
+                                        out.zero_point, out.type)
+    prefix = 'Dw' if depthwise else 'Conv'
+    self.per_channel(prefix, op, flt.scales, inp.scale, out.scale, out_c)
+    n = op.index
+    self.tables.append(
+        'constexpr data_dims_t k%sIn%d = {%d, %d, %d, 1};\n'
+        'constexpr data_dims_t k%sFilter%d = {%d, %d, 0, 0};\n'
+        'constexpr data_dims_t k%sOut%d = {%d, %d, %d, 1};' %
+        (prefix, n, in_w, in_h, in_c, prefix, n, f_w, f_h, prefix, n, out_w,
+         out_h, out_c))
+    if depthwise:
+      self.tables.append(
+          'constexpr dw_conv_params_t kDwParams%d = {%d, %d, %d, {%d, %d}, '
+          '{%d, %d}, {0, 0}, {%d, %d}};' %
+          (n, -inp.zero_point, out.zero_point, ch_mult, stride_w, stride_h,
+           pad_w, pad_h, act_min, act_max))
+      self.scratch.append(
+          'esp_nn_get_depthwise_conv_scratch_size(&kDwIn%d, &kDwFilter%d, '
+          '&kDwOut%d, &kDwParams%d)' % (n, n, n, n))
+      fn, setter = 'esp_nn_depthwise_conv_s8', 'esp_nn_set_depthwise_conv_scratch_buf'
+      self.macs += out_h * out_w * out_c * f_h * f_w
+    else:
+      self.tables.append(
+          'constexpr conv_params_t kConvParams%d = {%d, %d, {%d, %d}, '
+          '{%d, %d}, {0, 0}, {%d, %d}};' %
+          (n, -inp.zero_point, out.zero_point, stride_w, stride_h, pad_w,
+           pad_h, act_min, act_max))
+      self.scratch.append(
+          'esp_nn_get_conv_scratch_size(&kConvIn%d, &kConvFilter%d, '
+          '&kConvOut%d, &kConvParams%d)' % (n, n, n, n))
+      fn, setter = 'esp_nn_conv_s8', 'esp_nn_set_conv_scratch_buf'
+      self.macs += out_h * out_w * out_c * f_h * f_w * in_c
+    bias_ptr = self.const(bias, 'int32_t') if bias >= 0 else 'nullptr'
+    self.body.append(
+        '  {\n'
+        '    const quant_data_t quant = {const_cast<int32_t*>(k%sShift%d),\n'
+        '                                const_cast<int32_t*>(k%sMult%d)};\n'
+        '    %s(scratch);\n'
+        '    %s(&k%sIn%d, %s, &k%sFilter%d,\n'
+        '        %s, %s,\n'
+        '        &k%sOut%d, %s, &k%sParams%d, &quant);\n'
+        '  }' %
+        (prefix, n, prefix, n, setter, fn, prefix, n,
+         self.s8(inp.index), prefix, n, self.const(flt.index, 'int8_t'),
+         bias_ptr, prefix, n, self.s8(out.index), prefix, n))
+
+  def emit_add(self, op):
+    in1, in2 = self.tensors[op.inputs[0]], self.tensors[op.inputs[1]]
+    out = self.tensors[op.outputs[0]]
+    if in1.shape != in2.shape or out.type != TYPE_INT8:
+      raise CodegenError('ADD (number %d) must be a non-broadcast int8 add'
+                         % op.index)
+    left_shift = 20
+    twice_max = 2.0 * max(in1.scale, in2.scale)
+    m1, s1 = quantize_multiplier(in1.scale / twice_max)
+    m2, s2 = quantize_multiplier(in2.scale / twice_max)
+    mo, so = quantize_multiplier(twice_max / ((1 << left_shift) * out.scale))
+    activation = op.options.scalar(0, 'b') if op.options else ACT_NONE
+    act_min, act_max = activation_range(activation, out.scale, out.zero_point,
+                                        out.type)
+    size = out.num_elements
+    self.scratch.append('esp_nn_get_add_scratch_size(%d)' % size)
+    self.body.append(
+        '  esp_nn_set_add_scratch_buf(scratch);\n'
+        '  esp_nn_add_elementwise_s8(%s,\n'
+        '                            %s,\n'
+        '                            %d, %d, %d, %d, %d, %d, %d,\n'
+        '                            %s,\n'
+        '                            %d, %d, %d, %d, %d, %d);' %
+        (self.s8(in1.index), self.s8(in2.index), -in1.zero_point,
+         -in2.zero_point, m1, m2, s1, s2, left_shift, self.s8(out.index),
+         out.zero_point, mo, so, act_min, act_max, size))
+
+  def emit_mean(self, op):
+    inp, out = self.tensors[op.inputs[0]], self.tensors[op.outputs[0]]
+    axis = self.tensors[op.inputs[1]]
+    axis_values = list(struct.unpack_from(
+        '<%di' % axis.num_elements, self.model, axis.data_offset))
+    if (inp.type != TYPE_INT8 or len(inp.shape) != 4 or inp.shape[0] != 1 or
+        sorted(a % 4 for a in axis_values) != [1, 2]):
+      raise CodegenError('MEAN (number %d) must reduce int8 NHWC over H and W'
+                         % op.index)
+    count = inp.shape[1] * inp.shape[2]
+    channels = inp.shape[3]
+    mult, shift = quantize_multiplier(inp.scale / out.scale)
+    # Fold 1/count into the multiplier exactly as QuantizedMeanOrSum does.
+    extra = min(count.bit_length() - 1, 32, 31 + shift)
+    mult = (mult << extra) // count
+    shift -= extra
+    self.scratch.append('%d * sizeof(int32_t)' % channels)
+    self.body.append(
+        '  {\n'
+        '    int32_t* sum = reinterpret_cast<int32_t*>(scratch);\n'
+        '    const int8_t* in = %s;\n'
+        '    for (int c = 0; c < %d; ++c) sum[c] = 0;\n'
+        '    for (int i = 0; i < %d; ++i, in += %d) {\n'
+        '      for (int c = 0; c < %d; ++c) sum[c] += in[c];\n'
+        '    }\n'
+        '    int8_t* out = %s;\n'
+        '    for (int c = 0; c < %d; ++c) {\n'
+        '      const int32_t value = tflite::MultiplyByQuantizedMultiplier(\n'
+        '                                sum[c] - (%d), %d, %d) + (%d);\n'
+        '      out[c] = static_cast<int8_t>(std::min(std::max(value, -128), 127));\n'
+        '    }\n'
+        '  }' %
+        (self.s8(inp.index), channels, count, channels, channels,
+         self.s8(out.index), channels, inp.zero_point * count, mult, shift,
+         out.zero_point))
+
+  def emit_fully_connected(self, op):
+    inp = self.tensors[op.inputs[0]]
+    flt = self.tensors[op.inputs[1]]
+    bias = op.inputs[2] if len(op.inputs) > 2 else -1
+    out = self.tensors[op.outputs[0]]
+    if inp.type != TYPE_INT8 or flt.type != TYPE_INT8:
+      raise CodegenError('FULLY_CONNECTED (number %d) must be int8' % op.index)
+    activation = op.options.scalar(0, 'b') if op.options else ACT_NONE
+    act_min, act_max = activation_range(activation, out.scale, out.zero_point,
+                                        out.type)
+    out_depth, accum_depth = flt.shape[-2], flt.shape[-1]
+    batches = out.num_elements // out.shape[-1]
+    if batches != 1:
+      raise CodegenError('FULLY_CONNECTED (number %d) must be single-batch'
+                         % op.index)
+    bias_ptr = self.const(bias, 'int32_t') if bias >= 0 else 'nullptr'
+    self.macs += out_depth * accum_depth
+    if len(flt.scales) > 1:
+      self.per_channel('Fc', op, flt.scales, inp.scale, out.scale, out_depth)
+      self.body.append(
+          '  esp_nn_fully_connected_per_ch_s8(\n'
+          '      %s, %d, %d,\n'
+          '      %s, %d, %s,\n'
+          '      %s, %d, %d,\n'
+          '      const_cast<int32_t*>(kFcShift%d),\n'
+          '      const_cast<int32_t*>(kFcMult%d), %d, %d);' %
+          (self.s8(inp.index), -inp.zero_point, accum_depth,
+           self.const(flt.index, 'int8_t'), -flt.zero_point, bias_ptr,
+           self.s8(out.index), out_depth, out.zero_point, op.index, op.index,
+           act_min, act_max))
+    else:
+      mult, shift = quantize_multiplier(inp.scale * flt.scale / out.scale)
+      self.body.append(
+          '  esp_nn_fully_connected_s8(%s, %d, %d,\n'
+          '                            %s, %d,\n'
+          '                            %s,\n'
+          '                            %s, %d, %d, %d, %d, %d, %d);' %
+          (self.s8(inp.index), -inp.zero_point, accum_depth,
+           self.const(flt.index, 'int8_t'), -flt.zero_point, bias_ptr,
+           self.s8(out.index), out_depth, out.zero_point, shift, mult,
+           act_min, act_max))
+
+  def emit_softmax(self, op):
+    inp, out = self.tensors[op.inputs[0]], self.tensors[op.outputs[0]]
+    if (inp.type != TYPE_INT8 or out.type != TYPE_INT8 or
+        out.zero_point != -128 or out.scale != f32(1.0 / 256)):
+      raise CodegenError('SOFTMAX (number %d) must be int8 -> int8 with '
+                         'output scale 1/256' % op.index)
+    beta = op.options.scalar(0, 'f') if op.options else 0.0
+    # PreprocessSoftmaxScaling() and CalculateInputRadius() with
+    # kScaledDiffIntegerBits = 5.
+    integer_bits = 5
+    real = min(beta * inp.scale * (1 << (31 - integer_bits)), (1 << 31) - 1.0)
+    mult, shift = quantize_multiplier(real)
+    radius = math.floor(((1 << integer_bits) - 1) *
+                        (1 << (31 - integer_bits)) / (1 << shift))
+    depth = inp.shape[-1]
+    outer = inp.num_elements // depth
+    self.scratch.append('esp_nn_get_softmax_scratch_size(%d, %d)'
+                        % (depth, outer))
+    self.body.append(
+        '  esp_nn_set_softmax_scratch_buf(scratch);\n'
+        '  esp_nn_softmax_s8(%s, %d, %d, %d, %d, %d,\n'
+        '                    %s);' %
+        (self.s8(inp.index), outer, depth, mult, shift, -radius,
+         self.s8(out.index)))
+
+
+def generate(model, source_name, out_prefix, namespace):
+  tensors, operators, graph_inputs, graph_outputs = load_model(model)
+  if len(graph_inputs) != 1 or len(graph_outputs) != 1:
+    raise CodegenError('only single-input, single-output models are supported')
+  operators = fold_relu6(tensors, operators, graph_outputs)
+  offsets, arena_bytes, alias = plan_arena(tensors, operators, graph_inputs,
+                                           graph_outputs)
+  emitter = Emitter(model, tensors, offsets)
+  for op in operators:
+    emitter.emit(op)
+
+  inp, out = tensors[graph_inputs[0]], tensors[graph_outputs[0]]
+  guard = re.sub(r'[^A-Z0-9]', '_', os.path.basename(out_prefix).upper()) + '_H_'
+  header_name = os.path.basename(out_prefix) + '.h'
+  banner = ('// Generated by tools/tflite_codegen.py from %s.\n'
+            '// Do not edit; regenerate whenever the model changes.\n'
+            % source_name)
+
+  header = '''%s
+#ifndef %s
+#define %s
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+
+namespace %s {
+
+// Size of the model image the constant tensors are addressed in.
+constexpr size_t kModelSize = %d;
+
+// Bytes of arena taken by the activation tensors; the esp-nn scratch buffer
+// follows them (see RequiredArenaSize()).
+constexpr size_t kActivationBytes = %d;
+
+constexpr size_t kInputBytes = %d;
+constexpr size_t kOutputBytes = %d;
+constexpr int kNumOps = %d;
+constexpr long long kMacs = %dLL;
+
+// Arena size needed by Invoke() on the current target, including the
+// scratch buffer requested by the selected esp-nn kernels.
+size_t RequiredArenaSize();
+
+// Input (%s %s) and output (%s %s) buffers inside the arena.
+inline %s* Input(uint8_t* arena) {
+  return reinterpret_cast<%s*>(arena + %d);
+}
+inline const %s* Output(const uint8_t* arena) {
+  return reinterpret_cast<const %s*>(arena + %d);
+}
+
+// Runs the whole network.  `model` must be the image this file was
+// generated from and `arena` must be 16-byte aligned.
+TfLiteStatus Invoke(const uint8_t* model, uint8_t* arena, size_t arena_size);
+
+}  // namespace %s
+
+#endif  // %s
+''' % (banner, guard, guard, namespace, len(model), arena_bytes, inp.nbytes,
+       out.nbytes, len(operators), emitter.macs, TYPE_NAMES[inp.type],
+       list(inp.shape), TYPE_NAMES[out.type], list(out.shape),
+       TYPE_NAMES[inp.type], TYPE_NAMES[inp.type], offsets[inp.index],
+       TYPE_NAMES[out.type], TYPE_NAMES[out.type], offsets[out.index],
+       namespace, guard)
+
+  activation_offsets = '\n'.join(
+      'constexpr size_t kTensor%d = %d;%s' %
+      (t, offsets[t], '  // in place of t%d' % alias[t] if t in alias else '')
+      for t in sorted(offsets))
+  const_offsets = '\n'.join(
+      'constexpr size_t kConst%d = %d;' % (t, tensors[t].data_offset)
+      for t in sorted(emitter.const_tensors))
+  scratch = '\n'.join('  size = std::max<size_t>(size, %s);' % s
+                      for s in emitter.scratch)
+
+  source = '''%s
+#include "%s"
+
+#include <algorithm>
+
+#include "esp_nn.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/reference/requantize.h"
+
+namespace %s {
+namespace {
+
+// Arena offsets of the activation tensors.
+%s
+
+// Offsets of the constant tensors inside the model image.
+%s
+
+inline int8_t* Act(uint8_t* arena, size_t offset) {
+  return reinterpret_cast<int8_t*>(arena + offset);
+}
+inline const int8_t* Weights(const uint8_t* model, size_t offset) {
+  return reinterpret_cast<const int8_t*>(model + offset);
+}
+inline const int32_t* Bias(const uint8_t* model, size_t offset) {
+  return reinterpret_cast<const int32_t*>(model + offset);
+}
+
+%s
+
+size_t ScratchSize() {
+  size_t size = 0;
+%s
+  return size;
+}
+
+}  // namespace
+
+size_t RequiredArenaSize() {
+  static const size_t size = kActivationBytes + ScratchSize();
+  return size;
+}
+
+TfLiteStatus Invoke(const uint8_t* model, uint8_t* arena, size_t arena_size) {
+  if (arena_size < RequiredArenaSize() ||
+      reinterpret_cast<uintptr_t>(arena) %% %d != 0) {
+    return kTfLiteError;
+  }
+  void* scratch = arena + kActivationBytes;
+
+%s
+
+  return kTfLiteOk;
+}
+
+}  // namespace %s
+''' % (banner, header_name, namespace, activation_offsets, const_offsets,
+       '\n\n'.join(emitter.tables), scratch, ALIGNMENT, '\n'.join(emitter.body),
+       namespace)
+
+  with open(out_prefix + '.h', 'w') as f:
+    f.write(header)
+  with open(out_prefix + '.cc', 'w') as f:
+    f.write(source)
+  return len(operators), arena_bytes, emitter.macs
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+  parser.add_argument('model', help='.tflite file, or C/C++ source with --array')
+  parser.add_argument('out_prefix', help='output path without extension')
+  parser.add_argument('--array', help='name of the byte array holding the model '
+                      'when MODEL is a C/C++ source file')
+  parser.add_argument('--namespace', default='model_codegen')
+  args = parser.parse_args()
+  try:
+    model = read_model_file(args.model, args.array)
+    ops, arena_bytes, macs = generate(model, os.path.basename(args.model),
+                                      args.out_prefix, args.namespace)
+  except (CodegenError, OSError) as e:
+    sys.exit('tflite_codegen: %s' % e)
+  print('%d ops, %d activation bytes, %d MACs' % (ops, arena_bytes, macs))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,221 @@
+// Host check for tflite::MicroWeightPrefetcher on the waste classifier.
+//
+// Runs the model without a prefetcher, then with MockCopyEngine in immediate
+// mode (every copy done before its operator starts: full overlap) and in
+// deferred mode (every copy done while its operator waits: no overlap), with
+// a staging area that holds every operator and with one that leaves the
+// largest to read in place. Each prefetch run must give the outputs of the
+// run without a prefetcher and leave every constant tensor pointing at the
+// flatbuffer. Its report must account for the constant bytes that run reads,
+// split between staging and in place the same way in both modes, and show
+// 100% overlap in immediate mode and 0% in deferred mode.
+//
+// Build and run from the repository root, with the reference kernels:
+//
+//   T=managed_components/espressif__esp-tflite-micro
+//   M=$T/tensorflow/lite/micro
+//   SRCS="main/model_data.cc $M/*.cc $M/kernels/*.cc $M/memory_planner/*.cc
+//         $M/arena_allocator/*.cc $M/tflite_bridge/*.cc
+//         $T/tensorflow/lite/core/c/common.cc $T/tensorflow/lite/core/api/*.cc
+//         $T/tensorflow/lite/kernels/kernel_util.cc
+//         $T/tensorflow/lite/kernels/internal/*.cc
+//         $T/tensorflow/lite/kernels/internal/reference/*.cc
+//         $T/tensorflow/compiler/mlir/lite/core/api/*.cc
+//         $T/tensorflow/compiler/mlir/lite/schema/*.cc
+//         $T/signal/micro/kernels/*.cc $T/signal/src/*.cc
+//         $T/signal/src/kiss_fft_wrappers/*.cc"
+//   g++ -O2 -std=gnu++17 -fno-rtti -fno-exceptions -DTF_LITE_STATIC_MEMORY
+//       -DTF_LITE_USE_CTIME -Imain -I$T -I$T/third_party/flatbuffers/include
+//       -I$T/third_party/gemmlowp -I$T/third_party/ruy -I$T/third_party/kissfft
+//       tools/weight_prefetch_check.cc $SRCS -o weight_prefetch_check
+//   ./weight_prefetch_check
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "model_data.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_weight_prefetcher.h"
+#include "tensorflow/lite/micro/mock_copy_engine.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr size_t kArenaSize = 1024 * 1024;
+constexpr int kInvokes = 3;
+
+// Data of `tensor_index` in the flatbuffer, or nullptr for a tensor that is
+// not constant.
+const flatbuffers::Vector<uint8_t>* ConstantData(const tflite::Model* model,
+                                                 int tensor_index) {
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  const auto* data = model->buffers()
+                         ->Get(subgraph->tensors()->Get(tensor_index)->buffer())
+                         ->data();
+  return data != nullptr && data->size() > 0 ? data : nullptr;
+}
+
+// Constant bytes one inference reads, each constant input of an operator
+// aligned as in a staging slot and counted once per operator. No operator of
+// this model with constant inputs is taken out by the load-time rewrites.
+uint32_t ConstantBytesPerInvoke(const tflite::Model* model) {
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  uint32_t total = 0;
+  for (const tflite::Operator* op : *subgraph->operators()) {
+    for (uint32_t i = 0; op->inputs() != nullptr && i < op->inputs()->size();
+         i++) {
+      const int tensor_index = op->inputs()->Get(i);
+      bool repeated = false;
+      for (uint32_t j = 0; j < i; j++) {
+        repeated |= op->inputs()->Get(j) == tensor_index;
+      }
+      const auto* data =
+          tensor_index >= 0 ? ConstantData(model, tensor_index) : nullptr;
+      if (data != nullptr && !repeated) {
+        total += tflite::AlignSizeUp(data->size(),
+                                     tflite::MicroArenaBufferAlignment());
+      }
+    }
+  }
+  return total;
+}
+
+bool ConstantsRestored(tflite::MicroInterpreter& interpreter,
+                       const tflite::Model* model) {
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  for (uint32_t t = 0; t < subgraph->tensors()->size(); t++) {
+    const auto* data = ConstantData(model, t);
+    if (data != nullptr &&
+        interpreter.GetTensor(t)->data.data != data->data()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Output of the last of `kInvokes` inferences on `image`; empty on failure or
+// if the inferences disagree.
+std::vector<uint8_t> Invoke(tflite::MicroInterpreter& interpreter,
+                            const std::vector<uint8_t>& image) {
+  std::vector<uint8_t> output;
+  for (int i = 0; i < kInvokes; i++) {
+    memcpy(interpreter.input(0)->data.uint8, image.data(), image.size());
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return {};
+    }
+    const TfLiteTensor* tensor = interpreter.output(0);
+    std::vector<uint8_t> current(tensor->data.uint8,
+                                 tensor->data.uint8 + tensor->bytes);
+    if (i > 0 && current != output) {
+      return {};
+    }
+    output = current;
+  }
+  return output;
+}
+
+}  // namespace
+
+int main() {
+  tflite::MicroMutableOpResolver<9> resolver;
+  resolver.AddQuantize();
+  resolver.AddDequantize();
+  resolver.AddConv2D();
+  resolver.AddRelu6();
+  resolver.AddDepthwiseConv2D();
+  resolver.AddAdd();
+  resolver.AddMean();
+  resolver.AddFullyConnected();
+  resolver.AddSoftmax();
+
+  const tflite::Model* model = tflite::GetModel(modelo_tflite);
+  static uint8_t arena[kArenaSize] __attribute__((aligned(16)));
+  // Every tensor preserved, for ConstantsRestored() to reach them through
+  // GetTensor().
+  tflite::MicroInterpreter interpreter(model, resolver, arena, kArenaSize,
+                                       nullptr, nullptr,
+                                       /*preserve_all_tensors=*/true);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    fprintf(stderr, "AllocateTensors failed\n");
+    return 1;
+  }
+  std::vector<uint8_t> image(interpreter.input(0)->bytes);
+  srand(1);
+  for (uint8_t& pixel : image) {
+    pixel = static_cast<uint8_t>(rand() & 0xff);
+  }
+  const std::vector<uint8_t> reference = Invoke(interpreter, image);
+  if (reference.empty()) {
+    fprintf(stderr, "Invoke failed without a prefetcher\n");
+    return 1;
+  }
+
+  const size_t largest = tflite::MicroWeightPrefetcher::LargestNodeBytes(model);
+  const uint32_t constant_bytes = kInvokes * ConstantBytesPerInvoke(model);
+  printf("no prefetcher: %u constant bytes over %d invokes, largest "
+         "operator %zu bytes\n",
+         static_cast<unsigned>(constant_bytes), kInvokes, largest);
+
+  int failures = 0;
+  // Both slots of the full staging area hold the largest operator; the
+  // small one only the operators up to half the largest.
+  for (const size_t staging_size : {2 * largest, largest}) {
+    tflite::MicroWeightPrefetcher::Stats mode_stats[2];
+    for (const bool immediate : {true, false}) {
+      const size_t alignment = tflite::MicroArenaBufferAlignment();
+      std::vector<uint8_t> buffer(staging_size + alignment);
+      tflite::MockCopyEngine engine(immediate);
+      tflite::MicroWeightPrefetcher prefetcher(
+          &engine, tflite::AlignPointerUp(buffer.data(), alignment),
+          staging_size);
+      interpreter.SetWeightPrefetcher(&prefetcher);
+      const std::vector<uint8_t> output = Invoke(interpreter, image);
+      interpreter.SetWeightPrefetcher(nullptr);
+
+      const tflite::MicroWeightPrefetcher::Stats& stats = prefetcher.stats();
+      mode_stats[immediate] = stats;
+      const uint32_t hidden_ticks = stats.copy_ticks > stats.wait_ticks
+                                        ? stats.copy_ticks - stats.wait_ticks
+                                        : 0;
+      const bool overlap_ok =
+          immediate ? stats.ready_nodes == stats.staged_nodes &&
+                          stats.wait_ticks == 0
+                    : stats.ready_nodes == 0 && hidden_ticks == 0 &&
+                          engine.wait_count() >=
+                              static_cast<int>(stats.staged_nodes);
+      const bool ok =
+          output == reference && ConstantsRestored(interpreter, model) &&
+          stats.invokes == kInvokes &&
+          stats.staged_bytes + stats.direct_bytes == constant_bytes &&
+          stats.staged_nodes > 0 &&
+          (staging_size < 2 * largest || stats.direct_nodes == 0) &&
+          overlap_ok;
+      printf("%s, %zu-byte staging: %u operators staged (%u ready), %u read "
+             "in place, %u + %u bytes, %d waits: %s\n",
+             immediate ? "immediate" : "deferred", staging_size,
+             static_cast<unsigned>(stats.staged_nodes),
+             static_cast<unsigned>(stats.ready_nodes),
+             static_cast<unsigned>(stats.direct_nodes),
+             static_cast<unsigned>(stats.staged_bytes),
+             static_cast<unsigned>(stats.direct_bytes), engine.wait_count(),
+             ok ? "OK" : "FAILED");
+      prefetcher.Log();
+      failures += !ok;
+    }
+    // Which operators are staged depends on the slot size, not on when the
+    // copies finish.
+    if (mode_stats[0].staged_nodes != mode_stats[1].staged_nodes ||
+        mode_stats[0].staged_bytes != mode_stats[1].staged_bytes) {
+      printf("%zu-byte staging: immediate and deferred modes staged different "
+             "operators: FAILED\n",
+             staging_size);
+      failures++;
+    }
+  }
+  return failures ? 1 : 0;
+}